@@ -35,3 +35,6 @@ endif()
 
 # force standalone asio
 add_definitions( -DASIO_STANDALONE )
+
+# strip trace and debug logging from release builds, see Logging/Logger.h
+set_property( DIRECTORY APPEND PROPERTY COMPILE_DEFINITIONS $<$<CONFIG:Release>:SAPPHIRE_LOG_ACTIVE_LEVEL=2> )
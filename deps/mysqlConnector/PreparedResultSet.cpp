@@ -31,16 +31,8 @@ namespace
 
 uint32_t Mysql::PreparedResultSet::findColumn( const std::string &columnLabel ) const
 {
-   std::string searchColumn = columnLabel;
-
-   std::transform( searchColumn.begin(), searchColumn.end(), searchColumn.begin(),
-                   [](unsigned char c){ return std::toupper( c ); } );
-
-   auto iter = m_fieldNameToIndex.find( searchColumn );
-   if( iter == m_fieldNameToIndex.end() )
-      return 0;
-
-   return iter->second + 1;
+   // column labels are resolved once per statement when it is prepared
+   return m_pStmt->findColumn( columnLabel );
 }
 
 Mysql::PreparedResultSet::PreparedResultSet( std::shared_ptr< ResultBind >& pBind,
@@ -53,21 +45,6 @@ Mysql::PreparedResultSet::PreparedResultSet( std::shared_ptr< ResultBind >& pBin
 
    m_numRows = mysql_stmt_num_rows( par->getRawStmt() );
    m_numFields = mysql_stmt_field_count( par->getRawStmt() );
-   auto resMeta = mysql_stmt_result_metadata( m_pStmt->getRawStmt() );
-
-   for( uint32_t i = 0; i < m_numFields; ++i )
-   {
-
-      auto field = resMeta->fields[i];
-      std::string fieldName( field.name );
-
-      std::transform( fieldName.begin(), fieldName.end(), fieldName.begin(),
-                      []( unsigned char c ){ return std::toupper(c); } );
-
-      m_fieldNameToIndex[fieldName] = i;
-
-   }
-
 }
 
 bool Mysql::PreparedResultSet::isBeforeFirstOrAfterLast() const
@@ -167,8 +144,8 @@ int64_t Mysql::PreparedResultSet::getInt64( const std::string& columnLabel ) con
 uint64_t Mysql::PreparedResultSet::getUInt64_intern( const uint32_t columnIndex, bool ) const
 {
 
-   MYSQL_RES* res = mysql_stmt_result_metadata( m_pStmt->getRawStmt() );
-   MYSQL_FIELD* field = mysql_fetch_field_direct( res, columnIndex - 1 );
+   // the metadata is kept by the statement, fetching it here would allocate it again for every value read
+   MYSQL_FIELD* field = m_pStmt->getResultField( columnIndex - 1 );
 
    switch( Mysql::Util::mysql_type_to_datatype( field ) )
    {
@@ -260,8 +237,7 @@ uint64_t Mysql::PreparedResultSet::getUInt64_intern( const uint32_t columnIndex,
 int64_t Mysql::PreparedResultSet::getInt64_intern( const uint32_t columnIndex, bool ) const
 {
 
-   MYSQL_RES* res = mysql_stmt_result_metadata( m_pStmt->getRawStmt() );
-   MYSQL_FIELD* field = mysql_fetch_field_direct( res, columnIndex - 1 );
+   MYSQL_FIELD* field = m_pStmt->getResultField( columnIndex - 1 );
 
    switch( Mysql::Util::mysql_type_to_datatype( field ) )
    {
@@ -382,8 +358,7 @@ std::string Mysql::PreparedResultSet::getString( const uint32_t columnIndex ) co
    if( *m_pResultBind->m_pBind[columnIndex - 1].is_null )
       return std::string("");
 
-   MYSQL_RES* res = mysql_stmt_result_metadata( m_pStmt->getRawStmt() );
-   MYSQL_FIELD* field = mysql_fetch_field_direct( res, columnIndex - 1 );
+   MYSQL_FIELD* field = m_pStmt->getResultField( columnIndex - 1 );
 
    switch( Mysql::Util::mysql_type_to_datatype( field ) )
    {
@@ -504,8 +479,7 @@ long double Mysql::PreparedResultSet::getDouble(const uint32_t columnIndex) cons
    if( *m_pResultBind->m_pBind[columnIndex - 1].is_null)
       return 0.0;
 
-   MYSQL_RES* res = mysql_stmt_result_metadata( m_pStmt->getRawStmt() );
-   MYSQL_FIELD* field = mysql_fetch_field_direct( res, columnIndex - 1);
+   MYSQL_FIELD* field = m_pStmt->getResultField( columnIndex - 1 );
 
    switch( Mysql::Util::mysql_type_to_datatype( field ) )
    {
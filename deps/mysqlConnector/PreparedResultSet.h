@@ -18,10 +18,6 @@ namespace Mysql
          uint64_t m_numRows;
          uint64_t m_rowPosition;
 
-         typedef std::map< std::string, uint32_t > FieldNameIndexMap;
-
-         FieldNameIndexMap m_fieldNameToIndex;
-
          std::shared_ptr< PreparedStatement > m_pStmt;
 
          bool is_valid;
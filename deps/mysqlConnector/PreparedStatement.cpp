@@ -3,6 +3,8 @@
 #include "Connection.h"
 #include "ResultBind.h"
 #include <variant>
+#include <algorithm>
+#include <cctype>
 #include <errmsg.h>
 #include <string.h>
 #include <mysql.h>
@@ -314,6 +316,43 @@ Mysql::PreparedStatement::PreparedStatement( MYSQL_STMT* pStmt, std::shared_ptr<
    m_paramCount = mysql_stmt_param_count( m_pStmt );
    m_pParamBind.reset( new ParamBind( m_paramCount ) );
    m_pResultBind.reset( new ResultBind( pStmt ) );
+
+   // statements without a result set (insert, update, ...) have no metadata
+   m_pResultMeta = mysql_stmt_result_metadata( m_pStmt );
+   if( m_pResultMeta )
+   {
+      auto numFields = mysql_num_fields( m_pResultMeta );
+      for( uint32_t i = 0; i < numFields; ++i )
+         m_columnIndex.emplace( m_pResultMeta->fields[ i ].name, i + 1 );
+   }
+}
+
+bool Mysql::ColumnNameLess::operator()( const std::string& lhs, const std::string& rhs ) const
+{
+   return std::lexicographical_compare( lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                        []( unsigned char a, unsigned char b )
+                                        {
+                                           return std::toupper( a ) < std::toupper( b );
+                                        } );
+}
+
+uint32_t Mysql::PreparedStatement::findColumn( const std::string& columnLabel ) const
+{
+   auto iter = m_columnIndex.find( columnLabel );
+   if( iter == m_columnIndex.end() )
+      return 0;
+
+   return iter->second;
+}
+
+const Mysql::ColumnIndexMap& Mysql::PreparedStatement::getColumnIndexMap() const
+{
+   return m_columnIndex;
+}
+
+MYSQL_FIELD* Mysql::PreparedStatement::getResultField( uint32_t fieldIndex ) const
+{
+   return mysql_fetch_field_direct( m_pResultMeta, fieldIndex );
 }
 
 uint32_t Mysql::PreparedStatement::errNo()
@@ -375,6 +414,12 @@ void Mysql::PreparedStatement::doQuery()
 
 void Mysql::PreparedStatement::closeIntern()
 {
+   if( m_pResultMeta )
+   {
+      mysql_free_result( m_pResultMeta );
+      m_pResultMeta = nullptr;
+   }
+
    if( m_pStmt )
       mysql_stmt_close( m_pStmt );
    clearParameters();
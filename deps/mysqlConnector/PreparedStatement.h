@@ -1,10 +1,14 @@
 #ifndef SAPPHIRE_DB_PREPAREDSTATEMENT_H
 #define SAPPHIRE_DB_PREPAREDSTATEMENT_H
 
+#include <map>
 #include <memory>
+#include <string>
 #include "Statement.h"
 
 typedef struct st_mysql_stmt MYSQL_STMT;
+typedef struct st_mysql_res MYSQL_RES;
+typedef struct st_mysql_field MYSQL_FIELD;
 
 namespace Mysql
 {
@@ -12,6 +16,14 @@ namespace Mysql
       class ParamBind;
       class ResultBind;
 
+      // orders column labels case insensitively, so lookups don't need an uppercased copy of the label
+      struct ColumnNameLess
+      {
+         bool operator()( const std::string& lhs, const std::string& rhs ) const;
+      };
+
+      using ColumnIndexMap = std::map< std::string, uint32_t, ColumnNameLess >;
+
       class PreparedStatement : public Statement
       {
       protected:
@@ -25,6 +37,12 @@ namespace Mysql
 
          std::shared_ptr< ResultBind > m_pResultBind;
 
+         // result column labels to 1-based indices, resolved once when the statement is prepared
+         ColumnIndexMap m_columnIndex;
+
+         // fetched once when the statement is prepared, nullptr if it has no result set
+         MYSQL_RES* m_pResultMeta;
+
          unsigned int warningsCount;
 
          virtual void doQuery();
@@ -39,6 +57,14 @@ namespace Mysql
          std::shared_ptr< Connection > getConnection() override;
          MYSQL_STMT* getRawStmt();
 
+         // returns the 1-based index of a result column, 0 if the statement has no such column
+         uint32_t findColumn( const std::string& columnLabel ) const;
+
+         const ColumnIndexMap& getColumnIndexMap() const;
+
+         // metadata of a result column by its 0-based index, the result sets read the column types from it
+         MYSQL_FIELD* getResultField( uint32_t fieldIndex ) const;
+
          uint32_t errNo() override;
 
          uint32_t getWarningCount() override;
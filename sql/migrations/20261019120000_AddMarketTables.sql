@@ -0,0 +1,33 @@
+-- Migration generated at 2026/10/19 12:00:00
+-- 20261019120000_AddMarketTables.sql
+
+CREATE TABLE IF NOT EXISTS `marketlisting` (
+  `ListingId` bigint(20) UNSIGNED NOT NULL,
+  `CatalogId` int(10) UNSIGNED NOT NULL,
+  `RetainerId` bigint(20) UNSIGNED DEFAULT '0',
+  `RetainerOwnerId` bigint(20) UNSIGNED DEFAULT '0',
+  `ArtisanId` bigint(20) UNSIGNED DEFAULT '0',
+  `RetainerName` varchar(32) DEFAULT NULL,
+  `PricePerUnit` int(10) UNSIGNED NOT NULL,
+  `Quantity` int(10) UNSIGNED NOT NULL,
+  `IsHq` tinyint(1) NOT NULL DEFAULT '0',
+  `MarketCity` tinyint(3) UNSIGNED NOT NULL DEFAULT '0',
+  `ListTime` int(10) UNSIGNED NOT NULL,
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`ListingId`),
+  KEY `CatalogId` (`CatalogId`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
+CREATE TABLE IF NOT EXISTS `marketsalehistory` (
+  `SaleId` bigint(20) UNSIGNED NOT NULL AUTO_INCREMENT,
+  `CatalogId` int(10) UNSIGNED NOT NULL,
+  `BuyerName` varchar(32) DEFAULT NULL,
+  `SalePrice` int(10) UNSIGNED NOT NULL,
+  `Quantity` int(10) UNSIGNED NOT NULL,
+  `IsHq` tinyint(1) NOT NULL DEFAULT '0',
+  `OnMannequin` tinyint(1) NOT NULL DEFAULT '0',
+  `PurchaseTime` int(10) UNSIGNED NOT NULL,
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`SaleId`),
+  KEY `CatalogId` (`CatalogId`, `PurchaseTime`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
@@ -0,0 +1,11 @@
+-- Migration generated at 2026/10/19 13:00:00
+-- 20261019130000_AddLinkshellMemberTable.sql
+
+CREATE TABLE IF NOT EXISTS `linkshellmember` (
+  `LinkshellId` bigint(20) NOT NULL,
+  `CharacterId` bigint(20) UNSIGNED NOT NULL,
+  `MemberRank` tinyint(3) UNSIGNED NOT NULL DEFAULT '1',
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`LinkshellId`, `CharacterId`),
+  KEY `CharacterId` (`CharacterId`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
@@ -451,6 +451,15 @@ CREATE TABLE `infolinkshell` (
   PRIMARY KEY(`LinkshellId`)
 ) ENGINE=InnoDB DEFAULT CHARSET=utf8;
 
+CREATE TABLE `linkshellmember` (
+  `LinkshellId` bigint(20) NOT NULL,
+  `CharacterId` bigint(20) UNSIGNED NOT NULL,
+  `MemberRank` tinyint(3) UNSIGNED NOT NULL DEFAULT '1',
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`LinkshellId`, `CharacterId`),
+  KEY `CharacterId` (`CharacterId`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
 CREATE TABLE `land` (
   `LandSetId` bigint(20) UNSIGNED NOT NULL,
   `LandId` bigint(20) UNSIGNED NOT NULL,
@@ -596,6 +605,37 @@ CREATE TABLE `charamonsternote` (
   PRIMARY KEY(`CharacterId`)
 ) ENGINE=InnoDB DEFAULT CHARSET=latin1;
 
+CREATE TABLE `marketlisting` (
+  `ListingId` bigint(20) UNSIGNED NOT NULL,
+  `CatalogId` int(10) UNSIGNED NOT NULL,
+  `RetainerId` bigint(20) UNSIGNED DEFAULT '0',
+  `RetainerOwnerId` bigint(20) UNSIGNED DEFAULT '0',
+  `ArtisanId` bigint(20) UNSIGNED DEFAULT '0',
+  `RetainerName` varchar(32) DEFAULT NULL,
+  `PricePerUnit` int(10) UNSIGNED NOT NULL,
+  `Quantity` int(10) UNSIGNED NOT NULL,
+  `IsHq` tinyint(1) NOT NULL DEFAULT '0',
+  `MarketCity` tinyint(3) UNSIGNED NOT NULL DEFAULT '0',
+  `ListTime` int(10) UNSIGNED NOT NULL,
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`ListingId`),
+  KEY `CatalogId` (`CatalogId`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
+CREATE TABLE `marketsalehistory` (
+  `SaleId` bigint(20) UNSIGNED NOT NULL AUTO_INCREMENT,
+  `CatalogId` int(10) UNSIGNED NOT NULL,
+  `BuyerName` varchar(32) DEFAULT NULL,
+  `SalePrice` int(10) UNSIGNED NOT NULL,
+  `Quantity` int(10) UNSIGNED NOT NULL,
+  `IsHq` tinyint(1) NOT NULL DEFAULT '0',
+  `OnMannequin` tinyint(1) NOT NULL DEFAULT '0',
+  `PurchaseTime` int(10) UNSIGNED NOT NULL,
+  `UPDATE_DATE` datetime DEFAULT CURRENT_TIMESTAMP,
+  PRIMARY KEY(`SaleId`),
+  KEY `CatalogId` (`CatalogId`, `PurchaseTime`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
 CREATE TABLE `__Migration` (
    `MigrationName` VARCHAR(250) NOT NULL,
    PRIMARY KEY (`MigrationName`)
@@ -18,6 +18,7 @@
 #include <Database/DbWorkerPool.h>
 #include <Database/PreparedStatement.h>
 #include <Util/Util.h>
+#include <Metrics/Metrics.h>
 
 //Added for the default_resource example
 #include <fstream>
@@ -220,6 +221,18 @@ void getZoneName( shared_ptr< HttpServer::Response > response, shared_ptr< HttpS
   *response << buildHttpResponse( 200, responseStr );
 }
 
+void getMetrics( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
+{
+  // the api listens publicly, metrics are only handed to a local scraper
+  if( request->remote_endpoint_address != "127.0.0.1" && request->remote_endpoint_address != "::1" )
+  {
+    *response << buildHttpResponse( 403 );
+    return;
+  }
+
+  *response << buildHttpResponse( 200, Sapphire::Common::Metrics::Registry::scrape(), TEXT_PLAIN );
+}
+
 void createAccount( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
   print_request_info( request );
@@ -719,6 +732,7 @@ int main( int argc, char* argv[] )
   Logger::setLogLevel( m_config.global.general.logLevel );
 
   server.resource[ "^ZoneName/([0-9]+)$" ][ "GET" ] = &getZoneName;
+  server.resource[ "^metrics$" ][ "GET" ] = &getMetrics;
   server.resource[ "^sapphire-api/lobby/createAccount" ][ "POST" ] = &createAccount;
   server.resource[ "^sapphire-api/lobby/login" ][ "POST" ] = &login;
   server.resource[ "^sapphire-api/lobby/deleteCharacter" ][ "POST" ] = &deleteCharacter;
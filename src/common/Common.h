@@ -1045,7 +1045,8 @@ namespace Sapphire::Common
     CircularAOE = 2,
     Type3 = 3, // another single target? no idea how to call it
     RectangularAOE = 4,
-    CircularAoEPlaced = 7
+    CircularAoEPlaced = 7,
+    ConeAOE = 13
   };
 
   enum class Role : uint8_t
@@ -45,6 +45,14 @@ namespace Sapphire::Common::Config
       uint16_t disconnectTimeout;
 
       float inRangeDistance;
+
+      uint32_t inPacketBudget;
+      uint32_t inPacketBudgetUs;
+      uint32_t inPacketRateLimit;
+      uint32_t inPacketQueueLimit;
+
+      // localhost port serving /metrics, 0 disables it
+      uint16_t metricsPort;
     } network;
 
     struct Housing
@@ -62,9 +70,16 @@ namespace Sapphire::Common::Config
     struct Navigation
     {
       std::string meshPath;
+      // threads searching bnpc paths, shared by every navmesh
+      uint8_t pathWorkers;
+      // corridors kept per navmesh for repeated searches, 0 disables the cache
+      uint32_t pathCacheSize;
     } navigation;
 
     std::string motd;
+
+    // master seed of every random engine, 0 picks a new one on each start
+    uint64_t rngSeed;
   };
 
   struct LobbyConfig
@@ -75,6 +90,9 @@ namespace Sapphire::Common::Config
     {
       std::string listenIp;
       uint16_t listenPort;
+
+      // localhost port serving /metrics, 0 disables it
+      uint16_t metricsPort;
     } network;
 
     bool allowNoSessionConnect;
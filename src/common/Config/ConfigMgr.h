@@ -6,6 +6,7 @@
 #include <inih/INIReader.h>
 #include <string>
 #include <stdint.h>
+#include <cstdlib>
 #include "ConfigDef.h"
 
 namespace Sapphire::Common
@@ -38,6 +39,14 @@ namespace Sapphire::Common
           return m_pInih->GetInteger( section, name, defaultValue );
         else if constexpr ( std::is_same_v< T, long > )
           return m_pInih->GetInteger( section, name, defaultValue );
+        else if constexpr ( std::is_same_v< T, uint64_t > )
+        {
+          // GetInteger is a signed long, too small for the full range on some platforms
+          auto value = m_pInih->Get( section, name, "" );
+          char* end = nullptr;
+          auto result = std::strtoull( value.c_str(), &end, 0 );
+          return ( value.empty() || *end != '\0' ) ? defaultValue : static_cast< uint64_t >( result );
+        }
         else if constexpr ( std::is_same_v< T, double > )
           return m_pInih->GetReal( section, name, defaultValue );
         else if constexpr ( std::is_same_v< T, float > )
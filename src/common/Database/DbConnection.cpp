@@ -90,19 +90,46 @@ void Sapphire::Db::DbConnection::unlock()
   m_mutex.unlock();
 }
 
-void Sapphire::Db::DbConnection::beginTransaction()
+bool Sapphire::Db::DbConnection::beginTransaction()
 {
-  m_pConnection->beginTransaction();
+  try
+  {
+    m_pConnection->beginTransaction();
+    return true;
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+    return false;
+  }
 }
 
-void Sapphire::Db::DbConnection::rollbackTransaction()
+bool Sapphire::Db::DbConnection::rollbackTransaction()
 {
-  m_pConnection->rollbackTransaction();
+  try
+  {
+    m_pConnection->rollbackTransaction();
+    return true;
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+    return false;
+  }
 }
 
-void Sapphire::Db::DbConnection::commitTransaction()
+bool Sapphire::Db::DbConnection::commitTransaction()
 {
-  m_pConnection->commitTransaction();
+  try
+  {
+    m_pConnection->commitTransaction();
+    return true;
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+    return false;
+  }
 }
 
 bool Sapphire::Db::DbConnection::execute( const std::string& sql )
@@ -189,7 +216,9 @@ bool Sapphire::Db::DbConnection::execute( std::shared_ptr< Sapphire::Db::Prepare
   try
   {
     stmt->bindParameters();
-    return pStmt->execute();
+    // the result only tells if there is a result set, errors are thrown
+    pStmt->execute();
+    return true;
   }
   catch( std::runtime_error& e )
   {
@@ -208,6 +237,16 @@ std::shared_ptr< Mysql::PreparedStatement > Sapphire::Db::DbConnection::getPrepa
   return ret;
 }
 
+const std::vector< uint32_t >& Sapphire::Db::DbConnection::getColumnIndices( uint32_t index ) const
+{
+  static const std::vector< uint32_t > noColumns;
+
+  if( index >= m_columnIndices.size() )
+    return noColumns;
+
+  return m_columnIndices[ index ];
+}
+
 void Sapphire::Db::DbConnection::prepareStatement( uint32_t index,
                                                    const std::string& sql,
                                                    Sapphire::Db::ConnectionFlags flags )
@@ -239,6 +278,40 @@ void Sapphire::Db::DbConnection::prepareStatement( uint32_t index,
 
 }
 
+void Sapphire::Db::DbConnection::prepareColumns( uint32_t index, uint32_t columnCount,
+                                                 std::initializer_list< const char* > columnNames )
+{
+  if( m_columnIndices.size() <= index )
+    m_columnIndices.resize( index + 1 );
+
+  auto& columnIndices = m_columnIndices[ index ];
+  columnIndices.clear();
+
+  // not used on this connection, or the statement itself failed and was reported already
+  auto pStmt = m_stmts[ index ];
+  if( !pStmt )
+    return;
+
+  if( columnNames.size() != columnCount )
+  {
+    Logger::error( "Statement #{0} declares {1} columns but names {2}", index, columnCount, columnNames.size() );
+    m_prepareError = true;
+    return;
+  }
+
+  for( auto columnName : columnNames )
+  {
+    auto columnIndex = pStmt->findColumn( columnName );
+    if( columnIndex == 0 )
+    {
+      Logger::error( "Statement #{0} has no result column {1}", index, columnName );
+      m_prepareError = true;
+    }
+
+    columnIndices.push_back( columnIndex );
+  }
+}
+
 bool Sapphire::Db::DbConnection::prepareStatements()
 {
   doPrepareStatements();
@@ -1,6 +1,7 @@
 #ifndef _SAPPHIRE_DBCONNECTION_H
 #define _SAPPHIRE_DBCONNECTION_H
 
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -60,11 +61,11 @@ namespace Sapphire::Db
 
     std::shared_ptr< Mysql::ResultSet > query( std::shared_ptr< PreparedStatement > stmt );
 
-    void beginTransaction();
+    bool beginTransaction();
 
-    void rollbackTransaction();
+    bool rollbackTransaction();
 
-    void commitTransaction();
+    bool commitTransaction();
 
     bool ping();
 
@@ -81,12 +82,24 @@ namespace Sapphire::Db
 
     std::shared_ptr< Mysql::PreparedStatement > getPreparedStatement( uint32_t index );
 
+    /*! gets the column indices resolved by prepareColumns, in the order the names were passed */
+    const std::vector< uint32_t >& getColumnIndices( uint32_t index ) const;
+
     void prepareStatement( uint32_t index, const std::string& sql, ConnectionFlags flags );
 
+    /*!
+     * @brief Resolves result columns of a statement to their 1-based indices
+     *
+     * Called right after prepareStatement. A missing column fails the prepare step the same way invalid sql
+     * does, so a schema that doesn't match stops the server on startup instead of loading zeroes.
+     */
+    void prepareColumns( uint32_t index, uint32_t columnCount, std::initializer_list< const char* > columnNames );
+
     virtual void doPrepareStatements() = 0;
 
   protected:
     std::vector< std::shared_ptr< Mysql::PreparedStatement > > m_stmts;
+    std::vector< std::vector< uint32_t > > m_columnIndices;
     PreparedStatementMap m_queries;
     bool m_reconnecting;
     bool m_prepareError;
@@ -1,11 +1,18 @@
 #include "DbWorker.h"
 #include "Operation.h"
 #include "Util/LockedWaitQueue.h"
+#include "Metrics/Metrics.h"
+
+#include <chrono>
 
 using namespace Sapphire::Common;
 
 Sapphire::Db::DbWorker::DbWorker( Util::LockedWaitQueue< std::shared_ptr< Operation > >* newQueue,
-                                  DbConnection* pConn )
+                                  DbConnection* pConn ) :
+  m_queueLength( Metrics::Registry::gauge( "sapphire_db_queue_length",
+                                           "Async database operations waiting for a worker" ) ),
+  m_operationTime( Metrics::Registry::histogram( "sapphire_db_operation_us",
+                                                 "Execution time of async database operations in microseconds" ) )
 {
   m_pConn = pConn;
   m_queue = newQueue;
@@ -34,7 +41,14 @@ void Sapphire::Db::DbWorker::workerThread()
     if( m_cancelationToken || !operation )
       return;
 
+    m_queueLength.sub();
+
+    auto start = std::chrono::steady_clock::now();
+
     operation->setConnection( m_pConn );
     operation->call();
+
+    m_operationTime.record( static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+      std::chrono::steady_clock::now() - start ).count() ) );
   }
 }
@@ -6,6 +6,12 @@
 #include "Util/LockedWaitQueue.h"
 #include <memory>
 
+namespace Sapphire::Common::Metrics
+{
+  class Gauge;
+  class Histogram;
+}
+
 namespace Sapphire::Db
 {
   class DbConnection;
@@ -28,6 +34,9 @@ namespace Sapphire::Db
 
     std::atomic< bool > m_cancelationToken;
 
+    Common::Metrics::Gauge& m_queueLength;
+    Common::Metrics::Histogram& m_operationTime;
+
     DbWorker( DbWorker const& right ) = delete;
 
     DbWorker& operator=( DbWorker const& right ) = delete;
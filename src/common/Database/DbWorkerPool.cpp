@@ -1,12 +1,14 @@
 #include "DbWorkerPool.h"
 #include "DbConnection.h"
 #include "PreparedStatement.h"
+#include "PreparedStatementPool.h"
 #include <MySqlConnector.h>
 #include "StatementTask.h"
 #include "Operation.h"
 #include "ZoneDbConnection.h"
 
 #include "Logging/Logger.h"
+#include "Metrics/Metrics.h"
 #include <mysql.h>
 
 class PingOperation : public Sapphire::Db::Operation
@@ -21,8 +23,11 @@ class PingOperation : public Sapphire::Db::Operation
 template< class T >
 Sapphire::Db::DbWorkerPool< T >::DbWorkerPool() :
   m_queue( new Common::Util::LockedWaitQueue< std::shared_ptr< Operation > >() ),
+  m_stmtPool( std::make_shared< PreparedStatementPool >( PreparedStatementIndex::MAX_STATEMENTS ) ),
   m_asyncThreads( 0 ),
-  m_synchThreads( 0 )
+  m_synchThreads( 0 ),
+  m_queueLength( Common::Metrics::Registry::gauge( "sapphire_db_queue_length",
+                                                   "Async database operations waiting for a worker" ) )
 {
 }
 
@@ -68,6 +73,8 @@ template< class T >
 void Sapphire::Db::DbWorkerPool< T >::close()
 {
   Logger::info( "[DbPool] Closing down DatabasePool {0}", getDatabaseName() );
+  Logger::info( "[DbPool] Prepared statements allocated: {0}, reused: {1}",
+                m_stmtPool->getAllocationCount(), m_stmtPool->getReuseCount() );
   m_connections[ IDX_ASYNC ].clear();
   m_connections[ IDX_SYNCH ].clear();
   Logger::info( "[DbPool] All connections on DatabasePool {0} closed.", getDatabaseName() );
@@ -121,7 +128,15 @@ template< class T >
 std::shared_ptr< Sapphire::Db::PreparedStatement >
 Sapphire::Db::DbWorkerPool< T >::getPreparedStatement( PreparedStatementIndex index )
 {
-  return std::make_shared< PreparedStatement >( index );
+  return m_stmtPool->acquire( index );
+}
+
+template< class T >
+const std::vector< uint32_t >&
+  Sapphire::Db::DbWorkerPool< T >::getColumnIndices( PreparedStatementIndex index ) const
+{
+  // all connections prepare the same sql, so the column layout is the same on each of them
+  return m_connections[ IDX_SYNCH ].front()->getColumnIndices( index );
 }
 
 template< class T >
@@ -197,6 +212,9 @@ unsigned long Sapphire::Db::DbWorkerPool< T >::escapeString( char* to, const cha
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::enqueue( std::shared_ptr< Operation > op )
 {
+  // the workers take it off again once they pick the operation up
+  m_queueLength.add();
+
   m_queue->push( op );
 }
 
@@ -238,6 +256,14 @@ void Sapphire::Db::DbWorkerPool< T >::execute( std::shared_ptr< PreparedStatemen
   enqueue( task );
 }
 
+template< class T >
+void Sapphire::Db::DbWorkerPool< T >::execute( const std::shared_ptr< PreparedStatementStrand >& strand,
+                                               std::shared_ptr< PreparedStatement > stmt )
+{
+  if( strand->add( std::move( stmt ) ) )
+    enqueue( strand );
+}
+
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::directExecute( const std::string& sql )
 {
@@ -254,5 +280,27 @@ void Sapphire::Db::DbWorkerPool< T >::directExecute( std::shared_ptr< PreparedSt
   connection->unlock();
 }
 
+template< class T >
+bool Sapphire::Db::DbWorkerPool< T >::directExecuteTransaction(
+  const std::vector< std::shared_ptr< PreparedStatement > >& stmts )
+{
+  auto connection = getFreeConnection();
+
+  bool success = connection->beginTransaction();
+
+  for( auto it = stmts.begin(); success && it != stmts.end(); ++it )
+    success = connection->execute( *it );
+
+  if( success )
+    success = connection->commitTransaction();
+
+  if( !success )
+    connection->rollbackTransaction();
+
+  connection->unlock();
+
+  return success;
+}
+
 template
 class Sapphire::Db::DbWorkerPool< Sapphire::Db::ZoneDbConnection >;
@@ -8,6 +8,11 @@
 #include "Util/LockedWaitQueue.h"
 #include "DbConnection.h"
 
+namespace Sapphire::Common::Metrics
+{
+  class Gauge;
+}
+
 namespace Sapphire::Db
 {
 
@@ -18,6 +23,10 @@ namespace Sapphire::Db
 
   class PreparedStatement;
 
+  class PreparedStatementStrand;
+
+  class PreparedStatementPool;
+
   struct ConnectionInfo;
 
   template< class T >
@@ -54,11 +63,20 @@ namespace Sapphire::Db
 
     void execute( std::shared_ptr< PreparedStatement > stmt );
 
+    /*! queues stmt behind the statements already pending on strand, they run in order */
+    void execute( const std::shared_ptr< PreparedStatementStrand >& strand, std::shared_ptr< PreparedStatement > stmt );
+
     // Sync execution
     void directExecute( const std::string& sql );
 
     void directExecute( std::shared_ptr< PreparedStatement > stmt );
 
+    /*!
+     * @brief Runs the statements in order in one transaction on a synchronous connection
+     * @return false if one of them failed, nothing was written then
+     */
+    bool directExecuteTransaction( const std::vector< std::shared_ptr< PreparedStatement > >& stmts );
+
     std::shared_ptr< Mysql::ResultSet >
     query( const std::string& sql, std::shared_ptr< T > connection = nullptr );
 
@@ -68,6 +86,13 @@ namespace Sapphire::Db
 
     std::shared_ptr< PreparedStatement > getPreparedStatement( PreparedStatementIndex index );
 
+    /*!
+     * @brief Gets the result column indices of a statement, index them with the column enum of the statement
+     *
+     * Resolved when the statements are prepared, only statements prepared on synchronous connections have them.
+     */
+    const std::vector< uint32_t >& getColumnIndices( PreparedStatementIndex index ) const;
+
     void escapeString( std::string& str );
 
     void keepAlive();
@@ -84,10 +109,12 @@ namespace Sapphire::Db
     const std::string& getDatabaseName() const;
 
     std::unique_ptr< Common::Util::LockedWaitQueue< std::shared_ptr< Operation > > > m_queue;
+    std::shared_ptr< PreparedStatementPool > m_stmtPool;
     std::array< std::vector< std::shared_ptr< T > >, IDX_SIZE > m_connections;
     ConnectionInfo m_connectionInfo;
     uint8_t m_asyncThreads;
     uint8_t m_synchThreads;
+    Common::Metrics::Gauge& m_queueLength;
   };
 
 }
@@ -64,6 +64,15 @@ void Sapphire::Db::PreparedStatement::bindParameters()
   }
 }
 
+void Sapphire::Db::PreparedStatement::clear()
+{
+  m_stmt.reset();
+
+  // a statement index always binds the same parameters, so the entries are kept and overwritten by the next user
+  for( auto& data : m_statementData )
+    data.type = TYPE_NULL;
+}
+
 //- Bind to buffer
 void Sapphire::Db::PreparedStatement::setBool( uint8_t index, const bool value )
 {
@@ -75,6 +75,9 @@ namespace Sapphire::Db
 
     void bindParameters();
 
+    // drops the bound mysql statement and parameter values, keeping the parameter storage for reuse
+    void clear();
+
   protected:
     std::shared_ptr< Mysql::PreparedStatement > m_stmt;
     uint32_t m_index;
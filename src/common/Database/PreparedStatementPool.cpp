@@ -0,0 +1,121 @@
+#include "PreparedStatementPool.h"
+#include "PreparedStatement.h"
+
+Sapphire::Db::PreparedStatementPool::PreparedStatementPool( uint32_t statementCount ) :
+  m_freeLists( statementCount ),
+  m_allocationCount( 0 ),
+  m_reuseCount( 0 )
+{
+  for( auto& freeList : m_freeLists )
+  {
+    freeList.statements.reserve( MaxFreeStatements );
+    freeList.blocks.reserve( MaxFreeStatements );
+  }
+}
+
+Sapphire::Db::PreparedStatementPool::~PreparedStatementPool()
+{
+  for( auto& freeList : m_freeLists )
+  {
+    for( auto pStmt : freeList.statements )
+      delete pStmt;
+
+    for( auto pBlock : freeList.blocks )
+      ::operator delete( pBlock );
+  }
+}
+
+std::shared_ptr< Sapphire::Db::PreparedStatement > Sapphire::Db::PreparedStatementPool::acquire( uint32_t index )
+{
+  if( index >= m_freeLists.size() )
+    return std::make_shared< PreparedStatement >( index );
+
+  PreparedStatement* pStmt = nullptr;
+
+  auto& freeList = m_freeLists[ index ];
+  {
+    std::lock_guard< std::mutex > lock( freeList.mutex );
+    if( !freeList.statements.empty() )
+    {
+      pStmt = freeList.statements.back();
+      freeList.statements.pop_back();
+    }
+  }
+
+  if( pStmt )
+    ++m_reuseCount;
+  else
+  {
+    pStmt = new PreparedStatement( index );
+    ++m_allocationCount;
+  }
+
+  // the allocator inside the control block keeps the pool alive until every statement it handed out has come back
+  return std::shared_ptr< PreparedStatement >( pStmt, [ this ]( PreparedStatement* pStmt )
+  {
+    release( pStmt );
+  }, BlockAllocator< PreparedStatement >( shared_from_this(), index ) );
+}
+
+void Sapphire::Db::PreparedStatementPool::release( PreparedStatement* pStmt )
+{
+  pStmt->clear();
+
+  auto& freeList = m_freeLists[ pStmt->getIndex() ];
+  {
+    std::lock_guard< std::mutex > lock( freeList.mutex );
+    if( freeList.statements.size() < MaxFreeStatements )
+    {
+      freeList.statements.push_back( pStmt );
+      return;
+    }
+  }
+
+  delete pStmt;
+}
+
+void* Sapphire::Db::PreparedStatementPool::allocateBlock( uint32_t index, std::size_t size )
+{
+  auto& freeList = m_freeLists[ index ];
+  {
+    std::lock_guard< std::mutex > lock( freeList.mutex );
+    if( freeList.blockSize == size && !freeList.blocks.empty() )
+    {
+      auto pBlock = freeList.blocks.back();
+      freeList.blocks.pop_back();
+      return pBlock;
+    }
+  }
+
+  return ::operator new( size );
+}
+
+void Sapphire::Db::PreparedStatementPool::releaseBlock( uint32_t index, void* pBlock, std::size_t size )
+{
+  auto& freeList = m_freeLists[ index ];
+  {
+    std::lock_guard< std::mutex > lock( freeList.mutex );
+
+    // all control blocks of a pool share one type, a block of any other size is freed
+    if( freeList.blocks.empty() )
+      freeList.blockSize = size;
+
+    if( freeList.blockSize == size && freeList.blocks.size() < MaxFreeStatements )
+    {
+      freeList.blocks.push_back( pBlock );
+      return;
+    }
+  }
+
+  ::operator delete( pBlock );
+}
+
+uint64_t Sapphire::Db::PreparedStatementPool::getAllocationCount() const
+{
+  return m_allocationCount;
+}
+
+uint64_t Sapphire::Db::PreparedStatementPool::getReuseCount() const
+{
+  return m_reuseCount;
+}
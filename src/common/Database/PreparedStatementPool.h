@@ -0,0 +1,114 @@
+#ifndef SAPPHIRE_PREPAREDSTATEMENTPOOL_H
+#define SAPPHIRE_PREPAREDSTATEMENTPOOL_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Sapphire::Db
+{
+  class PreparedStatement;
+
+  /*!
+   * @brief Recycles PreparedStatement objects per statement index.
+   *
+   * Statements handed out by acquire() return to the free list of their index once the last
+   * owner releases them, which for async statements is the db worker after execution.
+   * Recycled statements keep their parameter storage, so the next user of the same index
+   * binds its parameters without reallocating. The shared_ptr control blocks are recycled the
+   * same way, acquiring a statement that is in the free list doesn't touch the heap.
+   */
+  class PreparedStatementPool : public std::enable_shared_from_this< PreparedStatementPool >
+  {
+  public:
+    // upper bound of idle statements kept per index
+    static constexpr std::size_t MaxFreeStatements = 64;
+
+    explicit PreparedStatementPool( uint32_t statementCount );
+
+    ~PreparedStatementPool();
+
+    std::shared_ptr< PreparedStatement > acquire( uint32_t index );
+
+    uint64_t getAllocationCount() const;
+
+    uint64_t getReuseCount() const;
+
+  private:
+    struct FreeList
+    {
+      std::mutex mutex;
+      std::vector< PreparedStatement* > statements;
+      // control blocks of released statements, all of them have blockSize bytes
+      std::vector< void* > blocks;
+      std::size_t blockSize = 0;
+    };
+
+    /*!
+     * @brief Hands the control blocks of the shared_ptrs out of the free list of their statement index
+     *
+     * Holds the pool, the control block is deallocated after the deleter ran and may outlive every statement.
+     */
+    template< typename T >
+    struct BlockAllocator
+    {
+      using value_type = T;
+
+      BlockAllocator( std::shared_ptr< PreparedStatementPool > pPool, uint32_t index ) :
+        pPool( std::move( pPool ) ),
+        index( index )
+      {
+      }
+
+      template< typename U >
+      BlockAllocator( const BlockAllocator< U >& other ) :
+        pPool( other.pPool ),
+        index( other.index )
+      {
+      }
+
+      T* allocate( std::size_t count )
+      {
+        return static_cast< T* >( pPool->allocateBlock( index, count * sizeof( T ) ) );
+      }
+
+      void deallocate( T* pBlock, std::size_t count )
+      {
+        pPool->releaseBlock( index, pBlock, count * sizeof( T ) );
+      }
+
+      template< typename U >
+      bool operator==( const BlockAllocator< U >& other ) const
+      {
+        return pPool == other.pPool && index == other.index;
+      }
+
+      template< typename U >
+      bool operator!=( const BlockAllocator< U >& other ) const
+      {
+        return !( *this == other );
+      }
+
+      std::shared_ptr< PreparedStatementPool > pPool;
+      uint32_t index;
+    };
+
+    void release( PreparedStatement* pStmt );
+
+    void* allocateBlock( uint32_t index, std::size_t size );
+
+    void releaseBlock( uint32_t index, void* pBlock, std::size_t size );
+
+    std::vector< FreeList > m_freeLists;
+
+    std::atomic< uint64_t > m_allocationCount;
+    std::atomic< uint64_t > m_reuseCount;
+
+    PreparedStatementPool( PreparedStatementPool const& right ) = delete;
+
+    PreparedStatementPool& operator=( PreparedStatementPool const& right ) = delete;
+  };
+}
+
+#endif //SAPPHIRE_PREPAREDSTATEMENTPOOL_H
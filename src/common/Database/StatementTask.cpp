@@ -68,3 +68,40 @@ bool Sapphire::Db::PreparedStatementTask::execute()
 
   return m_pConn->execute( m_stmt );
 }
+
+bool Sapphire::Db::PreparedStatementStrand::add( std::shared_ptr< Sapphire::Db::PreparedStatement > stmt )
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+  m_pending.push_back( std::move( stmt ) );
+
+  if( m_scheduled )
+    return false;
+
+  m_scheduled = true;
+  return true;
+}
+
+bool Sapphire::Db::PreparedStatementStrand::execute()
+{
+  bool success = true;
+
+  while( true )
+  {
+    std::shared_ptr< PreparedStatement > stmt;
+
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      if( m_pending.empty() )
+      {
+        // statements added from now on queue the strand again
+        m_scheduled = false;
+        return success;
+      }
+
+      stmt = std::move( m_pending.front() );
+      m_pending.pop_front();
+    }
+
+    success = m_pConn->execute( stmt ) && success;
+  }
+}
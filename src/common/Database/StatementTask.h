@@ -3,7 +3,9 @@
 
 #include <string>
 #include "Operation.h"
+#include <deque>
 #include <memory>
+#include <mutex>
 
 namespace Sapphire::Db
 {
@@ -39,6 +41,33 @@ namespace Sapphire::Db
     bool m_hasResult;
   };
 
+  /*!
+   * @brief Runs prepared statements asynchronously in the order they were added
+   *
+   * The async workers pick operations off a shared queue, two statements queued on their own may run on
+   * different connections and overtake each other. A strand is queued as a single operation while it has
+   * statements pending, whichever worker picks it up runs all of them one after another.
+   */
+  class PreparedStatementStrand :
+    public Operation
+  {
+  public:
+    PreparedStatementStrand() = default;
+
+    /*!
+     * @brief Appends a statement
+     * @return true if the strand has to be queued, it is not waiting for a worker yet
+     */
+    bool add( std::shared_ptr< PreparedStatement > stmt );
+
+    bool execute() override;
+
+  private:
+    std::mutex m_mutex;
+    std::deque< std::shared_ptr< PreparedStatement > > m_pending;
+    bool m_scheduled = false;
+  };
+
 }
 
 
@@ -19,7 +19,10 @@ Sapphire::Db::ZoneDbConnection::~ZoneDbConnection()
 void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
 {
   if( !m_reconnecting )
+  {
     m_stmts.resize( MAX_STATEMENTS );
+    m_columnIndices.resize( MAX_STATEMENTS );
+  }
 
   /// CHARA
   prepareStatement( CHARA_SEL,
@@ -36,6 +39,14 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "Pose "
                     "FROM charainfo WHERE CharacterId = ?;",
                     CONNECTION_SYNC );
+  prepareColumns( CHARA_SEL, CharaSel::ColumnCount,
+                  { "Name", "TerritoryType", "TerritoryId", "OTerritoryType", "OTerritoryId", "PosX", "PosY", "PosZ",
+                    "PosR", "OPosX", "OPosY", "OPosZ", "OPosR", "Customize", "ModelMainWeapon", "ModelEquip",
+                    "GuardianDeity", "BirthDay", "BirthMonth", "Status", "EmoteModeType", "ActiveTitle", "Class",
+                    "Homepoint", "ContentId", "Voice", "StartTown", "TotalPlayTime", "IsNewGame", "IsNewAdventurer",
+                    "OpeningSequence", "GrandCompany", "CFPenaltyUntil", "GMRank", "EquipDisplayFlags", "Pose",
+                    "HowTo", "QuestCompleteFlags", "QuestTracking", "Aetheryte", "Unlocks", "Discovery", "TitleList",
+                    "Mounts", "Orchestrion", "GrandCompanyRank", "Hp", "Mp", "Mount" } );
 
 
   prepareStatement( CHARA_UP,
@@ -266,6 +277,9 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "LEFT JOIN landplaceditems "
                     "ON houseiteminventory.ItemId = landplaceditems.ItemId;",
                     CONNECTION_BOTH );
+  prepareColumns( LAND_INV_SEL_ALL, LandInvSelAll::ColumnCount,
+                  { "LandIdent", "ContainerId", "ItemId", "SlotId", "catalogId", "stain", "PosX", "PosY", "PosZ",
+                    "Rotation" } );
 
   prepareStatement( LAND_INV_SEL_HOUSE,
                     "SELECT LandIdent, ContainerId, ItemId, SlotId FROM houseiteminventory WHERE LandIdent = ?",
@@ -281,6 +295,9 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "LEFT JOIN house "
                     "ON land.HouseId = house.HouseId;",
                     CONNECTION_SYNC );
+  prepareColumns( LAND_SEL_ALL, LandSelAll::ColumnCount,
+                  { "LandSetId", "LandId", "Type", "Size", "Status", "LandPrice", "UpdateTime", "OwnerId", "HouseId",
+                    "Welcome", "Comment", "HouseName", "BuildTime", "Endorsements", "Aetheryte" } );
 
   prepareStatement( LAND_INV_UP,
                     "INSERT INTO houseiteminventory ( LandIdent, ContainerId, SlotId, ItemId ) "
@@ -304,6 +321,72 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "WHERE ItemId = ?;",
                     CONNECTION_BOTH );
 
+  /// MARKET
+  prepareStatement( MARKET_LISTING_SEL_ALL,
+                    "SELECT ListingId, CatalogId, RetainerId, RetainerOwnerId, ArtisanId, RetainerName, "
+                    "PricePerUnit, Quantity, IsHq, MarketCity, ListTime "
+                    "FROM marketlisting "
+                    "ORDER BY PricePerUnit, ListingId;",
+                    CONNECTION_SYNC );
+
+  prepareStatement( MARKET_LISTING_INS,
+                    "INSERT INTO marketlisting ( ListingId, CatalogId, RetainerId, RetainerOwnerId, ArtisanId, "
+                    "RetainerName, PricePerUnit, Quantity, IsHq, MarketCity, ListTime ) "
+                    "VALUES ( ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ? );",
+                    CONNECTION_ASYNC );
+
+  prepareStatement( MARKET_LISTING_UP_PRICE,
+                    "UPDATE marketlisting SET PricePerUnit = ? WHERE ListingId = ?;",
+                    CONNECTION_ASYNC );
+
+  prepareStatement( MARKET_LISTING_DEL,
+                    "DELETE FROM marketlisting WHERE ListingId = ?;",
+                    CONNECTION_ASYNC );
+
+  prepareStatement( MARKET_HISTORY_SEL_ALL,
+                    "SELECT CatalogId, BuyerName, SalePrice, Quantity, IsHq, OnMannequin, PurchaseTime "
+                    "FROM marketsalehistory "
+                    "ORDER BY CatalogId, PurchaseTime DESC;",
+                    CONNECTION_SYNC );
+
+  prepareStatement( MARKET_HISTORY_INS,
+                    "INSERT INTO marketsalehistory ( CatalogId, BuyerName, SalePrice, Quantity, IsHq, "
+                    "OnMannequin, PurchaseTime ) "
+                    "VALUES ( ?, ?, ?, ?, ?, ?, ? );",
+                    CONNECTION_ASYNC );
+
+  prepareStatement( LINKSHELL_SEL_ALL,
+                    "SELECT LinkshellId, MasterCharacterId, CharacterIdList, "
+                    "LinkshellName, LeaderIdList, InviteIdList "
+                    "FROM infolinkshell "
+                    "ORDER BY LinkshellId ASC;",
+                    CONNECTION_SYNC );
+  prepareColumns( LINKSHELL_SEL_ALL, LinkshellSelAll::ColumnCount,
+                  { "LinkshellId", "MasterCharacterId", "CharacterIdList", "LinkshellName", "LeaderIdList",
+                    "InviteIdList" } );
+
+  prepareStatement( LINKSHELL_UP_CLEAR_ID_LISTS,
+                    "UPDATE infolinkshell SET CharacterIdList = NULL, LeaderIdList = NULL, InviteIdList = NULL "
+                    "WHERE LinkshellId = ?;",
+                    CONNECTION_SYNC );
+
+  prepareStatement( LINKSHELL_MEMBER_SEL_ALL,
+                    "SELECT LinkshellId, CharacterId, MemberRank "
+                    "FROM linkshellmember;",
+                    CONNECTION_SYNC );
+  prepareColumns( LINKSHELL_MEMBER_SEL_ALL, LinkshellMemberSelAll::ColumnCount,
+                  { "LinkshellId", "CharacterId", "MemberRank" } );
+
+  prepareStatement( LINKSHELL_MEMBER_INS,
+                    "INSERT INTO linkshellmember ( LinkshellId, CharacterId, MemberRank ) "
+                    "VALUES ( ?, ?, ? ) "
+                    "ON DUPLICATE KEY UPDATE MemberRank = VALUES( MemberRank );",
+                    CONNECTION_SYNC );
+
+  prepareStatement( LINKSHELL_MEMBER_DEL,
+                    "DELETE FROM linkshellmember WHERE LinkshellId = ? AND CharacterId = ?;",
+                    CONNECTION_SYNC );
+
   /*prepareStatement( LAND_INS,
                     "INSERT INTO land ( LandSetId ) VALUES ( ? );",
                     CONNECTION_BOTH );
@@ -101,10 +101,156 @@ namespace Sapphire::Db
     LAND_INV_UP_ITEMPOS,
     LAND_INV_DEL_ITEMPOS,
 
+    MARKET_LISTING_SEL_ALL,
+    MARKET_LISTING_INS,
+    MARKET_LISTING_UP_PRICE,
+    MARKET_LISTING_DEL,
+    MARKET_HISTORY_SEL_ALL,
+    MARKET_HISTORY_INS,
+
+    LINKSHELL_SEL_ALL,
+    LINKSHELL_UP_CLEAR_ID_LISTS,
+    LINKSHELL_MEMBER_SEL_ALL,
+    LINKSHELL_MEMBER_INS,
+    LINKSHELL_MEMBER_DEL,
+
 
     MAX_STATEMENTS
   };
 
+  /*! result columns of CHARA_SEL read by Player::load, the order of the names passed to prepareColumns */
+  namespace CharaSel
+  {
+    enum Column : uint32_t
+    {
+      Name,
+      TerritoryType,
+      TerritoryId,
+      OTerritoryType,
+      OTerritoryId,
+      PosX,
+      PosY,
+      PosZ,
+      PosR,
+      OPosX,
+      OPosY,
+      OPosZ,
+      OPosR,
+      Customize,
+      ModelMainWeapon,
+      ModelEquip,
+      GuardianDeity,
+      BirthDay,
+      BirthMonth,
+      Status,
+      EmoteModeType,
+      ActiveTitle,
+      Class,
+      Homepoint,
+      ContentId,
+      Voice,
+      StartTown,
+      TotalPlayTime,
+      IsNewGame,
+      IsNewAdventurer,
+      OpeningSequence,
+      GrandCompany,
+      CFPenaltyUntil,
+      GMRank,
+      EquipDisplayFlags,
+      Pose,
+      HowTo,
+      QuestCompleteFlags,
+      QuestTracking,
+      Aetheryte,
+      Unlocks,
+      Discovery,
+      TitleList,
+      Mounts,
+      Orchestrion,
+      GrandCompanyRank,
+      Hp,
+      Mp,
+      Mount,
+
+      ColumnCount
+    };
+  }
+
+  /*! result columns of LAND_INV_SEL_ALL read by HousingMgr::loadEstateInventories, the order of the names passed to prepareColumns */
+  namespace LandInvSelAll
+  {
+    enum Column : uint32_t
+    {
+      LandIdent,
+      ContainerId,
+      ItemId,
+      SlotId,
+      CatalogId,
+      Stain,
+      PosX,
+      PosY,
+      PosZ,
+      Rotation,
+
+      ColumnCount
+    };
+  }
+
+  /*! result columns of LAND_SEL_ALL read by HousingMgr::initLandCache, the order of the names passed to prepareColumns */
+  namespace LandSelAll
+  {
+    enum Column : uint32_t
+    {
+      LandSetId,
+      LandId,
+      Type,
+      Size,
+      Status,
+      LandPrice,
+      UpdateTime,
+      OwnerId,
+      HouseId,
+      Welcome,
+      Comment,
+      HouseName,
+      BuildTime,
+      Endorsements,
+      Aetheryte,
+
+      ColumnCount
+    };
+  }
+
+  /*! result columns of LINKSHELL_SEL_ALL read by LinkshellMgr::loadLinkshells, the order of the names passed to prepareColumns */
+  namespace LinkshellSelAll
+  {
+    enum Column : uint32_t
+    {
+      LinkshellId,
+      MasterCharacterId,
+      CharacterIdList,
+      LinkshellName,
+      LeaderIdList,
+      InviteIdList,
+
+      ColumnCount
+    };
+  }
+
+  /*! result columns of LINKSHELL_MEMBER_SEL_ALL read by LinkshellMgr::loadLinkshells, the order of the names passed to prepareColumns */
+  namespace LinkshellMemberSelAll
+  {
+    enum Column : uint32_t
+    {
+      LinkshellId,
+      CharacterId,
+      MemberRank,
+
+      ColumnCount
+    };
+  }
+
   class ZoneDbConnection : public DbConnection
   {
   public:
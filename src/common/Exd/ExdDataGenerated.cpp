@@ -12165,7 +12165,10 @@ Sapphire::Data::ZoneSharedGroup::ZoneSharedGroup( uint32_t row_id, uint32_t subR
 }
 
 
-Sapphire::Data::ExdDataGenerated::ExdDataGenerated()
+Sapphire::Data::ExdDataGenerated::ExdDataGenerated() :
+  m_lookups( Common::Metrics::Registry::counter( "sapphire_exd_lookups_total", "Rows read from the game data" ) ),
+  m_failedLookups( Common::Metrics::Registry::counter( "sapphire_exd_failed_lookups_total",
+                                                       "Rows requested from the game data that don't exist" ) )
 {
 }
 
@@ -13,6 +13,8 @@
 #include <set>
 #include <variant>
 
+#include <Metrics/Metrics.h>
+
 #if _WIN32
 #undef near
 #undef far
@@ -7553,6 +7555,9 @@ struct ZoneSharedGroup
     std::shared_ptr< xiv::dat::GameData > m_data;
     std::shared_ptr< xiv::exd::ExdData > m_exd_data;
 
+    Common::Metrics::Counter& m_lookups;
+    Common::Metrics::Counter& m_failedLookups;
+
     std::shared_ptr< xiv::dat::GameData > getGameData()
     {
       return m_data;
@@ -7561,6 +7566,7 @@ struct ZoneSharedGroup
     template< class T >
     std::shared_ptr< T > get( uint32_t id )
     {
+      m_lookups.inc();
       try
       {
         auto info = std::make_shared< T >( id, this );
@@ -7568,6 +7574,7 @@ struct ZoneSharedGroup
       }
       catch( ... )
       {
+        m_failedLookups.inc();
         return nullptr;
       }
       return nullptr;
@@ -7576,6 +7583,7 @@ struct ZoneSharedGroup
     template< class T >
     std::shared_ptr< T > get( uint32_t id, uint32_t slotId )
     {
+      m_lookups.inc();
       try
       {
         auto info = std::make_shared< T >( id, slotId, this );
@@ -7583,6 +7591,7 @@ struct ZoneSharedGroup
       }
       catch( ... )
       {
+        m_failedLookups.inc();
         return nullptr;
       }
       return nullptr;
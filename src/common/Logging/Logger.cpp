@@ -9,9 +9,16 @@
 
 // #include <iostream>
 #include <filesystem> // or #include <filesystem>
+#include <cstring>
 
 namespace fs = std::filesystem;
 
+namespace
+{
+  // cached on init so logging doesn't go through spdlog's mutex guarded registry for every message
+  std::shared_ptr< spdlog::logger > s_logger;
+}
+
 void Sapphire::Logger::init( const std::string& logPath )
 {
   auto pos = logPath.find_last_of( fs::path::preferred_separator );
@@ -36,6 +43,9 @@ void Sapphire::Logger::init( const std::string& logPath )
   spdlog::register_logger( logger );
   spdlog::set_pattern( "[%H:%M:%S.%e] [%^%l%$] %v" );
   spdlog::set_level( spdlog::level::debug );
+  m_logLevel = Debug;
+
+  s_logger = logger;
   // always flush the log on criticial messages, otherwise it's done by libc
   // see: https://github.com/gabime/spdlog/wiki/7.-Flush-policy
   // nb: if the server crashes, log data can be missing from the file unless something logs critical just before it does
@@ -45,35 +55,59 @@ void Sapphire::Logger::init( const std::string& logPath )
 void Sapphire::Logger::setLogLevel( uint8_t logLevel )
 {
   spdlog::set_level( static_cast< spdlog::level::level_enum >( logLevel ) );
+  m_logLevel = logLevel;
+}
+
+void Sapphire::Logger::write( Level level, const std::string& text )
+{
+  if( s_logger )
+    s_logger->log( static_cast< spdlog::level::level_enum >( level ), text );
+}
+
+void Sapphire::Logger::write( Level level, const char* file, uint32_t line, const std::string& text )
+{
+  if( !s_logger )
+    return;
+
+  // only keep the file name of the source location
+  auto fileName = std::strrchr( file, fs::path::preferred_separator );
+  fileName = fileName ? fileName + 1 : file;
+
+  s_logger->log( static_cast< spdlog::level::level_enum >( level ), "[{0}:{1}] {2}", fileName, line, text );
 }
 
 void Sapphire::Logger::error( const std::string& text )
 {
-  spdlog::get( "logger" )->error( text );
+  if( shouldLog( Error ) )
+    write( Error, text );
 }
 
 void Sapphire::Logger::warn( const std::string& text )
 {
-  spdlog::get( "logger" )->warn( text );
+  if( shouldLog( Warn ) )
+    write( Warn, text );
 }
 
 void Sapphire::Logger::info( const std::string& text )
 {
-  spdlog::get( "logger" )->info( text );
+  if( shouldLog( Info ) )
+    write( Info, text );
 }
 
 void Sapphire::Logger::debug( const std::string& text )
 {
-  spdlog::get( "logger" )->debug( text );
+  if( shouldLog( Debug ) )
+    write( Debug, text );
 }
 
 void Sapphire::Logger::fatal( const std::string& text )
 {
-  spdlog::get( "logger" )->critical( text );
+  if( shouldLog( Fatal ) )
+    write( Fatal, text );
 }
 
 void Sapphire::Logger::trace( const std::string& text )
 {
-  spdlog::get( "logger" )->trace( text );
+  if( shouldLog( Trace ) )
+    write( Trace, text );
 }
-
@@ -1,40 +1,97 @@
 #ifndef _LOGGER_H
 #define _LOGGER_H 
 
+#include <atomic>
 #include <string>
 
 #include <spdlog/fmt/fmt.h>
 
+// lowest level compiled into the binary, 0 = trace ... 6 = off
+// release builds set this to info, stripping all trace and debug logging at compile time
+#ifndef SAPPHIRE_LOG_ACTIVE_LEVEL
+  #define SAPPHIRE_LOG_ACTIVE_LEVEL 0
+#endif
+
 namespace Sapphire
 {
 
   class Logger
   {
 
+  public:
+    // mirrors spdlog::level::level_enum
+    enum Level : uint8_t
+    {
+      Trace,
+      Debug,
+      Info,
+      Warn,
+      Error,
+      Fatal,
+      Off
+    };
+
   private:
     std::string m_logFile;
     Logger() = default;
     ~Logger() = default;
 
+    inline static std::atomic< uint8_t > m_logLevel{ Debug };
+
+    static void write( Level level, const std::string& text );
+    static void write( Level level, const char* file, uint32_t line, const std::string& text );
+
   public:
 
     static void init( const std::string& logPath );
     static void setLogLevel( uint8_t logLevel );
 
+    static constexpr bool isCompiledIn( Level level )
+    {
+#if SAPPHIRE_LOG_ACTIVE_LEVEL > 0
+      return level >= SAPPHIRE_LOG_ACTIVE_LEVEL;
+#else
+      // every level is compiled in, comparing the unsigned level against 0 would only trip -Wtype-limits
+      ( void ) level;
+      return true;
+#endif
+    }
+
+    // cheap enough to guard log calls on hot paths with, avoids formatting messages nobody will see
+    static bool shouldLog( Level level )
+    {
+      return isCompiledIn( level ) && level >= m_logLevel.load( std::memory_order_relaxed );
+    }
+
+    // used by the SAPPHIRE_LOG_* macros, prefixes the message with its source location
+    template< typename... Args >
+    static void log( Level level, const char* file, uint32_t line, const std::string& text, const Args&... args )
+    {
+      if( !shouldLog( level ) )
+        return;
+
+      if constexpr( sizeof...( Args ) == 0 )
+        write( level, file, line, text );
+      else
+        write( level, file, line, fmt::format( text, args... ) );
+    }
+
     // todo: this is a minor increase in build time because of fmtlib, but much less than including spdlog directly
 
     static void error( const std::string& text );
     template< typename... Args >
     static void error( const std::string& text, const Args&... args )
     {
-      error( fmt::format( text, args... ) );
+      if( shouldLog( Error ) )
+        write( Error, fmt::format( text, args... ) );
     }
 
     static void warn( const std::string& text );
     template< typename... Args >
     static void warn( const std::string& text, const Args&... args )
     {
-      warn( fmt::format( text, args... ) );
+      if( shouldLog( Warn ) )
+        write( Warn, fmt::format( text, args... ) );
     }
 
 
@@ -42,7 +99,8 @@ namespace Sapphire
     template< typename... Args >
     static void info( const std::string& text, const Args&... args )
     {
-      info( fmt::format( text, args... ) );
+      if( shouldLog( Info ) )
+        write( Info, fmt::format( text, args... ) );
     }
 
 
@@ -50,7 +108,11 @@ namespace Sapphire
     template< typename... Args >
     static void debug( const std::string& text, const Args&... args )
     {
-      debug( fmt::format( text, args... ) );
+      if constexpr( isCompiledIn( Debug ) )
+      {
+        if( shouldLog( Debug ) )
+          write( Debug, fmt::format( text, args... ) );
+      }
     }
 
 
@@ -58,7 +120,8 @@ namespace Sapphire
     template< typename... Args >
     static void fatal( const std::string& text, const Args&... args )
     {
-      fatal( fmt::format( text, args... ) );
+      if( shouldLog( Fatal ) )
+        write( Fatal, fmt::format( text, args... ) );
     }
 
 
@@ -66,7 +129,11 @@ namespace Sapphire
     template< typename... Args >
     static void trace( const std::string& text, const Args&... args )
     {
-      trace( fmt::format( text, args... ) );
+      if constexpr( isCompiledIn( Trace ) )
+      {
+        if( shouldLog( Trace ) )
+          write( Trace, fmt::format( text, args... ) );
+      }
     }
 
 
@@ -74,5 +141,29 @@ namespace Sapphire
 
 }
 
+// the arguments of these are only evaluated if the level is enabled
+#define SAPPHIRE_LOG( level, ... ) \
+  do \
+  { \
+    if( ::Sapphire::Logger::shouldLog( level ) ) \
+      ::Sapphire::Logger::log( level, __FILE__, __LINE__, __VA_ARGS__ ); \
+  } while( 0 )
+
+#if SAPPHIRE_LOG_ACTIVE_LEVEL <= 0
+  #define SAPPHIRE_LOG_TRACE( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Trace, __VA_ARGS__ )
+#else
+  #define SAPPHIRE_LOG_TRACE( ... ) ( void ) 0
+#endif
+
+#if SAPPHIRE_LOG_ACTIVE_LEVEL <= 1
+  #define SAPPHIRE_LOG_DEBUG( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Debug, __VA_ARGS__ )
+#else
+  #define SAPPHIRE_LOG_DEBUG( ... ) ( void ) 0
+#endif
+
+#define SAPPHIRE_LOG_INFO( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Info, __VA_ARGS__ )
+#define SAPPHIRE_LOG_WARN( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Warn, __VA_ARGS__ )
+#define SAPPHIRE_LOG_ERROR( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Error, __VA_ARGS__ )
+#define SAPPHIRE_LOG_FATAL( ... ) SAPPHIRE_LOG( ::Sapphire::Logger::Fatal, __VA_ARGS__ )
 
 #endif
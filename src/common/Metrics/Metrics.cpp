@@ -0,0 +1,317 @@
+#include "Metrics.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include <spdlog/fmt/fmt.h>
+
+Sapphire::Common::Metrics::OpcodeCounters::OpcodeCounters()
+{
+  static std::atomic< uint32_t > nextInstanceId{ 0 };
+
+  m_instanceId = nextInstanceId++;
+  if( m_instanceId >= MaxInstances )
+    throw std::runtime_error( "OpcodeCounters: too many instances" );
+}
+
+Sapphire::Common::Metrics::OpcodeCounters::Shard::~Shard()
+{
+  for( auto& page : pages )
+    delete page.load( std::memory_order_relaxed );
+}
+
+Sapphire::Common::Metrics::OpcodeCounters::Shard* Sapphire::Common::Metrics::OpcodeCounters::addShard()
+{
+  std::lock_guard< std::mutex > lock( m_shardMutex );
+
+  m_shards.push_back( std::make_unique< Shard >() );
+  t_shards[ m_instanceId ] = m_shards.back().get();
+
+  return m_shards.back().get();
+}
+
+Sapphire::Common::Metrics::OpcodeCounters::Page*
+  Sapphire::Common::Metrics::OpcodeCounters::addPage( Shard& shard, uint32_t pageIndex )
+{
+  auto pPage = new Page();
+
+  // published to collect, which may run on another thread
+  shard.pages[ pageIndex ].store( pPage, std::memory_order_release );
+
+  return pPage;
+}
+
+std::vector< Sapphire::Common::Metrics::OpcodeCounters::Totals >
+  Sapphire::Common::Metrics::OpcodeCounters::collect() const
+{
+  std::map< uint16_t, Totals > totals;
+
+  std::lock_guard< std::mutex > lock( m_shardMutex );
+
+  for( const auto& pShard : m_shards )
+  {
+    for( uint32_t pageIndex = 0; pageIndex < PageCount; ++pageIndex )
+    {
+      auto pPage = pShard->pages[ pageIndex ].load( std::memory_order_acquire );
+      if( !pPage )
+        continue;
+
+      for( uint32_t i = 0; i < PageSize; ++i )
+      {
+        auto packets = ( *pPage )[ i ].packets.load( std::memory_order_relaxed );
+        if( packets == 0 )
+          continue;
+
+        auto opcode = static_cast< uint16_t >( ( pageIndex << PageBits ) | i );
+        auto& entry = totals.emplace( opcode, Totals{ opcode, 0, 0 } ).first->second;
+        entry.packets += packets;
+        entry.bytes += ( *pPage )[ i ].bytes.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+  std::vector< Totals > result;
+  result.reserve( totals.size() );
+  for( const auto& entry : totals )
+    result.push_back( entry.second );
+
+  return result;
+}
+
+uint64_t Sapphire::Common::Metrics::Histogram::getCount() const
+{
+  return m_count.load( std::memory_order_relaxed );
+}
+
+uint64_t Sapphire::Common::Metrics::Histogram::getSum() const
+{
+  return m_sum.load( std::memory_order_relaxed );
+}
+
+uint64_t Sapphire::Common::Metrics::Histogram::getQuantile( double quantile ) const
+{
+  // the buckets are read one by one, a sample recorded meanwhile may or may not be included
+  std::array< uint64_t, BucketCount > counts;
+  uint64_t total = 0;
+  for( uint32_t i = 0; i < BucketCount; ++i )
+  {
+    counts[ i ] = m_buckets[ i ].load( std::memory_order_relaxed );
+    total += counts[ i ];
+  }
+
+  if( total == 0 )
+    return 0;
+
+  auto rank = static_cast< uint64_t >( quantile * static_cast< double >( total - 1 ) ) + 1;
+  uint64_t seen = 0;
+  for( uint32_t i = 0; i < BucketCount; ++i )
+  {
+    seen += counts[ i ];
+    if( seen >= rank )
+      return getBucketUpperBound( i );
+  }
+
+  return getBucketUpperBound( BucketCount - 1 );
+}
+
+uint64_t Sapphire::Common::Metrics::Histogram::getBucketUpperBound( uint32_t index )
+{
+  if( index < SubBucketCount )
+    return index;
+
+  auto shift = index / SubBucketCount - 1;
+  auto subBucket = index % SubBucketCount;
+  return ( ( static_cast< uint64_t >( SubBucketCount + subBucket ) + 1 ) << shift ) - 1;
+}
+
+Sapphire::Common::Metrics::Registry::Entry&
+  Sapphire::Common::Metrics::Registry::getEntry( const std::string& name, const std::string& help,
+                                                 const std::string& labels, Type type )
+{
+  std::lock_guard< std::mutex > lock( s_mutex );
+
+  for( auto& pEntry : s_entries )
+  {
+    if( pEntry->name == name && pEntry->labels == labels && pEntry->type == type )
+      return *pEntry;
+  }
+
+  auto pEntry = std::make_unique< Entry >();
+  pEntry->name = name;
+  pEntry->help = help;
+  pEntry->labels = labels;
+  pEntry->type = type;
+
+  switch( type )
+  {
+    case Type::Counter:
+      pEntry->pCounter = std::make_unique< Counter >();
+      break;
+    case Type::Gauge:
+      pEntry->pGauge = std::make_unique< Gauge >();
+      break;
+    case Type::Histogram:
+      pEntry->pHistogram = std::make_unique< Histogram >();
+      break;
+    case Type::OpcodeCounters:
+      pEntry->pOpcodeCounters = std::make_unique< OpcodeCounters >();
+      break;
+  }
+
+  s_entries.push_back( std::move( pEntry ) );
+  return *s_entries.back();
+}
+
+Sapphire::Common::Metrics::Counter&
+  Sapphire::Common::Metrics::Registry::counter( const std::string& name, const std::string& help,
+                                                const std::string& labels )
+{
+  return *getEntry( name, help, labels, Type::Counter ).pCounter;
+}
+
+Sapphire::Common::Metrics::Gauge&
+  Sapphire::Common::Metrics::Registry::gauge( const std::string& name, const std::string& help,
+                                              const std::string& labels )
+{
+  return *getEntry( name, help, labels, Type::Gauge ).pGauge;
+}
+
+Sapphire::Common::Metrics::Histogram&
+  Sapphire::Common::Metrics::Registry::histogram( const std::string& name, const std::string& help,
+                                                  const std::string& labels )
+{
+  return *getEntry( name, help, labels, Type::Histogram ).pHistogram;
+}
+
+Sapphire::Common::Metrics::OpcodeCounters&
+  Sapphire::Common::Metrics::Registry::opcodeCounters( const std::string& name, const std::string& help,
+                                                       const std::string& labels )
+{
+  return *getEntry( name, help, labels, Type::OpcodeCounters ).pOpcodeCounters;
+}
+
+void Sapphire::Common::Metrics::Registry::writeHeader( std::string& out, const std::string& name,
+                                                       const std::string& help, const std::string& type )
+{
+  out += fmt::format( "# HELP {0} {1}\n# TYPE {0} {2}\n", name, help, type );
+}
+
+void Sapphire::Common::Metrics::Registry::writeSample( std::string& out, const std::string& name,
+                                                       const std::string& labels, double value )
+{
+  if( labels.empty() )
+    out += fmt::format( "{0} {1}\n", name, value );
+  else
+    out += fmt::format( "{0}{{{1}}} {2}\n", name, labels, value );
+}
+
+void Sapphire::Common::Metrics::Registry::writeSample( std::string& out, const std::string& name,
+                                                       const std::string& labels, uint64_t value )
+{
+  if( labels.empty() )
+    out += fmt::format( "{0} {1}\n", name, value );
+  else
+    out += fmt::format( "{0}{{{1}}} {2}\n", name, labels, value );
+}
+
+void Sapphire::Common::Metrics::Registry::writeEntry( std::string& out, const Entry& entry, bool bytes )
+{
+  auto withLabel = [ &entry ]( const std::string& label )
+  {
+    return entry.labels.empty() ? label : entry.labels + "," + label;
+  };
+
+  switch( entry.type )
+  {
+    case Type::Counter:
+      writeSample( out, entry.name, entry.labels, entry.pCounter->get() );
+      break;
+
+    case Type::Gauge:
+      writeSample( out, entry.name, entry.labels, static_cast< double >( entry.pGauge->get() ) );
+      break;
+
+    case Type::Histogram:
+    {
+      const auto& histogram = *entry.pHistogram;
+      for( auto quantile : { 0.5, 0.9, 0.99, 0.999 } )
+      {
+        writeSample( out, entry.name, withLabel( fmt::format( "quantile=\"{0}\"", quantile ) ),
+                     histogram.getQuantile( quantile ) );
+      }
+      writeSample( out, entry.name + "_sum", entry.labels, histogram.getSum() );
+      writeSample( out, entry.name + "_count", entry.labels, histogram.getCount() );
+      break;
+    }
+
+    case Type::OpcodeCounters:
+    {
+      for( const auto& totals : entry.pOpcodeCounters->collect() )
+      {
+        auto label = withLabel( fmt::format( "opcode=\"0x{0:04X}\"", totals.opcode ) );
+        if( bytes )
+          writeSample( out, entry.name + "_bytes_total", label, totals.bytes );
+        else
+          writeSample( out, entry.name + "_packets_total", label, totals.packets );
+      }
+      break;
+    }
+  }
+}
+
+std::string Sapphire::Common::Metrics::Registry::scrape()
+{
+  std::string out;
+
+  std::lock_guard< std::mutex > lock( s_mutex );
+
+  // samples of a metric have to be grouped together, labelled variants may have been registered at any point
+  std::vector< const Entry* > entries;
+  for( const auto& pEntry : s_entries )
+    entries.push_back( pEntry.get() );
+  std::stable_sort( entries.begin(), entries.end(), []( const Entry* a, const Entry* b )
+  {
+    return a->name < b->name;
+  } );
+
+  for( auto groupStart = entries.begin(); groupStart != entries.end(); )
+  {
+    auto groupEnd = std::find_if( groupStart, entries.end(), [ groupStart ]( const Entry* pEntry )
+    {
+      return pEntry->name != ( *groupStart )->name;
+    } );
+
+    const auto& first = **groupStart;
+    switch( first.type )
+    {
+      case Type::Counter:
+        writeHeader( out, first.name, first.help, "counter" );
+        break;
+      case Type::Gauge:
+        writeHeader( out, first.name, first.help, "gauge" );
+        break;
+      case Type::Histogram:
+        writeHeader( out, first.name, first.help, "summary" );
+        break;
+      case Type::OpcodeCounters:
+        writeHeader( out, first.name + "_packets_total", first.help, "counter" );
+        break;
+    }
+
+    for( auto it = groupStart; it != groupEnd; ++it )
+      writeEntry( out, **it, false );
+
+    // opcode counters expand into a second metric
+    if( first.type == Type::OpcodeCounters )
+    {
+      writeHeader( out, first.name + "_bytes_total", first.help, "counter" );
+      for( auto it = groupStart; it != groupEnd; ++it )
+        writeEntry( out, **it, true );
+    }
+
+    groupStart = groupEnd;
+  }
+
+  return out;
+}
@@ -0,0 +1,253 @@
+#ifndef SAPPHIRE_METRICS_H
+#define SAPPHIRE_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Common::Metrics
+{
+
+  /*! monotonically increasing value */
+  class Counter
+  {
+  public:
+    void inc( uint64_t value = 1 )
+    {
+      m_value.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    uint64_t get() const
+    {
+      return m_value.load( std::memory_order_relaxed );
+    }
+
+  private:
+    std::atomic< uint64_t > m_value{ 0 };
+  };
+
+  /*! value that goes up and down */
+  class Gauge
+  {
+  public:
+    void set( int64_t value )
+    {
+      m_value.store( value, std::memory_order_relaxed );
+    }
+
+    void add( int64_t value = 1 )
+    {
+      m_value.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    void sub( int64_t value = 1 )
+    {
+      m_value.fetch_sub( value, std::memory_order_relaxed );
+    }
+
+    int64_t get() const
+    {
+      return m_value.load( std::memory_order_relaxed );
+    }
+
+  private:
+    std::atomic< int64_t > m_value{ 0 };
+  };
+
+  /*!
+   * @brief Log-linear histogram in the style of HdrHistogram
+   *
+   * Every power of two is split into 8 linear sub buckets, which keeps the error of a quantile below 12.5%
+   * over the full uint64 range with a fixed set of 496 buckets. Recording is a couple of relaxed atomic adds.
+   */
+  class Histogram
+  {
+  public:
+    static constexpr uint32_t SubBucketBits = 3;
+    static constexpr uint32_t SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32_t BucketCount = ( 64 - SubBucketBits + 1 ) * SubBucketCount;
+
+    void record( uint64_t value )
+    {
+      m_buckets[ getBucketIndex( value ) ].fetch_add( 1, std::memory_order_relaxed );
+      m_count.fetch_add( 1, std::memory_order_relaxed );
+      m_sum.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    uint64_t getCount() const;
+
+    uint64_t getSum() const;
+
+    /*! @return upper bound of the bucket holding the given quantile, 0 if nothing was recorded */
+    uint64_t getQuantile( double quantile ) const;
+
+    static uint32_t getBucketIndex( uint64_t value )
+    {
+      if( value < SubBucketCount )
+        return static_cast< uint32_t >( value );
+
+      // position of the highest set bit
+      uint32_t msb = 0;
+      for( uint32_t shift = 32; shift > 0; shift >>= 1 )
+      {
+        if( value >> ( msb + shift ) )
+          msb += shift;
+      }
+
+      auto shift = msb - SubBucketBits;
+      auto subBucket = static_cast< uint32_t >( value >> shift ) & ( SubBucketCount - 1 );
+      return ( shift + 1 ) * SubBucketCount + subBucket;
+    }
+
+    static uint64_t getBucketUpperBound( uint32_t index );
+
+  private:
+    std::array< std::atomic< uint64_t >, BucketCount > m_buckets{};
+    std::atomic< uint64_t > m_count{ 0 };
+    std::atomic< uint64_t > m_sum{ 0 };
+  };
+
+  /*!
+   * @brief Packet and byte counters for every possible opcode
+   *
+   * Every packet passes through here, so each thread counts into its own shard. A shard only has one writer and
+   * is updated with plain loads and stores instead of locked adds, which made up most of the cost of the metrics
+   * on the inbound path (see tools/metrics_overhead). Shards are tables of pages that are allocated when the
+   * first opcode of a page is seen, only opcodes that were seen are exported.
+   */
+  class OpcodeCounters
+  {
+  public:
+    struct Totals
+    {
+      uint16_t opcode;
+      uint64_t packets;
+      uint64_t bytes;
+    };
+
+    OpcodeCounters();
+
+    void add( uint16_t opcode, uint64_t bytes )
+    {
+      auto& entry = getEntry( opcode );
+      entry.packets.store( entry.packets.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+      entry.bytes.store( entry.bytes.load( std::memory_order_relaxed ) + bytes, std::memory_order_relaxed );
+    }
+
+    /*! sums the shards of all threads, ordered by opcode */
+    std::vector< Totals > collect() const;
+
+  private:
+    static constexpr uint32_t PageBits = 8;
+    static constexpr uint32_t PageSize = 1 << PageBits;
+    static constexpr uint32_t PageCount = 0x10000 / PageSize;
+    // thread local shard slots, every instance takes one
+    static constexpr uint32_t MaxInstances = 32;
+
+    struct Entry
+    {
+      std::atomic< uint64_t > packets{ 0 };
+      std::atomic< uint64_t > bytes{ 0 };
+    };
+
+    using Page = std::array< Entry, PageSize >;
+
+    struct Shard
+    {
+      // written by the owning thread only, read by scrapes
+      std::array< std::atomic< Page* >, PageCount > pages{};
+
+      ~Shard();
+    };
+
+    Entry& getEntry( uint16_t opcode )
+    {
+      auto pShard = t_shards[ m_instanceId ];
+      if( !pShard )
+        pShard = addShard();
+
+      auto pPage = pShard->pages[ opcode >> PageBits ].load( std::memory_order_relaxed );
+      if( !pPage )
+        pPage = addPage( *pShard, opcode >> PageBits );
+
+      return ( *pPage )[ opcode & ( PageSize - 1 ) ];
+    }
+
+    Shard* addShard();
+    Page* addPage( Shard& shard, uint32_t pageIndex );
+
+    // defined inline so the constant initialisation is visible and the hot path reads it without a tls wrapper
+    static inline thread_local std::array< Shard*, MaxInstances > t_shards{};
+
+    uint32_t m_instanceId;
+
+    mutable std::mutex m_shardMutex;
+    // shards outlive their threads, counts of finished threads are kept
+    std::vector< std::unique_ptr< Shard > > m_shards;
+  };
+
+  /*!
+   * @brief Process wide set of metrics, rendered in the prometheus text format
+   *
+   * Metrics are created once and live until the process exits, callers keep the returned reference around
+   * so the hot paths never touch the registry itself. Labels are passed preformatted, e.g. territory="128".
+   */
+  class Registry
+  {
+  public:
+    static Counter& counter( const std::string& name, const std::string& help, const std::string& labels = "" );
+
+    static Gauge& gauge( const std::string& name, const std::string& help, const std::string& labels = "" );
+
+    static Histogram& histogram( const std::string& name, const std::string& help, const std::string& labels = "" );
+
+    static OpcodeCounters& opcodeCounters( const std::string& name, const std::string& help,
+                                           const std::string& labels = "" );
+
+    /*! @return every metric in the prometheus text exposition format */
+    static std::string scrape();
+
+  private:
+    static void writeHeader( std::string& out, const std::string& name, const std::string& help,
+                             const std::string& type );
+
+    static void writeSample( std::string& out, const std::string& name, const std::string& labels, double value );
+
+    static void writeSample( std::string& out, const std::string& name, const std::string& labels, uint64_t value );
+
+    enum class Type
+    {
+      Counter,
+      Gauge,
+      Histogram,
+      OpcodeCounters
+    };
+
+    struct Entry
+    {
+      std::string name;
+      std::string help;
+      std::string labels;
+      Type type;
+      std::unique_ptr< Counter > pCounter;
+      std::unique_ptr< Gauge > pGauge;
+      std::unique_ptr< Histogram > pHistogram;
+      std::unique_ptr< OpcodeCounters > pOpcodeCounters;
+    };
+
+    static Entry& getEntry( const std::string& name, const std::string& help, const std::string& labels, Type type );
+
+    /*! @param bytes writes the byte instead of the packet counts of opcode counters */
+    static void writeEntry( std::string& out, const Entry& entry, bool bytes );
+
+    inline static std::mutex s_mutex;
+    inline static std::vector< std::unique_ptr< Entry > > s_entries;
+  };
+
+}
+
+#endif //SAPPHIRE_METRICS_H
@@ -0,0 +1,58 @@
+#include "MetricsConnection.h"
+#include "Metrics.h"
+
+#include <Network/Acceptor.h>
+
+#include <spdlog/fmt/fmt.h>
+
+Sapphire::Network::MetricsConnection::MetricsConnection( HivePtr pHive, AcceptorPtr pAcceptor ) :
+  Connection( pHive ),
+  m_pAcceptor( pAcceptor ),
+  m_hasResponded( false )
+{
+}
+
+void Sapphire::Network::MetricsConnection::onAccept( const std::string& host, uint16_t port )
+{
+  auto connection = std::make_shared< MetricsConnection >( m_hive, m_pAcceptor );
+  m_pAcceptor->accept( connection );
+}
+
+void Sapphire::Network::MetricsConnection::onRecv( std::vector< uint8_t >& buffer )
+{
+  if( m_hasResponded )
+    return;
+
+  m_request.append( buffer.begin(), buffer.end() );
+
+  // only the request line matters, wait until the headers are complete so the client is done sending
+  if( m_request.find( "\r\n\r\n" ) == std::string::npos )
+  {
+    if( m_request.size() > 0x2000 )
+      disconnect();
+    return;
+  }
+
+  m_hasResponded = true;
+
+  if( m_request.rfind( "GET /metrics ", 0 ) == 0 || m_request.rfind( "GET / ", 0 ) == 0 )
+    sendResponse( "200 OK", Common::Metrics::Registry::scrape() );
+  else
+    sendResponse( "404 Not Found", "" );
+}
+
+void Sapphire::Network::MetricsConnection::onSend( const std::vector< uint8_t >& buffer )
+{
+  disconnect();
+}
+
+void Sapphire::Network::MetricsConnection::sendResponse( const std::string& status, const std::string& body )
+{
+  auto response = fmt::format( "HTTP/1.1 {0}\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Content-Length: {1}\r\n"
+                               "Connection: close\r\n\r\n", status, body.size() );
+  response += body;
+
+  send( std::vector< uint8_t >( response.begin(), response.end() ) );
+}
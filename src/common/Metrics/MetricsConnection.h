@@ -0,0 +1,38 @@
+#ifndef SAPPHIRE_METRICSCONNECTION_H
+#define SAPPHIRE_METRICSCONNECTION_H
+
+#include <Network/Connection.h>
+
+#include <string>
+
+namespace Sapphire::Network
+{
+
+  /*!
+   * @brief Minimal http responder serving the metrics registry
+   *
+   * Answers GET /metrics with the prometheus text format and closes the connection afterwards,
+   * meant to be bound to localhost and scraped by a local prometheus or curl.
+   */
+  class MetricsConnection : public Connection
+  {
+  public:
+    MetricsConnection( HivePtr pHive, AcceptorPtr pAcceptor );
+
+  private:
+    void onAccept( const std::string& host, uint16_t port ) override;
+
+    void onRecv( std::vector< uint8_t >& buffer ) override;
+
+    void onSend( const std::vector< uint8_t >& buffer ) override;
+
+    void sendResponse( const std::string& status, const std::string& body );
+
+    AcceptorPtr m_pAcceptor;
+    std::string m_request;
+    bool m_hasResponded;
+  };
+
+}
+
+#endif //SAPPHIRE_METRICSCONNECTION_H
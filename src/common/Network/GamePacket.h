@@ -101,6 +101,12 @@ namespace Sapphire::Network::Packets
       return {};
     }
 
+    /** @return the ipc opcode for ipc segments, 0 otherwise */
+    virtual uint16_t getIpcOpcode() const
+    {
+      return 0;
+    }
+
   protected:
     /** The segment header */
     FFXIVARR_PACKET_SEGMENT_HEADER m_segHdr;
@@ -236,6 +242,11 @@ namespace Sapphire::Network::Packets
       return static_cast< T1 >( m_data._ServerIpcType );
     };
 
+    uint16_t getIpcOpcode() const override
+    {
+      return static_cast< uint16_t >( m_ipcHdr.type );
+    }
+
     /** Gets a reference to the underlying IPC data structure. */
     T& data()
     {
@@ -310,6 +321,14 @@ namespace Sapphire::Network::Packets
       return data;
     }
 
+    uint16_t getIpcOpcode() const override
+    {
+      if( m_segHdr.type != SEGMENTTYPE_IPC || m_data.size() < 4 )
+        return 0;
+
+      return *reinterpret_cast< const uint16_t* >( &m_data[ 2 ] );
+    }
+
     /** Gets a reference to the underlying IPC data structure. */
     std::vector< uint8_t >& data()
     {
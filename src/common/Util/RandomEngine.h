@@ -0,0 +1,97 @@
+#ifndef SAPPHIRE_RANDOMENGINE_H
+#define SAPPHIRE_RANDOMENGINE_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace Sapphire::Common::Util
+{
+  /*!
+   * @brief xoshiro256** generator, small and fast enough to keep one per territory or thread
+   *
+   * Satisfies UniformRandomBitGenerator so it can be used with the std distributions.
+   * Not thread safe, every thread or territory needs its own instance.
+   */
+  class RandomEngine
+  {
+  public:
+    using result_type = uint64_t;
+
+    explicit RandomEngine( uint64_t seed = 0 )
+    {
+      this->seed( seed );
+    }
+
+    /*! expands seed into the full state, the same seed always gives the same sequence */
+    void seed( uint64_t seed )
+    {
+      for( auto& state : m_state )
+        state = splitMix64( seed );
+    }
+
+    static constexpr result_type min()
+    {
+      return 0;
+    }
+
+    static constexpr result_type max()
+    {
+      return std::numeric_limits< result_type >::max();
+    }
+
+    result_type operator()()
+    {
+      const auto result = rotl( m_state[ 1 ] * 5, 7 ) * 9;
+      const auto t = m_state[ 1 ] << 17;
+
+      m_state[ 2 ] ^= m_state[ 0 ];
+      m_state[ 3 ] ^= m_state[ 1 ];
+      m_state[ 1 ] ^= m_state[ 2 ];
+      m_state[ 0 ] ^= m_state[ 3 ];
+
+      m_state[ 2 ] ^= t;
+      m_state[ 3 ] = rotl( m_state[ 3 ], 45 );
+
+      return result;
+    }
+
+    /*! @return a value in [ 0, bound ) */
+    uint32_t nextUInt( uint32_t bound )
+    {
+      // multiply and shift instead of a modulo, the bias is negligible for the bounds we use
+      return static_cast< uint32_t >( ( ( ( *this )() >> 32 ) * bound ) >> 32 );
+    }
+
+    /*! @return a value in [ 0, 1 ) */
+    float nextFloat()
+    {
+      return static_cast< float >( ( *this )() >> 40 ) * ( 1.f / 16777216.f );
+    }
+
+    /*! @return a value in [ minRange, maxRange ) */
+    float nextFloat( float minRange, float maxRange )
+    {
+      return minRange + nextFloat() * ( maxRange - minRange );
+    }
+
+    /*! advances state and returns the next value of the splitmix64 sequence, used to derive seeds */
+    static uint64_t splitMix64( uint64_t& state )
+    {
+      auto z = ( state += 0x9E3779B97F4A7C15 );
+      z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9;
+      z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EB;
+      return z ^ ( z >> 31 );
+    }
+
+  private:
+    static uint64_t rotl( uint64_t x, int k )
+    {
+      return ( x << k ) | ( x >> ( 64 - k ) );
+    }
+
+    std::array< uint64_t, 4 > m_state;
+  };
+}
+
+#endif // SAPPHIRE_RANDOMENGINE_H
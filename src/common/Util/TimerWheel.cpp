@@ -0,0 +1,241 @@
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+using namespace Sapphire::Common;
+
+Util::TimerWheel::TimerWheel( uint32_t resolutionMs, uint64_t startTimeMs ) :
+  m_firingHead( InvalidNode ),
+  m_resolutionMs( std::max< uint32_t >( resolutionMs, 1 ) ),
+  m_currentTimeMs( startTimeMs ),
+  m_timerCount( 0 )
+{
+  m_currentTick = startTimeMs / m_resolutionMs;
+  m_slots.fill( InvalidNode );
+}
+
+Util::TimerWheel::TimerId Util::TimerWheel::scheduleAt( uint64_t timeMs, Callback callback )
+{
+  auto nodeIdx = allocNode();
+  auto& node = m_nodes[ nodeIdx ];
+
+  // round up, a timer may fire up to one slot late but never early
+  node.expiryTick = ( timeMs + m_resolutionMs - 1 ) / m_resolutionMs;
+  // the slot of the current tick has already been run
+  node.expiryTick = std::max( node.expiryTick, m_currentTick + 1 );
+  node.callback = std::move( callback );
+
+  insert( nodeIdx );
+  ++m_timerCount;
+
+  return ( static_cast< uint64_t >( node.generation ) << 32 ) | ( nodeIdx + 1 );
+}
+
+Util::TimerWheel::TimerId Util::TimerWheel::schedule( uint64_t delayMs, Callback callback )
+{
+  return scheduleAt( m_currentTimeMs + delayMs, std::move( callback ) );
+}
+
+bool Util::TimerWheel::cancel( TimerId id )
+{
+  if( !isScheduled( id ) )
+    return false;
+
+  auto nodeIdx = static_cast< uint32_t >( id & 0xFFFFFFFF ) - 1;
+  unlink( nodeIdx );
+  freeNode( nodeIdx );
+
+  return true;
+}
+
+bool Util::TimerWheel::isScheduled( TimerId id ) const
+{
+  if( id == InvalidTimerId )
+    return false;
+
+  auto nodeIdx = static_cast< uint32_t >( id & 0xFFFFFFFF ) - 1;
+  auto generation = static_cast< uint32_t >( id >> 32 );
+
+  if( nodeIdx >= m_nodes.size() )
+    return false;
+
+  auto& node = m_nodes[ nodeIdx ];
+  return node.generation == generation && node.slot != FreeSlot;
+}
+
+void Util::TimerWheel::advance( uint64_t timeMs )
+{
+  if( timeMs <= m_currentTimeMs )
+    return;
+
+  m_currentTimeMs = timeMs;
+  auto targetTick = timeMs / m_resolutionMs;
+
+  // nothing to walk over, just move the clock
+  if( m_timerCount == 0 )
+  {
+    m_currentTick = std::max( m_currentTick, targetTick );
+    return;
+  }
+
+  while( m_currentTick < targetTick )
+  {
+    ++m_currentTick;
+
+    // the inner wheel wrapped around, pull the timers of the next slot of the outer wheels in
+    if( ( m_currentTick & SlotMask ) == 0 )
+      cascade( 1 );
+
+    runSlot( m_currentTick & SlotMask );
+  }
+}
+
+uint64_t Util::TimerWheel::getTimeMs() const
+{
+  return m_currentTimeMs;
+}
+
+std::size_t Util::TimerWheel::size() const
+{
+  return m_timerCount;
+}
+
+uint32_t Util::TimerWheel::allocNode()
+{
+  if( !m_freeNodes.empty() )
+  {
+    auto nodeIdx = m_freeNodes.back();
+    m_freeNodes.pop_back();
+    return nodeIdx;
+  }
+
+  TimerNode node{};
+  node.prev = InvalidNode;
+  node.next = InvalidNode;
+  node.slot = FreeSlot;
+  node.generation = 1;
+
+  m_nodes.push_back( std::move( node ) );
+
+  return static_cast< uint32_t >( m_nodes.size() - 1 );
+}
+
+void Util::TimerWheel::freeNode( uint32_t nodeIdx )
+{
+  auto& node = m_nodes[ nodeIdx ];
+
+  node.callback = nullptr;
+  node.slot = FreeSlot;
+
+  // invalidates every id handed out for this node so far
+  if( ++node.generation == 0 )
+    node.generation = 1;
+
+  m_freeNodes.push_back( nodeIdx );
+  --m_timerCount;
+}
+
+uint32_t& Util::TimerWheel::slotHead( uint32_t slot )
+{
+  return slot == FiringSlot ? m_firingHead : m_slots[ slot ];
+}
+
+void Util::TimerWheel::link( uint32_t nodeIdx, uint32_t slot )
+{
+  auto& head = slotHead( slot );
+  auto& node = m_nodes[ nodeIdx ];
+
+  node.slot = slot;
+  node.prev = InvalidNode;
+  node.next = head;
+
+  if( head != InvalidNode )
+    m_nodes[ head ].prev = nodeIdx;
+
+  head = nodeIdx;
+}
+
+void Util::TimerWheel::unlink( uint32_t nodeIdx )
+{
+  auto& node = m_nodes[ nodeIdx ];
+
+  if( node.prev != InvalidNode )
+    m_nodes[ node.prev ].next = node.next;
+  else
+    slotHead( node.slot ) = node.next;
+
+  if( node.next != InvalidNode )
+    m_nodes[ node.next ].prev = node.prev;
+
+  node.prev = InvalidNode;
+  node.next = InvalidNode;
+}
+
+void Util::TimerWheel::insert( uint32_t nodeIdx )
+{
+  auto expiry = m_nodes[ nodeIdx ].expiryTick;
+  auto delta = expiry - m_currentTick;
+
+  for( uint32_t wheel = 0; wheel < WheelCount; ++wheel )
+  {
+    auto shift = wheel * SlotBits;
+    if( delta < ( static_cast< uint64_t >( SlotCount ) << shift ) || wheel == WheelCount - 1 )
+    {
+      // timers beyond the range of the outermost wheel wait in its last slot and get re-inserted from there
+      if( wheel == WheelCount - 1 && delta >= ( static_cast< uint64_t >( SlotCount ) << shift ) )
+        expiry = m_currentTick + ( static_cast< uint64_t >( SlotCount ) << shift ) - 1;
+
+      link( nodeIdx, wheel * SlotCount + ( ( expiry >> shift ) & SlotMask ) );
+      return;
+    }
+  }
+}
+
+void Util::TimerWheel::cascade( uint32_t wheel )
+{
+  if( wheel >= WheelCount )
+    return;
+
+  auto index = ( m_currentTick >> ( wheel * SlotBits ) ) & SlotMask;
+
+  // this wheel wrapped as well, the next outer one has to be pulled in first
+  if( index == 0 )
+    cascade( wheel + 1 );
+
+  auto& head = m_slots[ wheel * SlotCount + index ];
+  auto nodeIdx = head;
+  head = InvalidNode;
+
+  while( nodeIdx != InvalidNode )
+  {
+    auto next = m_nodes[ nodeIdx ].next;
+    insert( nodeIdx );
+    nodeIdx = next;
+  }
+}
+
+void Util::TimerWheel::runSlot( uint32_t slot )
+{
+  auto& head = m_slots[ slot ];
+  if( head == InvalidNode )
+    return;
+
+  // detach the slot first, callbacks may schedule new timers or cancel the ones that are about to fire
+  m_firingHead = head;
+  head = InvalidNode;
+
+  for( auto nodeIdx = m_firingHead; nodeIdx != InvalidNode; nodeIdx = m_nodes[ nodeIdx ].next )
+    m_nodes[ nodeIdx ].slot = FiringSlot;
+
+  while( m_firingHead != InvalidNode )
+  {
+    auto nodeIdx = m_firingHead;
+    unlink( nodeIdx );
+
+    auto callback = std::move( m_nodes[ nodeIdx ].callback );
+    freeNode( nodeIdx );
+
+    if( callback )
+      callback();
+  }
+}
@@ -0,0 +1,101 @@
+#ifndef SAPPHIRE_TIMERWHEEL_H
+#define SAPPHIRE_TIMERWHEEL_H
+
+#include <stdint.h>
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace Sapphire::Common::Util
+{
+
+  /*!
+   * @brief Hierarchical timer wheel for scheduling callbacks against a millisecond clock.
+   *
+   * Timers are kept in intrusive lists hanging off the slots of 4 wheels with 64 slots each,
+   * scheduling and cancelling a timer are O(1). Timers further out than the outermost wheel
+   * are cascaded down to the finer wheels as time advances.
+   * Not thread safe, every wheel is meant to be owned and advanced by a single territory.
+   */
+  class TimerWheel
+  {
+  public:
+    using TimerId = uint64_t;
+    using Callback = std::function< void() >;
+
+    static constexpr TimerId InvalidTimerId = 0;
+
+    /*!
+     * @param resolutionMs length of a single slot of the innermost wheel
+     * @param startTimeMs current time of the clock the wheel is advanced with
+     */
+    explicit TimerWheel( uint32_t resolutionMs = 10, uint64_t startTimeMs = 0 );
+
+    ~TimerWheel() = default;
+
+    /*! schedules a callback to run once the wheel has been advanced past timeMs */
+    TimerId scheduleAt( uint64_t timeMs, Callback callback );
+
+    /*! schedules a callback to run delayMs after the time the wheel was last advanced to */
+    TimerId schedule( uint64_t delayMs, Callback callback );
+
+    /*! @return false if the timer has already fired or was cancelled before */
+    bool cancel( TimerId id );
+
+    bool isScheduled( TimerId id ) const;
+
+    /*! runs every timer that expired up until timeMs */
+    void advance( uint64_t timeMs );
+
+    uint64_t getTimeMs() const;
+
+    std::size_t size() const;
+
+  private:
+    static constexpr uint32_t SlotBits = 6;
+    static constexpr uint32_t SlotCount = 1 << SlotBits;
+    static constexpr uint32_t SlotMask = SlotCount - 1;
+    static constexpr uint32_t WheelCount = 4;
+
+    static constexpr uint32_t InvalidNode = UINT32_MAX;
+    // slot marker of timers detached from the wheels because they are about to fire
+    static constexpr uint32_t FiringSlot = WheelCount * SlotCount;
+    static constexpr uint32_t FreeSlot = FiringSlot + 1;
+
+    struct TimerNode
+    {
+      Callback callback;
+      uint64_t expiryTick;
+      uint32_t prev;
+      uint32_t next;
+      uint32_t slot;
+      uint32_t generation;
+    };
+
+    uint32_t allocNode();
+    void freeNode( uint32_t nodeIdx );
+
+    void link( uint32_t nodeIdx, uint32_t slot );
+    void unlink( uint32_t nodeIdx );
+
+    void insert( uint32_t nodeIdx );
+    void cascade( uint32_t wheel );
+    void runSlot( uint32_t slot );
+
+    uint32_t& slotHead( uint32_t slot );
+
+    std::vector< TimerNode > m_nodes;
+    std::vector< uint32_t > m_freeNodes;
+
+    std::array< uint32_t, WheelCount * SlotCount > m_slots;
+    uint32_t m_firingHead;
+
+    uint32_t m_resolutionMs;
+    uint64_t m_currentTick;
+    uint64_t m_currentTimeMs;
+    std::size_t m_timerCount;
+  };
+
+}
+
+#endif //SAPPHIRE_TIMERWHEEL_H
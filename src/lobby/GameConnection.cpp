@@ -10,6 +10,7 @@
 #include <Crypt/md5.h>
 #include <Crypt/blowfish.h>
 #include <Config/ConfigMgr.h>
+#include <Metrics/Metrics.h>
 
 #include "ServerLobby.h"
 #include "RestConnector.h"
@@ -41,6 +42,10 @@ Lobby::GameConnection::~GameConnection()
 // overwrite the parents onConnect for our game socket needs
 void Lobby::GameConnection::onAccept( const std::string& host, uint16_t port )
 {
+  static auto& connections = Common::Metrics::Registry::counter( "sapphire_lobby_connections_total",
+                                                                 "Accepted lobby connections" );
+  connections.inc();
+
   auto connection = make_GameConnection( m_hive, m_pAcceptor );
   m_pAcceptor->accept( connection );
 
@@ -387,6 +392,10 @@ void Lobby::GameConnection::handleGamePacket( Network::Packets::FFXIVARR_PACKET_
 
   uint32_t tmpId = packet.segHdr.target_actor;
 
+  static auto& inTraffic = Common::Metrics::Registry::opcodeCounters( "sapphire_lobby_in",
+                                                                      "Inbound ipc traffic by opcode" );
+  inTraffic.add( *reinterpret_cast< uint16_t* >( &packet.data[ 2 ] ), packet.segHdr.size );
+
   Logger::info( "OpCode [{0}]", *reinterpret_cast< uint16_t* >( &packet.data[ 2 ] ) );
   
   switch( *reinterpret_cast< uint16_t* >( &packet.data[ 2 ] ) )
@@ -3,7 +3,9 @@
 #include "ServerLobby.h"
 #include <Logging/Logger.h>
 #include <Crypt/base64.h>
+#include <Metrics/Metrics.h>
 #include <time.h>
+#include <chrono>
 #include <iomanip>
 
 #include <nlohmann/json.hpp>
@@ -28,6 +30,13 @@ HttpResponse Lobby::RestConnector::requestApi( std::string endpoint, std::string
 
   std::string reqstr = "/sapphire-api/lobby/" + endpoint;
 
+  static auto& requestTime = Common::Metrics::Registry::histogram( "sapphire_lobby_api_request_us",
+                                                                  "Round trip time of api requests in microseconds" );
+  static auto& failedRequests = Common::Metrics::Registry::counter( "sapphire_lobby_api_failed_requests_total",
+                                                                    "Api requests that didn't reach the api" );
+
+  auto start = std::chrono::steady_clock::now();
+
   HttpResponse r;
   try
   {
@@ -35,9 +44,13 @@ HttpResponse Lobby::RestConnector::requestApi( std::string endpoint, std::string
   }
   catch( std::exception& e )
   {
+    failedRequests.inc();
     Logger::error( "{0} failed, Api is not reachable: {1}", endpoint, e.what() );
     return nullptr;
   }
+
+  requestTime.record( static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+    std::chrono::steady_clock::now() - start ).count() ) );
   return r;
 }
 
@@ -5,6 +5,7 @@
 
 #include <Network/Hive.h>
 #include <Network/Acceptor.h>
+#include <Metrics/MetricsConnection.h>
 
 #include <Version.h>
 #include <Logging/Logger.h>
@@ -69,6 +70,12 @@ namespace Sapphire::Lobby
 
     Logger::info( "Lobby server running on {0}:{1}", m_ip, m_port );
 
+    if( m_config.network.metricsPort != 0 )
+    {
+      Network::addServerToHive< Network::MetricsConnection >( "127.0.0.1", m_config.network.metricsPort, hive );
+      Logger::info( "Metrics available at http://127.0.0.1:{0}/metrics", m_config.network.metricsPort );
+    }
+
     std::vector< std::thread > threadGroup;
 
     threadGroup.emplace_back( std::bind( &Sapphire::Network::Hive::run, hive.get() ) );
@@ -109,6 +116,7 @@ namespace Sapphire::Lobby
 
     m_config.network.listenIp = m_pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
     m_config.network.listenPort = m_pConfig->getValue< uint16_t >( "Network", "ListenPort", 54994 );
+    m_config.network.metricsPort = m_pConfig->getValue< uint16_t >( "Network", "MetricsPort", 54996 );
 
     std::vector< std::string > args( argv + 1, argv + argc );
     for( size_t i = 0; i + 1 < args.size(); i += 2 )
@@ -39,6 +39,7 @@ struct ActionEntry
   uint32_t rearPotency;
   uint32_t curePotency;
   uint32_t restorePercentage;
+  std::shared_ptr< Sapphire::Data::Action > sheet;
 };
 
 bool invalidChar( char c )
@@ -75,7 +76,7 @@ int main( int argc, char* argv[] )
   Logger::init( "action_parse" );
 
   if( !fs::exists( "ActionLutData.cpp.tmpl" ) )
-    throw std::runtime_error( "ActionLut.cpp.tmpl is missing in working directory" );
+    throw std::runtime_error( "ActionLutData.cpp.tmpl is missing in working directory" );
 
   if( argc == 2 )
   {
@@ -131,6 +132,7 @@ int main( int argc, char* argv[] )
 
       entry.name = action->name;
       entry.id = id;
+      entry.sheet = action;
 
       Logger::info( "  {0} - {1}", id, action->name );
       std::string desc = actionTransient->description;
@@ -254,11 +256,18 @@ int main( int argc, char* argv[] )
 //                  action.first, data.name, data.potency, data.flankPotency, data.frontPotency, data.rearPotency,
 //                  data.curePotency, data.restorePercentage );
 
-    auto out = fmt::format( "  // {}\n  {{ {}, {{ {}, {}, {}, {}, {}, {}, {} }} }},\n",
+    const auto& sheet = *data.sheet;
+    auto out = fmt::format( "  // {}\n  {{ {}, {{ {}, {}, {}, {}, {}, {}, {} }}, true,\n"
+                            "    {{ {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {} }} }},\n",
                             data.name, action.first,
                             data.potency, data.comboPotency,
                             data.flankPotency, data.frontPotency, data.rearPotency,
-                            data.curePotency, 0 );
+                            data.curePotency, 0,
+                            sheet.cast100ms, sheet.recast100ms, sheet.cooldownGroup, sheet.range, sheet.effectRange,
+                            sheet.xAxisModifier, sheet.castType, sheet.aspect, sheet.primaryCostType,
+                            sheet.primaryCostValue, sheet.classJob, sheet.classJobLevel, sheet.isRoleAction,
+                            sheet.actionCombo, sheet.preservesCombo, sheet.canTargetSelf, sheet.canTargetParty,
+                            sheet.canTargetFriendly, sheet.canTargetHostile, sheet.canTargetDead, sheet.targetArea );
 
     output += out;
 //    Logger::info( out );
@@ -269,7 +278,11 @@ int main( int argc, char* argv[] )
   std::string actionTmpl( ( std::istreambuf_iterator< char >( ifs ) ),
                             std::istreambuf_iterator< char >() );
 
+  // the index covers every id up to the highest one in the table
+  auto indexSize = actions.empty() ? 1 : actions.rbegin()->first + 1;
+
   auto result = std::regex_replace( actionTmpl, std::regex( "%INSERT_GARBAGE%" ), output );
+  result = std::regex_replace( result, std::regex( "%INDEX_SIZE%" ), std::to_string( indexSize ) );
 
   std::ofstream outH( "ActionLutData.cpp" );
   outH << result;
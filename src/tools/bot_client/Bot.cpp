@@ -0,0 +1,314 @@
+#include <Network/GamePacket.h>
+#include <Network/PacketDef/Zone/ClientZoneDef.h>
+#include <Network/PacketDef/Zone/ServerZoneDef.h>
+#include <Logging/Logger.h>
+#include <Util/Util.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "Bot.h"
+
+using namespace Sapphire::Network::Packets;
+
+Sapphire::Tool::Bot::Bot( uint32_t characterId, const BotConfig& config, BotStats& stats, bool queriesServerInfo ) :
+  m_characterId( characterId ),
+  m_config( config ),
+  m_stats( stats ),
+  m_queriesServerInfo( queriesServerInfo ),
+  m_state( State::Idle ),
+  m_connectTime( 0 ),
+  m_zoneRequestTime( 0 ),
+  m_hasLoggedIn( false ),
+  m_center{ 0.f, 0.f, 0.f },
+  m_pathAngle( 0.f ),
+  m_lastMoveTime( 0 ),
+  m_nextPingTime( 0 ),
+  m_nextChatTime( 0 ),
+  m_nextActionTime( 0 ),
+  m_nextTeleTime( 0 ),
+  m_nextServerInfoTime( 0 ),
+  m_actionRequestTime( 0 ),
+  m_actionSequence( 0 ),
+  m_teleIndex( 0 )
+{
+}
+
+void Sapphire::Tool::Bot::start( Network::HivePtr pHive )
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  m_connectTime = Common::Util::getTimeMs();
+  m_state = State::Connecting;
+
+  m_pZoneCon = std::make_shared< BotConnection >( pHive, *this, BotConnectionType::Zone );
+  m_pChatCon = std::make_shared< BotConnection >( pHive, *this, BotConnectionType::Chat );
+
+  m_pZoneCon->connect( m_config.host, m_config.port );
+}
+
+void Sapphire::Tool::Bot::stop()
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  if( m_pZoneCon )
+    m_pZoneCon->disconnect();
+  if( m_pChatCon )
+    m_pChatCon->disconnect();
+}
+
+void Sapphire::Tool::Bot::update( uint64_t tickCount )
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  if( m_state != State::InWorld )
+    return;
+
+  if( tickCount - m_lastMoveTime >= m_config.moveIntervalMs )
+    sendPosition( tickCount );
+
+  if( tickCount >= m_nextPingTime )
+  {
+    m_nextPingTime = tickCount + m_config.pingIntervalMs;
+
+    auto pPing = std::make_shared< ZoneChannelPacket< Client::FFXIVIpcPingHandler > >( m_characterId );
+    pPing->data().timestamp = static_cast< uint32_t >( tickCount );
+    sendZone( pPing );
+  }
+
+  if( tickCount >= m_nextChatTime )
+  {
+    m_nextChatTime = tickCount + m_config.chatIntervalMs;
+    sendChat( Common::ChatType::Say, "bot " + std::to_string( m_characterId ) + " at " + std::to_string( tickCount ) );
+  }
+
+  if( tickCount >= m_nextActionTime )
+  {
+    m_nextActionTime = tickCount + m_config.actionIntervalMs;
+
+    auto pAction = std::make_shared< ZoneChannelPacket< Client::FFXIVIpcSkillHandler > >( m_characterId );
+    pAction->data().type = 1;
+    pAction->data().actionId = m_config.actionId;
+    pAction->data().sequence = ++m_actionSequence;
+    pAction->data().targetId = m_characterId;
+    sendZone( pAction );
+
+    m_actionRequestTime = tickCount;
+  }
+
+  if( !m_config.teleAetherytes.empty() && tickCount >= m_nextTeleTime )
+  {
+    m_nextTeleTime = tickCount + m_config.teleIntervalMs;
+
+    auto aetheryteId = m_config.teleAetherytes[ m_teleIndex++ % m_config.teleAetherytes.size() ];
+    sendChat( Common::ChatType::Say, "!set tele " + std::to_string( aetheryteId ) );
+
+    m_zoneRequestTime = tickCount;
+  }
+
+  if( m_queriesServerInfo && tickCount >= m_nextServerInfoTime )
+  {
+    m_nextServerInfoTime = tickCount + m_config.serverInfoIntervalMs;
+    sendChat( Common::ChatType::Say, "!info" );
+  }
+}
+
+uint32_t Sapphire::Tool::Bot::getCharacterId() const
+{
+  return m_characterId;
+}
+
+Sapphire::Tool::Bot::State Sapphire::Tool::Bot::getState() const
+{
+  return m_state;
+}
+
+void Sapphire::Tool::Bot::onConnected( BotConnection& connection )
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  connection.sendSessionInit( m_characterId );
+
+  // the zone connection creates the session, the chat connection attaches to it afterwards
+  if( connection.getType() == BotConnectionType::Zone )
+    m_pChatCon->connect( m_config.host, m_config.port );
+}
+
+void Sapphire::Tool::Bot::onDisconnected( BotConnection& connection )
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  if( m_state.exchange( State::Disconnected ) == State::Disconnected )
+    return;
+
+  if( m_hasLoggedIn )
+    --m_stats.inWorld;
+  ++m_stats.disconnects;
+
+  Logger::warn( "[{0}] Disconnected", m_characterId );
+}
+
+void Sapphire::Tool::Bot::onPacket( BotConnection& connection, const FFXIVARR_PACKET_RAW& packet )
+{
+  ++m_stats.packetsReceived;
+
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  if( connection.getType() != BotConnectionType::Zone )
+    return;
+
+  switch( packet.segHdr.type )
+  {
+    // the session was bound to the zone connection
+    case 0x02:
+    {
+      if( m_state != State::Connecting )
+        break;
+
+      m_state = State::Initializing;
+      sendZone( makeRawIpc( ClientZoneIpcType::InitHandler, 0x18 ) );
+      break;
+    }
+
+    case SEGMENTTYPE_IPC:
+    {
+      onZonePacket( packet );
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void Sapphire::Tool::Bot::onZonePacket( const FFXIVARR_PACKET_RAW& packet )
+{
+  if( packet.data.size() < sizeof( FFXIVARR_IPC_HEADER ) )
+    return;
+
+  auto opcode = *reinterpret_cast< const uint16_t* >( &packet.data[ 0x02 ] );
+  auto tickCount = Common::Util::getTimeMs();
+
+  switch( opcode )
+  {
+    case ServerZoneIpcType::InitZone:
+    {
+      const auto initZone = ZoneChannelPacket< Server::FFXIVIpcInitZone >( packet );
+      m_center = initZone.data().pos;
+      m_pathAngle = 0.f;
+
+      if( !m_hasLoggedIn )
+        m_stats.login.add( tickCount - m_connectTime );
+      else if( m_zoneRequestTime != 0 )
+        m_stats.zoning.add( tickCount - m_zoneRequestTime );
+
+      m_zoneRequestTime = 0;
+      m_state = State::Loading;
+
+      sendZone( makeRawIpc( ClientZoneIpcType::FinishLoadingHandler, 0x18 ) );
+
+      if( !m_hasLoggedIn )
+      {
+        m_hasLoggedIn = true;
+        ++m_stats.inWorld;
+      }
+
+      m_state = State::InWorld;
+      m_lastMoveTime = tickCount;
+      break;
+    }
+
+    case ServerZoneIpcType::Ping:
+    {
+      const auto ping = ZoneChannelPacket< Server::FFXIVIpcPing >( packet );
+
+      // the server echoes the timestamp of the request in the lower half
+      auto sentTime = static_cast< uint32_t >( ping.data().timeInMilliseconds & 0xFFFFFFFF );
+      m_stats.ping.add( static_cast< uint32_t >( tickCount ) - sentTime );
+      break;
+    }
+
+    case ServerZoneIpcType::Effect:
+    {
+      if( m_actionRequestTime != 0 && packet.segHdr.source_actor == m_characterId )
+      {
+        m_stats.action.add( tickCount - m_actionRequestTime );
+        m_actionRequestTime = 0;
+      }
+      break;
+    }
+
+    case ServerZoneIpcType::Chat:
+    {
+      if( !m_queriesServerInfo )
+        break;
+
+      const auto chat = ZoneChannelPacket< Server::FFXIVIpcChat >( packet );
+      if( chat.data().chatType != Common::ChatType::ServerDebug )
+        break;
+
+      std::string message( chat.data().msg, strnlen( chat.data().msg, sizeof( chat.data().msg ) ) );
+      if( message.rfind( "Main loop", 0 ) == 0 )
+      {
+        std::lock_guard< std::mutex > lock( m_stats.serverInfoMutex );
+        m_stats.serverTickInfo = message;
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+Sapphire::Network::Packets::FFXIVPacketBasePtr Sapphire::Tool::Bot::makeRawIpc( uint16_t opcode, std::size_t bodySize ) const
+{
+  auto size = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) + sizeof( FFXIVARR_IPC_HEADER ) + bodySize;
+  auto pPacket = std::make_shared< FFXIVRawPacket >( SEGMENTTYPE_IPC, static_cast< uint32_t >( size ),
+                                                     m_characterId, m_characterId );
+
+  FFXIVARR_IPC_HEADER ipcHeader{};
+  ipcHeader.reserved = 0x14;
+  ipcHeader.type = opcode;
+  ipcHeader.timestamp = Common::Util::getTimeSeconds();
+  std::memcpy( pPacket->data().data(), &ipcHeader, sizeof( FFXIVARR_IPC_HEADER ) );
+
+  return pPacket;
+}
+
+void Sapphire::Tool::Bot::sendZone( FFXIVPacketBasePtr pPacket )
+{
+  if( !m_pZoneCon )
+    return;
+
+  ++m_stats.packetsSent;
+  m_pZoneCon->sendPacket( pPacket );
+}
+
+void Sapphire::Tool::Bot::sendChat( Common::ChatType chatType, const std::string& message )
+{
+  auto pChat = std::make_shared< ZoneChannelPacket< Client::FFXIVIpcChatHandler > >( m_characterId );
+  pChat->data().sourceId = m_characterId;
+  pChat->data().chatType = chatType;
+  std::strncpy( pChat->data().message, message.c_str(), sizeof( pChat->data().message ) - 1 );
+  sendZone( pChat );
+}
+
+void Sapphire::Tool::Bot::sendPosition( uint64_t tickCount )
+{
+  auto elapsed = static_cast< float >( tickCount - m_lastMoveTime ) / 1000.f;
+  m_lastMoveTime = tickCount;
+
+  if( m_config.pathRadius <= 0.f )
+    return;
+
+  m_pathAngle = std::fmod( m_pathAngle + m_config.moveSpeed * elapsed / m_config.pathRadius, 6.2831853f );
+
+  auto pMove = std::make_shared< ZoneChannelPacket< Client::FFXIVIpcUpdatePosition > >( m_characterId );
+  pMove->data().position.x = m_center.x + std::cos( m_pathAngle ) * m_config.pathRadius;
+  pMove->data().position.y = m_center.y;
+  pMove->data().position.z = m_center.z + std::sin( m_pathAngle ) * m_config.pathRadius;
+  // facing along the circle
+  pMove->data().rotation = m_pathAngle + 1.5707963f;
+  sendZone( pMove );
+}
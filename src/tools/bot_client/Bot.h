@@ -0,0 +1,144 @@
+#ifndef SAPPHIRE_BOT_H
+#define SAPPHIRE_BOT_H
+
+#include <Common.h>
+#include <Network/CommonNetwork.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BotConnection.h"
+#include "LatencyStats.h"
+
+namespace Sapphire::Tool
+{
+
+  struct BotConfig
+  {
+    std::string host{ "127.0.0.1" };
+    uint16_t port{ 54992 };
+
+    uint32_t moveIntervalMs{ 100 };
+    float pathRadius{ 10.f };
+    // yalms per second
+    float moveSpeed{ 6.f };
+
+    uint32_t pingIntervalMs{ 5000 };
+    uint32_t chatIntervalMs{ 15000 };
+
+    uint32_t actionIntervalMs{ 10000 };
+    // sprint, it can be used anywhere and targets the caster
+    uint32_t actionId{ 3 };
+
+    // aetherytes the bots teleport between through the "set tele" debug command, needs gm rank
+    std::vector< uint32_t > teleAetherytes;
+    uint32_t teleIntervalMs{ 60000 };
+
+    uint32_t serverInfoIntervalMs{ 10000 };
+  };
+
+  /*! counters and latencies of every bot, read by the reporter */
+  struct BotStats
+  {
+    LatencyStats login{ "login" };
+    LatencyStats ping{ "ping" };
+    LatencyStats action{ "action" };
+    LatencyStats zoning{ "zoning" };
+
+    std::atomic< uint32_t > inWorld{ 0 };
+    std::atomic< uint32_t > disconnects{ 0 };
+    std::atomic< uint64_t > packetsSent{ 0 };
+    std::atomic< uint64_t > packetsReceived{ 0 };
+
+    std::mutex serverInfoMutex;
+    // last main loop timings the world server reported through the info debug command
+    std::string serverTickInfo;
+  };
+
+  /*!
+   * @brief One synthetic character connected to the world server
+   *
+   * Logs in through the session init of the zone and chat connections, finishes loading every zone it is put
+   * into and then walks a circle around its spawn point, chats, pings and uses an action on itself.
+   */
+  class Bot
+  {
+  public:
+    enum class State
+    {
+      Idle,
+      Connecting,
+      Initializing,
+      Loading,
+      InWorld,
+      Disconnected
+    };
+
+    Bot( uint32_t characterId, const BotConfig& config, BotStats& stats, bool queriesServerInfo );
+
+    void start( Network::HivePtr pHive );
+
+    void stop();
+
+    /*! sends whatever is due, called from the driver loop */
+    void update( uint64_t tickCount );
+
+    uint32_t getCharacterId() const;
+
+    State getState() const;
+
+    void onConnected( BotConnection& connection );
+
+    void onDisconnected( BotConnection& connection );
+
+    void onPacket( BotConnection& connection, const Network::Packets::FFXIVARR_PACKET_RAW& packet );
+
+  private:
+    void onZonePacket( const Network::Packets::FFXIVARR_PACKET_RAW& packet );
+
+    /*! ipc packets without a client structure, only the opcode and a zeroed body */
+    Network::Packets::FFXIVPacketBasePtr makeRawIpc( uint16_t opcode, std::size_t bodySize ) const;
+
+    void sendZone( Network::Packets::FFXIVPacketBasePtr pPacket );
+
+    void sendChat( Common::ChatType chatType, const std::string& message );
+
+    void sendPosition( uint64_t tickCount );
+
+    uint32_t m_characterId;
+    const BotConfig& m_config;
+    BotStats& m_stats;
+    bool m_queriesServerInfo;
+
+    mutable std::mutex m_mutex;
+    std::atomic< State > m_state;
+
+    BotConnectionPtr m_pZoneCon;
+    BotConnectionPtr m_pChatCon;
+
+    uint64_t m_connectTime;
+    uint64_t m_zoneRequestTime;
+    bool m_hasLoggedIn;
+
+    Common::FFXIVARR_POSITION3 m_center;
+    float m_pathAngle;
+    uint64_t m_lastMoveTime;
+
+    uint64_t m_nextPingTime;
+    uint64_t m_nextChatTime;
+    uint64_t m_nextActionTime;
+    uint64_t m_nextTeleTime;
+    uint64_t m_nextServerInfoTime;
+
+    uint64_t m_actionRequestTime;
+    uint16_t m_actionSequence;
+    std::size_t m_teleIndex;
+  };
+
+  using BotPtr = std::shared_ptr< Bot >;
+
+}
+
+#endif //SAPPHIRE_BOT_H
@@ -0,0 +1,125 @@
+#include <Network/GamePacketParser.h>
+#include <Network/Hive.h>
+#include <Logging/Logger.h>
+#include <Util/Util.h>
+
+#include <cstring>
+
+#include "Bot.h"
+#include "BotConnection.h"
+
+using namespace Sapphire::Network::Packets;
+
+Sapphire::Tool::BotConnection::BotConnection( Network::HivePtr pHive, Bot& bot, BotConnectionType type ) :
+  Connection( pHive ),
+  m_bot( bot ),
+  m_type( type ),
+  m_bytesReceived( 0 )
+{
+  setReceiveBufferSize( 0x10000 );
+}
+
+void Sapphire::Tool::BotConnection::sendSessionInit( uint32_t characterId )
+{
+  // the world server reads the character id as text at offset 4 of the segment
+  auto pInit = std::make_shared< FFXIVRawPacket >( SEGMENTTYPE_SESSIONINIT, 0x40 + sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ), 0, 0 );
+  auto idString = std::to_string( characterId );
+  std::memcpy( &pInit->data()[ 4 ], idString.c_str(), idString.size() );
+
+  sendPacket( pInit );
+}
+
+void Sapphire::Tool::BotConnection::sendPacket( FFXIVPacketBasePtr pPacket )
+{
+  sendPackets( { pPacket } );
+}
+
+void Sapphire::Tool::BotConnection::sendPackets( const std::vector< FFXIVPacketBasePtr >& packets )
+{
+  FFXIVARR_PACKET_HEADER header{};
+  header.timestamp = Common::Util::getTimeMs();
+  header.size = sizeof( FFXIVARR_PACKET_HEADER );
+  header.connectionType = static_cast< uint16_t >( m_type );
+  header.count = static_cast< uint16_t >( packets.size() );
+
+  for( auto& pPacket : packets )
+    header.size += static_cast< uint32_t >( pPacket->getSize() );
+
+  std::vector< uint8_t > buffer;
+  buffer.reserve( header.size );
+  buffer.insert( buffer.end(), reinterpret_cast< uint8_t* >( &header ),
+                 reinterpret_cast< uint8_t* >( &header ) + sizeof( FFXIVARR_PACKET_HEADER ) );
+
+  for( auto& pPacket : packets )
+  {
+    auto data = pPacket->getData();
+    buffer.insert( buffer.end(), data.begin(), data.end() );
+  }
+
+  send( buffer );
+}
+
+Sapphire::Tool::BotConnectionType Sapphire::Tool::BotConnection::getType() const
+{
+  return m_type;
+}
+
+uint64_t Sapphire::Tool::BotConnection::getBytesReceived() const
+{
+  return m_bytesReceived;
+}
+
+void Sapphire::Tool::BotConnection::onConnect( const std::string& host, uint16_t port )
+{
+  m_bot.onConnected( *this );
+}
+
+void Sapphire::Tool::BotConnection::onRecv( std::vector< uint8_t >& buffer )
+{
+  m_bytesReceived += buffer.size();
+  m_recvBuffer.insert( m_recvBuffer.end(), buffer.begin(), buffer.end() );
+
+  // a read can end in the middle of a frame or hold several of them
+  std::size_t offset = 0;
+  while( m_recvBuffer.size() - offset >= sizeof( FFXIVARR_PACKET_HEADER ) )
+  {
+    FFXIVARR_PACKET_HEADER header{};
+    std::memcpy( &header, &m_recvBuffer[ offset ], sizeof( FFXIVARR_PACKET_HEADER ) );
+
+    if( !checkHeader( header ) || header.size < sizeof( FFXIVARR_PACKET_HEADER ) )
+    {
+      Logger::error( "[{0}] Malformed frame from server, disconnecting", m_bot.getCharacterId() );
+      m_recvBuffer.clear();
+      disconnect();
+      return;
+    }
+
+    if( m_recvBuffer.size() - offset < header.size )
+      break;
+
+    // getPacket copies the full segment size from behind the segment header, give it room to do so
+    std::vector< uint8_t > frame( m_recvBuffer.begin() + offset, m_recvBuffer.begin() + offset + header.size );
+    frame.resize( frame.size() + sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) );
+
+    std::vector< FFXIVARR_PACKET_RAW > packets;
+    if( getPackets( frame, sizeof( FFXIVARR_PACKET_HEADER ), header, packets ) == Success )
+    {
+      for( auto& packet : packets )
+        m_bot.onPacket( *this, packet );
+    }
+
+    offset += header.size;
+  }
+
+  m_recvBuffer.erase( m_recvBuffer.begin(), m_recvBuffer.begin() + offset );
+}
+
+void Sapphire::Tool::BotConnection::onError( const asio::error_code& error )
+{
+  Logger::debug( "[{0}] Connection error: {1}", m_bot.getCharacterId(), error.message() );
+}
+
+void Sapphire::Tool::BotConnection::onDisconnect()
+{
+  m_bot.onDisconnected( *this );
+}
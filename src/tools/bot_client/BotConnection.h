@@ -0,0 +1,63 @@
+#ifndef SAPPHIRE_BOTCONNECTION_H
+#define SAPPHIRE_BOTCONNECTION_H
+
+#include <Network/Connection.h>
+#include <Network/CommonNetwork.h>
+#include <Network/GamePacket.h>
+
+#include <vector>
+
+namespace Sapphire::Tool
+{
+
+  class Bot;
+
+  enum class BotConnectionType : uint16_t
+  {
+    Zone = 1,
+    Chat = 2
+  };
+
+  /*!
+   * @brief Client side of a zone or chat connection to the world server
+   *
+   * Incoming frames are split into their segments with the GamePacketParser and handed to the owning bot,
+   * outgoing packets are framed the same way the client does.
+   */
+  class BotConnection : public Network::Connection
+  {
+  public:
+    BotConnection( Network::HivePtr pHive, Bot& bot, BotConnectionType type );
+
+    /*! sends the session init segment that binds this connection to a character */
+    void sendSessionInit( uint32_t characterId );
+
+    void sendPacket( Network::Packets::FFXIVPacketBasePtr pPacket );
+
+    void sendPackets( const std::vector< Network::Packets::FFXIVPacketBasePtr >& packets );
+
+    BotConnectionType getType() const;
+
+    uint64_t getBytesReceived() const;
+
+  private:
+    void onConnect( const std::string& host, uint16_t port ) override;
+
+    void onRecv( std::vector< uint8_t >& buffer ) override;
+
+    void onError( const asio::error_code& error ) override;
+
+    void onDisconnect() override;
+
+    Bot& m_bot;
+    BotConnectionType m_type;
+    // bytes that didn't make up a complete frame yet
+    std::vector< uint8_t > m_recvBuffer;
+    uint64_t m_bytesReceived;
+  };
+
+  using BotConnectionPtr = std::shared_ptr< BotConnection >;
+
+}
+
+#endif //SAPPHIRE_BOTCONNECTION_H
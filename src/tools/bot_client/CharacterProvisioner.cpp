@@ -0,0 +1,152 @@
+#include <Crypt/base64.h>
+#include <Logging/Logger.h>
+
+#include <iterator>
+
+#include "CharacterProvisioner.h"
+#include "client_http.hpp"
+
+using HttpClient = SimpleWeb::Client< SimpleWeb::HTTP >;
+
+namespace
+{
+  // the character creation payload of the client, a hyur gladiator with a plain look
+  std::string makeInfoJson()
+  {
+    auto look = nlohmann::json::array();
+    const uint8_t customize[ 26 ] = { 1, 0, 1, 50, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 50, 1, 1, 1 };
+    for( auto value : customize )
+      look.push_back( std::to_string( value ) );
+
+    nlohmann::json payload;
+    // voice, guardian deity, birth month, birth day, class, tribe
+    payload[ "content" ] = { look, "1", "1", "1", "1", "1", "1" };
+
+    return payload.dump();
+  }
+}
+
+Sapphire::Tool::CharacterProvisioner::CharacterProvisioner( std::string apiHost, std::string serverSecret ) :
+  m_apiHost( std::move( apiHost ) ),
+  m_serverSecret( std::move( serverSecret ) )
+{
+}
+
+std::vector< uint32_t > Sapphire::Tool::CharacterProvisioner::provision( const std::string& accountName,
+                                                                         const std::string& password, uint32_t count )
+{
+  std::vector< uint32_t > characterIds;
+
+  nlohmann::json account{ { "username", accountName }, { "pass", password } };
+  nlohmann::json session;
+
+  // the account is only created on the first run, every later one logs in
+  if( !request( "createAccount", account, session ) && !request( "login", account, session ) )
+  {
+    Logger::error( "Could not create or log into account {0} at {1}", accountName, m_apiHost );
+    return characterIds;
+  }
+
+  std::string sId = session[ "sId" ];
+
+  std::map< std::string, uint32_t > characters;
+  if( !getCharacters( sId, characters ) )
+    return characterIds;
+
+  auto infoJson = makeInfoJson();
+  auto encodedInfo = Common::Util::base64Encode( reinterpret_cast< const uint8_t* >( infoJson.data() ),
+                                                 static_cast< uint32_t >( infoJson.size() ) );
+
+  uint32_t createdCount = 0;
+  for( uint32_t i = 0; i < count; ++i )
+  {
+    auto name = getBotName( i );
+    if( characters.count( name ) )
+      continue;
+
+    nlohmann::json character{ { "sId", sId }, { "secret", m_serverSecret }, { "name", name },
+                              { "infoJson", encodedInfo } };
+    nlohmann::json result;
+
+    if( !request( "createCharacter", character, result ) || result[ "result" ] == "invalid" )
+    {
+      Logger::error( "Could not create character {0}: {1}", name, result.dump() );
+      return characterIds;
+    }
+
+    ++createdCount;
+  }
+
+  // the api answers character creation with the account id, the character ids come from the list
+  if( createdCount != 0 && !getCharacters( sId, characters ) )
+    return characterIds;
+
+  for( uint32_t i = 0; i < count; ++i )
+  {
+    auto it = characters.find( getBotName( i ) );
+    if( it == characters.end() )
+    {
+      Logger::error( "Character {0} is missing from account {1}", getBotName( i ), accountName );
+      return {};
+    }
+
+    characterIds.push_back( it->second );
+  }
+
+  Logger::info( "Provisioned {0} characters on account {1}, {2} of them created", count, accountName, createdCount );
+
+  return characterIds;
+}
+
+std::string Sapphire::Tool::CharacterProvisioner::getBotName( uint32_t index )
+{
+  std::string suffix( 4, 'a' );
+  for( auto it = suffix.rbegin(); it != suffix.rend() && index != 0; ++it, index /= 26 )
+    *it = static_cast< char >( 'a' + index % 26 );
+
+  suffix[ 0 ] = static_cast< char >( suffix[ 0 ] - 'a' + 'A' );
+
+  return "Bot " + suffix;
+}
+
+bool Sapphire::Tool::CharacterProvisioner::request( const std::string& endpoint, const nlohmann::json& data,
+                                                    nlohmann::json& result ) const
+{
+  HttpClient client( m_apiHost );
+
+  try
+  {
+    auto pResponse = client.request( "POST", "/sapphire-api/lobby/" + endpoint, data.dump() );
+    if( pResponse->status_code.find( "200" ) == std::string::npos )
+      return false;
+
+    std::string content( std::istreambuf_iterator< char >( pResponse->content ), {} );
+    result = nlohmann::json::parse( content );
+  }
+  catch( const std::exception& e )
+  {
+    Logger::error( "{0} failed: {1}", endpoint, e.what() );
+    return false;
+  }
+
+  return true;
+}
+
+bool Sapphire::Tool::CharacterProvisioner::getCharacters( const std::string& sId,
+                                                          std::map< std::string, uint32_t >& characters ) const
+{
+  nlohmann::json result;
+  if( !request( "getCharacterList", { { "sId", sId }, { "secret", m_serverSecret } }, result ) ||
+      result[ "result" ] != "success" )
+  {
+    Logger::error( "Could not list the characters: {0}", result.dump() );
+    return false;
+  }
+
+  characters.clear();
+  for( const auto& entry : result[ "charArray" ] )
+    characters[ entry[ "name" ].get< std::string >() ] =
+      static_cast< uint32_t >( std::stoul( entry[ "charId" ].get< std::string >() ) );
+
+  return true;
+}
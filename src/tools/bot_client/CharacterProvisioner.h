@@ -0,0 +1,43 @@
+#ifndef SAPPHIRE_CHARACTERPROVISIONER_H
+#define SAPPHIRE_CHARACTERPROVISIONER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace Sapphire::Tool
+{
+
+  /*!
+   * @brief Creates the characters of the bots through the api, the same requests the lobby sends
+   *
+   * Logs into the bot account, creating it if needed, and creates every character the account is still missing.
+   * Characters are named after the index of their bot, the ones created by an earlier run are reused.
+   */
+  class CharacterProvisioner
+  {
+  public:
+    CharacterProvisioner( std::string apiHost, std::string serverSecret );
+
+    /*! @return the character ids of the first count bots of the account, empty if a request failed */
+    std::vector< uint32_t > provision( const std::string& accountName, const std::string& password, uint32_t count );
+
+    /*! "Bot Aaaa", "Bot Aaab", ... */
+    static std::string getBotName( uint32_t index );
+
+  private:
+    /*! posts data to /sapphire-api/lobby/<endpoint>, @return false if the api didn't answer with 200 */
+    bool request( const std::string& endpoint, const nlohmann::json& data, nlohmann::json& result ) const;
+
+    bool getCharacters( const std::string& sId, std::map< std::string, uint32_t >& characters ) const;
+
+    std::string m_apiHost;
+    std::string m_serverSecret;
+  };
+
+}
+
+#endif //SAPPHIRE_CHARACTERPROVISIONER_H
@@ -0,0 +1,70 @@
+#ifndef SAPPHIRE_LATENCYSTATS_H
+#define SAPPHIRE_LATENCYSTATS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+namespace Sapphire::Tool
+{
+
+  /*!
+   * @brief Collects latency samples of all bots between two reports
+   */
+  class LatencyStats
+  {
+  public:
+    explicit LatencyStats( std::string name ) :
+      m_name( std::move( name ) ),
+      m_totalCount( 0 )
+    {
+    }
+
+    void add( uint64_t sampleMs )
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      m_samples.push_back( sampleMs );
+      ++m_totalCount;
+    }
+
+    /*! formats the percentiles of the samples since the last report and clears them */
+    std::string report()
+    {
+      std::vector< uint64_t > samples;
+      uint64_t totalCount;
+      {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        samples.swap( m_samples );
+        totalCount = m_totalCount;
+      }
+
+      if( samples.empty() )
+        return fmt::format( "{0}: no samples ( {1} total )", m_name, totalCount );
+
+      std::sort( samples.begin(), samples.end() );
+
+      auto percentile = [ &samples ]( double p )
+      {
+        auto index = static_cast< std::size_t >( p * static_cast< double >( samples.size() - 1 ) );
+        return samples[ index ];
+      };
+
+      return fmt::format( "{0}: n={1} p50={2}ms p95={3}ms p99={4}ms max={5}ms ( {6} total )",
+                          m_name, samples.size(), percentile( 0.50 ), percentile( 0.95 ), percentile( 0.99 ),
+                          samples.back(), totalCount );
+    }
+
+  private:
+    std::string m_name;
+    std::mutex m_mutex;
+    std::vector< uint64_t > m_samples;
+    uint64_t m_totalCount;
+  };
+
+}
+
+#endif //SAPPHIRE_LATENCYSTATS_H
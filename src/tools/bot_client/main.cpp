@@ -0,0 +1,233 @@
+#include <Network/Hive.h>
+#include <Logging/Logger.h>
+#include <Util/Util.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Bot.h"
+#include "CharacterProvisioner.h"
+
+using namespace Sapphire;
+
+namespace
+{
+  void printUsage()
+  {
+    Logger::info( "Usage: bot_client [options]" );
+    Logger::info( "  --host <ip>              world server address ( 127.0.0.1 )" );
+    Logger::info( "  --port <port>            world server port ( 54992 )" );
+    Logger::info( "  --first-id <id>          character id of the first bot ( 1 )" );
+    Logger::info( "  --provision <account>    create the characters of the bots on this account through the api" );
+    Logger::info( "                           and use them instead of --first-id, existing ones are reused" );
+    Logger::info( "  --password <pass>        password of the bot account ( bots )" );
+    Logger::info( "  --api <host:port>        api used to provision the characters ( 127.0.0.1:80 )" );
+    Logger::info( "  --secret <secret>        ServerSecret of the api ( default )" );
+    Logger::info( "  --count <n>              number of bots, they use consecutive character ids ( 1 )" );
+    Logger::info( "  --spawn-rate <n>         bots logged in per second ( 10 )" );
+    Logger::info( "  --duration <s>           seconds to run, 0 runs until killed ( 60 )" );
+    Logger::info( "  --threads <n>            network threads ( 2 )" );
+    Logger::info( "  --action <id>            action the bots use on themselves ( 3 )" );
+    Logger::info( "  --action-interval <ms>   ( 10000 )" );
+    Logger::info( "  --chat-interval <ms>     ( 15000 )" );
+    Logger::info( "  --path-radius <yalms>    radius of the circle the bots walk ( 10 )" );
+    Logger::info( "  --tele <id,id,...>       aetherytes to teleport between, needs gm rank 1" );
+    Logger::info( "  --tele-interval <ms>     ( 60000 )" );
+    Logger::info( "  --report-interval <s>    ( 10 )" );
+  }
+
+  std::vector< uint32_t > parseIdList( const std::string& list )
+  {
+    std::vector< uint32_t > ids;
+    std::istringstream ss( list );
+    std::string id;
+
+    while( std::getline( ss, id, ',' ) )
+    {
+      if( !id.empty() )
+        ids.push_back( static_cast< uint32_t >( std::stoul( id ) ) );
+    }
+
+    return ids;
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/bot_client" );
+
+  Tool::BotConfig config;
+  uint32_t firstId = 1;
+  uint32_t botCount = 1;
+  uint32_t spawnRate = 10;
+  uint32_t duration = 60;
+  uint32_t threadCount = 2;
+  uint32_t reportInterval = 10;
+  std::string provisionAccount;
+  std::string provisionPassword = "bots";
+  std::string apiHost = "127.0.0.1:80";
+  std::string serverSecret = "default";
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--host" )
+        config.host = value;
+      else if( arg == "--port" )
+        config.port = static_cast< uint16_t >( std::stoul( value ) );
+      else if( arg == "--first-id" )
+        firstId = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--provision" )
+        provisionAccount = value;
+      else if( arg == "--password" )
+        provisionPassword = value;
+      else if( arg == "--api" )
+        apiHost = value;
+      else if( arg == "--secret" )
+        serverSecret = value;
+      else if( arg == "--count" )
+        botCount = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--spawn-rate" )
+        spawnRate = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--duration" )
+        duration = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--threads" )
+        threadCount = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--action" )
+        config.actionId = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--action-interval" )
+        config.actionIntervalMs = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--chat-interval" )
+        config.chatIntervalMs = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--path-radius" )
+        config.pathRadius = std::stof( value );
+      else if( arg == "--tele" )
+        config.teleAetherytes = parseIdList( value );
+      else if( arg == "--tele-interval" )
+        config.teleIntervalMs = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--report-interval" )
+        reportInterval = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  config.serverInfoIntervalMs = reportInterval * 1000;
+
+  // the server refuses the command to characters without gm rank, the zoning latency then stays empty
+  if( !config.teleAetherytes.empty() )
+    Logger::warn( "Teleports use !set tele, the characters need gm rank 1 or no zoning is measured" );
+
+  std::vector< uint32_t > characterIds;
+
+  if( !provisionAccount.empty() )
+  {
+    Tool::CharacterProvisioner provisioner( apiHost, serverSecret );
+    characterIds = provisioner.provision( provisionAccount, provisionPassword, botCount );
+    if( characterIds.size() != botCount )
+      return 1;
+  }
+  else
+  {
+    for( uint32_t i = 0; i < botCount; ++i )
+      characterIds.push_back( firstId + i );
+  }
+
+  Logger::info( "Starting {0} bots against {1}:{2}", botCount, config.host, config.port );
+
+  auto pHive = std::make_shared< Network::Hive >();
+
+  std::vector< std::thread > networkThreads;
+  for( uint32_t i = 0; i < threadCount; ++i )
+    networkThreads.emplace_back( [ pHive ]() { pHive->run(); } );
+
+  Tool::BotStats stats;
+  std::vector< Tool::BotPtr > bots;
+  bots.reserve( botCount );
+
+  auto startTime = Common::Util::getTimeMs();
+  auto nextReportTime = startTime + reportInterval * 1000;
+  auto spawnIntervalMs = std::max< uint64_t >( 1, 1000 / spawnRate );
+  auto nextSpawnTime = startTime;
+
+  while( duration == 0 || Common::Util::getTimeMs() - startTime < duration * 1000ull )
+  {
+    auto tickCount = Common::Util::getTimeMs();
+
+    while( bots.size() < botCount && tickCount >= nextSpawnTime )
+    {
+      // the first bot asks the server for its main loop timings
+      auto pBot = std::make_shared< Tool::Bot >( characterIds[ bots.size() ], config, stats, bots.empty() );
+      pBot->start( pHive );
+      bots.push_back( pBot );
+
+      nextSpawnTime += spawnIntervalMs;
+    }
+
+    for( auto& pBot : bots )
+      pBot->update( tickCount );
+
+    if( tickCount >= nextReportTime )
+    {
+      nextReportTime += reportInterval * 1000;
+
+      Logger::info( "Bots in world: {0}/{1}, disconnects: {2}, packets sent: {3}, received: {4}",
+                    stats.inWorld.load(), bots.size(), stats.disconnects.load(),
+                    stats.packetsSent.load(), stats.packetsReceived.load() );
+      Logger::info( "{0}", stats.login.report() );
+      Logger::info( "{0}", stats.ping.report() );
+      Logger::info( "{0}", stats.action.report() );
+      Logger::info( "{0}", stats.zoning.report() );
+
+      std::lock_guard< std::mutex > lock( stats.serverInfoMutex );
+      if( !stats.serverTickInfo.empty() )
+        Logger::info( "Server {0}", stats.serverTickInfo );
+    }
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+  }
+
+  Logger::info( "Stopping bots" );
+
+  for( auto& pBot : bots )
+    pBot->stop();
+
+  // give the disconnects a moment to go out
+  std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+
+  pHive->stop();
+  for( auto& thread : networkThreads )
+    thread.join();
+
+  return 0;
+}
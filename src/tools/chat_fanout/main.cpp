@@ -0,0 +1,233 @@
+#include <Logging/Logger.h>
+#include <Network/Hive.h>
+#include <Util/UtilMath.h>
+
+#include "Actor/Player.h"
+#include "Manager/ChatChannelMgr.h"
+#include "Network/GameConnection.h"
+#include "Network/PacketWrappers/ChatPacket.h"
+#include "Session.h"
+#include "SessionRegistry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t subscribers = 1000;
+    uint32_t messages = 1000;
+    uint32_t rounds = 3;
+  };
+
+  // range of a yell before it was a territory channel
+  const uint32_t YellRange = 6000;
+  const uint64_t TerritoryGuId = 1;
+
+  /*!
+   * @brief Players of one territory with a session and zone connection each, nothing is connected to a socket
+   *
+   * Packets queued for the connections stay queued, every round gets a fresh territory.
+   */
+  struct BenchTerritory
+  {
+    Network::HivePtr pHive;
+    std::vector< Entity::PlayerPtr > players;
+    std::vector< World::SessionPtr > sessions;
+
+    // what queuePacketForRange went through
+    std::unordered_map< int32_t, Entity::PlayerPtr > playerMap;
+    World::SessionRegistry sessionRegistry;
+
+    World::Manager::ChatChannelMgr chatChannelMgr;
+
+    BenchTerritory( uint32_t subscriberCount, std::mt19937& rng )
+    {
+      pHive = std::make_shared< Network::Hive >();
+      std::uniform_real_distribution< float > coord( -1500.f, 1500.f );
+
+      for( uint32_t i = 0; i < subscriberCount; ++i )
+      {
+        auto playerId = 0x10000000 + i;
+
+        auto pPlayer = std::make_shared< Entity::Player >();
+        pPlayer->setId( playerId );
+        pPlayer->setPos( coord( rng ), 0.f, coord( rng ), false );
+
+        auto pSession = std::make_shared< World::Session >( playerId );
+        pSession->setZoneConnection( std::make_shared< Network::GameConnection >( pHive, nullptr ) );
+
+        playerMap[ playerId ] = pPlayer;
+        sessionRegistry.insert( playerId, pSession );
+        chatChannelMgr.join( World::Manager::ChatChannelMgr::ChannelType::Territory, TerritoryGuId, playerId,
+                             pSession );
+
+        players.push_back( std::move( pPlayer ) );
+        sessions.push_back( std::move( pSession ) );
+      }
+    }
+
+    // Territory::queuePacketForRange as yell and shout used it
+    std::size_t sendInRange( Entity::Player& sender, Network::Packets::FFXIVPacketBasePtr pPacket )
+    {
+      std::size_t count = 0;
+
+      for( auto entry : playerMap )
+      {
+        auto player = entry.second;
+        auto distance = Common::Util::distance( sender.getPos().x, sender.getPos().y, sender.getPos().z,
+                                                player->getPos().x, player->getPos().y, player->getPos().z );
+
+        if( distance < YellRange && sender.getId() != player->getId() )
+        {
+          auto pSession = sessionRegistry.find( player->getId() );
+          if( pSession )
+          {
+            pSession->getZoneConnection()->queueOutPacket( pPacket );
+            ++count;
+          }
+        }
+      }
+
+      return count;
+    }
+  };
+
+  struct FanOutResult
+  {
+    double seconds = 0.0;
+    uint64_t deliveries = 0;
+  };
+
+  /*! fastest of config.rounds rounds of config.messages yells from random players through send */
+  template< typename Send >
+  FanOutResult measure( const BenchConfig& config, Send&& send )
+  {
+    FanOutResult best;
+    best.seconds = 1e9;
+
+    const std::string message( "anyone up for a run of the aurum vale? need a healer and a tank" );
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      std::mt19937 rng( 42 );
+      BenchTerritory territory( config.subscribers, rng );
+
+      uint64_t deliveries = 0;
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint32_t i = 0; i < config.messages; ++i )
+      {
+        auto& sender = *territory.players[ rng() % territory.players.size() ];
+        // one packet per message, queued to every recipient
+        auto pPacket = std::make_shared< Network::Packets::Server::ChatPacket >( sender, Common::ChatType::Yell,
+                                                                                  message );
+        deliveries += send( territory, sender, pPacket );
+      }
+
+      auto seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+      if( seconds < best.seconds )
+        best = { seconds, deliveries };
+    }
+
+    return best;
+  }
+
+  void report( const char* name, const BenchConfig& config, const FanOutResult& result )
+  {
+    Logger::info( "{0}: {1:.0f} messages/s, {2:.2f}M deliveries/s, {3:.2f} us per message", name,
+                  config.messages / result.seconds, result.deliveries / result.seconds / 1e6,
+                  result.seconds * 1e6 / config.messages );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: chat_fanout [options]" );
+    Logger::info( "  --subscribers <n>   players in the territory ( 1000 )" );
+    Logger::info( "  --messages <n>      yells per round ( 1000 )" );
+    Logger::info( "  --rounds <n>        rounds of each variant, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/chat_fanout" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--subscribers" )
+        config.subscribers = std::max< uint32_t >( 2, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--messages" )
+        config.messages = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  auto rangeScan = measure( config, []( BenchTerritory& territory, Entity::Player& sender,
+                                        Network::Packets::FFXIVPacketBasePtr pPacket )
+  {
+    return territory.sendInRange( sender, std::move( pPacket ) );
+  } );
+
+  auto channel = measure( config, []( BenchTerritory& territory, Entity::Player& sender,
+                                      Network::Packets::FFXIVPacketBasePtr pPacket )
+  {
+    return territory.chatChannelMgr.broadcast( World::Manager::ChatChannelMgr::ChannelType::Territory,
+                                               TerritoryGuId, sender.getId(), std::move( pPacket ) );
+  } );
+
+  Logger::info( "{0} subscribers, {1} yells, fastest of {2} rounds", config.subscribers, config.messages,
+                config.rounds );
+  report( "range scan", config, rangeScan );
+  report( "territory channel", config, channel );
+
+  // every player is in yell range, both have to reach everybody but the sender
+  auto expected = static_cast< uint64_t >( config.messages ) * ( config.subscribers - 1 );
+  if( rangeScan.deliveries != expected || channel.deliveries != expected )
+  {
+    Logger::error( "Delivered {0} and {1} packets, expected {2}", rangeScan.deliveries, channel.deliveries, expected );
+    return 1;
+  }
+
+  return 0;
+}
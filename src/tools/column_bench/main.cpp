@@ -0,0 +1,169 @@
+#include <Logging/Logger.h>
+
+#include <Database/ZoneDbConnection.h>
+
+#include <PreparedStatement.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t rows = 100000;
+  };
+
+  // the result columns of CHARA_SEL in select order
+  const char* const SelectColumns[] =
+  {
+    "ContentId", "Name", "Hp", "Mp", "Tp", "Gp", "Mode", "Mount", "InvincibleGM", "Voice", "Customize",
+    "ModelMainWeapon", "ModelSubWeapon", "ModelSystemWeapon", "ModelEquip", "EmoteModeType", "FirstLoginTime",
+    "Language", "IsNewGame", "IsNewAdventurer", "TerritoryType", "TerritoryId", "PosX", "PosY", "PosZ", "PosR",
+    "OTerritoryType", "OTerritoryId", "OPosX", "OPosY", "OPosZ", "OPosR", "GuardianDeity", "BirthDay", "BirthMonth",
+    "Class", "Status", "TotalPlayTime", "FirstClass", "HomePoint", "FavoritePoint", "RestPoint", "StartTown",
+    "ActiveTitle", "TitleList", "Achievement", "Aetheryte", "HowTo", "Minions", "Mounts", "Orchestrion",
+    "EquippedMannequin", "ConfigFlags", "QuestCompleteFlags", "OpeningSequence", "QuestTracking", "GrandCompany",
+    "GrandCompanyRank", "Discovery", "GMRank", "EquipDisplayFlags", "Unlocks", "CFPenaltyUntil", "Pose",
+  };
+
+  // the columns Player::loadFromDb reads, in the order of Db::CharaSel
+  const char* const ReadColumns[] =
+  {
+    "Name", "TerritoryType", "TerritoryId", "OTerritoryType", "OTerritoryId", "PosX", "PosY", "PosZ", "PosR", "OPosX",
+    "OPosY", "OPosZ", "OPosR", "Customize", "ModelMainWeapon", "ModelEquip", "GuardianDeity", "BirthDay",
+    "BirthMonth", "Status", "EmoteModeType", "ActiveTitle", "Class", "Homepoint", "ContentId", "Voice", "StartTown",
+    "TotalPlayTime", "IsNewGame", "IsNewAdventurer", "OpeningSequence", "GrandCompany", "CFPenaltyUntil", "GMRank",
+    "EquipDisplayFlags", "Pose", "HowTo", "QuestCompleteFlags", "QuestTracking", "Aetheryte", "Unlocks", "Discovery",
+    "TitleList", "Mounts", "Orchestrion", "GrandCompanyRank", "Hp", "Mp", "Mount",
+  };
+
+  static_assert( sizeof( ReadColumns ) / sizeof( ReadColumns[ 0 ] ) == Db::CharaSel::ColumnCount,
+                 "ReadColumns has to match Db::CharaSel" );
+
+  constexpr uint32_t SelectColumnCount = sizeof( SelectColumns ) / sizeof( SelectColumns[ 0 ] );
+
+  double msSince( std::chrono::steady_clock::time_point start )
+  {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() / 1000.0;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: column_bench [options]" );
+    Logger::info( "  --rows <n>   charainfo rows to read ( 100000 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/column_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--rows" )
+        config.rows = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  // the same map PreparedStatement builds from the result metadata
+  Mysql::ColumnIndexMap columnIndex;
+  for( uint32_t i = 0; i < SelectColumnCount; ++i )
+    columnIndex.emplace( SelectColumns[ i ], i + 1 );
+
+  // stands in for the fetched rows, the timings only cover finding the fields
+  std::mt19937_64 rng( 3 );
+  std::vector< uint64_t > rows( static_cast< std::size_t >( config.rows ) * SelectColumnCount );
+  for( auto& field : rows )
+    field = rng();
+
+  // every read looks its column up by name, the way res->getUInt( "TerritoryType" ) does
+  uint64_t nameSum = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  for( uint32_t row = 0; row < config.rows; ++row )
+  {
+    const auto* pRow = &rows[ static_cast< std::size_t >( row ) * SelectColumnCount ];
+    for( auto columnName : ReadColumns )
+    {
+      auto it = columnIndex.find( columnName );
+      if( it == columnIndex.end() )
+      {
+        Logger::error( "No result column {0}", columnName );
+        return 1;
+      }
+      nameSum += pRow[ it->second - 1 ];
+    }
+  }
+
+  auto nameMs = msSince( start );
+
+  // resolved once like DbConnection::prepareColumns, every read indexes the handles
+  uint64_t handleSum = 0;
+  start = std::chrono::steady_clock::now();
+
+  std::vector< uint32_t > col;
+  col.reserve( Db::CharaSel::ColumnCount );
+  for( auto columnName : ReadColumns )
+    col.push_back( columnIndex.find( columnName )->second );
+
+  for( uint32_t row = 0; row < config.rows; ++row )
+  {
+    const auto* pRow = &rows[ static_cast< std::size_t >( row ) * SelectColumnCount ];
+    for( uint32_t i = 0; i < Db::CharaSel::ColumnCount; ++i )
+      handleSum += pRow[ col[ i ] - 1 ];
+  }
+
+  auto handleMs = msSince( start );
+
+  if( nameSum != handleSum )
+  {
+    Logger::error( "names read {0}, handles read {1}", nameSum, handleSum );
+    return 1;
+  }
+
+  auto reads = static_cast< double >( config.rows ) * Db::CharaSel::ColumnCount;
+  Logger::info( "{0} rows, {1} columns each", config.rows, static_cast< uint32_t >( Db::CharaSel::ColumnCount ) );
+  Logger::info( "by name: {0:.1f} ms, {1:.1f} ns/column", nameMs, nameMs * 1000000.0 / reads );
+  Logger::info( "by handle: {0:.1f} ms, {1:.1f} ns/column", handleMs, handleMs * 1000000.0 / reads );
+
+  return 0;
+}
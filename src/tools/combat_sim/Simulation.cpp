@@ -0,0 +1,334 @@
+#include "Simulation.h"
+
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+#include <Network/CommonActorControl.h>
+#include <Service.h>
+#include <Util/Util.h>
+#include <Util/UtilMath.h>
+
+#include "Action/Action.h"
+#include "Actor/BNpc.h"
+#include "Actor/BNpcTemplate.h"
+#include "Actor/Player.h"
+#include "Inventory/Item.h"
+#include "Inventory/ItemContainer.h"
+#include "Manager/ChatChannelMgr.h"
+#include "Manager/RNGMgr.h"
+#include "Manager/TerritoryMgr.h"
+#include "Math/CalcStats.h"
+#include "Network/PacketWrappers/ActorControlTargetPacket.h"
+#include "Network/PacketWrappers/MoveActorPacket.h"
+#include "Network/PacketWrappers/UpdateHpMpTpPacket.h"
+#include "Script/ScriptMgr.h"
+#include "Territory/Territory.h"
+#include "ServerMgr.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace Sapphire;
+
+namespace
+{
+  // high enough that no rotation kills a target between two refills
+  constexpr uint32_t TargetHp = 10000000;
+
+  uint64_t nanosecondsSince( std::chrono::steady_clock::time_point start )
+  {
+    return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - start ).count() );
+  }
+
+  Common::Metrics::Counter& effectPacketCounter()
+  {
+    return Common::Metrics::Registry::counter( "sapphire_world_effect_packets", "Effect packets built for actions" );
+  }
+
+  // parts of Entity::Chara::StateFlag in bit order, labels of the counters Chara counts them into
+  const char* const StateParts[] = { "hp", "status", "position", "target" };
+
+  Common::Metrics::Counter& stateChangeCounter( std::size_t part )
+  {
+    return Common::Metrics::Registry::counter( "sapphire_world_state_changes", "Actor state changes by part",
+                                               std::string( "part=\"" ) + StateParts[ part ] + "\"" );
+  }
+
+  Common::Metrics::Counter& stateUpdateCounter( std::size_t part )
+  {
+    return Common::Metrics::Registry::counter( "sapphire_world_state_updates",
+                                               "Actor state updates sent by part, at most one per tick",
+                                               std::string( "part=\"" ) + StateParts[ part ] + "\"" );
+  }
+
+  void reportPhase( const std::string& name, const Common::Metrics::Histogram& histogram )
+  {
+    auto count = histogram.getCount();
+    if( count == 0 )
+      return;
+
+    Logger::info( "{0:<8} calls: {1} total: {2:.2f}ms mean: {3:.2f}us p50: {4:.2f}us p99: {5:.2f}us",
+                  name, count, histogram.getSum() / 1000000.0, histogram.getSum() / 1000.0 / count,
+                  histogram.getQuantile( 0.5 ) / 1000.0, histogram.getQuantile( 0.99 ) / 1000.0 );
+  }
+}
+
+Tool::Simulation::Simulation( const SimulationConfig& config ) :
+  m_config( config ),
+  m_clockMs( 0 ),
+  m_sequence( 0 ),
+  m_actionsUsed( 0 ),
+  m_actionsFailed( 0 ),
+  m_totalDamage( 0 ),
+  m_totalHealing( 0 ),
+  m_effectPacketsAtStart( 0 ),
+  m_stateChangesAtStart{},
+  m_stateUpdatesAtStart{}
+{
+}
+
+bool Tool::Simulation::init()
+{
+  Logger::info( "Setting up EXD data" );
+  auto pExdData = std::make_shared< Data::ExdDataGenerated >();
+  if( !pExdData->init( m_config.dataPath ) )
+  {
+    Logger::fatal( "Error setting up EXD data, make sure --data points to the sqpack directory" );
+    return false;
+  }
+  Common::Service< Data::ExdDataGenerated >::set( pExdData );
+
+  if( !Math::CalcStats::init() || !World::Action::ActionLut::init() )
+    return false;
+
+  // none of these touch the database or the network unless asked to
+  Common::Service< World::ServerMgr >::set( std::make_shared< World::ServerMgr >( "config.ini" ) );
+  Common::Service< Scripting::ScriptMgr >::set( std::make_shared< Scripting::ScriptMgr >() );
+  Common::Service< World::Manager::TerritoryMgr >::set( std::make_shared< World::Manager::TerritoryMgr >() );
+  Common::Service< World::Manager::ChatChannelMgr >::set( std::make_shared< World::Manager::ChatChannelMgr >() );
+
+  auto pRNGMgr = std::make_shared< World::Manager::RNGMgr >( m_config.seed );
+  Common::Service< World::Manager::RNGMgr >::set( pRNGMgr );
+
+  // a territory without a territory type, there is nothing to load for it
+  m_pTerritory = std::make_shared< Territory >();
+  m_pTerritory->getRandomEngine() = pRNGMgr->createEngine( m_pTerritory->getGuId() );
+  m_clockMs = m_pTerritory->getTimerWheel().getTimeMs();
+
+  if( !setupPlayer() )
+    return false;
+
+  if( !pExdData->get< Data::BNpcBase >( m_config.bNpcBaseId ) )
+  {
+    Logger::fatal( "BNpcBase#{0} does not exist", m_config.bNpcBaseId );
+    return false;
+  }
+
+  setupTargets();
+
+  for( auto actionId : m_config.rotation )
+  {
+    if( !pExdData->get< Data::Action >( actionId ) )
+    {
+      Logger::fatal( "Action#{0} does not exist", actionId );
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Tool::Simulation::setupPlayer()
+{
+  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+
+  auto classJobInfo = exdData.get< Data::ClassJob >( m_config.classJob );
+  if( !classJobInfo )
+  {
+    Logger::fatal( "ClassJob#{0} does not exist", m_config.classJob );
+    return false;
+  }
+
+  auto weaponId = m_config.weaponId != 0 ? m_config.weaponId : static_cast< uint32_t >( classJobInfo->itemStartingWeapon );
+  if( !exdData.get< Data::Item >( weaponId ) )
+  {
+    Logger::fatal( "Item#{0} does not exist", weaponId );
+    return false;
+  }
+
+  m_pPlayer = std::make_shared< Entity::Player >();
+  m_pPlayer->setId( 1 );
+  m_pPlayer->setLookAt( Common::CharaLook::Tribe, m_config.tribe );
+  m_pPlayer->setClassJob( static_cast< Common::ClassJob >( m_config.classJob ) );
+  m_pPlayer->setLevel( m_config.level );
+  m_pPlayer->setPos( 0.f, 0.f, 0.f, false );
+  m_pPlayer->setRot( 0.f );
+
+  m_pPlayer->initInventory();
+
+  auto pWeapon = std::make_shared< Item >( 1, weaponId );
+  m_pPlayer->getInventoryContainer( Common::GearSet0 )->setItem( Common::GearSetSlot::MainHand, pWeapon );
+  // also recalculates the stats
+  m_pPlayer->equipItem( Common::GearSetSlot::MainHand, pWeapon, false );
+
+  m_pPlayer->resetHp();
+  m_pPlayer->resetMp();
+
+  m_pPlayer->setCurrentZone( m_pTerritory );
+  m_pTerritory->pushActor( m_pPlayer );
+
+  Logger::info( "Player: class {0} level {1}, weapon #{2}", m_config.classJob, m_config.level, weaponId );
+
+  return true;
+}
+
+void Tool::Simulation::setupTargets()
+{
+  auto pTemplate = std::make_shared< Entity::BNpcTemplate >( 1, m_config.bNpcBaseId, m_config.bNpcNameId,
+                                                             0, 0, 0, 0, 0, 0, 0 );
+
+  for( uint32_t i = 0; i < m_config.targetCount; ++i )
+  {
+    // an arc in front of the player, close enough for melee actions and most aoes
+    auto angle = ( static_cast< float >( i ) - ( m_config.targetCount - 1 ) / 2.f ) * 0.3f;
+
+    auto pBNpc = std::make_shared< Entity::BNpc >( m_pTerritory->getNextActorId(), pTemplate,
+                                                   std::sin( angle ) * 3.f, 0.f, std::cos( angle ) * 3.f,
+                                                   angle + PI, m_config.bNpcLevel, TargetHp, m_pTerritory );
+    m_pTerritory->pushActor( pBNpc );
+    m_targets.push_back( pBNpc );
+  }
+
+  Logger::info( "Targets: {0} x BNpcBase#{1} level {2}", m_config.targetCount, m_config.bNpcBaseId,
+                m_config.bNpcLevel );
+}
+
+bool Tool::Simulation::step( uint32_t actionId )
+{
+  // there is no regen, every action starts with full resources
+  m_pPlayer->setTp( 1000 );
+  m_pPlayer->resetMp();
+  // heals are measured as hp gained, starting low keeps overheal out of it
+  m_pPlayer->setHp( 1 );
+
+  auto start = std::chrono::steady_clock::now();
+
+  auto pAction = World::Action::make_Action( m_pPlayer, actionId, m_sequence++ );
+  pAction->setTargetId( m_targets.front()->getId() );
+  pAction->setPos( m_pPlayer->getPos() );
+
+  auto usable = pAction->init() && pAction->preCheck();
+
+  m_initTime.record( nanosecondsSince( start ) );
+
+  if( !usable )
+  {
+    ++m_actionsFailed;
+    return false;
+  }
+
+  // casts complete instantly, the gcd of the rotation already accounts for them
+  start = std::chrono::steady_clock::now();
+  pAction->execute();
+  m_executeTime.record( nanosecondsSince( start ) );
+
+  // effect results land 850ms after execute, by the next gcd they have all been applied
+  start = std::chrono::steady_clock::now();
+  m_clockMs += m_config.gcdMs;
+  m_pTerritory->getTimerWheel().advance( m_clockMs );
+  m_pTerritory->flushStateUpdates();
+  m_applyTime.record( nanosecondsSince( start ) );
+
+  for( auto& pTarget : m_targets )
+  {
+    m_totalDamage += TargetHp - pTarget->getHp();
+    pTarget->setHp( TargetHp );
+  }
+
+  m_totalHealing += m_pPlayer->getHp() - 1;
+
+  ++m_actionsUsed;
+  return true;
+}
+
+void Tool::Simulation::run()
+{
+  auto steps = m_config.duration * 1000ull / std::max< uint32_t >( 1, m_config.gcdMs );
+
+  Logger::info( "Running {0} actions", steps );
+
+  m_effectPacketsAtStart = effectPacketCounter().get();
+  for( std::size_t part = 0; part < m_stateChangesAtStart.size(); ++part )
+  {
+    m_stateChangesAtStart[ part ] = stateChangeCounter( part ).get();
+    m_stateUpdatesAtStart[ part ] = stateUpdateCounter( part ).get();
+  }
+
+  for( uint64_t i = 0; i < steps; ++i )
+    step( m_config.rotation[ i % m_config.rotation.size() ] );
+}
+
+Tool::SimulationResult Tool::Simulation::getResult() const
+{
+  return { m_actionsUsed, m_actionsFailed, m_totalDamage, m_totalHealing,
+           effectPacketCounter().get() - m_effectPacketsAtStart };
+}
+
+void Tool::Simulation::printReport() const
+{
+  double duration = std::max< uint32_t >( 1, m_config.duration );
+
+  Logger::info( "Seed {0}: {1} actions used, {2} failed over {3}s",
+                m_config.seed, m_actionsUsed, m_actionsFailed, m_config.duration );
+  Logger::info( "Damage: {0} total, {1:.1f} dps", m_totalDamage, m_totalDamage / duration );
+  Logger::info( "Healing: {0} total, {1:.1f} hps", m_totalHealing, m_totalHealing / duration );
+  Logger::info( "Effect packets: {0}", getResult().effectPackets );
+
+  reportStateTraffic();
+
+  reportPhase( "init", m_initTime );
+  reportPhase( "execute", m_executeTime );
+  reportPhase( "apply", m_applyTime );
+}
+
+void Tool::Simulation::reportStateTraffic() const
+{
+  using namespace Network::Packets;
+  using namespace Network::Packets::Server;
+
+  // every part always goes out as the same packet
+  const std::array< std::size_t, 4 > packetSizes{
+    std::make_shared< UpdateHpMpTpPacket >( *m_pPlayer )->getSize(),
+    makeZonePacket< FFXIVIpcStatusEffectList >( m_pPlayer->getId() )->getSize(),
+    std::make_shared< MoveActorPacket >( *m_targets.front(), 0x3a, 2, 0, 0x5A )->getSize(),
+    makeActorControlTarget( m_pPlayer->getId(), Network::ActorControl::SetTarget, 0, 0, 0, 0, 0 )->getSize()
+  };
+
+  uint64_t totalChanges = 0;
+  uint64_t totalUpdates = 0;
+  uint64_t bytesBefore = 0;
+  uint64_t bytesAfter = 0;
+
+  // changes were sent right away before updates were coalesced, the same packets go to every player in range
+  for( std::size_t part = 0; part < packetSizes.size(); ++part )
+  {
+    auto changes = stateChangeCounter( part ).get() - m_stateChangesAtStart[ part ];
+    auto updates = stateUpdateCounter( part ).get() - m_stateUpdatesAtStart[ part ];
+
+    Logger::info( "State {0:<8} changes: {1} updates sent: {2} bytes: {3} -> {4}", StateParts[ part ], changes,
+                  updates, changes * packetSizes[ part ], updates * packetSizes[ part ] );
+
+    totalChanges += changes;
+    totalUpdates += updates;
+    bytesBefore += changes * packetSizes[ part ];
+    bytesAfter += updates * packetSizes[ part ];
+  }
+
+  if( totalChanges == 0 )
+    return;
+
+  Logger::info( "State packets per player in range: {0} -> {1} ( {2:.1f}% ), bytes: {3} -> {4} ( {5:.1f}% )",
+                totalChanges, totalUpdates, 100.0 * totalUpdates / totalChanges, bytesBefore, bytesAfter,
+                100.0 * bytesAfter / bytesBefore );
+}
@@ -0,0 +1,113 @@
+#ifndef SAPPHIRE_SIMULATION_H
+#define SAPPHIRE_SIMULATION_H
+
+#include <Common.h>
+#include <Metrics/Metrics.h>
+
+#include <ForwardsZone.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Tool
+{
+
+  struct SimulationConfig
+  {
+    std::string dataPath;
+
+    // same seed, same rolls
+    uint64_t seed{ 1 };
+
+    uint8_t classJob{ static_cast< uint8_t >( Common::ClassJob::Gladiator ) };
+    uint8_t level{ 80 };
+    // midlander
+    uint8_t tribe{ 1 };
+    // 0 equips the starting weapon of the class
+    uint32_t weaponId{ 0 };
+
+    // fast blade, riot blade
+    std::vector< uint32_t > rotation{ 9, 15 };
+    // simulated time between two actions of the rotation
+    uint32_t gcdMs{ 2500 };
+    // simulated seconds
+    uint32_t duration{ 300 };
+
+    uint32_t targetCount{ 1 };
+    uint32_t bNpcBaseId{ 1 };
+    uint32_t bNpcNameId{ 1 };
+    uint32_t bNpcLevel{ 80 };
+  };
+
+  /*! what a run produced, the numbers the golden check compares */
+  struct SimulationResult
+  {
+    uint32_t actionsUsed;
+    uint32_t actionsFailed;
+    uint64_t damage;
+    uint64_t healing;
+    uint64_t effectPackets;
+  };
+
+  /*!
+   * @brief Runs a rotation of a single player against a pack of bnpcs, without network or database
+   *
+   * Builds real Player and BNpc instances in a territory nobody is connected to and feeds every action of the
+   * rotation through Action::init and Action::execute, so the damage goes through EffectBuilder and CalcStats
+   * exactly like on the server. Effect results are applied by advancing the timer wheel of the territory on a
+   * simulated clock, one gcd per action.
+   */
+  class Simulation
+  {
+  public:
+    explicit Simulation( const SimulationConfig& config );
+
+    /*! sets up exd data and the services used by actors and actions */
+    bool init();
+
+    void run();
+
+    SimulationResult getResult() const;
+
+    void printReport() const;
+
+  private:
+    bool setupPlayer();
+
+    void setupTargets();
+
+    /*! state changes of the run against the state updates sent for them, in packets and bytes */
+    void reportStateTraffic() const;
+
+    /*! @return false if the action could not be used */
+    bool step( uint32_t actionId );
+
+    SimulationConfig m_config;
+
+    TerritoryPtr m_pTerritory;
+    Entity::PlayerPtr m_pPlayer;
+    std::vector< Entity::BNpcPtr > m_targets;
+
+    uint64_t m_clockMs;
+    uint16_t m_sequence;
+
+    uint32_t m_actionsUsed;
+    uint32_t m_actionsFailed;
+    uint64_t m_totalDamage;
+    uint64_t m_totalHealing;
+    // the effect packet counter is process wide, this is where it stood when the run started
+    uint64_t m_effectPacketsAtStart;
+    // same for the state changes and updates Chara counts, one per part of Entity::Chara::StateFlag
+    std::array< uint64_t, 4 > m_stateChangesAtStart;
+    std::array< uint64_t, 4 > m_stateUpdatesAtStart;
+
+    // nanoseconds spent per action in each phase
+    Common::Metrics::Histogram m_initTime;
+    Common::Metrics::Histogram m_executeTime;
+    Common::Metrics::Histogram m_applyTime;
+  };
+
+}
+
+#endif // SAPPHIRE_SIMULATION_H
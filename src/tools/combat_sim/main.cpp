@@ -0,0 +1,343 @@
+#include <Logging/Logger.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "Simulation.h"
+
+using namespace Sapphire;
+
+namespace
+{
+  // ctest counts a test exiting with this as skipped
+  constexpr int SkipExitCode = 77;
+
+  void printUsage()
+  {
+    Logger::info( "Usage: combat_sim --data <sqpack path> [options]" );
+    Logger::info( "  --data <path>            sqpack directory of the game client" );
+    Logger::info( "  --seed <n>               seed for every roll, 0 picks a random one ( 1 )" );
+    Logger::info( "  --class <id>             classjob of the player ( 1 )" );
+    Logger::info( "  --level <n>              ( 80 )" );
+    Logger::info( "  --tribe <id>             ( 1 )" );
+    Logger::info( "  --weapon <id>            main hand item, 0 uses the starting weapon of the class ( 0 )" );
+    Logger::info( "  --rotation <id,id,...>   actions used in order, repeated until the end ( 9,15 )" );
+    Logger::info( "  --gcd <ms>               simulated time between two actions ( 2500 )" );
+    Logger::info( "  --duration <s>           simulated seconds ( 300 )" );
+    Logger::info( "  --targets <n>            number of bnpcs in front of the player ( 1 )" );
+    Logger::info( "  --bnpc-base <id>         ( 1 )" );
+    Logger::info( "  --bnpc-name <id>         ( 1 )" );
+    Logger::info( "  --bnpc-level <n>         ( 80 )" );
+    Logger::info( "  --log-level <n>          0 trace - 6 off, the report is always printed ( 3 )" );
+    Logger::info( "  --golden <file>          runs the scenario in file twice and checks the results against it" );
+    Logger::info( "  --record                 writes the results of --golden into its file instead of checking" );
+  }
+
+  std::vector< uint32_t > parseIdList( const std::string& list )
+  {
+    std::vector< uint32_t > ids;
+    std::istringstream ss( list );
+    std::string id;
+
+    while( std::getline( ss, id, ',' ) )
+    {
+      if( !id.empty() )
+        ids.push_back( static_cast< uint32_t >( std::stoul( id ) ) );
+    }
+
+    return ids;
+  }
+
+  /*! @return false if name is no simulation option, std::stoul throws on bad values */
+  bool applyOption( Tool::SimulationConfig& config, const std::string& name, const std::string& value )
+  {
+    if( name == "data" )
+      config.dataPath = value;
+    else if( name == "seed" )
+      config.seed = std::stoull( value );
+    else if( name == "class" )
+      config.classJob = static_cast< uint8_t >( std::stoul( value ) );
+    else if( name == "level" )
+      config.level = static_cast< uint8_t >( std::stoul( value ) );
+    else if( name == "tribe" )
+      config.tribe = static_cast< uint8_t >( std::stoul( value ) );
+    else if( name == "weapon" )
+      config.weaponId = static_cast< uint32_t >( std::stoul( value ) );
+    else if( name == "rotation" )
+      config.rotation = parseIdList( value );
+    else if( name == "gcd" )
+      config.gcdMs = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+    else if( name == "duration" )
+      config.duration = static_cast< uint32_t >( std::stoul( value ) );
+    else if( name == "targets" )
+      config.targetCount = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+    else if( name == "bnpc-base" )
+      config.bNpcBaseId = static_cast< uint32_t >( std::stoul( value ) );
+    else if( name == "bnpc-name" )
+      config.bNpcNameId = static_cast< uint32_t >( std::stoul( value ) );
+    else if( name == "bnpc-level" )
+      config.bNpcLevel = static_cast< uint32_t >( std::stoul( value ) );
+    else
+      return false;
+
+    return true;
+  }
+
+  /*!
+   * @brief A pinned scenario and the results it produced when it was recorded
+   *
+   * One "key value" per line, # starts a comment. Scenario keys are the option names without dashes, results
+   * are actions, failed, damage, healing and packets. Results are empty until --record wrote them.
+   */
+  struct GoldenFile
+  {
+    std::vector< std::pair< std::string, std::string > > scenario;
+    std::map< std::string, uint64_t > results;
+  };
+
+  const std::vector< std::string > ResultKeys{ "actions", "failed", "damage", "healing", "packets" };
+
+  std::map< std::string, uint64_t > toResultMap( const Tool::SimulationResult& result )
+  {
+    return { { "actions", result.actionsUsed }, { "failed", result.actionsFailed }, { "damage", result.damage },
+             { "healing", result.healing }, { "packets", result.effectPackets } };
+  }
+
+  bool loadGolden( const std::string& path, GoldenFile& golden, Tool::SimulationConfig& config )
+  {
+    std::ifstream file( path );
+    if( !file )
+    {
+      Logger::error( "Could not open golden file {0}", path );
+      return false;
+    }
+
+    std::string line;
+    while( std::getline( file, line ) )
+    {
+      std::istringstream ss( line );
+      std::string key;
+      std::string value;
+      if( !( ss >> key >> value ) || key[ 0 ] == '#' )
+        continue;
+
+      try
+      {
+        if( std::find( ResultKeys.begin(), ResultKeys.end(), key ) != ResultKeys.end() )
+          golden.results[ key ] = std::stoull( value );
+        else if( key != "data" && applyOption( config, key, value ) )
+          golden.scenario.emplace_back( key, value );
+        else
+        {
+          Logger::error( "Unknown key {0} in {1}", key, path );
+          return false;
+        }
+      }
+      catch( const std::exception& )
+      {
+        Logger::error( "Invalid value {0} for {1} in {2}", value, key, path );
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool saveGolden( const std::string& path, const GoldenFile& golden, const Tool::SimulationResult& result )
+  {
+    std::ofstream file( path, std::ios::trunc );
+    if( !file )
+    {
+      Logger::error( "Could not write golden file {0}", path );
+      return false;
+    }
+
+    file << "# combat_sim golden scenario, rewrite the results with combat_sim --golden <this file> --record\n";
+    for( const auto& [ key, value ] : golden.scenario )
+      file << key << " " << value << "\n";
+
+    auto results = toResultMap( result );
+    for( const auto& key : ResultKeys )
+      file << key << " " << results[ key ] << "\n";
+
+    return true;
+  }
+
+  bool runOnce( const Tool::SimulationConfig& config, Tool::SimulationResult& result )
+  {
+    Tool::Simulation simulation( config );
+    if( !simulation.init() )
+      return false;
+
+    simulation.run();
+    result = simulation.getResult();
+
+    Logger::setLogLevel( 2 );
+    simulation.printReport();
+    return true;
+  }
+
+  /*!
+   * @brief Runs the golden scenario twice and compares both runs with each other and with the recorded results
+   *
+   * The numbers depend on the game data, they are recorded against the client version the server targets.
+   * @return 0 if everything matched, SkipExitCode without game data
+   */
+  int runGolden( const std::string& path, bool record, Tool::SimulationConfig& config, uint8_t logLevel )
+  {
+    GoldenFile golden;
+    auto dataPath = config.dataPath;
+    if( !loadGolden( path, golden, config ) )
+      return 1;
+
+    if( dataPath.empty() )
+    {
+      Logger::warn( "No game data given, skipping the golden check of {0}", path );
+      return SkipExitCode;
+    }
+
+    Tool::SimulationResult results[ 2 ];
+    for( auto& result : results )
+    {
+      Logger::setLogLevel( logLevel );
+      if( !runOnce( config, result ) )
+        return 1;
+    }
+
+    auto first = toResultMap( results[ 0 ] );
+    auto second = toResultMap( results[ 1 ] );
+    bool matched = true;
+
+    for( const auto& key : ResultKeys )
+    {
+      if( first[ key ] != second[ key ] )
+      {
+        Logger::error( "{0}: {1} in the first run, {2} in the second with the same seed", key, first[ key ],
+                       second[ key ] );
+        matched = false;
+      }
+    }
+
+    if( !matched )
+      return 1;
+
+    if( record )
+    {
+      if( !saveGolden( path, golden, results[ 0 ] ) )
+        return 1;
+
+      Logger::info( "Recorded the results into {0}", path );
+      return 0;
+    }
+
+    if( golden.results.empty() )
+    {
+      Logger::warn( "{0} has no recorded results yet, only checked that both runs agree", path );
+      return 0;
+    }
+
+    for( const auto& key : ResultKeys )
+    {
+      auto it = golden.results.find( key );
+      if( it == golden.results.end() || it->second != first[ key ] )
+      {
+        Logger::error( "{0}: expected {1}, got {2}", key,
+                       it == golden.results.end() ? std::string( "nothing" ) : std::to_string( it->second ),
+                       first[ key ] );
+        matched = false;
+      }
+    }
+
+    if( matched )
+      Logger::info( "Golden results of {0} matched", path );
+
+    return matched ? 0 : 1;
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/combat_sim" );
+
+  Tool::SimulationConfig config;
+  // debug messages of every action would drown out the report
+  uint8_t logLevel = 3;
+  std::string goldenPath;
+  bool record = false;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( arg == "--record" )
+    {
+      record = true;
+      continue;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--golden" )
+        goldenPath = value;
+      else if( arg == "--log-level" )
+        logLevel = static_cast< uint8_t >( std::stoul( value ) );
+      else if( arg.compare( 0, 2, "--" ) != 0 || !applyOption( config, arg.substr( 2 ), value ) )
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  if( !goldenPath.empty() )
+    return runGolden( goldenPath, record, config, logLevel );
+
+  if( config.dataPath.empty() || config.rotation.empty() )
+  {
+    printUsage();
+    return 1;
+  }
+
+  Logger::setLogLevel( logLevel );
+
+  Tool::Simulation simulation( config );
+  if( !simulation.init() )
+    return 1;
+
+  auto startTime = std::chrono::steady_clock::now();
+  simulation.run();
+  auto elapsedMs = std::chrono::duration_cast< std::chrono::milliseconds >(
+    std::chrono::steady_clock::now() - startTime ).count();
+
+  // the report goes out at info level no matter what was asked for
+  Logger::setLogLevel( 2 );
+  simulation.printReport();
+  Logger::info( "Simulated {0}s in {1}ms", config.duration, elapsedMs );
+
+  return 0;
+}
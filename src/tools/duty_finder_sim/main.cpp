@@ -0,0 +1,492 @@
+#include <Logging/Logger.h>
+
+#include <ContentFinder/MatchQueue.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct SimConfig
+  {
+    uint32_t players = 10000;
+    uint32_t arrivalSeconds = 600;
+    uint32_t seconds = 900;
+    uint32_t tickMs = 50;
+    uint32_t seed = 1;
+  };
+
+  using QueueRole = World::MatchQueue::QueueRole;
+  using RoleCounts = World::MatchQueue::RoleCounts;
+
+  // six light party and two full party contents
+  const std::vector< RoleCounts > PartySizes{ { 1, 1, 2 }, { 1, 1, 2 }, { 1, 1, 2 }, { 1, 1, 2 }, { 1, 1, 2 },
+                                              { 1, 1, 2 }, { 2, 2, 4 }, { 2, 2, 4 } };
+
+  enum class PlayerState : uint8_t
+  {
+    Waiting,
+    Queued,
+    Matched,
+    Accepted,
+    Commenced,
+    Dropped,
+    Withdrew
+  };
+
+  enum class ActionType : uint8_t
+  {
+    Register,
+    Accept,
+    Withdraw,
+    Logout
+  };
+
+  struct SimPlayer
+  {
+    QueueRole role;
+    std::vector< uint16_t > contentIds;
+    PlayerState state = PlayerState::Waiting;
+    bool isOnline = true;
+    uint64_t registeredAt = 0;
+    uint64_t firstMatchAt = 0;
+    uint16_t matchedContent = 0;
+    // bumped on every match and requeue, actions scheduled for an older one are stale
+    uint32_t epoch = 0;
+  };
+
+  struct SimAction
+  {
+    ActionType type;
+    uint32_t playerIdx;
+    uint32_t epoch;
+  };
+
+  /*! what a run ended with, two runs with the same seed have to agree on all of it */
+  struct SimSummary
+  {
+    uint32_t matches = 0;
+    uint32_t commenced = 0;
+    uint32_t dropped = 0;
+    uint32_t withdrew = 0;
+    uint32_t loggedOut = 0;
+    uint32_t stillQueued = 0;
+    uint64_t matchWaitSum = 0;
+
+    bool operator==( const SimSummary& other ) const
+    {
+      return matches == other.matches && commenced == other.commenced && dropped == other.dropped &&
+             withdrew == other.withdrew && loggedOut == other.loggedOut && stillQueued == other.stillQueued &&
+             matchWaitSum == other.matchWaitSum;
+    }
+  };
+
+  /*!
+   * @brief The duty finder queues with synthetic players behind them
+   *
+   * Checks every callback against what the player it names is doing and counts what doesn't add up.
+   */
+  class SimQueue : public World::MatchQueue
+  {
+  public:
+    SimQueue( std::vector< SimPlayer >& players, std::mt19937& rng, std::multimap< uint64_t, SimAction >& actions ) :
+      m_players( players ),
+      m_rng( rng ),
+      m_actions( actions )
+    {
+    }
+
+    uint64_t now = 0;
+    uint32_t errors = 0;
+    uint32_t matches = 0;
+    std::vector< uint64_t > matchWaitMs;
+    std::vector< uint64_t > commenceWaitMs;
+
+    static uint32_t toPlayerId( uint32_t playerIdx )
+    {
+      return playerIdx + 1;
+    }
+
+  protected:
+    RoleCounts getPartySize( uint16_t contentId ) override
+    {
+      if( contentId == 0 || contentId > PartySizes.size() )
+        return {};
+      return PartySizes[ contentId - 1 ];
+    }
+
+    bool isOnline( uint32_t playerId ) const override
+    {
+      return m_players[ playerId - 1 ].isOnline;
+    }
+
+    void onMatched( uint16_t contentId, const std::vector< uint32_t >& playerIds ) override
+    {
+      ++matches;
+
+      RoleCounts roles{};
+      for( auto playerId : playerIds )
+      {
+        auto& player = m_players[ playerId - 1 ];
+        if( player.state != PlayerState::Queued || !player.isOnline )
+          fail( "matched player#{0}, which isn't waiting", playerId );
+
+        roles[ static_cast< std::size_t >( player.role ) ]++;
+
+        if( player.firstMatchAt == 0 )
+        {
+          player.firstMatchAt = now;
+          matchWaitMs.push_back( now - player.registeredAt );
+        }
+
+        player.state = PlayerState::Matched;
+        player.matchedContent = contentId;
+        ++player.epoch;
+
+        // most confirm within a few seconds, some never answer and some withdraw
+        auto delay = 1000 + m_rng() % 14000;
+        auto choice = m_rng() % 100;
+        if( choice < 92 )
+          m_actions.emplace( now + delay, SimAction{ ActionType::Accept, playerId - 1, player.epoch } );
+        else if( choice < 96 )
+          m_actions.emplace( now + delay, SimAction{ ActionType::Withdraw, playerId - 1, player.epoch } );
+      }
+
+      if( roles != getPartySize( contentId ) )
+        fail( "match for content#{0} doesn't have the party composition of it", contentId );
+    }
+
+    void onRequeued( uint16_t contentId, uint32_t playerId ) override
+    {
+      auto& player = m_players[ playerId - 1 ];
+      if( ( player.state != PlayerState::Matched && player.state != PlayerState::Accepted ) ||
+          player.matchedContent != contentId )
+        fail( "requeued player#{0}, which wasn't matched for content#{1}", playerId, contentId );
+
+      player.state = PlayerState::Queued;
+      ++player.epoch;
+    }
+
+    void onDropped( uint32_t playerId ) override
+    {
+      auto& player = m_players[ playerId - 1 ];
+      if( player.state != PlayerState::Matched )
+        fail( "dropped player#{0}, which didn't leave a readiness check open", playerId );
+
+      player.state = PlayerState::Dropped;
+    }
+
+    void onCommence( uint16_t contentId, const std::vector< uint32_t >& playerIds ) override
+    {
+      RoleCounts roles{};
+      for( auto playerId : playerIds )
+      {
+        auto& player = m_players[ playerId - 1 ];
+        if( player.state != PlayerState::Accepted || player.matchedContent != contentId )
+          fail( "player#{0} entered content#{1} without confirming it", playerId, contentId );
+
+        roles[ static_cast< std::size_t >( player.role ) ]++;
+        player.state = PlayerState::Commenced;
+        commenceWaitMs.push_back( now - player.registeredAt );
+      }
+
+      if( roles != getPartySize( contentId ) )
+        fail( "party entering content#{0} doesn't have the party composition of it", contentId );
+    }
+
+  private:
+    template< typename... Args >
+    void fail( const std::string& text, const Args&... args )
+    {
+      if( errors++ < 10 )
+        Logger::error( text, args... );
+    }
+
+    std::vector< SimPlayer >& m_players;
+    std::mt19937& m_rng;
+    std::multimap< uint64_t, SimAction >& m_actions;
+  };
+
+  struct SimTimes
+  {
+    std::vector< uint64_t > updateNs;
+    uint64_t totalNs = 0;
+  };
+
+  uint64_t nanosecondsSince( std::chrono::steady_clock::time_point start )
+  {
+    return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - start ).count() );
+  }
+
+  double percentile( std::vector< uint64_t > values, double quantile )
+  {
+    if( values.empty() )
+      return 0.0;
+
+    std::sort( values.begin(), values.end() );
+    return static_cast< double >( values[ static_cast< std::size_t >( quantile * ( values.size() - 1 ) ) ] );
+  }
+
+  void reportWait( const char* name, const std::vector< uint64_t >& waitMs )
+  {
+    Logger::info( "{0}: {1} players, p50 {2:.1f}s p90 {3:.1f}s p99 {4:.1f}s max {5:.1f}s", name, waitMs.size(),
+                  percentile( waitMs, 0.5 ) / 1000.0, percentile( waitMs, 0.9 ) / 1000.0,
+                  percentile( waitMs, 0.99 ) / 1000.0, percentile( waitMs, 1.0 ) / 1000.0 );
+  }
+
+  /*!
+   * @brief Queues config.players synthetic players over config.arrivalSeconds and runs the queues on a simulated clock
+   *
+   * Players pick one to three contents, one in a hundred logs out while waiting. Matched players confirm, withdraw
+   * or let the readiness check time out. Every draw comes from one engine seeded with config.seed.
+   * @return number of inconsistencies found, summary and times are filled in
+   */
+  uint32_t runSimulation( const SimConfig& config, bool report, SimSummary& summary, SimTimes& times )
+  {
+    std::mt19937 rng( config.seed );
+    std::vector< SimPlayer > players( config.players );
+    std::multimap< uint64_t, SimAction > actions;
+
+    for( uint32_t i = 0; i < config.players; ++i )
+    {
+      auto& player = players[ i ];
+
+      auto roll = rng() % 100;
+      player.role = roll < 18 ? QueueRole::Tank : roll < 40 ? QueueRole::Healer : QueueRole::Dps;
+
+      auto contentCount = 1 + rng() % 3;
+      while( player.contentIds.size() < contentCount )
+      {
+        auto contentId = static_cast< uint16_t >( 1 + rng() % PartySizes.size() );
+        if( std::find( player.contentIds.begin(), player.contentIds.end(), contentId ) == player.contentIds.end() )
+          player.contentIds.push_back( contentId );
+      }
+
+      auto registerAt = static_cast< uint64_t >( rng() % ( config.arrivalSeconds * 1000ull ) );
+      actions.emplace( registerAt, SimAction{ ActionType::Register, i, 0 } );
+
+      if( rng() % 100 == 0 )
+        actions.emplace( registerAt + rng() % 300000, SimAction{ ActionType::Logout, i, 0 } );
+    }
+
+    SimQueue queue( players, rng, actions );
+    uint64_t endMs = config.seconds * 1000ull;
+
+    auto runStart = std::chrono::steady_clock::now();
+
+    for( uint64_t now = config.tickMs; now <= endMs; now += config.tickMs )
+    {
+      queue.now = now;
+
+      while( !actions.empty() && actions.begin()->first <= now )
+      {
+        auto action = actions.begin()->second;
+        actions.erase( actions.begin() );
+
+        auto& player = players[ action.playerIdx ];
+        auto playerId = SimQueue::toPlayerId( action.playerIdx );
+
+        switch( action.type )
+        {
+          case ActionType::Register:
+            if( !player.isOnline )
+              break;
+            player.registeredAt = now;
+            player.state = PlayerState::Queued;
+            if( !queue.registerPlayer( playerId, player.role, player.contentIds ) )
+            {
+              Logger::error( "Could not register player#{0}", playerId );
+              ++queue.errors;
+            }
+            break;
+          case ActionType::Accept:
+            if( action.epoch == player.epoch && player.state == PlayerState::Matched )
+            {
+              player.state = PlayerState::Accepted;
+              queue.acceptDuty( playerId );
+            }
+            break;
+          case ActionType::Withdraw:
+            if( action.epoch == player.epoch && player.state == PlayerState::Matched )
+            {
+              player.state = PlayerState::Withdrew;
+              queue.withdrawPlayer( playerId );
+            }
+            break;
+          case ActionType::Logout:
+            player.isOnline = false;
+            break;
+        }
+      }
+
+      auto updateStart = std::chrono::steady_clock::now();
+      queue.update( now );
+      times.updateNs.push_back( nanosecondsSince( updateStart ) );
+    }
+
+    times.totalNs = nanosecondsSince( runStart );
+
+    summary.matches = queue.matches;
+    for( uint32_t i = 0; i < config.players; ++i )
+    {
+      auto& player = players[ i ];
+      auto isQueued = queue.isQueued( SimQueue::toPlayerId( i ) );
+
+      switch( player.state )
+      {
+        case PlayerState::Commenced:
+          ++summary.commenced;
+          break;
+        case PlayerState::Dropped:
+          ++summary.dropped;
+          break;
+        case PlayerState::Withdrew:
+          ++summary.withdrew;
+          break;
+        case PlayerState::Waiting:
+          // logged out before registering
+          ++summary.loggedOut;
+          break;
+        default:
+          if( isQueued )
+            ++summary.stillQueued;
+          else if( !player.isOnline )
+            ++summary.loggedOut;
+          else
+          {
+            Logger::error( "player#{0} is waiting but no longer queued", SimQueue::toPlayerId( i ) );
+            ++queue.errors;
+          }
+          break;
+      }
+
+      if( isQueued && ( player.state == PlayerState::Commenced || player.state == PlayerState::Dropped ||
+                        player.state == PlayerState::Withdrew ) )
+      {
+        Logger::error( "player#{0} left the duty finder but is still queued", SimQueue::toPlayerId( i ) );
+        ++queue.errors;
+      }
+
+      if( player.firstMatchAt != 0 )
+        summary.matchWaitSum += player.firstMatchAt - player.registeredAt;
+    }
+
+    if( report )
+    {
+      Logger::info( "{0} players over {1}s, {2}s simulated, seed {3}", config.players, config.arrivalSeconds,
+                    config.seconds, config.seed );
+      Logger::info( "{0} parties formed, {1} players commenced, {2} dropped by the readiness check, {3} withdrew, "
+                    "{4} logged out, {5} still queued", summary.matches, summary.commenced, summary.dropped,
+                    summary.withdrew, summary.loggedOut, summary.stillQueued );
+      reportWait( "wait until matched", queue.matchWaitMs );
+      reportWait( "wait until commenced", queue.commenceWaitMs );
+    }
+
+    return queue.errors;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: duty_finder_sim [options]" );
+    Logger::info( "  --players <n>   synthetic players queueing ( 10000 )" );
+    Logger::info( "  --arrival <s>   simulated seconds over which they register ( 600 )" );
+    Logger::info( "  --seconds <s>   simulated seconds in total ( 900 )" );
+    Logger::info( "  --tick <ms>     time between two updates of the queues ( 50 )" );
+    Logger::info( "  --seed <n>      ( 1 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/duty_finder_sim" );
+
+  SimConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--players" )
+        config.players = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--arrival" )
+        config.arrivalSeconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--seconds" )
+        config.seconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--tick" )
+        config.tickMs = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--seed" )
+        config.seed = static_cast< uint32_t >( std::stoul( value ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  // debug messages of every formed party would drown out the report
+  Logger::setLogLevel( Logger::Info );
+
+  SimSummary summary;
+  SimTimes times;
+  auto errors = runSimulation( config, true, summary, times );
+
+  auto updates = std::max< std::size_t >( 1, times.updateNs.size() );
+  uint64_t updateTotal = 0;
+  for( auto ns : times.updateNs )
+    updateTotal += ns;
+
+  Logger::info( "update: {0:.1f} us mean, {1:.1f} us p99, {2:.1f} us max over {3} updates",
+                updateTotal / 1000.0 / updates, percentile( times.updateNs, 0.99 ) / 1000.0,
+                percentile( times.updateNs, 1.0 ) / 1000.0, updates );
+  Logger::info( "throughput: {0:.0f} registrations and {1:.0f} parties per second of wall time",
+                config.players / ( times.totalNs / 1e9 ), summary.matches / ( times.totalNs / 1e9 ) );
+
+  SimSummary repeat;
+  SimTimes repeatTimes;
+  errors += runSimulation( config, false, repeat, repeatTimes );
+
+  if( !( summary == repeat ) )
+  {
+    Logger::error( "A second run with seed {0} ended differently", config.seed );
+    ++errors;
+  }
+
+  if( errors != 0 )
+  {
+    Logger::error( "{0} inconsistencies", errors );
+    return 1;
+  }
+
+  return 0;
+}
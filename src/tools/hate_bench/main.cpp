@@ -0,0 +1,352 @@
+#include <Logging/Logger.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t attackers = 24;
+    uint32_t seconds = 600;
+    uint32_t hitsPerSecond = 2;
+    uint32_t rounds = 3;
+  };
+
+  // territories update every 50ms, BNpc::update picks its target once per update
+  const uint32_t UpdateMs = 50;
+
+  struct Attacker
+  {
+    uint32_t id;
+  };
+
+  using AttackerPtr = std::shared_ptr< Attacker >;
+
+  struct Hit
+  {
+    uint32_t attacker;
+    uint32_t hate;
+  };
+
+  /*! hits landing on the boss in every update, the same for both hate lists */
+  std::vector< std::vector< Hit > > makeFight( const BenchConfig& config )
+  {
+    std::mt19937 rng( 42 );
+    auto updates = config.seconds * 1000 / UpdateMs;
+    auto updatesPerSecond = 1000 / UpdateMs;
+
+    std::vector< std::vector< Hit > > fight( updates );
+    for( uint32_t second = 0; second < config.seconds; ++second )
+    {
+      for( uint32_t attacker = 0; attacker < config.attackers; ++attacker )
+      {
+        for( uint32_t i = 0; i < config.hitsPerSecond; ++i )
+        {
+          // the first two are tanks in tank stance
+          auto hate = static_cast< uint32_t >( 2000 + rng() % 18000 );
+          if( attacker < 2 )
+            hate *= 10;
+          fight[ second * updatesPerSecond + rng() % updatesPerSecond ].push_back( { attacker, hate } );
+        }
+      }
+    }
+
+    return fight;
+  }
+
+  /*!
+   * @brief BNpc hate list before the flat vector
+   *
+   * A set of shared entries ordered by address, every hit looks for the highest entry on aggro and for the
+   * entry of the attacker through hateListUpdate.
+   */
+  class SetHateList
+  {
+  public:
+    void onHit( const AttackerPtr& pSource, uint32_t hateAmount )
+    {
+      // onActionHostile
+      if( !getHighest() )
+        m_aggroCount++;
+
+      for( auto listEntry : m_hateList )
+      {
+        if( listEntry->m_pChara == pSource )
+        {
+          listEntry->m_hateAmount += hateAmount;
+          return;
+        }
+      }
+
+      auto hateEntry = std::make_shared< HateListEntry >();
+      hateEntry->m_hateAmount = hateAmount;
+      hateEntry->m_pChara = pSource;
+      m_hateList.insert( hateEntry );
+    }
+
+    uint32_t update()
+    {
+      auto pHated = getHighest();
+      return pHated ? pHated->m_hateAmount : 0;
+    }
+
+    uint64_t m_aggroCount = 0;
+
+  private:
+    struct HateListEntry
+    {
+      uint32_t m_hateAmount;
+      AttackerPtr m_pChara;
+    };
+
+    std::shared_ptr< HateListEntry > getHighest()
+    {
+      auto it = m_hateList.begin();
+      uint32_t maxHate = 0;
+      std::shared_ptr< HateListEntry > entry;
+      for( ; it != m_hateList.end(); ++it )
+      {
+        if( ( *it )->m_hateAmount > maxHate )
+        {
+          maxHate = ( *it )->m_hateAmount;
+          entry = *it;
+        }
+      }
+
+      if( entry && maxHate != 0 )
+        return entry;
+
+      return nullptr;
+    }
+
+    std::set< std::shared_ptr< HateListEntry > > m_hateList;
+  };
+
+  /*! BNpc hate list now, sorted by hate with the hits of an update queued and merged once */
+  class FlatHateList
+  {
+  public:
+    void onHit( const AttackerPtr& pSource, uint32_t hateAmount )
+    {
+      if( m_hateList.empty() && m_pendingHate.empty() )
+        m_aggroCount++;
+
+      m_pendingHate.push_back( { pSource->id, hateAmount, pSource } );
+    }
+
+    uint32_t update()
+    {
+      flush();
+
+      while( !m_hateList.empty() && m_hateList.front().m_hateAmount != 0 )
+      {
+        if( auto pChara = m_hateList.front().m_pChara.lock() )
+          return m_hateList.front().m_hateAmount;
+
+        m_hateList.erase( m_hateList.begin() );
+      }
+
+      return 0;
+    }
+
+    uint64_t m_aggroCount = 0;
+
+  private:
+    struct HateListEntry
+    {
+      uint32_t m_actorId;
+      uint32_t m_hateAmount;
+      std::weak_ptr< Attacker > m_pChara;
+    };
+
+    void flush()
+    {
+      if( m_pendingHate.empty() )
+        return;
+
+      for( auto& pending : m_pendingHate )
+      {
+        auto it = std::find_if( m_hateList.begin(), m_hateList.end(), [ &pending ]( const HateListEntry& entry )
+        {
+          return entry.m_actorId == pending.m_actorId;
+        } );
+
+        if( it != m_hateList.end() )
+        {
+          it->m_hateAmount += pending.m_hateAmount;
+          it->m_pChara = std::move( pending.m_pChara );
+        }
+        else
+          m_hateList.push_back( std::move( pending ) );
+      }
+      m_pendingHate.clear();
+
+      m_hateList.erase( std::remove_if( m_hateList.begin(), m_hateList.end(), []( const HateListEntry& entry )
+      {
+        return entry.m_pChara.expired();
+      } ), m_hateList.end() );
+
+      for( std::size_t i = 1; i < m_hateList.size(); ++i )
+      {
+        if( m_hateList[ i - 1 ].m_hateAmount >= m_hateList[ i ].m_hateAmount )
+          continue;
+
+        auto entry = std::move( m_hateList[ i ] );
+        auto j = i;
+        for( ; j > 0 && m_hateList[ j - 1 ].m_hateAmount < entry.m_hateAmount; --j )
+          m_hateList[ j ] = std::move( m_hateList[ j - 1 ] );
+        m_hateList[ j ] = std::move( entry );
+      }
+    }
+
+    std::vector< HateListEntry > m_hateList;
+    std::vector< HateListEntry > m_pendingHate;
+  };
+
+  struct FightResult
+  {
+    double hitNs = 1e18;
+    double updateNs = 1e18;
+    uint64_t hits = 0;
+    // sum of the hate of the target picked in every update
+    uint64_t checksum = 0;
+    uint64_t aggroCount = 0;
+  };
+
+  template< typename HateList >
+  FightResult run( const BenchConfig& config, const std::vector< std::vector< Hit > >& fight )
+  {
+    FightResult best;
+
+    std::vector< AttackerPtr > attackers;
+    for( uint32_t i = 0; i < config.attackers; ++i )
+      attackers.push_back( std::make_shared< Attacker >( Attacker{ 0x10000000 + i } ) );
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      HateList hateList;
+      FightResult result;
+      std::chrono::steady_clock::duration hitTime{};
+      std::chrono::steady_clock::duration updateTime{};
+
+      for( auto& hits : fight )
+      {
+        auto start = std::chrono::steady_clock::now();
+        for( auto& hit : hits )
+          hateList.onHit( attackers[ hit.attacker ], hit.hate );
+        auto hitsDone = std::chrono::steady_clock::now();
+        result.checksum += hateList.update();
+        updateTime += std::chrono::steady_clock::now() - hitsDone;
+        hitTime += hitsDone - start;
+
+        result.hits += hits.size();
+      }
+
+      result.hitNs = std::chrono::duration< double, std::nano >( hitTime ).count() /
+                     std::max< uint64_t >( 1, result.hits );
+      result.updateNs = std::chrono::duration< double, std::nano >( updateTime ).count() / fight.size();
+      result.aggroCount = hateList.m_aggroCount;
+
+      best.hitNs = std::min( best.hitNs, result.hitNs );
+      best.updateNs = std::min( best.updateNs, result.updateNs );
+      best.hits = result.hits;
+      best.checksum = result.checksum;
+      best.aggroCount = result.aggroCount;
+    }
+
+    return best;
+  }
+
+  void report( const char* name, const FightResult& result, std::size_t updates )
+  {
+    Logger::info( "{0}: {1:.1f} ns per hit, {2:.1f} ns per update, {3:.1f} ms for the whole fight", name,
+                  result.hitNs, result.updateNs, ( result.hitNs * result.hits + result.updateNs * updates ) / 1e6 );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: hate_bench [options]" );
+    Logger::info( "  --attackers <n>   players on the boss, the first two tank ( 24 )" );
+    Logger::info( "  --seconds <n>     length of the fight ( 600 )" );
+    Logger::info( "  --hits <n>        hits per attacker and second ( 2 )" );
+    Logger::info( "  --rounds <n>      rounds of each hate list, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/hate_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--attackers" )
+        config.attackers = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--seconds" )
+        config.seconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--hits" )
+        config.hitsPerSecond = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  auto fight = makeFight( config );
+
+  auto setResult = run< SetHateList >( config, fight );
+  auto flatResult = run< FlatHateList >( config, fight );
+
+  Logger::info( "{0} attackers, {1} hits in {2} updates, fastest of {3} rounds", config.attackers, setResult.hits,
+                fight.size(), config.rounds );
+  report( "set by address", setResult, fight.size() );
+  report( "flat sorted", flatResult, fight.size() );
+
+  // ties can pick different actors, the hate of the picked target has to be the same
+  if( setResult.checksum != flatResult.checksum || setResult.aggroCount != flatResult.aggroCount )
+  {
+    Logger::error( "The hate lists picked targets with {0} and {1} hate in total, aggroed {2} and {3} times",
+                   setResult.checksum, flatResult.checksum, setResult.aggroCount, flatResult.aggroCount );
+    return 1;
+  }
+
+  return 0;
+}
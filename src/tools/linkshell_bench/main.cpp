@@ -0,0 +1,227 @@
+#include <Logging/Logger.h>
+
+#include <Manager/LinkshellMgr.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t linkshells = 100000;
+    uint32_t members = 24;
+    uint32_t characters = 200000;
+  };
+
+  struct MemberRow
+  {
+    uint64_t linkshellId;
+    uint64_t characterId;
+    LinkshellMemberRank rank;
+  };
+
+  struct LegacyRow
+  {
+    uint64_t linkshellId;
+    uint64_t masterId;
+    std::vector< char > members;
+    std::vector< char > leaders;
+    std::vector< char > invites;
+  };
+
+  std::vector< char > encodeIdList( const std::vector< uint64_t >& ids )
+  {
+    std::vector< char > data( ids.size() * sizeof( uint64_t ) );
+    if( !ids.empty() )
+      std::memcpy( data.data(), ids.data(), data.size() );
+    return data;
+  }
+
+  // the same linkshells as linkshellmember rows and as infolinkshell id lists before the conversion
+  void makeLinkshells( const BenchConfig& config, std::vector< MemberRow >& rows, std::vector< LegacyRow >& legacy )
+  {
+    std::mt19937_64 rng( 7 );
+    std::uniform_int_distribution< uint64_t > characterDist( 1, config.characters );
+
+    for( uint64_t lsId = 1; lsId <= config.linkshells; ++lsId )
+    {
+      LegacyRow legacyRow{ lsId, characterDist( rng ) };
+
+      std::vector< uint64_t > members{ legacyRow.masterId };
+      while( members.size() < config.members )
+      {
+        auto characterId = characterDist( rng );
+        if( std::find( members.begin(), members.end(), characterId ) == members.end() )
+          members.push_back( characterId );
+      }
+
+      // a couple of leaders and one pending invite per linkshell
+      std::vector< uint64_t > leaders( members.begin() + 1, members.begin() + std::min< std::size_t >( 3, members.size() ) );
+      std::vector< uint64_t > invites{ config.characters + lsId };
+
+      for( auto characterId : members )
+      {
+        auto rank = characterId == legacyRow.masterId ? LinkshellMemberRank::Master : LinkshellMemberRank::Member;
+        if( std::find( leaders.begin(), leaders.end(), characterId ) != leaders.end() )
+          rank = LinkshellMemberRank::Leader;
+        rows.push_back( { lsId, characterId, rank } );
+      }
+      for( auto characterId : invites )
+        rows.push_back( { lsId, characterId, LinkshellMemberRank::Invite } );
+
+      legacyRow.members = encodeIdList( members );
+      legacyRow.leaders = encodeIdList( leaders );
+      legacyRow.invites = encodeIdList( invites );
+      legacy.push_back( std::move( legacyRow ) );
+    }
+  }
+
+  double msSince( std::chrono::steady_clock::time_point start )
+  {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() / 1000.0;
+  }
+
+  // every membership has to be found through the character again
+  bool checkIndex( const World::Manager::LinkshellMgr& lsMgr, const std::vector< MemberRow >& rows )
+  {
+    for( const auto& row : rows )
+    {
+      auto linkshells = lsMgr.getPlayerLinkshells( row.characterId );
+      auto it = std::find_if( linkshells.begin(), linkshells.end(), [ &row ]( const LinkshellPtr& pLinkshell )
+      {
+        return pLinkshell->getId() == row.linkshellId;
+      } );
+
+      bool found = it != linkshells.end();
+      if( found == ( row.rank != LinkshellMemberRank::Invite ) )
+        continue;
+
+      Logger::error( "linkshell#{0} of character#{1} {2} the index", row.linkshellId, row.characterId,
+                     found ? "is wrongly in" : "is missing from" );
+      return false;
+    }
+
+    return true;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: linkshell_bench [options]" );
+    Logger::info( "  --linkshells <n>   linkshells to load ( 100000 )" );
+    Logger::info( "  --members <n>      members of each linkshell, the master included ( 24 )" );
+    Logger::info( "  --characters <n>   characters the members are picked from ( 200000 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/linkshell_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--linkshells" )
+        config.linkshells = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--members" )
+        config.members = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--characters" )
+        config.characters = static_cast< uint32_t >( std::stoul( value ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  config.characters = std::max( config.characters, config.members * 2 );
+
+  std::vector< MemberRow > rows;
+  std::vector< LegacyRow > legacy;
+  makeLinkshells( config, rows, legacy );
+
+  Logger::info( "{0} linkshells, {1} membership rows", config.linkshells, rows.size() );
+
+  // a boot after the conversion, linkshells come from infolinkshell and members from linkshellmember
+  World::Manager::LinkshellMgr rowMgr;
+  auto start = std::chrono::steady_clock::now();
+
+  for( const auto& legacyRow : legacy )
+    rowMgr.restoreLinkshell( legacyRow.linkshellId, "ls" + std::to_string( legacyRow.linkshellId ),
+                             legacyRow.masterId );
+  for( const auto& row : rows )
+    rowMgr.restoreMember( row.linkshellId, row.characterId, row.rank );
+
+  Logger::info( "from member rows: {0:.1f} ms", msSince( start ) );
+
+  // the first boot, every linkshell is converted from its id lists, the database writes are not included
+  World::Manager::LinkshellMgr legacyMgr;
+  start = std::chrono::steady_clock::now();
+
+  for( const auto& legacyRow : legacy )
+  {
+    legacyMgr.restoreLinkshell( legacyRow.linkshellId, "ls" + std::to_string( legacyRow.linkshellId ),
+                                legacyRow.masterId );
+
+    auto ranks = World::Manager::LinkshellMgr::resolveLegacyRanks( legacyRow.masterId, legacyRow.members,
+                                                                   legacyRow.leaders, legacyRow.invites );
+    for( const auto& entry : ranks )
+      legacyMgr.restoreMember( legacyRow.linkshellId, entry.first, entry.second );
+  }
+
+  Logger::info( "from id lists: {0:.1f} ms", msSince( start ) );
+
+  if( !checkIndex( rowMgr, rows ) || !checkIndex( legacyMgr, rows ) )
+    return 1;
+
+  // both ways have to end up with the same ranks
+  for( const auto& legacyRow : legacy )
+  {
+    auto pFromRows = rowMgr.getLinkshellById( legacyRow.linkshellId );
+    auto pFromLists = legacyMgr.getLinkshellById( legacyRow.linkshellId );
+
+    if( pFromRows->getMemberIdList() != pFromLists->getMemberIdList() ||
+        pFromRows->getLeaderIdList() != pFromLists->getLeaderIdList() ||
+        pFromRows->getInviteIdList() != pFromLists->getInviteIdList() )
+    {
+      Logger::error( "linkshell#{0} converted to other ranks than its rows", legacyRow.linkshellId );
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <Logging/Logger.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t calls = 5000000;
+    uint32_t rounds = 5;
+  };
+
+  // stands in for Chara::getName, which returns the name by value
+  struct BenchActor
+  {
+    uint32_t id;
+    std::string name;
+
+    std::string getName() const
+    {
+      return name;
+    }
+  };
+
+  /*!
+   * @brief Fastest of config.rounds runs of config.calls calls of func, in ns per call
+   *
+   * The actors change from call to call so nothing can be hoisted out of the loop.
+   */
+  template< typename Func >
+  double measure( const BenchConfig& config, const BenchActor ( &actors )[ 2 ], Func&& func )
+  {
+    auto fastest = std::chrono::nanoseconds::max();
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint32_t i = 0; i < config.calls; ++i )
+        func( actors[ i & 1 ], actors[ ( i + 1 ) & 1 ] );
+
+      fastest = std::min( fastest, std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::steady_clock::now() - start ) );
+    }
+
+    return static_cast< double >( fastest.count() ) / config.calls;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: log_bench [options]" );
+    Logger::info( "  --calls <n>    suppressed log calls per round ( 5000000 )" );
+    Logger::info( "  --rounds <n>   rounds of each variant, the fastest one counts ( 5 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/log_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--calls" )
+        config.calls = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  // names longer than the small string buffer, like most character names
+  const BenchActor actors[ 2 ] = { { 0x10000001, "Bench Player Alpha" }, { 0x10000002, "Bench Player Beta" } };
+
+  // the default of world.ini, debug messages are suppressed
+  Logger::setLogLevel( Logger::Info );
+
+  // Player::spawn before log levels were checked up front: format, then look the logger up and let it drop the message
+  auto formatted = measure( config, actors, []( const BenchActor& actor, const BenchActor& target )
+  {
+    spdlog::get( "logger" )->debug( fmt::format( "[{0}] Spawning {1} for {2}", target.id, actor.getName(),
+                                                 target.getName() ) );
+  } );
+
+  // the arguments are still built, the level check skips formatting
+  auto checked = measure( config, actors, []( const BenchActor& actor, const BenchActor& target )
+  {
+    Logger::debug( "[{0}] Spawning {1} for {2}", target.id, actor.getName(), target.getName() );
+  } );
+
+  // the arguments are only evaluated once the level check passed
+  auto macro = measure( config, actors, []( const BenchActor& actor, const BenchActor& target )
+  {
+    SAPPHIRE_LOG_DEBUG( "[{0}] Spawning {1} for {2}", target.id, actor.getName(), target.getName() );
+  } );
+
+  // release builds set SAPPHIRE_LOG_ACTIVE_LEVEL to info, only the arguments of Logger::debug are left of the last two
+  Logger::info( "suppressed debug call, {0} calls, fastest of {1} rounds, debug {2}", config.calls, config.rounds,
+                Logger::isCompiledIn( Logger::Debug ) ? "compiled in" : "compiled out" );
+  Logger::info( "format then drop:   {0:.2f} ns/call", formatted );
+  Logger::info( "Logger::debug:      {0:.2f} ns/call", checked );
+  Logger::info( "SAPPHIRE_LOG_DEBUG: {0:.2f} ns/call", macro );
+
+  return 0;
+}
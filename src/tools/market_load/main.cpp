@@ -0,0 +1,260 @@
+#include <Logging/Logger.h>
+
+#include <Manager/MarketMgr.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+using MarketMgr = World::Manager::MarketMgr;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t items = 15000;
+    uint32_t listings = 1000000;
+    uint32_t searches = 200000;
+  };
+
+  const char* const Words[] =
+  {
+    "iron", "bronze", "steel", "mythril", "cobalt", "darksteel", "silver", "electrum", "gold", "platinum",
+    "potion", "ether", "elixir", "tincture", "draught", "sword", "axe", "lance", "bow", "staff",
+    "rod", "grimoire", "codex", "knuckles", "daggers", "helm", "cap", "hat", "hood", "mask",
+    "tunic", "coat", "robe", "vest", "jacket", "gloves", "gauntlets", "bracers", "boots", "sabatons",
+    "ring", "earrings", "necklace", "choker", "bracelet", "hi", "mega", "super", "fine", "aged",
+  };
+
+  // listings and lookups lean on a few popular items like a real market board
+  uint32_t skewedIndex( std::mt19937& rng, uint32_t count )
+  {
+    std::uniform_real_distribution< double > dist( 0.0, 1.0 );
+    auto u = dist( rng );
+    return std::min( count - 1, static_cast< uint32_t >( u * u * u * count ) );
+  }
+
+  MarketMgr::MarketableItemCacheList makeItems( uint32_t count, std::mt19937& rng )
+  {
+    const auto wordCount = static_cast< uint32_t >( sizeof( Words ) / sizeof( Words[ 0 ] ) );
+
+    std::uniform_int_distribution< uint32_t > wordDist( 0, wordCount - 1 );
+    std::uniform_int_distribution< uint32_t > categoryDist( 1, 90 );
+    std::uniform_int_distribution< uint32_t > levelDist( 1, 90 );
+    std::uniform_int_distribution< uint32_t > classJobDist( 0, 40 );
+
+    MarketMgr::MarketableItemCacheList items;
+    items.reserve( count );
+
+    for( uint32_t i = 0; i < count; ++i )
+    {
+      MarketMgr::MarketableItem item {};
+      item.catalogId = 1000 + i;
+      item.itemSearchCategory = static_cast< uint8_t >( categoryDist( rng ) );
+      item.maxEquipLevel = static_cast< uint8_t >( levelDist( rng ) );
+      item.itemLevel = static_cast< uint16_t >( item.maxEquipLevel * 5 );
+      // most items are not class bound
+      auto classJob = classJobDist( rng );
+      item.classJob = static_cast< uint8_t >( classJob > 20 ? 0 : classJob );
+
+      item.name = Words[ wordDist( rng ) ];
+      item.name += ' ';
+      item.name += Words[ wordDist( rng ) ];
+      if( i % 3 == 0 )
+      {
+        item.name += '-';
+        item.name += Words[ wordDist( rng ) ];
+      }
+
+      items.push_back( std::move( item ) );
+    }
+
+    return items;
+  }
+
+  double msSince( std::chrono::steady_clock::time_point start )
+  {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() / 1000.0;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: market_load [options]" );
+    Logger::info( "  --items <n>      marketable items ( 15000 )" );
+    Logger::info( "  --listings <n>   listings spread over the items ( 1000000 )" );
+    Logger::info( "  --searches <n>   searches of each kind ( 200000 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/market_load" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--items" )
+        config.items = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--listings" )
+        config.listings = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--searches" )
+        config.searches = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  std::mt19937 rng( 11 );
+
+  auto items = makeItems( config.items, rng );
+
+  // the rows of MARKET_LISTING_SEL_ALL, cheapest first
+  std::vector< MarketMgr::MarketListing > listings;
+  listings.reserve( config.listings );
+
+  std::uniform_int_distribution< uint32_t > priceDist( 1, 500000 );
+  std::uniform_int_distribution< uint32_t > quantityDist( 1, 99 );
+
+  for( uint32_t i = 0; i < config.listings; ++i )
+  {
+    MarketMgr::MarketListing listing {};
+    listing.listingId = i + 1;
+    listing.catalogId = items[ skewedIndex( rng, config.items ) ].catalogId;
+    listing.retainerName = "retainer";
+    listing.pricePerUnit = priceDist( rng );
+    listing.quantity = quantityDist( rng );
+    listing.isHq = i % 4 == 0;
+    listings.push_back( std::move( listing ) );
+  }
+
+  std::sort( listings.begin(), listings.end(), []( const MarketMgr::MarketListing& a,
+                                                   const MarketMgr::MarketListing& b )
+  {
+    return a.pricePerUnit != b.pricePerUnit ? a.pricePerUnit < b.pricePerUnit : a.listingId < b.listingId;
+  } );
+
+  MarketMgr marketMgr;
+
+  auto start = std::chrono::steady_clock::now();
+  marketMgr.setMarketableItems( items );
+  Logger::info( "indexed {0} items in {1:.1f} ms", config.items, msSince( start ) );
+
+  start = std::chrono::steady_clock::now();
+  for( auto& listing : listings )
+    marketMgr.restoreListing( std::move( listing ) );
+  Logger::info( "restored {0} listings in {1:.1f} ms", config.listings, msSince( start ) );
+
+  std::uniform_int_distribution< uint32_t > categoryDist( 1, 90 );
+  std::uniform_int_distribution< uint32_t > levelDist( 0, 90 );
+  std::uniform_int_distribution< uint32_t > classJobDist( 1, 20 );
+  std::uniform_int_distribution< uint32_t > pageDist( 0, 2 );
+  std::uniform_int_distribution< uint32_t > wordDist( 0, sizeof( Words ) / sizeof( Words[ 0 ] ) - 1 );
+
+  enum SearchKind
+  {
+    Category,
+    ClassJob,
+    Name,
+    KindCount
+  };
+
+  const char* const kindNames[ KindCount ] = { "category", "category + class job", "name" };
+
+  MarketMgr::ItemSearchResultList results;
+  std::size_t resultCount = 0;
+
+  for( int kind = 0; kind < KindCount; ++kind )
+  {
+    start = std::chrono::steady_clock::now();
+
+    for( uint32_t i = 0; i < config.searches; ++i )
+    {
+      std::string searchStr;
+      uint8_t category = static_cast< uint8_t >( categoryDist( rng ) );
+      uint8_t classJob = 0;
+      uint8_t maxLevel = static_cast< uint8_t >( levelDist( rng ) );
+
+      if( kind == ClassJob )
+        classJob = static_cast< uint8_t >( classJobDist( rng ) );
+      else if( kind == Name )
+      {
+        // the client searches by name in every category, a prefix of a word is enough
+        std::string word( Words[ wordDist( rng ) ] );
+        searchStr = word.substr( 0, std::min< std::size_t >( word.size(), 3 ) );
+        category = 0;
+      }
+
+      results.clear();
+      marketMgr.findItems( searchStr, category, maxLevel, classJob, pageDist( rng ) * 20, results );
+      resultCount += results.size();
+
+      for( const auto& result : results )
+      {
+        auto pListings = marketMgr.getListings( result.catalogId );
+        if( !pListings || std::min< std::size_t >( pListings->size(), UINT16_MAX ) != result.quantity )
+        {
+          Logger::error( "search reported {0} listings of item#{1}", result.quantity, result.catalogId );
+          return 1;
+        }
+      }
+    }
+
+    auto elapsed = msSince( start );
+    Logger::info( "{0} searches: {1:.0f} searches/s, {2:.2f} us/search", kindNames[ kind ],
+                  config.searches * 1000.0 / elapsed, elapsed * 1000.0 / config.searches );
+  }
+
+  Logger::info( "{0} search results in total", resultCount );
+
+  // the first packet of requestItemListings, the ten cheapest listings of the item
+  uint64_t priceSum = 0;
+  start = std::chrono::steady_clock::now();
+
+  for( uint32_t i = 0; i < config.searches; ++i )
+  {
+    auto pListings = marketMgr.getListings( items[ skewedIndex( rng, config.items ) ].catalogId );
+    auto count = std::min< std::size_t >( pListings->size(), 10 );
+
+    for( std::size_t j = 0; j < count; ++j )
+      priceSum += ( *pListings )[ j ].pricePerUnit;
+  }
+
+  auto elapsed = msSince( start );
+  Logger::info( "listing requests: {0:.0f} requests/s ( price sum {1} )", config.searches * 1000.0 / elapsed,
+                priceSum );
+
+  return 0;
+}
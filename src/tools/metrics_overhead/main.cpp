@@ -0,0 +1,223 @@
+#include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
+#include <Network/CommonNetwork.h>
+#include <Util/LockedQueue.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  // the world server is allowed to spend this much more time on a packet because of the metrics
+  const double MaxOverhead = 0.01;
+
+  const uint32_t PacketsPerUpdate = 16;
+
+  struct BenchConfig
+  {
+    uint32_t packets = 2000000;
+    uint32_t rounds = 9;
+  };
+
+  std::vector< Network::Packets::FFXIVARR_PACKET_RAW > makePackets( uint32_t count )
+  {
+    // a handful of opcodes with the sizes of movement, chat and action packets
+    const uint16_t opcodes[] = { 0x0129, 0x0102, 0x0346, 0x00D2, 0x0177, 0x03AE, 0x0140, 0x014B };
+    const uint32_t sizes[] = { 32, 48, 64, 112, 256 };
+
+    std::mt19937 rng( 42 );
+    std::vector< Network::Packets::FFXIVARR_PACKET_RAW > packets( count );
+
+    for( auto& packet : packets )
+    {
+      auto size = sizes[ rng() % 5 ];
+      packet.segHdr.size = size + sizeof( Network::Packets::FFXIVARR_PACKET_SEGMENT_HEADER );
+      packet.data.resize( size );
+      *reinterpret_cast< uint16_t* >( &packet.data[ 0x02 ] ) = opcodes[ rng() % 8 ];
+    }
+
+    return packets;
+  }
+
+  /*!
+   * @brief Runs packets through the inbound path of GameConnection
+   *
+   * Packets are copied into the locked queue as queueInPacket does and taken off in batches like a session
+   * update. With Instrumented the metrics of that path are updated as well: traffic per opcode for every
+   * packet and the queue depth histogram once per update.
+   */
+  template< bool Instrumented >
+  uint64_t runInboundPath( const std::vector< Network::Packets::FFXIVARR_PACKET_RAW >& packets,
+                           Common::Metrics::OpcodeCounters& traffic, Common::Metrics::Histogram& queueDepth )
+  {
+    Common::Util::LockedQueue< Network::Packets::FFXIVARR_PACKET_RAW > inQueue;
+    uint64_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for( std::size_t i = 0; i < packets.size(); ++i )
+    {
+      const auto& packet = packets[ i ];
+
+      if( Instrumented )
+        traffic.add( *reinterpret_cast< const uint16_t* >( &packet.data[ 0x02 ] ), packet.segHdr.size );
+
+      inQueue.push( packet );
+
+      if( ( i + 1 ) % PacketsPerUpdate != 0 )
+        continue;
+
+      if( Instrumented )
+        queueDepth.record( inQueue.size() );
+
+      while( inQueue.size() > 0 )
+      {
+        auto inPacket = inQueue.pop();
+        checksum += inPacket.data.size() + inPacket.data[ 0x02 ];
+      }
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // keeps the compiler from dropping the loop
+    if( checksum == 0 )
+      Logger::debug( "empty run" );
+
+    return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() );
+  }
+
+  // the shards of every thread have to add up to what was counted
+  bool checkCounts( Common::Metrics::OpcodeCounters& traffic, uint32_t threadCount, uint32_t packetsPerThread )
+  {
+    std::vector< std::thread > threads;
+    for( uint32_t i = 0; i < threadCount; ++i )
+    {
+      threads.emplace_back( [ & ]()
+      {
+        for( uint32_t packet = 0; packet < packetsPerThread; ++packet )
+          traffic.add( static_cast< uint16_t >( packet % 0x300 ), 40 );
+      } );
+    }
+
+    for( auto& thread : threads )
+      thread.join();
+
+    uint64_t packets = 0;
+    uint64_t bytes = 0;
+    for( const auto& totals : traffic.collect() )
+    {
+      packets += totals.packets;
+      bytes += totals.bytes;
+    }
+
+    uint64_t expected = static_cast< uint64_t >( threadCount ) * packetsPerThread;
+    if( packets != expected || bytes != expected * 40 )
+    {
+      Logger::error( "Counted {0} packets and {1} bytes, expected {2} and {3}", packets, bytes, expected, expected * 40 );
+      return false;
+    }
+
+    return true;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: metrics_overhead [options]" );
+    Logger::info( "  --packets <n>    packets per round ( 2000000 )" );
+    Logger::info( "  --rounds <n>     rounds of each variant, the fastest one counts ( 9 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/metrics_overhead" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--packets" )
+        config.packets = std::max< uint32_t >( PacketsPerUpdate, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  auto& checkTraffic = Common::Metrics::Registry::opcodeCounters( "bench_check", "Counted from several threads" );
+  if( !checkCounts( checkTraffic, 4, 100000 ) )
+    return 1;
+
+  auto packets = makePackets( config.packets );
+
+  auto& traffic = Common::Metrics::Registry::opcodeCounters( "bench_in", "Inbound ipc traffic by opcode" );
+  auto& queueDepth = Common::Metrics::Registry::histogram( "bench_in_queue_depth", "Inbound queue depth" );
+
+  // alternate the variants and which one goes first so frequency changes and warm caches hit both alike,
+  // the fastest round is the least disturbed one
+  uint64_t plainTime = UINT64_MAX;
+  uint64_t instrumentedTime = UINT64_MAX;
+
+  for( uint32_t round = 0; round < config.rounds; ++round )
+  {
+    if( round % 2 == 0 )
+    {
+      plainTime = std::min( plainTime, runInboundPath< false >( packets, traffic, queueDepth ) );
+      instrumentedTime = std::min( instrumentedTime, runInboundPath< true >( packets, traffic, queueDepth ) );
+    }
+    else
+    {
+      instrumentedTime = std::min( instrumentedTime, runInboundPath< true >( packets, traffic, queueDepth ) );
+      plainTime = std::min( plainTime, runInboundPath< false >( packets, traffic, queueDepth ) );
+    }
+  }
+
+  auto overhead = static_cast< double >( instrumentedTime ) / static_cast< double >( plainTime ) - 1.0;
+
+  Logger::info( "without metrics: {0:.1f} ns/packet", static_cast< double >( plainTime ) / config.packets );
+  Logger::info( "with metrics: {0:.1f} ns/packet", static_cast< double >( instrumentedTime ) / config.packets );
+  Logger::info( "overhead: {0:.2f}%", overhead * 100.0 );
+
+  if( overhead > MaxOverhead )
+  {
+    Logger::error( "Metrics overhead is above {0:.0f}%", MaxOverhead * 100.0 );
+    return 1;
+  }
+
+  return 0;
+}
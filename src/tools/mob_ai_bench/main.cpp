@@ -0,0 +1,462 @@
+#include <Logging/Logger.h>
+#include <Util/UtilMath.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t mobs = 1000;
+    uint32_t players = 30;
+    uint32_t seconds = 60;
+    uint32_t rounds = 3;
+  };
+
+  // the grid of CellHandler, 128 cells of 81.25 yalms on each side
+  const uint32_t GridSize = 128;
+  const float CellSize = 325.f / 4;
+  const float GridMin = -( GridSize * CellSize ) / 2;
+
+  // TerritoryMgr's default in range distance and the pace of Territory::updateBNpcs
+  const float InRangeDistance = 80.f;
+  const uint32_t MobTickMs = 250;
+
+  // BNpc::calculateAiLod and BNpc::update
+  const float FullAiRange = 50.f;
+  const uint64_t ReducedAiInterval = 1000;
+
+  // mobs of an open world zone, every player out-levels them so nobody gets pulled and they all stay idle
+  const uint8_t MobLevel = 50;
+  const uint8_t PlayerLevel = 90;
+
+  enum class AiLod : uint8_t
+  {
+    Full,
+    Reduced,
+    Dormant,
+  };
+
+  struct Actor;
+  using ActorPtr = std::shared_ptr< Actor >;
+
+  struct Actor
+  {
+    uint32_t id;
+    bool isPlayer;
+    uint8_t level;
+    float x, y, z;
+    uint32_t mobIndex;
+    std::set< ActorPtr > m_inRangeActor;
+    std::set< ActorPtr > m_inRangePlayers;
+  };
+
+  struct Cell
+  {
+    std::set< ActorPtr > m_actors;
+    uint32_t m_playerCount = 0;
+    bool m_bActive = false;
+  };
+
+  /*! mobs in camps around the zone and players standing around, some of them close to a camp */
+  struct World
+  {
+    std::vector< std::unique_ptr< Cell > > cells;
+    std::vector< ActorPtr > actors;
+    uint32_t mobCount = 0;
+
+    World( const BenchConfig& config )
+    {
+      std::mt19937 rng( 42 );
+      std::uniform_real_distribution< float > zone( -1000.f, 1000.f );
+      std::uniform_real_distribution< float > offset( -15.f, 15.f );
+
+      cells.resize( GridSize * GridSize );
+
+      std::vector< std::array< float, 2 > > camps;
+      for( uint32_t i = 0; i < ( config.mobs + 4 ) / 5; ++i )
+        camps.push_back( { zone( rng ), zone( rng ) } );
+
+      for( uint32_t i = 0; i < config.mobs; ++i )
+      {
+        auto& camp = camps[ i / 5 ];
+        auto pMob = std::make_shared< Actor >( Actor{ 0x40000000 + i, false, MobLevel,
+                                                      camp[ 0 ] + offset( rng ), 0.f, camp[ 1 ] + offset( rng ), i } );
+        actors.push_back( pMob );
+      }
+      mobCount = config.mobs;
+
+      for( uint32_t i = 0; i < config.players; ++i )
+      {
+        float x, z;
+        // every other player is at a camp, within full ai range of it
+        if( i % 2 == 0 )
+        {
+          auto& camp = camps[ rng() % camps.size() ];
+          x = camp[ 0 ] + 20.f + offset( rng );
+          z = camp[ 1 ] + 20.f + offset( rng );
+        }
+        else
+        {
+          x = zone( rng );
+          z = zone( rng );
+        }
+
+        actors.push_back( std::make_shared< Actor >( Actor{ 0x10000000 + i, true, PlayerLevel, x, 0.f, z, 0 } ) );
+      }
+
+      for( auto& pActor : actors )
+      {
+        auto& pCell = cells[ cellIndex( cellCoord( pActor->x ), cellCoord( pActor->z ) ) ];
+        if( !pCell )
+          pCell = std::make_unique< Cell >();
+
+        pCell->m_actors.insert( pActor );
+        if( pActor->isPlayer )
+          pCell->m_playerCount++;
+      }
+
+      // Territory::updateCellActivity, run for every player cell with the radius of a spawn
+      for( uint32_t y = 0; y < GridSize; ++y )
+      {
+        for( uint32_t x = 0; x < GridSize; ++x )
+        {
+          if( isCellActive( x, y ) )
+          {
+            auto& pCell = cells[ cellIndex( x, y ) ];
+            if( !pCell )
+              pCell = std::make_unique< Cell >();
+            pCell->m_bActive = true;
+          }
+        }
+      }
+
+      // Territory::updateInRangeSet
+      for( std::size_t i = 0; i < actors.size(); ++i )
+      {
+        for( std::size_t j = i + 1; j < actors.size(); ++j )
+        {
+          auto& a = actors[ i ];
+          auto& b = actors[ j ];
+          if( Common::Util::distance( a->x, a->y, a->z, b->x, b->y, b->z ) > InRangeDistance )
+            continue;
+
+          a->m_inRangeActor.insert( b );
+          b->m_inRangeActor.insert( a );
+          if( b->isPlayer )
+            a->m_inRangePlayers.insert( b );
+          if( a->isPlayer )
+            b->m_inRangePlayers.insert( a );
+        }
+      }
+    }
+
+    static uint32_t cellCoord( float pos )
+    {
+      return std::min( GridSize - 1, static_cast< uint32_t >( ( pos - GridMin ) / CellSize ) );
+    }
+
+    static uint32_t cellIndex( uint32_t x, uint32_t y )
+    {
+      return y * GridSize + x;
+    }
+
+    Cell* getCellPtr( uint32_t x, uint32_t y ) const
+    {
+      if( x >= GridSize || y >= GridSize )
+        return nullptr;
+      return cells[ cellIndex( x, y ) ].get();
+    }
+
+    // the 3x3 probe Territory::isCellActive does
+    bool isCellActive( uint32_t x, uint32_t y ) const
+    {
+      uint32_t endX = ( ( x + 1 ) <= GridSize ) ? x + 1 : ( GridSize - 1 );
+      uint32_t endY = ( ( y + 1 ) <= GridSize ) ? y + 1 : ( GridSize - 1 );
+      uint32_t startX = x > 0 ? x - 1 : 0;
+      uint32_t startY = y > 0 ? y - 1 : 0;
+
+      for( auto posX = startX; posX <= endX; posX++ )
+      {
+        for( auto posY = startY; posY <= endY; posY++ )
+        {
+          auto pCell = getCellPtr( posX, posY );
+          if( pCell && pCell->m_playerCount > 0 )
+            return true;
+        }
+      }
+
+      return false;
+    }
+  };
+
+  float distance( const Actor& a, const Actor& b )
+  {
+    return Common::Util::distance( a.x, a.y, a.z, b.x, b.y, b.z );
+  }
+
+  /*! range BNpc::checkAggro pulls from, 0 once the player is ten levels above the mob */
+  float aggroRange( const Actor& mob, const Actor& player )
+  {
+    float range = 13.f;
+    if( player.level > mob.level )
+    {
+      auto levelDiff = std::abs( player.level - mob.level );
+      if( levelDiff >= 10 )
+        range = 0.f;
+      else
+        range = std::max< float >( 0.f, range - std::pow( 1.53f, levelDiff * 0.6f ) );
+    }
+    return range;
+  }
+
+  struct PassStats
+  {
+    uint64_t visited = 0;
+    // runs of the ai state machine, every one of them syncs the position with the navmesh
+    uint64_t aiRuns = 0;
+    uint64_t aggros = 0;
+  };
+
+  /*! updateBNpcs probing the neighbours of every cell and every mob running its ai on every mob tick */
+  struct FullRateAi
+  {
+    explicit FullRateAi( const World& ) {}
+
+    bool isCellActive( const World& world, uint32_t x, uint32_t y, const Cell& )
+    {
+      return world.isCellActive( x, y );
+    }
+
+    void update( Actor& mob, uint64_t, PassStats& stats )
+    {
+      stats.aiRuns++;
+
+      // checkAggro through Actor::getClosestChara, which walks every actor in range
+      ActorPtr pClosest = nullptr;
+      float minDistance = 10000;
+      for( const auto& pCurAct : mob.m_inRangeActor )
+      {
+        float actorDistance = distance( mob, *pCurAct );
+        if( actorDistance < minDistance )
+        {
+          minDistance = actorDistance;
+          pClosest = pCurAct;
+        }
+      }
+
+      if( pClosest && pClosest->isPlayer && distance( mob, *pClosest ) < aggroRange( mob, *pClosest ) )
+        stats.aggros++;
+    }
+  };
+
+  /*! updateBNpcs reading the activity flag, and the ai level of detail of every mob */
+  struct LodAi
+  {
+    std::vector< uint64_t > lastAiUpdate;
+
+    explicit LodAi( const World& world ) :
+      lastAiUpdate( world.mobCount, 0 )
+    {
+    }
+
+    bool isCellActive( const World&, uint32_t, uint32_t, const Cell& cell )
+    {
+      return cell.m_bActive;
+    }
+
+    static ActorPtr getClosestPlayer( const Actor& mob )
+    {
+      ActorPtr pClosestPlayer = nullptr;
+      float minDistanceSq = 0;
+
+      for( const auto& pPlayer : mob.m_inRangePlayers )
+      {
+        float distanceSq = Common::Util::distanceSq( mob.x, mob.y, mob.z, pPlayer->x, pPlayer->y, pPlayer->z );
+        if( !pClosestPlayer || distanceSq < minDistanceSq )
+        {
+          minDistanceSq = distanceSq;
+          pClosestPlayer = pPlayer;
+        }
+      }
+
+      return pClosestPlayer;
+    }
+
+    void update( Actor& mob, uint64_t tickCount, PassStats& stats )
+    {
+      // an idle mob with an empty hate list, the tier only depends on the closest player
+      auto pClosestPlayer = getClosestPlayer( mob );
+      auto lod = AiLod::Dormant;
+      if( pClosestPlayer )
+        lod = distance( mob, *pClosestPlayer ) <= FullAiRange ? AiLod::Full : AiLod::Reduced;
+
+      if( lod == AiLod::Dormant )
+        return;
+
+      auto& lastUpdate = lastAiUpdate[ mob.mobIndex ];
+      if( lod == AiLod::Reduced && ( tickCount - lastUpdate ) < ReducedAiInterval )
+        return;
+
+      lastUpdate = tickCount;
+      stats.aiRuns++;
+
+      auto pClosest = getClosestPlayer( mob );
+      if( pClosest && distance( mob, *pClosest ) < aggroRange( mob, *pClosest ) )
+        stats.aggros++;
+    }
+  };
+
+  struct AiResult
+  {
+    double seconds = 1e9;
+    PassStats stats;
+  };
+
+  template< typename Ai >
+  AiResult run( const BenchConfig& config, const World& world )
+  {
+    AiResult best;
+    auto passes = config.seconds * 1000 / MobTickMs;
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      Ai ai( world );
+      PassStats stats;
+
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint64_t pass = 1; pass <= passes; ++pass )
+      {
+        auto tickCount = pass * MobTickMs;
+
+        // Territory::updateBNpcs, collected first since updates may move mobs between cells
+        std::vector< ActorPtr > activeBNpcs;
+        for( uint32_t y = 0; y < GridSize; ++y )
+        {
+          for( uint32_t x = 0; x < GridSize; ++x )
+          {
+            auto pCell = world.getCellPtr( x, y );
+            if( !pCell || !ai.isCellActive( world, x, y, *pCell ) )
+              continue;
+
+            for( const auto& pActor : pCell->m_actors )
+            {
+              if( !pActor->isPlayer )
+                activeBNpcs.push_back( pActor );
+            }
+          }
+        }
+
+        stats.visited += activeBNpcs.size();
+        for( const auto& pMob : activeBNpcs )
+          ai.update( *pMob, tickCount, stats );
+      }
+
+      auto seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+      if( seconds < best.seconds )
+        best = { seconds, stats };
+    }
+
+    return best;
+  }
+
+  void report( const char* name, const BenchConfig& config, const World& world, const AiResult& result )
+  {
+    auto passes = config.seconds * 1000 / MobTickMs;
+    Logger::info( "{0}: {1:.1f} us per mob tick, {2:.1f} us of cpu per second and 1000 mobs, "
+                  "{3:.0f} mobs updated and {4:.0f} ai runs per second", name,
+                  result.seconds * 1e6 / passes, result.seconds * 1e6 / config.seconds * 1000 / world.mobCount,
+                  static_cast< double >( result.stats.visited ) / config.seconds,
+                  static_cast< double >( result.stats.aiRuns ) / config.seconds );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: mob_ai_bench [options]" );
+    Logger::info( "  --mobs <n>      idle mobs in the zone, in camps of five ( 1000 )" );
+    Logger::info( "  --players <n>   players standing around, every other one at a camp ( 30 )" );
+    Logger::info( "  --seconds <n>   simulated seconds ( 60 )" );
+    Logger::info( "  --rounds <n>    rounds of each variant, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/mob_ai_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--mobs" )
+        config.mobs = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--players" )
+        config.players = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--seconds" )
+        config.seconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  World world( config );
+
+  auto fullRate = run< FullRateAi >( config, world );
+  auto lod = run< LodAi >( config, world );
+
+  Logger::info( "{0} idle mobs, {1} players, {2} seconds, fastest of {3} rounds", config.mobs, config.players,
+                config.seconds, config.rounds );
+  report( "full rate", config, world, fullRate );
+  report( "level of detail", config, world, lod );
+
+  // both have to visit the same active cells, and nobody may be pulled by either
+  if( fullRate.stats.visited != lod.stats.visited || fullRate.stats.aggros != 0 || lod.stats.aggros != 0 )
+  {
+    Logger::error( "Visited {0} and {1} mobs, {2} and {3} aggroed", fullRate.stats.visited, lod.stats.visited,
+                   fullRate.stats.aggros, lod.stats.aggros );
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,412 @@
+#include <Logging/Logger.h>
+
+#include <Network/PacketDef/Ipcs.h>
+
+#include <Network/InPacketQueue.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+using namespace Sapphire::Network;
+using namespace Sapphire::Network::Packets;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t clients = 50;
+    uint32_t flooders = 2;
+    uint32_t flood = 2000;
+    uint32_t seconds = 10;
+    uint32_t tickMs = 50;
+    uint32_t costUs = 20;
+  };
+
+  // the world.ini defaults
+  const InPacketBudget Budget{ 64, 5000, 300, 512 };
+
+  const std::size_t SeqOffset = 0x10;
+
+  struct Client
+  {
+    bool isFlooder = false;
+    bool isConnected = true;
+    uint32_t nextSeq = 1;
+    uint32_t disconnectSecond = 0;
+
+    InPacketQueue queue;
+    InPacketRateGuard guard;
+
+    // latest position update sent up to the last drain and the last ones handled
+    uint32_t lastPositionSent = 0;
+    uint32_t lastPositionHandled = 0;
+    uint32_t lastSkillHandled = 0;
+    uint32_t lastPingHandled = 0;
+    uint32_t lastChatHandled = 0;
+
+    // the arrival order queue the tick used to drain completely
+    std::deque< FFXIVARR_PACKET_RAW > arrivalQueue;
+  };
+
+  struct TickStats
+  {
+    std::vector< double > tickMs;
+    uint64_t handled = 0;
+    uint64_t dropped = 0;
+    uint32_t maxLegitBacklog = 0;
+  };
+
+  FFXIVARR_PACKET_RAW makePacket( uint16_t opcode, uint32_t seq )
+  {
+    FFXIVARR_PACKET_RAW packet{};
+    packet.data.resize( 0x20 );
+    std::memcpy( &packet.data[ 0x02 ], &opcode, sizeof( opcode ) );
+    std::memcpy( &packet.data[ SeqOffset ], &seq, sizeof( seq ) );
+    return packet;
+  }
+
+  uint16_t getOpcode( const FFXIVARR_PACKET_RAW& packet )
+  {
+    uint16_t opcode;
+    std::memcpy( &opcode, &packet.data[ 0x02 ], sizeof( opcode ) );
+    return opcode;
+  }
+
+  uint32_t getSeq( const FFXIVARR_PACKET_RAW& packet )
+  {
+    uint32_t seq;
+    std::memcpy( &seq, &packet.data[ SeqOffset ], sizeof( seq ) );
+    return seq;
+  }
+
+  PacketPriority getPriority( uint16_t opcode )
+  {
+    if( opcode == PingHandler )
+      return PacketPriority::High;
+    if( opcode == ChatHandler )
+      return PacketPriority::Low;
+    return PacketPriority::Normal;
+  }
+
+  // what the client sends during one tick, a player moving and casting or a flooder mixing the same packets
+  std::vector< uint16_t > makeTickPackets( const BenchConfig& config, const Client& client, uint32_t tick )
+  {
+    std::vector< uint16_t > opcodes;
+
+    if( !client.isFlooder )
+    {
+      opcodes.push_back( UpdatePositionHandler );
+      if( tick % 4 == 0 )
+        opcodes.push_back( SkillHandler );
+      if( tick % 20 == 0 )
+        opcodes.push_back( PingHandler );
+      if( tick % 20 == 10 )
+        opcodes.push_back( ChatHandler );
+      return opcodes;
+    }
+
+    auto count = config.flood * config.tickMs / 1000;
+    for( uint32_t i = 0; i < count; ++i )
+    {
+      auto pick = ( tick * count + i ) % 10;
+      opcodes.push_back( pick < 7 ? UpdatePositionHandler : pick < 9 ? SkillHandler : ChatHandler );
+    }
+    return opcodes;
+  }
+
+  // stands in for the handlers, every packet costs the same
+  void burn( uint32_t costUs )
+  {
+    auto until = std::chrono::steady_clock::now() + std::chrono::microseconds( costUs );
+    while( std::chrono::steady_clock::now() < until )
+    {
+    }
+  }
+
+  /*!
+   * @brief Checks a handled packet against what the client sent
+   *
+   * Packets of one priority come out in the order they were sent, a handled position update is always the latest
+   * one the client had sent when its packets were drained.
+   */
+  bool checkHandled( Client& client, const FFXIVARR_PACKET_RAW& packet, uint32_t clientId )
+  {
+    auto opcode = getOpcode( packet );
+    auto seq = getSeq( packet );
+
+    uint32_t* pLast = &client.lastSkillHandled;
+    if( opcode == UpdatePositionHandler )
+      pLast = &client.lastPositionHandled;
+    else if( opcode == PingHandler )
+      pLast = &client.lastPingHandled;
+    else if( opcode == ChatHandler )
+      pLast = &client.lastChatHandled;
+
+    if( seq <= *pLast )
+    {
+      Logger::error( "client#{0}: packet {1:04X} #{2} handled after #{3}", clientId, opcode, seq, *pLast );
+      return false;
+    }
+    *pLast = seq;
+
+    if( opcode == UpdatePositionHandler && seq != client.lastPositionSent )
+    {
+      Logger::error( "client#{0}: position #{1} handled while #{2} was queued", clientId, seq,
+                     client.lastPositionSent );
+      return false;
+    }
+
+    return true;
+  }
+
+  void report( const char* name, TickStats& stats )
+  {
+    auto& ticks = stats.tickMs;
+    double sum = 0;
+    for( auto ms : ticks )
+      sum += ms;
+    auto mean = sum / ticks.size();
+
+    double variance = 0;
+    for( auto ms : ticks )
+      variance += ( ms - mean ) * ( ms - mean );
+    variance /= ticks.size();
+
+    std::sort( ticks.begin(), ticks.end() );
+    auto p99 = ticks[ std::min< std::size_t >( ticks.size() - 1, ticks.size() * 99 / 100 ) ];
+
+    Logger::info( "{0}: tick mean {1:.2f} ms, stddev {2:.2f} ms, variance {3:.3f} ms2, p99 {4:.2f} ms, "
+                  "max {5:.2f} ms", name, mean, std::sqrt( variance ), variance, p99, ticks.back() );
+    Logger::info( "{0}: {1} packets handled, {2} dropped, largest player backlog {3}", name, stats.handled,
+                  stats.dropped, stats.maxLegitBacklog );
+  }
+
+  std::vector< Client > makeClients( const BenchConfig& config )
+  {
+    std::vector< Client > clients( config.clients + config.flooders );
+    for( uint32_t i = 0; i < config.flooders; ++i )
+      clients[ config.clients + i ].isFlooder = true;
+    return clients;
+  }
+
+  // every packet in arrival order in the tick it arrived, the way the session update drained its queue before
+  TickStats runArrivalOrder( const BenchConfig& config )
+  {
+    auto clients = makeClients( config );
+    auto tickCount = config.seconds * 1000 / config.tickMs;
+
+    TickStats stats;
+    for( uint32_t tick = 0; tick < tickCount; ++tick )
+    {
+      auto start = std::chrono::steady_clock::now();
+
+      for( auto& client : clients )
+      {
+        for( auto opcode : makeTickPackets( config, client, tick ) )
+          client.arrivalQueue.push_back( makePacket( opcode, client.nextSeq++ ) );
+
+        while( !client.arrivalQueue.empty() )
+        {
+          client.arrivalQueue.pop_front();
+          burn( config.costUs );
+          ++stats.handled;
+        }
+      }
+
+      stats.tickMs.push_back(
+        std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - start ).count() /
+        1000.0 );
+    }
+
+    return stats;
+  }
+
+  /*!
+   * @brief The same traffic through InPacketQueue and InPacketRateGuard, the way GameConnection and Session use them
+   * @return false if a check failed
+   */
+  bool runScheduled( const BenchConfig& config, TickStats& stats )
+  {
+    auto clients = makeClients( config );
+    auto tickCount = config.seconds * 1000 / config.tickMs;
+
+    for( uint32_t tick = 0; tick < tickCount; ++tick )
+    {
+      auto currTime = tick * config.tickMs / 1000;
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint32_t clientId = 0; clientId < clients.size(); ++clientId )
+      {
+        auto& client = clients[ clientId ];
+        if( !client.isConnected )
+          continue;
+
+        for( auto opcode : makeTickPackets( config, client, tick ) )
+        {
+          auto seq = client.nextSeq++;
+
+          if( client.queue.countArrival( currTime, Budget.rateLimit ) &&
+              client.guard.onRateExceeded( currTime ) == InPacketRateGuard::Action::Disconnect )
+          {
+            client.queue.clear();
+            client.isConnected = false;
+            client.disconnectSecond = currTime;
+            break;
+          }
+
+          if( opcode == UpdatePositionHandler )
+            client.lastPositionSent = seq;
+
+          client.queue.push( makePacket( opcode, seq ), getPriority( opcode ), opcode == UpdatePositionHandler );
+        }
+
+        if( !client.isConnected )
+          continue;
+
+        if( client.queue.size() > Budget.maxQueued )
+        {
+          stats.dropped += client.queue.dropLowPriority();
+          if( client.queue.size() > Budget.maxQueued )
+          {
+            client.queue.clear();
+            client.isConnected = false;
+            client.disconnectSecond = currTime;
+            continue;
+          }
+        }
+
+        bool success = true;
+        client.queue.process( client.guard.apply( Budget, currTime ), [ & ]( FFXIVARR_PACKET_RAW& packet )
+        {
+          success = checkHandled( client, packet, clientId ) && success;
+          burn( config.costUs );
+          ++stats.handled;
+        } );
+
+        if( !success )
+          return false;
+
+        if( !client.isFlooder )
+          stats.maxLegitBacklog = std::max( stats.maxLegitBacklog, static_cast< uint32_t >( client.queue.size() ) );
+      }
+
+      stats.tickMs.push_back(
+        std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - start ).count() /
+        1000.0 );
+    }
+
+    for( uint32_t clientId = 0; clientId < clients.size(); ++clientId )
+    {
+      const auto& client = clients[ clientId ];
+
+      if( !client.isFlooder && ( client.guard.getStrikes() != 0 || !client.isConnected ) )
+      {
+        Logger::error( "client#{0} stayed under the rate limit but got {1} strikes", clientId,
+                       client.guard.getStrikes() );
+        return false;
+      }
+
+      if( client.isFlooder && config.flood > Budget.rateLimit )
+      {
+        if( client.isConnected || client.disconnectSecond >= InPacketRateGuard::MaxStrikes )
+        {
+          Logger::error( "flooder client#{0} was not disconnected after {1} strikes", clientId,
+                         InPacketRateGuard::MaxStrikes );
+          return false;
+        }
+
+        Logger::info( "flooder client#{0} throttled and disconnected in second {1}", clientId,
+                      client.disconnectSecond );
+      }
+    }
+
+    return true;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: packet_flood [options]" );
+    Logger::info( "  --clients <n>    players sending a normal packet mix ( 50 )" );
+    Logger::info( "  --flooders <n>   clients flooding the server ( 2 )" );
+    Logger::info( "  --flood <n>      packets per second of every flooder ( 2000 )" );
+    Logger::info( "  --seconds <n>    simulated seconds ( 10 )" );
+    Logger::info( "  --tick <ms>      time between two session updates ( 50 )" );
+    Logger::info( "  --cost <us>      time a handler spends on a packet ( 20 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/packet_flood" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--clients" )
+        config.clients = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--flooders" )
+        config.flooders = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--flood" )
+        config.flood = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--seconds" )
+        config.seconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--tick" )
+        config.tickMs = std::clamp< uint32_t >( static_cast< uint32_t >( std::stoul( value ) ), 1, 1000 );
+      else if( arg == "--cost" )
+        config.costUs = static_cast< uint32_t >( std::stoul( value ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  if( config.clients + config.flooders == 0 )
+  {
+    printUsage();
+    return 1;
+  }
+
+  auto arrivalStats = runArrivalOrder( config );
+  report( "arrival order", arrivalStats );
+
+  TickStats scheduledStats;
+  if( !runScheduled( config, scheduledStats ) )
+    return 1;
+  report( "scheduled", scheduledStats );
+
+  return 0;
+}
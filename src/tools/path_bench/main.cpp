@@ -0,0 +1,259 @@
+#include <Logging/Logger.h>
+
+#include <Navi/NaviProvider.h>
+#include <Navi/PathQueue.h>
+#include <Navi/PathWorkerPool.h>
+
+#include <recastnavigation/Detour/Include/DetourNavMesh.h>
+#include <recastnavigation/Detour/Include/DetourNavMeshQuery.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Sapphire;
+using namespace Sapphire::World;
+
+namespace
+{
+  struct BenchConfig
+  {
+    std::string meshPath;
+    uint32_t requests = 500;
+    uint32_t workers = 2;
+    uint32_t tickMs = 50;
+  };
+
+  struct PathRequest
+  {
+    float startPos[ 3 ];
+    float endPos[ 3 ];
+  };
+
+  // what dtCrowd uses to place agents with the 10 yalm agent radius of NaviProvider
+  const float HalfExtents[ 3 ] = { 20.f, 1.5f, 20.f };
+
+  std::mt19937 g_rng( 5 );
+
+  float randomFloat()
+  {
+    return std::uniform_real_distribution< float >( 0.f, 1.f )( g_rng );
+  }
+
+  double msSince( std::chrono::steady_clock::time_point start )
+  {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() / 1000.0;
+  }
+
+  // the same search as PathQueue runs, on the calling thread the way the tick used to do it
+  Navi::PathQueue::CorridorPtr searchInline( const dtNavMeshQuery& query, const dtQueryFilter& filter,
+                                             const PathRequest& request )
+  {
+    dtPolyRef startRef = 0;
+    dtPolyRef endRef = 0;
+
+    query.findNearestPoly( request.startPos, HalfExtents, &filter, &startRef, nullptr );
+    query.findNearestPoly( request.endPos, HalfExtents, &filter, &endRef, nullptr );
+
+    if( !startRef || !endRef )
+      return nullptr;
+
+    dtPolyRef polys[ Navi::PathQueue::MAX_PATH_POLYS ];
+    int32_t numPolys = 0;
+
+    auto status = query.findPath( startRef, endRef, request.startPos, request.endPos, &filter,
+                                  polys, &numPolys, Navi::PathQueue::MAX_PATH_POLYS );
+
+    if( dtStatusFailed( status ) || numPolys == 0 )
+      return nullptr;
+
+    auto pCorridor = std::make_shared< Navi::PathQueue::Corridor >();
+    pCorridor->polys.assign( polys, polys + numPolys );
+    pCorridor->endRef = polys[ numPolys - 1 ];
+    pCorridor->partial = pCorridor->endRef != endRef;
+
+    return pCorridor;
+  }
+
+  /*!
+   * @brief Queues every request and takes the results once per tick until all of them came back
+   * @return false if a result is missing or differs from the inline search
+   */
+  bool runQueued( const BenchConfig& config, Navi::PathQueue& queue, const std::vector< PathRequest >& requests,
+                  const std::vector< Navi::PathQueue::CorridorPtr >& expected, const char* name )
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    for( uint32_t i = 0; i < requests.size(); ++i )
+      queue.request( static_cast< int32_t >( i ), 1, requests[ i ].startPos, requests[ i ].endPos );
+
+    auto requestMs = msSince( start );
+
+    std::vector< Navi::PathQueue::Result > results;
+    std::vector< bool > received( requests.size(), false );
+    std::size_t receivedCount = 0;
+    double maxTakeMs = 0;
+    uint32_t ticks = 0;
+
+    while( receivedCount < requests.size() )
+    {
+      auto takeStart = std::chrono::steady_clock::now();
+      queue.takeResults( results );
+      maxTakeMs = std::max( maxTakeMs, msSince( takeStart ) );
+
+      for( const auto& result : results )
+      {
+        const auto& pExpected = expected[ result.agentId ];
+
+        bool same = !pExpected ? !result.pCorridor :
+                    result.pCorridor && result.pCorridor->polys == pExpected->polys;
+
+        if( received[ result.agentId ] || !same )
+        {
+          Logger::error( "{0}: {1} result for request#{2}", name, received[ result.agentId ] ? "second" : "wrong",
+                         result.agentId );
+          return false;
+        }
+
+        received[ result.agentId ] = true;
+        ++receivedCount;
+      }
+
+      if( receivedCount < requests.size() )
+      {
+        std::this_thread::sleep_for( std::chrono::milliseconds( config.tickMs ) );
+        ++ticks;
+      }
+    }
+
+    Logger::info( "{0}: {1:.2f} ms to queue, all results after {2:.1f} ms and {3} ticks, "
+                  "longest takeResults {4:.3f} ms", name, requestMs, msSince( start ), ticks, maxTakeMs );
+
+    return true;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: path_bench --mesh <file> [options]" );
+    Logger::info( "  --mesh <file>      navmesh exported by nav_export" );
+    Logger::info( "  --requests <n>     path requests between random points ( 500 )" );
+    Logger::info( "  --workers <n>      path worker threads ( 2 )" );
+    Logger::info( "  --tick <ms>        time between two takeResults calls ( 50 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/path_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--mesh" )
+        config.meshPath = value;
+      else if( arg == "--requests" )
+        config.requests = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--workers" )
+        config.workers = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--tick" )
+        config.tickMs = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  if( config.meshPath.empty() )
+  {
+    printUsage();
+    return 1;
+  }
+
+  Navi::NaviProvider provider( "path_bench" );
+  if( !provider.loadMesh( config.meshPath ) )
+    return 1;
+
+  const auto& naviMesh = *provider.getNaviMesh();
+
+  auto pQuery = dtAllocNavMeshQuery();
+  if( !pQuery || dtStatusFailed( pQuery->init( &naviMesh, 2048 ) ) )
+  {
+    Logger::error( "Could not init navmesh query" );
+    return 1;
+  }
+
+  dtQueryFilter filter;
+
+  std::vector< PathRequest > requests( config.requests );
+  for( auto& request : requests )
+  {
+    dtPolyRef ref;
+    pQuery->findRandomPoint( &filter, randomFloat, &ref, request.startPos );
+    pQuery->findRandomPoint( &filter, randomFloat, &ref, request.endPos );
+  }
+
+  // every search inside one tick, the way bnpcs searched their paths before the path workers
+  std::vector< Navi::PathQueue::CorridorPtr > expected;
+  expected.reserve( requests.size() );
+
+  auto start = std::chrono::steady_clock::now();
+  for( const auto& request : requests )
+    expected.push_back( searchInline( *pQuery, filter, request ) );
+  auto inlineMs = msSince( start );
+
+  auto found = std::count_if( expected.begin(), expected.end(), []( const Navi::PathQueue::CorridorPtr& pCorridor )
+  {
+    return pCorridor != nullptr;
+  } );
+
+  Logger::info( "inline: {0} of {1} paths found, the tick is blocked for {2:.1f} ms", found, requests.size(),
+                inlineMs );
+
+  bool success = true;
+
+  {
+    Navi::PathWorkerPool workers( config.workers );
+    auto pQueue = std::make_shared< Navi::PathQueue >( workers, naviMesh, filter, HalfExtents, requests.size() );
+
+    // the second run finds every corridor in the cache
+    success = runQueued( config, *pQueue, requests, expected, "path workers" ) &&
+              runQueued( config, *pQueue, requests, expected, "path cache" );
+  }
+
+  dtFreeNavMeshQuery( pQuery );
+
+  return success ? 0 : 1;
+}
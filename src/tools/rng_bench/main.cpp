@@ -0,0 +1,158 @@
+#include <Logging/Logger.h>
+
+#include <Manager/RNGMgr.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+
+using namespace Sapphire;
+
+namespace
+{
+  const float Pi = 3.14159265f;
+
+  struct BenchConfig
+  {
+    uint32_t rolls = 10000000;
+    uint32_t spawns = 2000;
+  };
+
+  // RandGenerator before it drew from a shared engine, every instance seeded its own mt19937
+  template< typename T >
+  class LegacyRandGenerator
+  {
+  public:
+    LegacyRandGenerator( T minRange, T maxRange ) :
+      m_dist( minRange, maxRange ),
+      m_engine( *engineSeed() )
+    {
+    }
+
+    T next()
+    {
+      return m_dist( m_engine );
+    }
+
+  private:
+    static std::unique_ptr< std::seed_seq > engineSeed()
+    {
+      std::array< uint32_t, std::mt19937::state_size > seedArray;
+      std::random_device rd;
+
+      std::generate_n( seedArray.data(), seedArray.size(), std::ref( rd ) );
+      return std::make_unique< std::seed_seq >( std::begin( seedArray ), std::end( seedArray ) );
+    }
+
+    std::uniform_real_distribution< T > m_dist;
+    std::mt19937 m_engine;
+  };
+
+  // the statics CalcStats rolled its crits and damage variance on
+  std::random_device g_dev;
+  std::mt19937 g_rng( g_dev() );
+  std::uniform_int_distribution< std::mt19937::result_type > g_range100( 0, 99 );
+
+  template< typename Roll >
+  double nsPerRoll( uint32_t count, Roll roll )
+  {
+    // summed so the compiler can't drop the rolls
+    double sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for( uint32_t i = 0; i < count; ++i )
+      sum += roll();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if( sum < 0 )
+      Logger::debug( "negative sum" );
+
+    return static_cast< double >( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) / count;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: rng_bench [options]" );
+    Logger::info( "  --rolls <n>      range100 rolls of each variant ( 10000000 )" );
+    Logger::info( "  --spawns <n>     spawn rotation rolls of each variant ( 2000 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/rng_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--rolls" )
+        config.rolls = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--spawns" )
+        config.spawns = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  // an engine of a territory, the way TerritoryMgr creates them
+  World::Manager::RNGMgr rngMgr( 1 );
+  auto engine = rngMgr.createEngine( 1 );
+
+  auto legacySpawn = nsPerRoll( config.spawns, []()
+  {
+    return LegacyRandGenerator< float >( 0.f, 2 * Pi ).next();
+  } );
+
+  auto spawn = nsPerRoll( config.spawns, [ & ]()
+  {
+    return World::Manager::RandGenerator< float >( engine, 0.f, 2 * Pi ).next();
+  } );
+
+  auto legacyRange100 = nsPerRoll( config.rolls, []()
+  {
+    return g_range100( g_rng );
+  } );
+
+  auto range100 = nsPerRoll( config.rolls, [ & ]()
+  {
+    return engine.nextUInt( 100 );
+  } );
+
+  Logger::info( "spawn rotation: {0:.1f} ns/roll before, {1:.1f} ns/roll now", legacySpawn, spawn );
+  Logger::info( "range100: {0:.1f} ns/roll before, {1:.1f} ns/roll now", legacyRange100, range100 );
+
+  return 0;
+}
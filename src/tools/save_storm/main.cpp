@@ -0,0 +1,244 @@
+#include <Logging/Logger.h>
+
+#include <Database/PreparedStatement.h>
+#include <Database/PreparedStatementPool.h>
+#include <Database/ZoneDbConnection.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  std::atomic< uint64_t > g_allocations( 0 );
+}
+
+// counts every heap allocation of the process, the storms below are the only thing running while they are read
+void* operator new( std::size_t size )
+{
+  ++g_allocations;
+  if( auto pBlock = std::malloc( size ? size : 1 ) )
+    return pBlock;
+  throw std::bad_alloc();
+}
+
+void operator delete( void* pBlock ) noexcept
+{
+  std::free( pBlock );
+}
+
+void operator delete( void* pBlock, std::size_t ) noexcept
+{
+  std::free( pBlock );
+}
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t players = 1000;
+    uint32_t rounds = 10;
+    uint32_t queue = 32;
+    uint32_t quests = 20;
+  };
+
+  using StatementPtr = std::shared_ptr< Db::PreparedStatement >;
+
+  struct SaveData
+  {
+    std::string name;
+    std::string searchComment;
+    std::vector< uint8_t > customize;
+    std::vector< uint8_t > modelEquip;
+    std::vector< uint8_t > unlocks;
+    std::vector< uint8_t > classes;
+  };
+
+  double msSince( std::chrono::steady_clock::time_point start )
+  {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() / 1000.0;
+  }
+
+  /*!
+   * @brief The statements of Player::updateSql, handed to the db worker through queue
+   *
+   * Binds the parameter types updateSql binds, the values don't matter for the allocations.
+   */
+  template< typename Acquire >
+  void savePlayer( const BenchConfig& config, const SaveData& data, uint32_t playerId, Acquire&& acquire,
+                   std::vector< StatementPtr >& queue )
+  {
+    auto stmt = acquire( Db::CHARA_UP );
+    for( uint8_t i = 1; i <= 55; ++i )
+    {
+      if( i == 9 )
+        stmt->setBinary( i, data.customize );
+      else if( i == 13 )
+        stmt->setBinary( i, data.modelEquip );
+      else if( ( i >= 37 && i <= 46 ) || i == 51 || i == 53 )
+        stmt->setBinary( i, data.unlocks );
+      else
+        stmt->setInt( i, static_cast< int32_t >( playerId + i ) );
+    }
+    stmt->setInt( 56, static_cast< int32_t >( playerId ) );
+    queue.push_back( std::move( stmt ) );
+
+    stmt = acquire( Db::CHARA_CLASS_UP );
+    stmt->setBinary( 1, data.classes );
+    stmt->setInt( 2, static_cast< int32_t >( playerId ) );
+    queue.push_back( std::move( stmt ) );
+
+    stmt = acquire( Db::CHARA_SEARCHINFO_UP_SELECTCLASS );
+    stmt->setInt( 1, 1 );
+    stmt->setInt( 2, static_cast< int32_t >( playerId ) );
+    queue.push_back( std::move( stmt ) );
+
+    stmt = acquire( Db::CHARA_SEARCHINFO_UP_SELECTREGION );
+    stmt->setInt( 1, 1 );
+    stmt->setInt( 2, static_cast< int32_t >( playerId ) );
+    queue.push_back( std::move( stmt ) );
+
+    stmt = acquire( Db::CHARA_SEARCHINFO_UP_SEARCHCOMMENT );
+    stmt->setString( 1, data.searchComment );
+    stmt->setInt( 2, static_cast< int32_t >( playerId ) );
+    queue.push_back( std::move( stmt ) );
+
+    for( uint32_t quest = 0; quest < config.quests; ++quest )
+    {
+      stmt = acquire( Db::CHARA_QUEST_UP );
+      for( uint8_t i = 1; i <= 10; ++i )
+        stmt->setInt( i, static_cast< int32_t >( quest + i ) );
+      stmt->setInt( 11, static_cast< int32_t >( playerId ) );
+      queue.push_back( std::move( stmt ) );
+    }
+  }
+
+  /*!
+   * @brief Every player saves at once for config.rounds rounds
+   *
+   * The worker drains the queue whenever config.queue statements are waiting, dropping the statements the way
+   * it does after executing them. Reports the allocations per save after a first round that fills any cache.
+   */
+  template< typename Acquire >
+  void runStorm( const BenchConfig& config, const char* name, Acquire&& acquire )
+  {
+    SaveData data{ "Bench Player", "looking for group", std::vector< uint8_t >( 26, 1 ),
+                   std::vector< uint8_t >( 40, 2 ), std::vector< uint8_t >( 64, 3 ), std::vector< uint8_t >( 80, 4 ) };
+
+    std::vector< StatementPtr > queue;
+    queue.reserve( config.queue + 64 );
+
+    uint64_t allocations = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for( uint32_t round = 0; round <= config.rounds; ++round )
+    {
+      if( round == 1 )
+      {
+        allocations = g_allocations;
+        start = std::chrono::steady_clock::now();
+      }
+
+      for( uint32_t playerId = 1; playerId <= config.players; ++playerId )
+      {
+        savePlayer( config, data, playerId, acquire, queue );
+
+        if( queue.size() >= config.queue )
+          queue.clear();
+      }
+
+      queue.clear();
+    }
+
+    auto saves = static_cast< double >( config.players ) * config.rounds;
+    auto elapsedMs = msSince( start );
+    allocations = g_allocations - allocations;
+
+    Logger::info( "{0}: {1} allocations, {2:.2f} per save, {3:.2f} us per save", name, allocations,
+                  allocations / saves, elapsedMs * 1000.0 / saves );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: save_storm [options]" );
+    Logger::info( "  --players <n>   players saving at once ( 1000 )" );
+    Logger::info( "  --rounds <n>    storms after the warm up ( 10 )" );
+    Logger::info( "  --queue <n>     statements waiting before the worker drains them ( 32 )" );
+    Logger::info( "  --quests <n>    active quests of every player ( 20 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/save_storm" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--players" )
+        config.players = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--queue" )
+        config.queue = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--quests" )
+        config.quests = static_cast< uint32_t >( std::stoul( value ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  // a new statement for every save, the way getPreparedStatement worked before the pool
+  runStorm( config, "make_shared", []( uint32_t index )
+  {
+    return std::make_shared< Db::PreparedStatement >( index );
+  } );
+
+  auto pPool = std::make_shared< Db::PreparedStatementPool >( Db::MAX_STATEMENTS );
+  runStorm( config, "statement pool", [ &pPool ]( uint32_t index )
+  {
+    return pPool->acquire( index );
+  } );
+
+  Logger::info( "statement pool: {0} statements allocated, {1} reused", pPool->getAllocationCount(),
+                pPool->getReuseCount() );
+
+  return 0;
+}
@@ -0,0 +1,230 @@
+#include <Logging/Logger.h>
+
+#include <SessionRegistry.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  // the maps ServerMgr kept its sessions in before, every access takes the same mutex
+  class MutexSessionMap
+  {
+  public:
+    bool insert( uint32_t sessionId, World::SessionPtr pSession )
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      return m_sessions.emplace( sessionId, std::move( pSession ) ).second;
+    }
+
+    bool insertName( const std::string& playerName, World::SessionPtr pSession )
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      m_sessionsByName[ playerName ] = std::move( pSession );
+      return true;
+    }
+
+    bool erase( uint32_t sessionId )
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      return m_sessions.erase( sessionId ) != 0;
+    }
+
+    World::SessionPtr find( uint32_t sessionId ) const
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      auto it = m_sessions.find( sessionId );
+      return it != m_sessions.end() ? it->second : nullptr;
+    }
+
+    World::SessionPtr find( const std::string& playerName ) const
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      auto it = m_sessionsByName.find( playerName );
+      return it != m_sessionsByName.end() ? it->second : nullptr;
+    }
+
+  private:
+    mutable std::mutex m_mutex;
+    std::unordered_map< uint32_t, World::SessionPtr > m_sessions;
+    std::map< std::string, World::SessionPtr > m_sessionsByName;
+  };
+
+  struct BenchConfig
+  {
+    uint32_t readers = 4;
+    uint32_t writers = 1;
+    uint32_t sessions = 1000;
+    uint32_t duration = 5;
+    uint32_t namePercent = 10;
+  };
+
+  struct BenchResult
+  {
+    uint64_t lookups;
+    uint64_t writes;
+  };
+
+  // readers look up random ids, writers keep removing and adding back random sessions
+  template< typename Map >
+  BenchResult runBench( Map& map, const BenchConfig& config )
+  {
+    // the maps only move pointers around, a shared_ptr that aliases an int still updates a real refcount
+    std::vector< World::SessionPtr > sessions;
+    std::vector< std::string > names;
+    for( uint32_t id = 0; id < config.sessions; ++id )
+    {
+      sessions.emplace_back( std::make_shared< uint32_t >( id ), nullptr );
+      names.push_back( "Bench Player" + std::to_string( id ) );
+      map.insert( id, sessions.back() );
+      map.insertName( names.back(), sessions.back() );
+    }
+
+    std::atomic< bool > running( true );
+    std::atomic< uint64_t > lookups( 0 );
+    std::atomic< uint64_t > writes( 0 );
+
+    std::vector< std::thread > threads;
+
+    for( uint32_t i = 0; i < config.readers; ++i )
+    {
+      threads.emplace_back( [ &, i ]()
+      {
+        std::mt19937 rng( i );
+        std::uniform_int_distribution< uint32_t > idDist( 0, config.sessions - 1 );
+        std::uniform_int_distribution< uint32_t > percentDist( 0, 99 );
+        uint64_t count = 0;
+
+        while( running.load( std::memory_order_relaxed ) )
+        {
+          // tells, invites and the like look the target up by name
+          if( percentDist( rng ) < config.namePercent )
+            map.find( names[ idDist( rng ) ] );
+          else
+            map.find( idDist( rng ) );
+          ++count;
+        }
+
+        lookups += count;
+      } );
+    }
+
+    for( uint32_t i = 0; i < config.writers; ++i )
+    {
+      threads.emplace_back( [ &, i ]()
+      {
+        std::mt19937 rng( config.readers + i );
+        std::uniform_int_distribution< uint32_t > idDist( 0, config.sessions - 1 );
+        uint64_t count = 0;
+
+        while( running.load( std::memory_order_relaxed ) )
+        {
+          auto id = idDist( rng );
+          if( map.erase( id ) )
+            map.insert( id, sessions[ id ] );
+          ++count;
+        }
+
+        writes += count;
+      } );
+    }
+
+    std::this_thread::sleep_for( std::chrono::seconds( config.duration ) );
+    running = false;
+
+    for( auto& thread : threads )
+      thread.join();
+
+    return { lookups.load(), writes.load() };
+  }
+
+  void report( const std::string& name, const BenchResult& result, const BenchConfig& config )
+  {
+    Logger::info( "{0}: {1} lookups/s, {2} writes/s", name,
+                  result.lookups / config.duration, result.writes / config.duration );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: session_bench [options]" );
+    Logger::info( "  --readers <n>    threads looking up sessions ( 4 )" );
+    Logger::info( "  --writers <n>    threads removing and adding sessions ( 1 )" );
+    Logger::info( "  --sessions <n>   registered sessions ( 1000 )" );
+    Logger::info( "  --duration <s>   seconds to run each map ( 5 )" );
+    Logger::info( "  --names <n>      percent of the lookups by player name ( 10 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/session_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--readers" )
+        config.readers = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--writers" )
+        config.writers = static_cast< uint32_t >( std::stoul( value ) );
+      else if( arg == "--sessions" )
+        config.sessions = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--duration" )
+        config.duration = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--names" )
+        config.namePercent = std::min< uint32_t >( 100, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  Logger::info( "{0} readers, {1} writers, {2} sessions, {3}s per map",
+                config.readers, config.writers, config.sessions, config.duration );
+
+  MutexSessionMap mutexMap;
+  report( "single mutex", runBench( mutexMap, config ), config );
+
+  World::SessionRegistry registry;
+  report( "SessionRegistry", runBench( registry, config ), config );
+
+  return 0;
+}
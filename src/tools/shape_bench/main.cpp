@@ -0,0 +1,327 @@
+#include <Logging/Logger.h>
+#include <Util/UtilMath.h>
+
+#include <Util/ShapeQuery.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+using namespace Sapphire::World::Util;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t candidates = 200;
+    uint32_t queries = 100000;
+    uint32_t rounds = 3;
+  };
+
+  struct Actor : public std::enable_shared_from_this< Actor >
+  {
+    virtual ~Actor() = default;
+
+    uint32_t id;
+    Common::FFXIVARR_POSITION3 pos;
+  };
+
+  struct Chara : public Actor
+  {
+  };
+
+  using ActorPtr = std::shared_ptr< Actor >;
+  using CharaPtr = std::shared_ptr< Chara >;
+
+  // the actor filter an aoe was given before the shapes
+  struct ActorFilter
+  {
+    virtual ~ActorFilter() = default;
+    virtual bool conditionApplies( const Actor& actor ) = 0;
+  };
+
+  struct ActorFilterInRange : public ActorFilter
+  {
+    ActorFilterInRange( Common::FFXIVARR_POSITION3 startPos, float range ) :
+      m_startPos( startPos ),
+      m_range( range )
+    {
+    }
+
+    bool conditionApplies( const Actor& actor ) override
+    {
+      return Common::Util::distance( m_startPos, actor.pos ) <= m_range;
+    }
+
+    Common::FFXIVARR_POSITION3 m_startPos;
+    float m_range;
+  };
+
+  /*!
+   * @brief A pack around the caster, in the in range set of the caster and in the cells of the territory
+   *
+   * Everybody stands in one of the four cells that meet at the caster, the shape queries gather all of them.
+   */
+  struct Pack
+  {
+    ActorPtr pCaster;
+    std::set< ActorPtr > inRangeActors;
+    std::array< std::set< ActorPtr >, 4 > cells;
+
+    // Territory::findCharasInShape keeps these between queries
+    std::vector< Chara* > candidates;
+    std::vector< float > candidateX;
+    std::vector< float > candidateZ;
+    std::vector< uint8_t > hits;
+
+    explicit Pack( uint32_t count )
+    {
+      std::mt19937 rng( 42 );
+      std::uniform_real_distribution< float > coord( -25.f, 25.f );
+
+      pCaster = std::make_shared< Chara >();
+      pCaster->id = 1;
+      pCaster->pos = { 0.f, 0.f, 0.f };
+      cells[ 0 ].insert( pCaster );
+
+      for( uint32_t i = 0; i < count; ++i )
+      {
+        auto pChara = std::make_shared< Chara >();
+        pChara->id = 0x40000000 + i;
+        // everybody on flat ground, the old filter measured in 3d and the shapes in 2d
+        pChara->pos = { coord( rng ), 0.f, coord( rng ) };
+
+        inRangeActors.insert( pChara );
+        cells[ ( pChara->pos.x < 0 ? 0 : 1 ) + ( pChara->pos.z < 0 ? 0 : 2 ) ].insert( pChara );
+      }
+    }
+
+    // Actor::getInRangeActors( true )
+    std::set< ActorPtr > getInRangeActors() const
+    {
+      auto tempInRange = inRangeActors;
+      tempInRange.insert( pCaster );
+      return tempInRange;
+    }
+
+    /*! the circle of Action::snapshotAffectedActors before the shapes */
+    void filterInRange( const Common::FFXIVARR_POSITION3& pos, float range, std::vector< CharaPtr >& actors ) const
+    {
+      std::vector< std::shared_ptr< ActorFilter > > actorFilters;
+      actorFilters.push_back( std::make_shared< ActorFilterInRange >( pos, range ) );
+
+      for( const auto& actor : getInRangeActors() )
+      {
+        for( const auto& filter : actorFilters )
+        {
+          if( filter->conditionApplies( *actor ) )
+          {
+            actors.push_back( std::dynamic_pointer_cast< Chara >( actor ) );
+            break;
+          }
+        }
+      }
+    }
+
+    /*! Territory::findCharasInShape */
+    void findCharasInShape( const TargetShape& shape, std::vector< CharaPtr >& charas )
+    {
+      candidates.clear();
+      candidateX.clear();
+      candidateZ.clear();
+
+      for( const auto& cell : cells )
+      {
+        for( const auto& pActor : cell )
+        {
+          candidates.push_back( static_cast< Chara* >( pActor.get() ) );
+          candidateX.push_back( pActor->pos.x );
+          candidateZ.push_back( pActor->pos.z );
+        }
+      }
+
+      hits.resize( candidates.size() );
+      queryShape( shape, candidateX.data(), candidateZ.data(), candidates.size(), hits.data() );
+
+      for( std::size_t i = 0; i < candidates.size(); ++i )
+      {
+        if( hits[ i ] )
+          charas.push_back( std::dynamic_pointer_cast< Chara >( candidates[ i ]->shared_from_this() ) );
+      }
+    }
+  };
+
+  struct QueryResult
+  {
+    double ns = 1e18;
+    uint64_t hits = 0;
+  };
+
+  /*! fastest of config.rounds rounds of config.queries calls of query( actors ) */
+  template< typename Query >
+  QueryResult measure( const BenchConfig& config, Query&& query )
+  {
+    QueryResult best;
+    std::vector< CharaPtr > actors;
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      uint64_t hits = 0;
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint32_t i = 0; i < config.queries; ++i )
+      {
+        actors.clear();
+        query( actors );
+        hits += actors.size();
+      }
+
+      auto ns = std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count() /
+                config.queries;
+      best.ns = std::min( best.ns, ns );
+      best.hits = hits;
+    }
+
+    return best;
+  }
+
+  void report( const char* name, const BenchConfig& config, const QueryResult& result )
+  {
+    Logger::info( "{0}: {1:.0f} ns per query, {2:.2f}M candidates/s, {3:.1f} hits per query", name, result.ns,
+                  config.candidates / result.ns * 1e3, static_cast< double >( result.hits ) / config.queries );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: shape_bench [options]" );
+    Logger::info( "  --candidates <n>   actors around the caster ( 200 )" );
+    Logger::info( "  --queries <n>      queries per round and shape ( 100000 )" );
+    Logger::info( "  --rounds <n>       rounds of every query, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/shape_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--candidates" )
+        config.candidates = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--queries" )
+        config.queries = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  Pack pack( config.candidates );
+  const Common::FFXIVARR_POSITION3 origin{ 0.f, 0.f, 0.f };
+  const float Pi = 3.14159265f;
+
+  auto filter = measure( config, [ & ]( std::vector< CharaPtr >& actors )
+  {
+    pack.filterInRange( origin, 10.f, actors );
+  } );
+
+  auto circle = TargetShape::circle( origin, 10.f );
+  auto shapeCircle = measure( config, [ & ]( std::vector< CharaPtr >& actors )
+  {
+    pack.findCharasInShape( circle, actors );
+  } );
+
+  auto donut = TargetShape::donut( origin, 5.f, 15.f );
+  auto shapeDonut = measure( config, [ & ]( std::vector< CharaPtr >& actors )
+  {
+    pack.findCharasInShape( donut, actors );
+  } );
+
+  auto rectangle = TargetShape::rectangle( origin, 0.5f, 20.f, 4.f );
+  auto shapeRectangle = measure( config, [ & ]( std::vector< CharaPtr >& actors )
+  {
+    pack.findCharasInShape( rectangle, actors );
+  } );
+
+  auto cone = TargetShape::cone( origin, 0.5f, 12.f, Pi / 2 );
+  auto shapeCone = measure( config, [ & ]( std::vector< CharaPtr >& actors )
+  {
+    pack.findCharasInShape( cone, actors );
+  } );
+
+  // only the batch test, without gathering the candidates or building the target list
+  QueryResult batch;
+  {
+    std::vector< uint8_t > hits( pack.candidateX.size() );
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      uint64_t hitCount = 0;
+      auto start = std::chrono::steady_clock::now();
+      for( uint32_t i = 0; i < config.queries; ++i )
+      {
+        queryShape( cone, pack.candidateX.data(), pack.candidateZ.data(), hits.size(), hits.data() );
+        hitCount += hits[ i % hits.size() ];
+      }
+      auto ns = std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count() /
+                config.queries;
+      batch.ns = std::min( batch.ns, ns );
+      batch.hits = hitCount;
+    }
+  }
+
+  Logger::info( "{0} candidates around the caster, fastest of {1} rounds of {2} queries", config.candidates,
+                config.rounds, config.queries );
+  report( "in range filter, circle 10y", config, filter );
+  report( "shape query, circle 10y", config, shapeCircle );
+  report( "shape query, donut 5-15y", config, shapeDonut );
+  report( "shape query, line 20x4y", config, shapeRectangle );
+  report( "shape query, cone 12y 90deg", config, shapeCone );
+  Logger::info( "queryShape only, cone: {0:.0f} ns per batch, {1:.2f}M candidates/s", batch.ns,
+                pack.candidateX.size() / batch.ns * 1e3 );
+
+  // the caster is part of both candidate lists, everybody stands on flat ground
+  if( filter.hits != shapeCircle.hits )
+  {
+    Logger::error( "The in range filter hit {0} actors, the circle {1}", filter.hits, shapeCircle.hits );
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,241 @@
+#include <Logging/Logger.h>
+#include <Util/UtilMath.h>
+
+#include <Util/ShapeQuery.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+using namespace Sapphire::World::Util;
+
+namespace
+{
+  const float Pi = 3.14159265f;
+
+  // points closer than this to an edge of the reference are not compared, float rounding may go either way
+  const float EdgeMargin = 1e-3f;
+
+  uint32_t g_failures = 0;
+
+  void check( bool condition, const std::string& what )
+  {
+    if( condition )
+      return;
+
+    ++g_failures;
+    Logger::error( "FAILED: {0}", what );
+  }
+
+  // rotation Chara::face gives an actor at from that looks at to
+  float faceRotation( const Common::FFXIVARR_POSITION3& from, const Common::FFXIVARR_POSITION3& to )
+  {
+    float rot = Common::Util::calcAngFrom( from.x, from.z, to.x, to.z );
+    return Pi - rot + ( Pi / 2 );
+  }
+
+  float wrapAngle( float angle )
+  {
+    while( angle > Pi )
+      angle -= 2 * Pi;
+    while( angle < -Pi )
+      angle += 2 * Pi;
+    return angle;
+  }
+
+  /*!
+   * @brief Scalar reference of queryShape in polar coordinates
+   *
+   * @param margin receives the distance of the point to the closest edge of the shape
+   */
+  bool referenceHit( const TargetShape& shape, float x, float z, float& margin )
+  {
+    float dx = x - shape.origin.x;
+    float dz = z - shape.origin.z;
+    float distance = std::sqrt( dx * dx + dz * dz );
+
+    // angle to the facing direction, 0 faces towards +z like the actor rotation
+    float angle = wrapAngle( std::atan2( dx, dz ) - shape.rotation );
+
+    switch( shape.type )
+    {
+      case TargetShape::Type::Circle:
+        margin = std::fabs( distance - shape.radius );
+        return distance <= shape.radius;
+
+      case TargetShape::Type::Donut:
+        margin = std::min( std::fabs( distance - shape.radius ), std::fabs( distance - shape.innerRadius ) );
+        return distance <= shape.radius && distance >= shape.innerRadius;
+
+      case TargetShape::Type::Rectangle:
+      {
+        float forward = distance * std::cos( angle );
+        float side = distance * std::sin( angle );
+        margin = std::min( { std::fabs( forward ), std::fabs( forward - shape.radius ),
+                             std::fabs( std::fabs( side ) - shape.halfWidth ) } );
+        return forward >= 0.f && forward <= shape.radius && std::fabs( side ) <= shape.halfWidth;
+      }
+
+      case TargetShape::Type::Cone:
+      {
+        // distance to the side edges of the cone
+        float sideDistance = distance * std::fabs( std::sin( std::fabs( angle ) - shape.halfAngle ) );
+        margin = std::min( { std::fabs( distance - shape.radius ), sideDistance, distance } );
+        return distance <= shape.radius && std::fabs( angle ) <= shape.halfAngle;
+      }
+    }
+
+    return false;
+  }
+
+  std::string describe( const TargetShape& shape )
+  {
+    static const char* names[] = { "circle", "donut", "rectangle", "cone" };
+    return std::string( names[ static_cast< uint8_t >( shape.type ) ] ) + " rot " + std::to_string( shape.rotation );
+  }
+
+  // random points around the shape compared against the reference, batch sizes that aren't a multiple of
+  // any vector width make sure the loop tail is handled
+  void testAgainstReference( const TargetShape& shape, std::mt19937& rng )
+  {
+    const std::size_t batchSizes[] = { 0, 1, 3, 7, 8, 31, 64, 257, 1000 };
+    std::uniform_real_distribution< float > posDist( -shape.getReach() * 1.5f, shape.getReach() * 1.5f );
+
+    for( auto count : batchSizes )
+    {
+      std::vector< float > posX( count );
+      std::vector< float > posZ( count );
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        posX[ i ] = shape.origin.x + posDist( rng );
+        posZ[ i ] = shape.origin.z + posDist( rng );
+      }
+
+      // one guard byte past the batch, queryShape must not write it
+      std::vector< uint8_t > hits( count + 1, 0xAB );
+      queryShape( shape, posX.data(), posZ.data(), count, hits.data() );
+
+      check( hits[ count ] == 0xAB, describe( shape ) + " wrote past " + std::to_string( count ) + " entries" );
+
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        check( hits[ i ] == 0 || hits[ i ] == 1, describe( shape ) + " hit is not 0 or 1" );
+
+        float margin;
+        bool expected = referenceHit( shape, posX[ i ], posZ[ i ], margin );
+        if( margin < EdgeMargin )
+          continue;
+
+        check( ( hits[ i ] != 0 ) == expected,
+               describe( shape ) + " at " + std::to_string( posX[ i ] ) + ", " + std::to_string( posZ[ i ] ) +
+               " expected " + ( expected ? "hit" : "miss" ) );
+
+        if( hits[ i ] )
+        {
+          float dx = posX[ i ] - shape.origin.x;
+          float dz = posZ[ i ] - shape.origin.z;
+          check( std::sqrt( dx * dx + dz * dz ) <= shape.getReach() + EdgeMargin,
+                 describe( shape ) + " hit beyond getReach" );
+        }
+      }
+    }
+  }
+
+  bool hitsPoint( const TargetShape& shape, float x, float z )
+  {
+    uint8_t hit = 0;
+    queryShape( shape, &x, &z, 1, &hit );
+    return hit != 0;
+  }
+
+  // an actor turned towards a target with Chara::face has it in front, inside its lines and cones
+  void testFacing()
+  {
+    const Common::FFXIVARR_POSITION3 origin{ 10.f, 0.f, -5.f };
+    // calcAngFrom returns 0 for targets on the same z, those aren't faced correctly and left out
+    const float offsets[][ 2 ] = { { 0.f, 5.f }, { 5.f, 0.5f }, { 0.f, -5.f }, { -5.f, -0.5f },
+                                   { 3.f, 4.f }, { -3.f, -4.f }, { 4.f, -3.f }, { -4.f, 3.f } };
+
+    for( const auto& offset : offsets )
+    {
+      Common::FFXIVARR_POSITION3 target{ origin.x + offset[ 0 ], 0.f, origin.z + offset[ 1 ] };
+      float rot = faceRotation( origin, target );
+
+      auto line = TargetShape::rectangle( origin, rot, 10.f, 2.f );
+      check( hitsPoint( line, target.x, target.z ), "faced target outside of " + describe( line ) );
+      check( !hitsPoint( line, origin.x - offset[ 0 ], origin.z - offset[ 1 ] ),
+             "target behind inside of " + describe( line ) );
+
+      auto cone = TargetShape::cone( origin, rot, 10.f, Pi / 2 );
+      check( hitsPoint( cone, target.x, target.z ), "faced target outside of " + describe( cone ) );
+      check( !hitsPoint( cone, origin.x - offset[ 0 ], origin.z - offset[ 1 ] ),
+             "target behind inside of " + describe( cone ) );
+    }
+  }
+
+  // known points on and around the edges
+  void testEdges()
+  {
+    const Common::FFXIVARR_POSITION3 origin{ 0.f, 0.f, 0.f };
+
+    auto circle = TargetShape::circle( origin, 5.f );
+    check( hitsPoint( circle, 0.f, 0.f ), "circle misses its origin" );
+    check( hitsPoint( circle, 5.f, 0.f ), "circle misses a point on its edge" );
+    check( !hitsPoint( circle, 3.6f, 3.6f ), "circle hits a point outside" );
+
+    auto donut = TargetShape::donut( origin, 2.f, 5.f );
+    check( !hitsPoint( donut, 0.f, 0.f ), "donut hits its origin" );
+    check( !hitsPoint( donut, 1.f, 1.f ), "donut hits a point in its hole" );
+    check( hitsPoint( donut, 0.f, 3.f ), "donut misses a point in its ring" );
+
+    // rotation 0 faces +z
+    auto line = TargetShape::rectangle( origin, 0.f, 10.f, 4.f );
+    check( hitsPoint( line, 0.f, 0.f ), "rectangle misses its origin" );
+    check( hitsPoint( line, 1.9f, 9.9f ), "rectangle misses its far corner" );
+    check( !hitsPoint( line, 0.f, -0.1f ), "rectangle hits behind its origin" );
+    check( !hitsPoint( line, 2.1f, 5.f ), "rectangle hits beside it" );
+    check( !hitsPoint( line, 0.f, 10.1f ), "rectangle hits past its length" );
+
+    auto cone = TargetShape::cone( origin, Pi / 2, 10.f, Pi / 2 );
+    check( hitsPoint( cone, 0.f, 0.f ), "cone misses its origin" );
+    check( hitsPoint( cone, 9.f, 0.f ), "cone misses a point straight ahead" );
+    check( hitsPoint( cone, 5.f, 4.9f ), "cone misses a point just inside its side" );
+    check( !hitsPoint( cone, 5.f, 5.1f ), "cone hits a point just outside its side" );
+    check( !hitsPoint( cone, -1.f, 0.f ), "cone hits behind its origin" );
+  }
+}
+
+int main()
+{
+  Logger::init( "log/shape_query_test" );
+
+  std::mt19937 rng( 1234 );
+  std::uniform_real_distribution< float > rotDist( -2 * Pi, 2 * Pi );
+
+  testEdges();
+  testFacing();
+
+  for( int i = 0; i < 50; ++i )
+  {
+    Common::FFXIVARR_POSITION3 origin{ rotDist( rng ) * 50.f, 0.f, rotDist( rng ) * 50.f };
+    float rot = rotDist( rng );
+
+    testAgainstReference( TargetShape::circle( origin, 6.f ), rng );
+    testAgainstReference( TargetShape::donut( origin, 4.f, 12.f ), rng );
+    testAgainstReference( TargetShape::rectangle( origin, rot, 15.f, 4.f ), rng );
+    testAgainstReference( TargetShape::cone( origin, rot, 8.f, Pi / 2 ), rng );
+    testAgainstReference( TargetShape::cone( origin, rot, 8.f, Pi / 6 ), rng );
+  }
+
+  if( g_failures != 0 )
+  {
+    Logger::error( "{0} checks failed", g_failures );
+    return 1;
+  }
+
+  Logger::info( "All shape query checks passed" );
+  return 0;
+}
@@ -0,0 +1,269 @@
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+#include <Service.h>
+
+#include "Action/ActionLut.h"
+#include "Actor/Player.h"
+#include "Inventory/Item.h"
+#include "Inventory/ItemContainer.h"
+#include "Manager/ChatChannelMgr.h"
+#include "Manager/RNGMgr.h"
+#include "Manager/TerritoryMgr.h"
+#include "Math/CalcStats.h"
+#include "Script/ScriptMgr.h"
+#include "Territory/Territory.h"
+#include "ServerMgr.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+using namespace Sapphire;
+
+namespace
+{
+  // ctest treats this as skipped, same as the combat_sim golden test
+  constexpr int SkipExitCode = 77;
+
+  struct BenchConfig
+  {
+    std::string dataPath;
+    uint8_t classJob = static_cast< uint8_t >( Common::ClassJob::Gladiator );
+    uint8_t level = 80;
+    uint32_t calls = 100000;
+    uint32_t rounds = 3;
+    // fast blade
+    uint32_t potency = 200;
+  };
+
+  /*! CalcStats::calculateMaxHp before the class and level tables, two exd rows per call */
+  uint32_t calculateMaxHpFromExd( Entity::Player& player )
+  {
+    auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+
+    auto classInfo = exdData.get< Data::ClassJob >( static_cast< uint8_t >( player.getClass() ) );
+    auto paramGrowthInfo = exdData.get< Data::ParamGrow >( player.getLevel() );
+
+    if( !classInfo || !paramGrowthInfo )
+      return 0;
+
+    uint8_t level = player.getLevel();
+
+    auto vitMod = player.getBonusStat( Common::BaseParam::Vitality );
+    float baseStat = Math::CalcStats::calculateBaseStat( player );
+    uint16_t vitStat = static_cast< uint16_t >( player.getStats().vit ) + static_cast< uint16_t >( vitMod );
+    uint16_t hpMod = paramGrowthInfo->hpModifier;
+    uint16_t jobModHp = classInfo->modifierHitPoints;
+    // the level table hp, the only part the tables keep unchanged
+    float approxBaseHp = Math::CalcStats::getLevelStats( level ).hp;
+
+    uint16_t result = static_cast< uint16_t >( floor( jobModHp * ( approxBaseHp / 100.0f ) ) +
+                                               floor( hpMod / 100.0f * ( vitStat - baseStat ) ) );
+
+    return result;
+  }
+
+  struct CallResult
+  {
+    double ns = 1e18;
+    uint64_t checksum = 0;
+  };
+
+  /*! fastest of config.rounds rounds of config.calls calls, call returns what goes into the checksum */
+  template< typename Call >
+  CallResult measure( const BenchConfig& config, Call&& call )
+  {
+    CallResult best;
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      uint64_t checksum = 0;
+      auto start = std::chrono::steady_clock::now();
+
+      for( uint32_t i = 0; i < config.calls; ++i )
+        checksum += call( round );
+
+      auto ns = std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count() /
+                config.calls;
+      best.ns = std::min( best.ns, ns );
+      best.checksum = checksum;
+    }
+
+    return best;
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: stat_bench --data <sqpack path> [options]" );
+    Logger::info( "  --class <id>      classjob of the player ( 1 )" );
+    Logger::info( "  --level <n>       level of the player ( 80 )" );
+    Logger::info( "  --calls <n>       calls per round ( 100000 )" );
+    Logger::info( "  --rounds <n>      rounds of every call, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/stat_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--data" )
+        config.dataPath = value;
+      else if( arg == "--class" )
+        config.classJob = static_cast< uint8_t >( std::stoul( value ) );
+      else if( arg == "--level" )
+        config.level = static_cast< uint8_t >( std::clamp< unsigned long >( std::stoul( value ), 1,
+                                                                            Common::MAX_PLAYER_LEVEL ) );
+      else if( arg == "--calls" )
+        config.calls = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  if( config.dataPath.empty() )
+  {
+    Logger::warn( "No --data given, nothing to measure without the sqpack" );
+    return SkipExitCode;
+  }
+
+  auto pExdData = std::make_shared< Data::ExdDataGenerated >();
+  if( !pExdData->init( config.dataPath ) )
+  {
+    Logger::fatal( "Error setting up EXD data, make sure --data points to the sqpack directory" );
+    return 1;
+  }
+  Common::Service< Data::ExdDataGenerated >::set( pExdData );
+
+  if( !Math::CalcStats::init() || !World::Action::ActionLut::init() )
+    return 1;
+
+  Common::Service< World::ServerMgr >::set( std::make_shared< World::ServerMgr >( "config.ini" ) );
+  Common::Service< Scripting::ScriptMgr >::set( std::make_shared< Scripting::ScriptMgr >() );
+  Common::Service< World::Manager::TerritoryMgr >::set( std::make_shared< World::Manager::TerritoryMgr >() );
+  Common::Service< World::Manager::ChatChannelMgr >::set( std::make_shared< World::Manager::ChatChannelMgr >() );
+
+  auto pRNGMgr = std::make_shared< World::Manager::RNGMgr >( 1 );
+  Common::Service< World::Manager::RNGMgr >::set( pRNGMgr );
+
+  auto pTerritory = std::make_shared< Territory >();
+
+  auto classJobInfo = pExdData->get< Data::ClassJob >( config.classJob );
+  if( !classJobInfo )
+  {
+    Logger::fatal( "ClassJob#{0} does not exist", config.classJob );
+    return 1;
+  }
+
+  auto weaponId = static_cast< uint32_t >( classJobInfo->itemStartingWeapon );
+
+  auto pPlayer = std::make_shared< Entity::Player >();
+  pPlayer->setId( 1 );
+  pPlayer->setLookAt( Common::CharaLook::Tribe, 1 );
+  pPlayer->setClassJob( static_cast< Common::ClassJob >( config.classJob ) );
+  pPlayer->setLevel( config.level );
+  pPlayer->initInventory();
+
+  auto pWeapon = std::make_shared< Item >( 1, weaponId );
+  pPlayer->getInventoryContainer( Common::GearSet0 )->setItem( Common::GearSetSlot::MainHand, pWeapon );
+  pPlayer->equipItem( Common::GearSetSlot::MainHand, pWeapon, false );
+
+  pPlayer->setCurrentZone( pTerritory );
+  pTerritory->pushActor( pPlayer );
+
+  auto role = pPlayer->getRole();
+  auto wepDmg = static_cast< float >( role == Common::Role::RangedMagical || role == Common::Role::Healer ?
+                                      pWeapon->getMagicalDmg() : pWeapon->getPhysicalDmg() );
+
+  auto maxHpExd = measure( config, [ & ]( uint32_t )
+  {
+    return calculateMaxHpFromExd( *pPlayer );
+  } );
+
+  auto maxHpTable = measure( config, [ & ]( uint32_t )
+  {
+    return Math::CalcStats::calculateMaxHp( pPlayer );
+  } );
+
+  // every round rolls the same crits and direct hits
+  uint32_t seededRound = UINT32_MAX;
+  auto reseed = [ & ]( uint32_t round )
+  {
+    if( round == seededRound )
+      return;
+    pTerritory->getRandomEngine() = pRNGMgr->createEngine( pTerritory->getGuId() );
+    seededRound = round;
+  };
+
+  auto damageRecalculated = measure( config, [ & ]( uint32_t round )
+  {
+    reseed( round );
+    // what every call paid before the attributes were cached
+    pPlayer->invalidateAttributes();
+    return static_cast< uint64_t >( Math::CalcStats::calcActionDamage( *pPlayer, config.potency, wepDmg ).first );
+  } );
+
+  seededRound = UINT32_MAX;
+  auto damageCached = measure( config, [ & ]( uint32_t round )
+  {
+    reseed( round );
+    return static_cast< uint64_t >( Math::CalcStats::calcActionDamage( *pPlayer, config.potency, wepDmg ).first );
+  } );
+
+  // Chara::getPrimaryStat read this row on every call, twice per calcActionDamage
+  auto classJobRow = measure( config, [ & ]( uint32_t )
+  {
+    return static_cast< uint64_t >( pExdData->get< Data::ClassJob >( config.classJob )->primaryStat );
+  } );
+
+  Logger::info( "class {0} level {1}, {2} max hp, fastest of {3} rounds of {4} calls", config.classJob, config.level,
+                maxHpTable.checksum / config.calls, config.rounds, config.calls );
+  Logger::info( "calculateMaxHp, exd rows: {0:.0f} ns per call", maxHpExd.ns );
+  Logger::info( "calculateMaxHp, tables: {0:.0f} ns per call", maxHpTable.ns );
+  Logger::info( "calcActionDamage, attributes recalculated: {0:.0f} ns per call", damageRecalculated.ns );
+  Logger::info( "calcActionDamage, attributes cached: {0:.0f} ns per call", damageCached.ns );
+  Logger::info( "ClassJob row lookup: {0:.0f} ns per call", classJobRow.ns );
+
+  if( maxHpExd.checksum != maxHpTable.checksum || damageRecalculated.checksum != damageCached.checksum )
+  {
+    Logger::error( "Max hp {0} and {1}, damage {2} and {3} in total", maxHpExd.checksum, maxHpTable.checksum,
+                   damageRecalculated.checksum, damageCached.checksum );
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,408 @@
+#include <Logging/Logger.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t actors = 500;
+    uint32_t effects = 20;
+    uint32_t ticks = 1000;
+    uint32_t rounds = 3;
+  };
+
+  const uint8_t MaxStatusEffects = 30;
+
+  /*! what the status effect paths of Chara read from a StatusEffect */
+  struct Effect
+  {
+    uint32_t id;
+    uint32_t sourceActorId;
+    uint32_t duration;
+    uint64_t startTimeMs;
+    uint16_t param;
+    // type and value getTickEffect hands to Chara::onTick
+    std::pair< uint8_t, uint32_t > tickEffect;
+  };
+
+  using EffectPtr = std::shared_ptr< Effect >;
+
+  /*! a status effect entry of the spawn packets */
+  struct SpawnEffect
+  {
+    uint16_t effect_id;
+    uint16_t param;
+    float duration;
+    uint32_t sourceActorId;
+  };
+
+  using SpawnEffects = std::array< SpawnEffect, MaxStatusEffects >;
+
+  /*!
+   * @brief Status effects of Chara before the slot array
+   *
+   * A map by slot, a queue of free slots and the loops that walked the map by value.
+   */
+  class MapStorage
+  {
+  public:
+    MapStorage()
+    {
+      for( uint8_t i = 0; i < MaxStatusEffects; i++ )
+        m_statusEffectFreeSlotQueue.push( i );
+    }
+
+    void add( EffectPtr pEffect )
+    {
+      if( m_statusEffectFreeSlotQueue.empty() )
+        return;
+
+      auto slot = m_statusEffectFreeSlotQueue.front();
+      m_statusEffectFreeSlotQueue.pop();
+      m_statusEffectMap[ slot ] = std::move( pEffect );
+    }
+
+    EffectPtr remove( uint8_t slot )
+    {
+      auto pEffectIt = m_statusEffectMap.find( slot );
+      if( pEffectIt == m_statusEffectMap.end() )
+        return nullptr;
+
+      m_statusEffectFreeSlotQueue.push( slot );
+      auto pEffect = pEffectIt->second;
+      m_statusEffectMap.erase( slot );
+      return pEffect;
+    }
+
+    // removeSingleStatusEffectById
+    int findSlot( uint32_t id ) const
+    {
+      for( auto effectIt : m_statusEffectMap )
+      {
+        if( effectIt.second->id == id )
+          return effectIt.first;
+      }
+      return -1;
+    }
+
+    // onTick
+    uint64_t sumTickEffects() const
+    {
+      uint64_t total = 0;
+      for( auto effectIt : m_statusEffectMap )
+        total += effectIt.second->tickEffect.second;
+      return total;
+    }
+
+    // NpcSpawnPacket and PlayerSpawnPacket through getStatusEffectMap
+    void writeSpawnEffects( SpawnEffects& effects, uint64_t currentTimeMs ) const
+    {
+      for( auto const& effect : getStatusEffectMap() )
+      {
+        auto& entry = effects[ effect.first ];
+        entry.effect_id = static_cast< uint16_t >( effect.second->id );
+        entry.duration = static_cast< float >( effect.second->duration -
+                                               ( currentTimeMs - effect.second->startTimeMs ) ) / 1000;
+        entry.sourceActorId = effect.second->sourceActorId;
+        entry.param = effect.second->param;
+      }
+    }
+
+  private:
+    std::map< uint8_t, EffectPtr > getStatusEffectMap() const
+    {
+      return m_statusEffectMap;
+    }
+
+    std::map< uint8_t, EffectPtr > m_statusEffectMap;
+    std::queue< uint8_t > m_statusEffectFreeSlotQueue;
+  };
+
+  /*! status effects of Chara now, slot array with an occupancy mask and the status id of every slot */
+  class SlotStorage
+  {
+  public:
+    SlotStorage()
+    {
+      m_statusEffectIds.fill( 0 );
+    }
+
+    void add( EffectPtr pEffect )
+    {
+      for( uint8_t slot = 0; slot < MaxStatusEffects; ++slot )
+      {
+        if( !( m_statusEffectMask & ( 1u << slot ) ) )
+        {
+          m_statusEffectIds[ slot ] = pEffect->id;
+          m_statusEffects[ slot ] = std::move( pEffect );
+          m_statusEffectMask |= 1u << slot;
+          return;
+        }
+      }
+    }
+
+    EffectPtr remove( uint8_t slot )
+    {
+      if( slot >= MaxStatusEffects || !m_statusEffects[ slot ] )
+        return nullptr;
+
+      auto pEffect = std::move( m_statusEffects[ slot ] );
+      m_statusEffectIds[ slot ] = 0;
+      m_statusEffectMask &= ~( 1u << slot );
+      return pEffect;
+    }
+
+    int findSlot( uint32_t id ) const
+    {
+      for( uint8_t slot = 0; ( m_statusEffectMask >> slot ) != 0; ++slot )
+      {
+        if( ( m_statusEffectMask & ( 1u << slot ) ) && m_statusEffectIds[ slot ] == id )
+          return slot;
+      }
+      return -1;
+    }
+
+    uint64_t sumTickEffects() const
+    {
+      uint64_t total = 0;
+      forEach( [ &total ]( uint8_t, const EffectPtr& pEffect ) { total += pEffect->tickEffect.second; } );
+      return total;
+    }
+
+    void writeSpawnEffects( SpawnEffects& effects, uint64_t currentTimeMs ) const
+    {
+      forEach( [ &effects, currentTimeMs ]( uint8_t slot, const EffectPtr& pEffect )
+      {
+        auto& entry = effects[ slot ];
+        entry.effect_id = static_cast< uint16_t >( pEffect->id );
+        entry.duration = static_cast< float >( pEffect->duration - ( currentTimeMs - pEffect->startTimeMs ) ) / 1000;
+        entry.sourceActorId = pEffect->sourceActorId;
+        entry.param = pEffect->param;
+      } );
+    }
+
+  private:
+    template< typename Func >
+    void forEach( Func&& func ) const
+    {
+      for( uint8_t slot = 0; ( m_statusEffectMask >> slot ) != 0; ++slot )
+      {
+        if( m_statusEffectMask & ( 1u << slot ) )
+          func( slot, m_statusEffects[ slot ] );
+      }
+    }
+
+    std::array< EffectPtr, MaxStatusEffects > m_statusEffects;
+    std::array< uint32_t, MaxStatusEffects > m_statusEffectIds;
+    uint32_t m_statusEffectMask{ 0 };
+  };
+
+  /*! ns per actor and tick of every operation, and what it computed so both storages can be compared */
+  struct StorageResult
+  {
+    double tickNs = 1e18;
+    double spawnNs = 1e18;
+    double lookupNs = 1e18;
+    double reapplyNs = 1e18;
+    uint64_t checksum = 0;
+  };
+
+  double nanosecondsPer( std::chrono::steady_clock::time_point start, uint64_t count )
+  {
+    return std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count() / count;
+  }
+
+  // status ids of the effects of an actor, the lookups also ask for ids nobody has
+  uint32_t effectId( uint32_t index )
+  {
+    return 100 + index * 7;
+  }
+
+  template< typename Storage >
+  StorageResult run( const BenchConfig& config )
+  {
+    StorageResult best;
+    uint64_t calls = static_cast< uint64_t >( config.actors ) * config.ticks;
+
+    for( uint32_t round = 0; round < config.rounds; ++round )
+    {
+      std::mt19937 rng( 42 );
+      std::vector< Storage > actors( config.actors );
+
+      for( uint32_t actor = 0; actor < config.actors; ++actor )
+      {
+        for( uint32_t i = 0; i < config.effects; ++i )
+        {
+          auto pEffect = std::make_shared< Effect >();
+          pEffect->id = effectId( i );
+          pEffect->sourceActorId = actor;
+          pEffect->duration = 30000 + rng() % 30000;
+          pEffect->startTimeMs = rng() % 10000;
+          pEffect->param = static_cast< uint16_t >( i );
+          pEffect->tickEffect = { 1, rng() % 1000 };
+          actors[ actor ].add( std::move( pEffect ) );
+        }
+      }
+
+      StorageResult result;
+
+      auto start = std::chrono::steady_clock::now();
+      for( uint32_t tick = 0; tick < config.ticks; ++tick )
+      {
+        for( auto& actor : actors )
+          result.checksum += actor.sumTickEffects();
+      }
+      result.tickNs = nanosecondsPer( start, calls );
+
+      SpawnEffects spawnEffects{};
+      start = std::chrono::steady_clock::now();
+      for( uint32_t tick = 0; tick < config.ticks; ++tick )
+      {
+        for( auto& actor : actors )
+        {
+          actor.writeSpawnEffects( spawnEffects, 10000 + tick );
+          result.checksum += spawnEffects[ tick % MaxStatusEffects ].sourceActorId;
+        }
+      }
+      result.spawnNs = nanosecondsPer( start, calls );
+
+      // half of the ids are on the actor, the other half isn't
+      std::vector< uint32_t > lookupIds( 1024 );
+      for( auto& id : lookupIds )
+        id = effectId( rng() % ( config.effects * 2 ) );
+
+      start = std::chrono::steady_clock::now();
+      for( uint32_t tick = 0; tick < config.ticks; ++tick )
+      {
+        for( uint32_t actor = 0; actor < config.actors; ++actor )
+        {
+          auto id = lookupIds[ ( tick + actor ) % lookupIds.size() ];
+          result.checksum += actors[ actor ].findSlot( id ) != -1 ? 1 : 0;
+        }
+      }
+      result.lookupNs = nanosecondsPer( start, calls );
+
+      // an effect expires and the same status is applied again
+      start = std::chrono::steady_clock::now();
+      for( uint32_t tick = 0; tick < config.ticks; ++tick )
+      {
+        for( uint32_t actor = 0; actor < config.actors; ++actor )
+        {
+          auto& storage = actors[ actor ];
+          auto slot = storage.findSlot( effectId( ( tick + actor ) % config.effects ) );
+          if( slot == -1 )
+            continue;
+
+          auto pEffect = storage.remove( static_cast< uint8_t >( slot ) );
+          pEffect->startTimeMs = tick;
+          storage.add( std::move( pEffect ) );
+          result.checksum += 1;
+        }
+      }
+      result.reapplyNs = nanosecondsPer( start, calls );
+
+      for( auto& actor : actors )
+        result.checksum += actor.sumTickEffects();
+
+      best.tickNs = std::min( best.tickNs, result.tickNs );
+      best.spawnNs = std::min( best.spawnNs, result.spawnNs );
+      best.lookupNs = std::min( best.lookupNs, result.lookupNs );
+      best.reapplyNs = std::min( best.reapplyNs, result.reapplyNs );
+      best.checksum = result.checksum;
+    }
+
+    return best;
+  }
+
+  void report( const char* name, const StorageResult& result )
+  {
+    Logger::info( "{0}: {1:.1f} ns onTick, {2:.1f} ns spawn packet, {3:.1f} ns lookup by id, {4:.1f} ns reapply",
+                  name, result.tickNs, result.spawnNs, result.lookupNs, result.reapplyNs );
+  }
+
+  void printUsage()
+  {
+    Logger::info( "Usage: status_bench [options]" );
+    Logger::info( "  --actors <n>    actors with status effects ( 500 )" );
+    Logger::info( "  --effects <n>   status effects per actor, at most 30 ( 20 )" );
+    Logger::info( "  --ticks <n>     times every operation runs on every actor ( 1000 )" );
+    Logger::info( "  --rounds <n>    rounds of each storage, the fastest one counts ( 3 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/status_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--actors" )
+        config.actors = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--effects" )
+        config.effects = std::clamp< uint32_t >( static_cast< uint32_t >( std::stoul( value ) ), 1, MaxStatusEffects );
+      else if( arg == "--ticks" )
+        config.ticks = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--rounds" )
+        config.rounds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  auto mapResult = run< MapStorage >( config );
+  auto slotResult = run< SlotStorage >( config );
+
+  Logger::info( "{0} actors with {1} status effects, {2} ticks, fastest of {3} rounds, ns per actor", config.actors,
+                config.effects, config.ticks, config.rounds );
+  report( "map by slot", mapResult );
+  report( "slot array", slotResult );
+
+  if( mapResult.checksum != slotResult.checksum )
+  {
+    Logger::error( "The storages computed different results, {0} and {1}", mapResult.checksum, slotResult.checksum );
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,281 @@
+#include <Logging/Logger.h>
+#include <Util/TimerWheel.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Sapphire;
+
+namespace
+{
+  struct BenchConfig
+  {
+    uint32_t timers = 50000;
+    uint32_t seconds = 60;
+    uint32_t tickMs = 50;
+    uint32_t cancels = 5000;
+  };
+
+  // effect results, status effect ticks and respawns, every timer rearms itself with its period
+  const uint32_t Periods[] = { 850, 3000, 60000 };
+
+  struct TickTimes
+  {
+    std::vector< uint64_t > ns;
+
+    void report( const char* name, uint64_t fired ) const
+    {
+      auto sorted = ns;
+      std::sort( sorted.begin(), sorted.end() );
+
+      uint64_t total = 0;
+      for( auto time : sorted )
+        total += time;
+
+      Logger::info( "{0}: {1} fired, {2:.1f} us mean, {3:.1f} us p99, {4:.1f} us max per tick", name, fired,
+                    total / 1000.0 / sorted.size(), sorted[ sorted.size() * 99 / 100 ] / 1000.0,
+                    sorted.back() / 1000.0 );
+    }
+  };
+
+  uint64_t nanosecondsSince( std::chrono::steady_clock::time_point start )
+  {
+    return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - start ).count() );
+  }
+
+  /*! first expiry and period of every timer, the same for both variants */
+  struct TimerPlan
+  {
+    std::vector< uint64_t > firstExpiry;
+    std::vector< uint32_t > period;
+    std::vector< uint32_t > cancelOrder;
+  };
+
+  TimerPlan makePlan( const BenchConfig& config )
+  {
+    std::mt19937 rng( 42 );
+    TimerPlan plan;
+
+    for( uint32_t i = 0; i < config.timers; ++i )
+    {
+      auto period = Periods[ rng() % 3 ];
+      plan.period.push_back( period );
+      plan.firstExpiry.push_back( 1 + rng() % period );
+    }
+
+    plan.cancelOrder.resize( config.timers );
+    for( uint32_t i = 0; i < config.timers; ++i )
+      plan.cancelOrder[ i ] = i;
+    std::shuffle( plan.cancelOrder.begin(), plan.cancelOrder.end(), rng );
+    plan.cancelOrder.resize( std::min( config.cancels, config.timers ) );
+
+    return plan;
+  }
+
+  /*! the timer wheel every territory advances in Territory::update */
+  struct WheelBench
+  {
+    Common::Util::TimerWheel wheel{ 10, 0 };
+    std::vector< Common::Util::TimerWheel::TimerId > ids;
+    const TimerPlan& plan;
+    uint64_t fired = 0;
+
+    explicit WheelBench( const TimerPlan& timerPlan ) :
+      plan( timerPlan )
+    {
+    }
+
+    void arm( uint32_t index, uint64_t expiry )
+    {
+      ids[ index ] = wheel.scheduleAt( expiry, [ this, index ]()
+      {
+        ++fired;
+        arm( index, wheel.getTimeMs() + plan.period[ index ] );
+      } );
+    }
+  };
+
+  /*!
+   * @brief Timers the way territories kept effect results before the wheel
+   *
+   * A vector scanned on every update, due entries are run and erased from the middle.
+   */
+  struct PolledBench
+  {
+    struct Entry
+    {
+      uint64_t expiry;
+      uint32_t index;
+    };
+
+    std::vector< Entry > entries;
+    const TimerPlan& plan;
+    uint64_t fired = 0;
+
+    explicit PolledBench( const TimerPlan& timerPlan ) :
+      plan( timerPlan )
+    {
+    }
+
+    void update( uint64_t timeMs )
+    {
+      std::vector< uint32_t > due;
+
+      for( auto it = entries.begin(); it != entries.end(); )
+      {
+        if( timeMs < it->expiry )
+        {
+          ++it;
+          continue;
+        }
+
+        ++fired;
+        due.push_back( it->index );
+        it = entries.erase( it );
+      }
+
+      for( auto index : due )
+        entries.push_back( { timeMs + plan.period[ index ], index } );
+    }
+
+    void cancel( uint32_t index )
+    {
+      auto it = std::find_if( entries.begin(), entries.end(), [ index ]( const Entry& entry )
+      {
+        return entry.index == index;
+      } );
+
+      if( it != entries.end() )
+        entries.erase( it );
+    }
+  };
+
+  void printUsage()
+  {
+    Logger::info( "Usage: timer_bench [options]" );
+    Logger::info( "  --timers <n>    outstanding timers ( 50000 )" );
+    Logger::info( "  --seconds <n>   simulated seconds ( 60 )" );
+    Logger::info( "  --tick <ms>     time between two territory updates ( 50 )" );
+    Logger::info( "  --cancels <n>   timers cancelled after the run ( 5000 )" );
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/timer_bench" );
+
+  BenchConfig config;
+
+  for( int i = 1; i < argc; ++i )
+  {
+    std::string arg( argv[ i ] );
+
+    if( arg == "--help" )
+    {
+      printUsage();
+      return 0;
+    }
+
+    if( i + 1 >= argc )
+    {
+      Logger::error( "Missing value for {0}", arg );
+      printUsage();
+      return 1;
+    }
+
+    std::string value( argv[ ++i ] );
+
+    try
+    {
+      if( arg == "--timers" )
+        config.timers = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--seconds" )
+        config.seconds = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--tick" )
+        config.tickMs = std::max< uint32_t >( 1, static_cast< uint32_t >( std::stoul( value ) ) );
+      else if( arg == "--cancels" )
+        config.cancels = static_cast< uint32_t >( std::stoul( value ) );
+      else
+      {
+        Logger::error( "Unknown option {0}", arg );
+        printUsage();
+        return 1;
+      }
+    }
+    catch( const std::exception& )
+    {
+      Logger::error( "Invalid value {0} for {1}", value, arg );
+      return 1;
+    }
+  }
+
+  auto plan = makePlan( config );
+  auto ticks = config.seconds * 1000ull / config.tickMs;
+
+  Logger::info( "{0} timers, {1} updates of {2}ms", config.timers, ticks, config.tickMs );
+
+  WheelBench wheelBench( plan );
+  wheelBench.ids.resize( config.timers );
+  PolledBench polledBench( plan );
+
+  auto start = std::chrono::steady_clock::now();
+  for( uint32_t i = 0; i < config.timers; ++i )
+    wheelBench.arm( i, plan.firstExpiry[ i ] );
+  auto wheelScheduleNs = nanosecondsSince( start );
+
+  start = std::chrono::steady_clock::now();
+  for( uint32_t i = 0; i < config.timers; ++i )
+    polledBench.entries.push_back( { plan.firstExpiry[ i ], i } );
+  auto polledScheduleNs = nanosecondsSince( start );
+
+  TickTimes wheelTimes;
+  TickTimes polledTimes;
+
+  for( uint64_t tick = 1; tick <= ticks; ++tick )
+  {
+    auto timeMs = tick * config.tickMs;
+
+    start = std::chrono::steady_clock::now();
+    wheelBench.wheel.advance( timeMs );
+    wheelTimes.ns.push_back( nanosecondsSince( start ) );
+
+    start = std::chrono::steady_clock::now();
+    polledBench.update( timeMs );
+    polledTimes.ns.push_back( nanosecondsSince( start ) );
+  }
+
+  start = std::chrono::steady_clock::now();
+  for( auto index : plan.cancelOrder )
+    wheelBench.wheel.cancel( wheelBench.ids[ index ] );
+  auto wheelCancelNs = nanosecondsSince( start );
+
+  start = std::chrono::steady_clock::now();
+  for( auto index : plan.cancelOrder )
+    polledBench.cancel( index );
+  auto polledCancelNs = nanosecondsSince( start );
+
+  auto cancels = std::max< std::size_t >( 1, plan.cancelOrder.size() );
+
+  wheelTimes.report( "timer wheel", wheelBench.fired );
+  Logger::info( "timer wheel: {0:.1f} ns per schedule, {1:.1f} ns per cancel",
+                static_cast< double >( wheelScheduleNs ) / config.timers,
+                static_cast< double >( wheelCancelNs ) / cancels );
+
+  polledTimes.report( "polled vector", polledBench.fired );
+  Logger::info( "polled vector: {0:.1f} ns per schedule, {1:.1f} ns per cancel",
+                static_cast< double >( polledScheduleNs ) / config.timers,
+                static_cast< double >( polledCancelNs ) / cancels );
+
+  // both run the same timers on the same clock, the wheel only rounds expiries up to its 10ms slots
+  if( wheelBench.fired != polledBench.fired )
+  {
+    Logger::error( "The timer wheel fired {0} timers, the polled vector {1}", wheelBench.fired, polledBench.fired );
+    return 1;
+  }
+
+  return 0;
+}
@@ -1,5 +1,7 @@
 #include "Action.h"
 
+#include <algorithm>
+
 #include <Inventory/Item.h>
 
 #include <Exd/ExdDataGenerated.h>
@@ -42,14 +44,15 @@ Action::Action::Action( Entity::CharaPtr caster, uint32_t actionId, uint16_t seq
 }
 
 Action::Action::Action( Entity::CharaPtr caster, uint32_t actionId, uint16_t sequence,
-                        Data::ActionPtr actionData ) :
+                        const ActionSheetEntry* pSheet ) :
   m_pSource( std::move( caster ) ),
-  m_actionData( std::move( actionData ) ),
+  m_pSheet( pSheet ),
   m_id( actionId ),
   m_targetId( 0 ),
   m_startTime( 0 ),
   m_interruptType( Common::ActionInterruptType::None ),
-  m_sequence( sequence )
+  m_sequence( sequence ),
+  m_hasTargetShape( false )
 {
 }
 
@@ -60,39 +63,23 @@ uint32_t Action::Action::getId() const
 
 bool Action::Action::init()
 {
-  if( !m_actionData )
-  {
-    // need to get actionData
-    auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+  m_effectBuilder = make_EffectBuilder( m_pSource, getId(), m_sequence );
 
-    auto actionData = exdData.get< Data::Action >( m_id );
-    assert( actionData );
+  if( !m_pSheet )
+    m_pSheet = ActionLut::getSheet( static_cast< uint16_t >( getId() ) );
 
-    m_actionData = actionData;
+  if( !m_pSheet )
+  {
+    Logger::error( "Action#{0} has no Action sheet entry", getId() );
+    return false;
   }
 
-  m_effectBuilder = make_EffectBuilder( m_pSource, getId(), m_sequence );
-
-  m_castTimeMs = static_cast< uint32_t >( m_actionData->cast100ms * 100 );
-  m_recastTimeMs = static_cast< uint32_t >( m_actionData->recast100ms * 100 );
-  m_cooldownGroup = m_actionData->cooldownGroup;
-  m_range = m_actionData->range;
-  m_effectRange = m_actionData->effectRange;
-  m_castType = static_cast< Common::CastType >( m_actionData->castType );
-  m_aspect = static_cast< Common::ActionAspect >( m_actionData->aspect );
-
-  // todo: move this to bitset
-  m_canTargetSelf = m_actionData->canTargetSelf;
-  m_canTargetParty = m_actionData->canTargetParty;
-  m_canTargetFriendly = m_actionData->canTargetFriendly;
-  m_canTargetHostile = m_actionData->canTargetHostile;
-  // todo: this one doesn't look right based on whats in that col, probably has shifted
-  m_canTargetDead = m_actionData->canTargetDead;
+  loadSheetEntry( *m_pSheet );
 
   // a default range is set by the game for the class/job
   if( m_range == -1 )
   {
-    switch( static_cast< Common::ClassJob >( m_actionData->classJob ) )
+    switch( static_cast< Common::ClassJob >( m_classJob ) )
     {
       case Common::ClassJob::Bard:
       case Common::ClassJob::Archer:
@@ -104,9 +91,6 @@ bool Action::Action::init()
     }
   }
 
-  m_primaryCostType = static_cast< Common::ActionPrimaryCostType >( m_actionData->primaryCostType );
-  m_primaryCost = m_actionData->primaryCostValue;
-
   /*if( !m_actionData->targetArea )
   {
     // override pos to target position
@@ -137,6 +121,35 @@ bool Action::Action::init()
   return true;
 }
 
+void Action::Action::loadSheetEntry( const ActionSheetEntry& sheet )
+{
+  m_castTimeMs = static_cast< uint32_t >( sheet.cast100ms * 100 );
+  m_recastTimeMs = static_cast< uint32_t >( sheet.recast100ms * 100 );
+  m_cooldownGroup = sheet.cooldownGroup;
+  m_range = sheet.range;
+  m_effectRange = sheet.effectRange;
+  m_xAxisModifier = sheet.xAxisModifier;
+  m_castType = static_cast< Common::CastType >( sheet.castType );
+  m_aspect = static_cast< Common::ActionAspect >( sheet.aspect );
+
+  // todo: move this to bitset
+  m_canTargetSelf = sheet.canTargetSelf;
+  m_canTargetParty = sheet.canTargetParty;
+  m_canTargetFriendly = sheet.canTargetFriendly;
+  m_canTargetHostile = sheet.canTargetHostile;
+  // todo: this one doesn't look right based on whats in that col, probably has shifted
+  m_canTargetDead = sheet.canTargetDead;
+
+  m_classJob = sheet.classJob;
+  m_classJobLevel = sheet.classJobLevel;
+  m_isRoleAction = sheet.isRoleAction;
+  m_actionCombo = sheet.actionCombo;
+  m_preservesCombo = sheet.preservesCombo;
+
+  m_primaryCostType = static_cast< Common::ActionPrimaryCostType >( sheet.primaryCostType );
+  m_primaryCost = sheet.primaryCostValue;
+}
+
 void Action::Action::setPos( Sapphire::Common::FFXIVARR_POSITION3 pos )
 {
   m_pos = pos;
@@ -388,7 +401,7 @@ void Action::Action::execute()
 
   // set currently casted action as the combo action if it interrupts a combo
   // ignore it otherwise (ogcds, etc.)
-  if( !m_actionData->preservesCombo )
+  if( !m_preservesCombo )
   {
     // potential combo starter or correct combo from last action, must hit something to progress combo
     if( !m_hitActors.empty() && ( !isComboAction() || isCorrectCombo() ) )
@@ -493,7 +506,7 @@ void Action::Action::buildEffects()
       m_effectBuilder->damage( actor, actor, dmg.first, dmg.second );
 
       if( dmg.first > 0 )
-        actor->onActionHostile( m_pSource );
+        actor->onActionHostile( m_pSource, dmg.first );
 
       if( isCorrectCombo() && shouldApplyComboSucceedEffect )
       {
@@ -515,7 +528,7 @@ void Action::Action::buildEffects()
           shouldRestoreMP = false;
         }
 
-        if ( !m_actionData->preservesCombo ) // we need something like m_actionData->hasNextComboAction
+        if ( !m_preservesCombo ) // we need something like m_actionData->hasNextComboAction
         {
           m_effectBuilder->startCombo( actor, getId() ); // this is on all targets hit
         }
@@ -563,29 +576,27 @@ bool Action::Action::playerPreCheck( Entity::Player& player )
     return false;
 
   // npc actions/non player actions
-  if( m_actionData->classJob == -1 && !m_actionData->isRoleAction )
+  if( m_classJob == -1 && !m_isRoleAction )
     return false;
 
-  if( player.getLevel() < m_actionData->classJobLevel )
+  if( player.getLevel() < m_classJobLevel )
     return false;
 
   auto currentClass = player.getClass();
-  auto actionClass = static_cast< Common::ClassJob >( m_actionData->classJob );
+  auto actionClass = static_cast< Common::ClassJob >( m_classJob );
 
-  if( actionClass != Common::ClassJob::Adventurer && currentClass != actionClass && !m_actionData->isRoleAction )
+  if( actionClass != Common::ClassJob::Adventurer && currentClass != actionClass && !m_isRoleAction )
   {
     // check if not a base class action
-    auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-
-    auto classJob = exdData.get< Data::ClassJob >( static_cast< uint8_t >( currentClass ) );
+    auto classJob = Math::CalcStats::getClassJobStats( currentClass );
     if( !classJob )
       return false;
 
-    if( classJob->classJobParent != m_actionData->classJob )
+    if( classJob->classJobParent != m_classJob )
       return false;
   }
 
-  if( !m_actionData->canTargetSelf && getTargetId() == m_pSource->getId() )
+  if( !m_canTargetSelf && getTargetId() == m_pSource->getId() )
     return false;
 
   // todo: does this need to check for party/alliance stuff or it's just same type?
@@ -626,12 +637,12 @@ bool Action::Action::isCorrectCombo() const
     return false;
   }
 
-  return m_actionData->actionCombo == lastActionId;
+  return m_actionCombo == lastActionId;
 }
 
 bool Action::Action::isComboAction() const
 {
-  return m_actionData->actionCombo != 0;
+  return m_actionCombo != 0;
 }
 
 bool Action::Action::primaryCostCheck( bool subtractCosts )
@@ -695,20 +706,38 @@ bool Action::Action::consumeResources()
 
 bool Action::Action::snapshotAffectedActors( std::vector< Entity::CharaPtr >& actors )
 {
-  for( const auto& actor : m_pSource->getInRangeActors( true ) )
+  if( m_hasTargetShape )
   {
-    // check for initial target validity based on flags in action exd (pc/enemy/etc.)
-    if( !preFilterActor( *actor ) )
-      continue;
+    if( auto pZone = m_pSource->getCurrentTerritory() )
+      pZone->findCharasInShape( m_targetShape, actors );
 
-    for( const auto& filter : m_actorFilters )
+    actors.erase( std::remove_if( actors.begin(), actors.end(), [ this ]( const Entity::CharaPtr& pChara )
     {
-      if( filter->conditionApplies( *actor ) )
+      // check for initial target validity based on flags in action exd (pc/enemy/etc.)
+      return !preFilterActor( *pChara );
+    } ), actors.end() );
+  }
+
+  if( !m_actorFilters.empty() )
+  {
+    auto shapeHits = actors.size();
+
+    m_pSource->forEachInRangeActor( [ this, &actors, shapeHits ]( const Entity::ActorPtr& actor )
+    {
+      if( !preFilterActor( *actor ) )
+        return;
+
+      for( const auto& filter : m_actorFilters )
       {
-        actors.push_back( actor->getAsChara() );
+        if( !filter->conditionApplies( *actor ) )
+          continue;
+
+        auto pChara = actor->getAsChara();
+        if( std::find( actors.begin(), actors.begin() + shapeHits, pChara ) == actors.begin() + shapeHits )
+          actors.push_back( std::move( pChara ) );
         break;
       }
-    }
+    }, true );
   }
 
   if( auto player = m_pSource->getAsPlayer() )
@@ -728,6 +757,12 @@ void Action::Action::addActorFilter( World::Util::ActorFilterPtr filter )
   m_actorFilters.push_back( std::move( filter ) );
 }
 
+void Action::Action::setTargetShape( const World::Util::TargetShape& shape )
+{
+  m_targetShape = shape;
+  m_hasTargetShape = true;
+}
+
 void Action::Action::addDefaultActorFilters()
 {
   switch( m_castType )
@@ -743,18 +778,30 @@ void Action::Action::addDefaultActorFilters()
     }
 
     case Common::CastType::CircularAOE:
+    case Common::CastType::CircularAoEPlaced:
     {
-      auto filter = std::make_shared< World::Util::ActorFilterInRange >( m_pos, m_effectRange );
+      setTargetShape( World::Util::TargetShape::circle( m_pos, m_effectRange ) );
 
-      addActorFilter( filter );
+      break;
+    }
+
+    // straight line in front of the caster, xAxisModifier is its width
+    case Common::CastType::RectangularAOE:
+    {
+      setTargetShape( World::Util::TargetShape::rectangle( m_pSource->getPos(), m_pSource->getRot(),
+                                                           m_effectRange, m_xAxisModifier ) );
 
       break;
     }
 
-//    case Common::CastType::RectangularAOE:
-//    {
-//      break;
-//    }
+    // the sheet has no angle, 90 degrees matches the omen of most cleaves
+    case Common::CastType::ConeAOE:
+    {
+      setTargetShape( World::Util::TargetShape::cone( m_pSource->getPos(), m_pSource->getRot(),
+                                                      m_effectRange, PI / 2 ) );
+
+      break;
+    }
 
     default:
     {
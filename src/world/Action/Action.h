@@ -4,15 +4,10 @@
 #include <Common.h>
 #include "ActionLut.h"
 #include "Util/ActorFilter.h"
+#include "Util/ShapeQuery.h"
 #include "ForwardsZone.h"
 #include "EffectBuilder.h"
 
-namespace Sapphire::Data
-{
-  struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
-}
-
 namespace Sapphire::World::Action
 {
 
@@ -23,7 +18,8 @@ namespace Sapphire::World::Action
 
     Action();
     Action( Entity::CharaPtr caster, uint32_t actionId, uint16_t sequence );
-    Action( Entity::CharaPtr caster, uint32_t actionId, uint16_t sequence, Data::ActionPtr actionData );
+    /*! @param pSheet sheet columns of actionId if the caller looked them up already, see ActionLut::getSheet */
+    Action( Entity::CharaPtr caster, uint32_t actionId, uint16_t sequence, const ActionSheetEntry* pSheet );
 
     virtual ~Action();
 
@@ -101,7 +97,13 @@ namespace Sapphire::World::Action
     void addActorFilter( World::Util::ActorFilterPtr filter );
 
     /*!
-     * @brief Adds the default actor filters based on the CastType entry in the Action exd.
+     * @brief Hits everything standing inside the shape, on top of what the actor filters match.
+     * @param shape The area of effect, replaces any shape set before
+     */
+    void setTargetShape( const World::Util::TargetShape& shape );
+
+    /*!
+     * @brief Adds the default actor filters or target shape based on the CastType entry in the Action exd.
      */
     void addDefaultActorFilters();
 
@@ -143,6 +145,8 @@ namespace Sapphire::World::Action
 
   protected:
 
+    void loadSheetEntry( const ActionSheetEntry& sheet );
+
     bool primaryCostCheck( bool subtractCosts );
     bool secondaryCostCheck( bool subtractCosts );
 
@@ -181,15 +185,23 @@ namespace Sapphire::World::Action
     bool m_canTargetHostile;
     bool m_canTargetDead;
 
+    int8_t m_classJob;
+    uint8_t m_classJobLevel;
+    bool m_isRoleAction;
+    uint16_t m_actionCombo;
+    bool m_preservesCombo;
+
     Common::ActionInterruptType m_interruptType;
 
-    Data::ActionPtr m_actionData;
+    const ActionSheetEntry* m_pSheet;
 
     Common::FFXIVARR_POSITION3 m_pos;
 
     EffectBuilderPtr m_effectBuilder;
 
     std::vector< World::Util::ActorFilterPtr > m_actorFilters;
+    World::Util::TargetShape m_targetShape;
+    bool m_hasTargetShape;
     std::vector< Entity::CharaPtr > m_hitActors;
 
     ActionEntry m_lutEntry;
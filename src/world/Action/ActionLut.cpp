@@ -1,16 +1,36 @@
+#include <algorithm>
 #include <cassert>
 #include "ActionLut.h"
 
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+#include <Service.h>
+
 using namespace Sapphire::World::Action;
 
+std::vector< ActionSheetEntry > ActionLut::m_sheets;
+std::vector< bool > ActionLut::m_hasSheet;
+
+const ActionLutEntry* ActionLut::find( uint16_t actionId )
+{
+  if( actionId >= m_indexSize )
+    return nullptr;
+
+  auto slot = m_index[ actionId ];
+  if( slot == 0 )
+    return nullptr;
+
+  return &m_entries[ slot - 1 ];
+}
+
 bool ActionLut::validEntryExists( uint16_t actionId )
 {
-  auto it = m_actionLut.find( actionId );
+  auto pEntry = find( actionId );
 
-  if( it == m_actionLut.end() )
+  if( !pEntry )
     return false;
 
-  const auto& entry = it->second;
+  const auto& entry = pEntry->entry;
 
   // if all of the fields are 0, it's not 'valid' due to parse error or no useful data in the tooltip
   return entry.potency != 0 || entry.comboPotency != 0 || entry.flankPotency != 0 || entry.frontPotency != 0 ||
@@ -19,9 +39,86 @@ bool ActionLut::validEntryExists( uint16_t actionId )
 
 const ActionEntry& ActionLut::getEntry( uint16_t actionId )
 {
-  auto it = m_actionLut.find( actionId );
+  auto pEntry = find( actionId );
+
+  assert( pEntry );
+
+  return pEntry->entry;
+}
+
+bool ActionLut::init()
+{
+  auto& exdData = Sapphire::Common::Service< Sapphire::Data::ExdDataGenerated >::ref();
+
+  auto& actionIds = exdData.getActionIdList();
+  if( actionIds.empty() )
+  {
+    Logger::error( "ActionLut: Action sheet is empty" );
+    return false;
+  }
 
-  assert( it != m_actionLut.end() );
+  auto actionCount = std::min< std::size_t >( *actionIds.rbegin() + 1, UINT16_MAX + 1 );
+  m_sheets.assign( actionCount, ActionSheetEntry{} );
+  m_hasSheet.assign( actionCount, false );
 
-  return it->second;
-}
\ No newline at end of file
+  std::size_t baked = 0;
+
+  for( auto actionId : actionIds )
+  {
+    if( actionId >= actionCount )
+      continue;
+
+    auto pLutEntry = find( static_cast< uint16_t >( actionId ) );
+    if( pLutEntry && pLutEntry->hasSheetEntry )
+    {
+      ++baked;
+      continue;
+    }
+
+    auto actionData = exdData.get< Sapphire::Data::Action >( actionId );
+    if( !actionData )
+      continue;
+
+    auto& sheet = m_sheets[ actionId ];
+    sheet.cast100ms = actionData->cast100ms;
+    sheet.recast100ms = actionData->recast100ms;
+    sheet.cooldownGroup = actionData->cooldownGroup;
+    sheet.range = actionData->range;
+    sheet.effectRange = actionData->effectRange;
+    sheet.xAxisModifier = actionData->xAxisModifier;
+    sheet.castType = actionData->castType;
+    sheet.aspect = actionData->aspect;
+    sheet.primaryCostType = actionData->primaryCostType;
+    sheet.primaryCostValue = actionData->primaryCostValue;
+    sheet.classJob = actionData->classJob;
+    sheet.classJobLevel = actionData->classJobLevel;
+    sheet.isRoleAction = actionData->isRoleAction;
+    sheet.actionCombo = actionData->actionCombo;
+    sheet.preservesCombo = actionData->preservesCombo;
+    sheet.canTargetSelf = actionData->canTargetSelf;
+    sheet.canTargetParty = actionData->canTargetParty;
+    sheet.canTargetFriendly = actionData->canTargetFriendly;
+    sheet.canTargetHostile = actionData->canTargetHostile;
+    sheet.canTargetDead = actionData->canTargetDead;
+    sheet.targetArea = actionData->targetArea;
+
+    m_hasSheet[ actionId ] = true;
+  }
+
+  Logger::info( "ActionLut: {0} actions baked in, {1} read from the Action sheet", baked,
+                std::count( m_hasSheet.begin(), m_hasSheet.end(), true ) );
+
+  return true;
+}
+
+const ActionSheetEntry* ActionLut::getSheet( uint16_t actionId )
+{
+  auto pLutEntry = find( actionId );
+  if( pLutEntry && pLutEntry->hasSheetEntry )
+    return &pLutEntry->sheet;
+
+  if( actionId >= m_hasSheet.size() || !m_hasSheet[ actionId ] )
+    return nullptr;
+
+  return &m_sheets[ actionId ];
+}
@@ -1,7 +1,10 @@
 #ifndef SAPPHIRE_ACTIONLUT_H
 #define SAPPHIRE_ACTIONLUT_H
 
-#include <unordered_map>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace Sapphire::World::Action
 {
@@ -16,15 +19,87 @@ namespace Sapphire::World::Action
     uint16_t restoreMPPercentage;
   };
 
+  /*!
+   * @brief The columns of the Action sheet needed to set up an action, baked in by action_parse
+   * so an action can be set up without fetching its exd row.
+   */
+  struct ActionSheetEntry
+  {
+    uint16_t cast100ms;
+    uint16_t recast100ms;
+    uint8_t cooldownGroup;
+    int8_t range;
+    uint8_t effectRange;
+    uint8_t xAxisModifier;
+    uint8_t castType;
+    uint8_t aspect;
+    uint8_t primaryCostType;
+    uint16_t primaryCostValue;
+    int8_t classJob;
+    uint8_t classJobLevel;
+    bool isRoleAction;
+    uint16_t actionCombo;
+    bool preservesCombo;
+    bool canTargetSelf;
+    bool canTargetParty;
+    bool canTargetFriendly;
+    bool canTargetHostile;
+    bool canTargetDead;
+    bool targetArea;
+  };
+
+  struct ActionLutEntry
+  {
+    uint16_t id;
+    ActionEntry entry;
+    // false for entries generated before the sheet columns were added, ActionLut::init fills those in
+    bool hasSheetEntry;
+    ActionSheetEntry sheet;
+  };
+
+  /*!
+   * @brief Flat table of the generated action data, see ActionLutData.cpp
+   *
+   * Entries are sorted by action id and found through a dense index built at compile time,
+   * so a lookup is two array reads.
+   */
   class ActionLut
   {
   public:
-    using Lut = std::unordered_map< uint16_t, ActionEntry >;
+    /*! @return the entry for actionId or nullptr if the table has none */
+    static const ActionLutEntry* find( uint16_t actionId );
 
     static bool validEntryExists( uint16_t actionId );
     static const ActionEntry& getEntry( uint16_t actionId );
 
-    static Lut m_actionLut;
+    /*!
+     * @brief Reads the Action sheet once for every action the generated table has no sheet columns for
+     *
+     * Has to run after the exd data is loaded. Afterwards getSheet never touches the exd data.
+     */
+    static bool init();
+
+    /*! @return the sheet columns of actionId, baked in or read by init, nullptr if there is no such action */
+    static const ActionSheetEntry* getSheet( uint16_t actionId );
+
+    /*! maps every action id below IndexSize to its position in entries + 1, 0 if it has no entry */
+    template< std::size_t IndexSize, std::size_t EntryCount >
+    static constexpr std::array< uint16_t, IndexSize > buildIndex( const ActionLutEntry ( &entries )[ EntryCount ] )
+    {
+      std::array< uint16_t, IndexSize > index{};
+      for( std::size_t i = 0; i < EntryCount; ++i )
+        index[ entries[ i ].id ] = static_cast< uint16_t >( i + 1 );
+      return index;
+    }
+
+  private:
+    static const ActionLutEntry* const m_entries;
+    static const uint16_t* const m_index;
+    static const std::size_t m_indexSize;
+
+    // by action id, filled by init for the actions without baked sheet columns
+    static std::vector< ActionSheetEntry > m_sheets;
+    static std::vector< bool > m_hasSheet;
   };
 }
 
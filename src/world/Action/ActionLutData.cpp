@@ -2,1526 +2,1536 @@
 
 using namespace Sapphire::World::Action;
 
-ActionLut::Lut ActionLut::m_actionLut =
+// { id, { potency, comboPotency, flankPotency, frontPotency, rearPotency, curePotency, restoreMPPercentage },
+//   hasSheetEntry, { cast100ms, recast100ms, cooldownGroup, range, effectRange, xAxisModifier, castType, aspect,
+//   primaryCostType, primaryCostValue, classJob, classJobLevel, isRoleAction, actionCombo, preservesCombo,
+//   canTargetSelf, canTargetParty, canTargetFriendly, canTargetHostile, canTargetDead, targetArea } }
+static constexpr ActionLutEntry actionLut[] =
 {
   // attack
-  { 7, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shot
-  { 8, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 8, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fast Blade
-  { 9, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 9, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Riot Blade
-  { 15, { 100, 300, 0, 0, 0, 0, 10 } },
+  { 15, { 100, 300, 0, 0, 0, 0, 10 }, false, {} },
   // Shield Bash
-  { 16, { 110, 0, 0, 0, 0, 0, 0 } },
+  { 16, { 110, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sentinel
-  { 17, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fight or Flight
-  { 20, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 20, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rage of Halone
-  { 21, { 100, 350, 0, 0, 0, 0, 0 } },
+  { 21, { 100, 350, 0, 0, 0, 0, 0 }, false, {} },
   // Circle of Scorn
-  { 23, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 23, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shield Lob
-  { 24, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 24, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cover
-  { 27, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 27, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Iron Will
-  { 28, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 28, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Spirits Within
-  { 29, { 100, 0, 0, 0, 0, 0, 5 } },
+  { 29, { 100, 0, 0, 0, 0, 0, 5 }, false, {} },
   // Hallowed Ground
-  { 30, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 30, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heavy Swing
-  { 31, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 31, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Maim
-  { 37, { 100, 300, 0, 0, 0, 0, 0 } },
+  { 37, { 100, 300, 0, 0, 0, 0, 0 }, false, {} },
   // Berserk
-  { 38, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 38, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thrill of Battle
-  { 40, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 40, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Overpower
-  { 41, { 130, 0, 0, 0, 0, 0, 0 } },
+  { 41, { 130, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Storm's Path
-  { 42, { 100, 380, 0, 0, 0, 250, 0 } },
+  { 42, { 100, 380, 0, 0, 0, 250, 0 }, false, {} },
   // Holmgang
-  { 43, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 43, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Vengeance
-  { 44, { 55, 0, 0, 0, 0, 0, 0 } },
+  { 44, { 55, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Storm's Eye
-  { 45, { 100, 380, 0, 0, 0, 0, 0 } },
+  { 45, { 100, 380, 0, 0, 0, 0, 0 }, false, {} },
   // Tomahawk
-  { 46, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 46, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Defiance
-  { 48, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 48, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Inner Beast
-  { 49, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 49, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Steel Cyclone
-  { 51, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 51, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Infuriate
-  { 52, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 52, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bootshine
-  { 53, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 53, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // True Strike
-  { 54, { 220, 0, 0, 0, 240, 0, 0 } },
+  { 54, { 220, 0, 0, 0, 240, 0, 0 }, false, {} },
   // Snap Punch
-  { 56, { 210, 0, 230, 0, 0, 0, 0 } },
+  { 56, { 210, 0, 230, 0, 0, 0, 0 }, false, {} },
   // Fists of Earth
-  { 60, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 60, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Twin Snakes
-  { 61, { 150, 0, 170, 0, 0, 0, 0 } },
+  { 61, { 150, 0, 170, 0, 0, 0, 0 }, false, {} },
   // Arm of the Destroyer
-  { 62, { 80, 0, 0, 0, 0, 0, 0 } },
+  { 62, { 80, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fists of Fire
-  { 63, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 63, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mantra
-  { 65, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 65, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Demolish
-  { 66, { 70, 0, 0, 0, 90, 0, 0 } },
+  { 66, { 70, 0, 0, 0, 90, 0, 0 }, false, {} },
   // Perfect Balance
-  { 69, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 69, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rockbreaker
-  { 70, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 70, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shoulder Tackle
-  { 71, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 71, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fists of Wind
-  { 73, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 73, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dragon Kick
-  { 74, { 180, 0, 200, 0, 0, 0, 0 } },
+  { 74, { 180, 0, 200, 0, 0, 0, 0 }, false, {} },
   // True Thrust
-  { 75, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 75, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Vorpal Thrust
-  { 78, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 78, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Life Surge
-  { 83, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 83, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Full Thrust
-  { 84, { 100, 530, 0, 0, 0, 0, 0 } },
+  { 84, { 100, 530, 0, 0, 0, 0, 0 }, false, {} },
   // Lance Charge
-  { 85, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 85, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doom Spike
-  { 86, { 170, 0, 0, 0, 0, 0, 0 } },
+  { 86, { 170, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Disembowel
-  { 87, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 87, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chaos Thrust
-  { 88, { 100, 290, 0, 0, 140, 0, 0 } },
+  { 88, { 100, 290, 0, 0, 140, 0, 0 }, false, {} },
   // Piercing Talon
-  { 90, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 90, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jump
-  { 92, { 310, 0, 0, 0, 0, 0, 0 } },
+  { 92, { 310, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Elusive Jump
-  { 94, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 94, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Spineshatter Dive
-  { 95, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 95, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dragonfire Dive
-  { 96, { 380, 0, 0, 0, 0, 0, 0 } },
+  { 96, { 380, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heavy Shot
-  { 97, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 97, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Straight Shot
-  { 98, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 98, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Venomous Bite
-  { 100, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 100, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raging Strikes
-  { 101, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 101, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Quick Nock
-  { 106, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 106, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Barrage
-  { 107, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 107, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bloodletter
-  { 110, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 110, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Repelling Shot
-  { 112, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 112, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Windbite
-  { 113, { 60, 0, 0, 0, 0, 0, 0 } },
+  { 113, { 60, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mage's Ballad
-  { 114, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 114, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Army's Paeon
-  { 116, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 116, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rain of Death
-  { 117, { 130, 0, 0, 0, 0, 0, 0 } },
+  { 117, { 130, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Battle Voice
-  { 118, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 118, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stone
-  { 119, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 119, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cure
-  { 120, { 0, 0, 0, 0, 0, 450, 0 } },
+  { 120, { 0, 0, 0, 0, 0, 450, 0 }, false, {} },
   // Aero
-  { 121, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 121, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Medica
-  { 124, { 0, 0, 0, 0, 0, 300, 0 } },
+  { 124, { 0, 0, 0, 0, 0, 300, 0 }, false, {} },
   // Raise
-  { 125, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 125, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stone II
-  { 127, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 127, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cure III
-  { 131, { 0, 0, 0, 0, 0, 550, 0 } },
+  { 131, { 0, 0, 0, 0, 0, 550, 0 }, false, {} },
   // Aero II
-  { 132, { 60, 0, 0, 0, 0, 0, 0 } },
+  { 132, { 60, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Medica II
-  { 133, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 133, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Fluid Aura
-  { 134, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 134, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cure II
-  { 135, { 0, 0, 0, 0, 0, 700, 0 } },
+  { 135, { 0, 0, 0, 0, 0, 700, 0 }, false, {} },
   // Presence of Mind
-  { 136, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 136, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Regen
-  { 137, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 137, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Holy
-  { 139, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 139, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Benediction
-  { 140, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 140, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fire
-  { 141, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 141, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blizzard
-  { 142, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 142, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunder
-  { 144, { 30, 0, 0, 0, 0, 0, 0 } },
+  { 144, { 30, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sleep
-  { 145, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 145, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blizzard II
-  { 146, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 146, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fire II
-  { 147, { 80, 0, 0, 0, 0, 0, 0 } },
+  { 147, { 80, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Transpose
-  { 149, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 149, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fire III
-  { 152, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 152, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunder III
-  { 153, { 70, 0, 0, 0, 0, 0, 0 } },
+  { 153, { 70, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blizzard III
-  { 154, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 154, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherial Manipulation
-  { 155, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 155, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Scathe
-  { 156, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 156, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Manaward
-  { 157, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 157, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Manafont
-  { 158, { 0, 0, 0, 0, 0, 0, 30 } },
+  { 158, { 0, 0, 0, 0, 0, 0, 30 }, false, {} },
   // Freeze
-  { 159, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 159, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flare
-  { 162, { 260, 0, 0, 0, 0, 0, 0 } },
+  { 162, { 260, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin
-  { 163, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 163, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bio
-  { 164, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 164, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon
-  { 165, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 165, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherflow
-  { 166, { 0, 0, 0, 0, 0, 0, 10 } },
+  { 166, { 0, 0, 0, 0, 0, 0, 10 }, false, {} },
   // Energy Drain
-  { 167, { 150, 0, 0, 0, 0, 0, 5 } },
+  { 167, { 150, 0, 0, 0, 0, 0, 5 }, false, {} },
   // Miasma
-  { 168, { 20, 0, 0, 0, 0, 0, 0 } },
+  { 168, { 20, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon II
-  { 170, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 170, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin II
-  { 172, { 160, 0, 0, 0, 0, 0, 0 } },
+  { 172, { 160, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Resurrection
-  { 173, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 173, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bane
-  { 174, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 174, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bio II
-  { 178, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 178, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon III
-  { 180, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 180, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fester
-  { 181, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 181, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle
-  { 184, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 184, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Adloquium
-  { 185, { 0, 0, 0, 0, 0, 300, 0 } },
+  { 185, { 0, 0, 0, 0, 0, 300, 0 }, false, {} },
   // Succor
-  { 186, { 0, 0, 0, 0, 0, 180, 0 } },
+  { 186, { 0, 0, 0, 0, 0, 180, 0 }, false, {} },
   // Sacred Soil
-  { 188, { 0, 0, 0, 0, 0, 100, 0 } },
+  { 188, { 0, 0, 0, 0, 0, 100, 0 }, false, {} },
   // Lustrate
-  { 189, { 0, 0, 0, 0, 0, 600, 0 } },
+  { 189, { 0, 0, 0, 0, 0, 600, 0 }, false, {} },
   // Physick
-  { 190, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 190, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Shield Wall
-  { 197, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 197, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stronghold
-  { 198, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 198, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Last Bastion
-  { 199, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 199, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Braver
-  { 200, { 2400, 0, 0, 0, 0, 0, 0 } },
+  { 200, { 2400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bladedance
-  { 201, { 5250, 0, 0, 0, 0, 0, 0 } },
+  { 201, { 5250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Final Heaven
-  { 202, { 9000, 0, 0, 0, 0, 0, 0 } },
+  { 202, { 9000, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Skyshard
-  { 203, { 1650, 0, 0, 0, 0, 0, 0 } },
+  { 203, { 1650, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Starstorm
-  { 204, { 3600, 0, 0, 0, 0, 0, 0 } },
+  { 204, { 3600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Meteor
-  { 205, { 6150, 0, 0, 0, 0, 0, 0 } },
+  { 205, { 6150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Healing Wind
-  { 206, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 206, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Breath of the Earth
-  { 207, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 207, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Pulse of Life
-  { 208, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 208, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Magitek Cannon
-  { 1128, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 1128, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Photon Stream
-  { 1129, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 1129, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 1533, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 1533, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Spinning Edge
-  { 2240, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 2240, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shade Shift
-  { 2241, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2241, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Gust Slash
-  { 2242, { 100, 330, 0, 0, 0, 0, 0 } },
+  { 2242, { 100, 330, 0, 0, 0, 0, 0 }, false, {} },
   // Hide
-  { 2245, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2245, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assassinate
-  { 2246, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 2246, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Throwing Dagger
-  { 2247, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 2247, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mug
-  { 2248, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 2248, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Death Blossom
-  { 2254, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 2254, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aeolian Edge
-  { 2255, { 100, 420, 0, 0, 160, 0, 0 } },
+  { 2255, { 100, 420, 0, 0, 160, 0, 0 }, false, {} },
   // Shadow Fang
-  { 2257, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 2257, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Trick Attack
-  { 2258, { 350, 0, 0, 0, 500, 0, 0 } },
+  { 2258, { 350, 0, 0, 0, 500, 0, 0 }, false, {} },
   // Ten
-  { 2259, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2259, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ninjutsu
-  { 2260, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2260, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chi
-  { 2261, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2261, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shukuchi
-  { 2262, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2262, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jin
-  { 2263, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2263, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kassatsu
-  { 2264, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2264, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fuma Shuriken
-  { 2265, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 2265, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Katon
-  { 2266, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 2266, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 2267, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 2267, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hyoton
-  { 2268, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 2268, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Huton
-  { 2269, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2269, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doton
-  { 2270, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 2270, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Suiton
-  { 2271, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 2271, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rabbit Medium
-  { 2272, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2272, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rook Autoturret
-  { 2864, { 80, 0, 0, 0, 0, 0, 0 } },
+  { 2864, { 80, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Split Shot
-  { 2866, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 2866, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Slug Shot
-  { 2868, { 100, 260, 0, 0, 0, 0, 0 } },
+  { 2868, { 100, 260, 0, 0, 0, 0, 0 }, false, {} },
   // Spread Shot
-  { 2870, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 2870, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hot Shot
-  { 2872, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 2872, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Clean Shot
-  { 2873, { 100, 340, 0, 0, 0, 0, 0 } },
+  { 2873, { 100, 340, 0, 0, 0, 0, 0 }, false, {} },
   // Gauss Round
-  { 2874, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 2874, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Reassemble
-  { 2876, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2876, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Wildfire
-  { 2878, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 2878, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ricochet
-  { 2890, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 2890, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 3203, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3203, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 3204, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3204, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kanashibari
-  { 3207, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3207, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Goring Blade
-  { 3538, { 100, 390, 0, 0, 0, 0, 0 } },
+  { 3538, { 100, 390, 0, 0, 0, 0, 0 }, false, {} },
   // Royal Authority
-  { 3539, { 100, 550, 0, 0, 0, 0, 0 } },
+  { 3539, { 100, 550, 0, 0, 0, 0, 0 }, false, {} },
   // Divine Veil
-  { 3540, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3540, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Clemency
-  { 3541, { 0, 0, 0, 0, 0, 1200, 0 } },
+  { 3541, { 0, 0, 0, 0, 0, 1200, 0 }, false, {} },
   // Sheltron
-  { 3542, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3542, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tornado Kick
-  { 3543, { 430, 0, 0, 0, 0, 0, 0 } },
+  { 3543, { 430, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Elixir Field
-  { 3545, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 3545, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Meditation
-  { 3546, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3546, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Forbidden Chakra
-  { 3547, { 370, 0, 0, 0, 0, 0, 0 } },
+  { 3547, { 370, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fell Cleave
-  { 3549, { 590, 0, 0, 0, 0, 0, 0 } },
+  { 3549, { 590, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Decimate
-  { 3550, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 3550, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raw Intuition
-  { 3551, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3551, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Equilibrium
-  { 3552, { 0, 0, 0, 0, 0, 1200, 0 } },
+  { 3552, { 0, 0, 0, 0, 0, 1200, 0 }, false, {} },
   // Blood of the Dragon
-  { 3553, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3553, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fang and Claw
-  { 3554, { 320, 0, 360, 0, 0, 0, 0 } },
+  { 3554, { 320, 0, 360, 0, 0, 0, 0 }, false, {} },
   // Geirskogul
-  { 3555, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 3555, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Wheeling Thrust
-  { 3556, { 320, 0, 0, 0, 360, 0, 0 } },
+  { 3556, { 320, 0, 0, 0, 360, 0, 0 }, false, {} },
   // Battle Litany
-  { 3557, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3557, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Empyreal Arrow
-  { 3558, { 230, 0, 0, 0, 0, 0, 0 } },
+  { 3558, { 230, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Wanderer's Minuet
-  { 3559, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 3559, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Iron Jaws
-  { 3560, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 3560, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Warden's Paean
-  { 3561, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3561, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sidewinder
-  { 3562, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 3562, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Armor Crush
-  { 3563, { 100, 400, 160, 0, 0, 0, 0 } },
+  { 3563, { 100, 400, 160, 0, 0, 0, 0 }, false, {} },
   // Dream Within a Dream
-  { 3566, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 3566, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stone III
-  { 3568, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 3568, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Asylum
-  { 3569, { 0, 0, 0, 0, 0, 100, 0 } },
+  { 3569, { 0, 0, 0, 0, 0, 100, 0 }, false, {} },
   // Tetragrammaton
-  { 3570, { 0, 0, 0, 0, 0, 700, 0 } },
+  { 3570, { 0, 0, 0, 0, 0, 700, 0 }, false, {} },
   // Assize
-  { 3571, { 400, 0, 0, 0, 0, 400, 5 } },
+  { 3571, { 400, 0, 0, 0, 0, 400, 5 }, false, {} },
   // Ley Lines
-  { 3573, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3573, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sharpcast
-  { 3574, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3574, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enochian
-  { 3575, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3575, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blizzard IV
-  { 3576, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 3576, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fire IV
-  { 3577, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 3577, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Painflare
-  { 3578, { 130, 0, 0, 0, 0, 0, 0 } },
+  { 3578, { 130, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin III
-  { 3579, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 3579, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tri-disaster
-  { 3580, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 3580, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dreadwyrm Trance
-  { 3581, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3581, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Deathflare
-  { 3582, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 3582, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Indomitability
-  { 3583, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 3583, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Broil
-  { 3584, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 3584, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Deployment Tactics
-  { 3585, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3585, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Emergency Tactics
-  { 3586, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3586, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dissipation
-  { 3587, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3587, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Draw
-  { 3590, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3590, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Redraw
-  { 3593, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3593, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Benefic
-  { 3594, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 3594, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Aspected Benefic
-  { 3595, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 3595, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Malefic
-  { 3596, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 3596, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Malefic II
-  { 3598, { 170, 0, 0, 0, 0, 0, 0 } },
+  { 3598, { 170, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Combust
-  { 3599, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3599, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Helios
-  { 3600, { 0, 0, 0, 0, 0, 330, 0 } },
+  { 3600, { 0, 0, 0, 0, 0, 330, 0 }, false, {} },
   // Aspected Helios
-  { 3601, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 3601, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Ascend
-  { 3603, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3603, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Diurnal Sect
-  { 3604, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3604, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Nocturnal Sect
-  { 3605, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3605, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Lightspeed
-  { 3606, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3606, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Combust II
-  { 3608, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3608, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Benefic II
-  { 3610, { 0, 0, 0, 0, 0, 700, 0 } },
+  { 3610, { 0, 0, 0, 0, 0, 700, 0 }, false, {} },
   // Synastry
-  { 3612, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3612, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Collective Unconscious
-  { 3613, { 0, 0, 0, 0, 0, 100, 0 } },
+  { 3613, { 0, 0, 0, 0, 0, 100, 0 }, false, {} },
   // Essential Dignity
-  { 3614, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 3614, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Gravity
-  { 3615, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 3615, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hard Slash
-  { 3617, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 3617, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Unleash
-  { 3621, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 3621, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Syphon Strike
-  { 3623, { 100, 300, 0, 0, 0, 0, 6 } },
+  { 3623, { 100, 300, 0, 0, 0, 0, 6 }, false, {} },
   // Unmend
-  { 3624, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 3624, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blood Weapon
-  { 3625, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3625, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Grit
-  { 3629, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3629, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Souleater
-  { 3632, { 100, 400, 0, 0, 0, 300, 0 } },
+  { 3632, { 100, 400, 0, 0, 0, 300, 0 }, false, {} },
   // Dark Mind
-  { 3634, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3634, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shadow Wall
-  { 3636, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3636, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Living Dead
-  { 3638, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 3638, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Salted Earth
-  { 3639, { 60, 0, 0, 0, 0, 0, 0 } },
+  { 3639, { 60, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Plunge
-  { 3640, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 3640, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Abyssal Drain
-  { 3641, { 200, 0, 0, 0, 0, 200, 0 } },
+  { 3641, { 200, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Carve and Spit
-  { 3643, { 450, 0, 0, 0, 0, 0, 6 } },
+  { 3643, { 450, 0, 0, 0, 0, 0, 6 }, false, {} },
   // Big Shot
-  { 4238, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4238, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Desperado
-  { 4239, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4239, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Land Waker
-  { 4240, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4240, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dark Force
-  { 4241, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4241, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dragonsong Dive
-  { 4242, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4242, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chimatsuri
-  { 4243, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4243, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sagittarius Arrow
-  { 4244, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4244, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Satellite Beam
-  { 4245, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4245, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Teraflare
-  { 4246, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4246, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Angel Feathers
-  { 4247, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4247, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Astral Stasis
-  { 4248, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4248, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Form Shift
-  { 4262, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4262, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cannonfire
-  { 4271, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4271, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Balance
-  { 4401, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4401, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Arrow
-  { 4402, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4402, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Spear
-  { 4403, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4403, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Bole
-  { 4404, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4404, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Ewer
-  { 4405, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4405, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Spire
-  { 4406, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4406, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 4977, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 4977, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 5069, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 5069, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 5199, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 5199, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 5846, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 5846, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stickyloom
-  { 5874, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 5874, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Void Fire II
-  { 6274, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 6274, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Total Eclipse
-  { 7381, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 7381, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Intervention
-  { 7382, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7382, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Requiescat
-  { 7383, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 7383, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Holy Spirit
-  { 7384, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 7384, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Passage of Arms
-  { 7385, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7385, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Onslaught
-  { 7386, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7386, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Upheaval
-  { 7387, { 450, 0, 0, 0, 0, 0, 0 } },
+  { 7387, { 450, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shake It Off
-  { 7388, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7388, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Inner Release
-  { 7389, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7389, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Delirium
-  { 7390, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7390, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Quietus
-  { 7391, { 210, 0, 0, 0, 0, 0, 6 } },
+  { 7391, { 210, 0, 0, 0, 0, 0, 6 }, false, {} },
   // Bloodspiller
-  { 7392, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 7392, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // The Blackest Night
-  { 7393, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7393, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Riddle of Earth
-  { 7394, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7394, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Riddle of Fire
-  { 7395, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7395, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Brotherhood
-  { 7396, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7396, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sonic Thrust
-  { 7397, { 100, 200, 0, 0, 0, 0, 0 } },
+  { 7397, { 100, 200, 0, 0, 0, 0, 0 }, false, {} },
   // Dragon Sight
-  { 7398, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7398, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mirage Dive
-  { 7399, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 7399, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Nastrond
-  { 7400, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 7400, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hellfrog Medium
-  { 7401, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 7401, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bhavacakra
-  { 7402, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 7402, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ten Chi Jin
-  { 7403, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7403, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Pitch Perfect
-  { 7404, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7404, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Troubadour
-  { 7405, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7405, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Caustic Bite
-  { 7406, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 7406, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stormbite
-  { 7407, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7407, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Nature's Minne
-  { 7408, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7408, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Refulgent Arrow
-  { 7409, { 330, 0, 0, 0, 0, 0, 0 } },
+  { 7409, { 330, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heat Blast
-  { 7410, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 7410, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heated Split Shot
-  { 7411, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 7411, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heated Slug Shot
-  { 7412, { 100, 330, 0, 0, 0, 0, 0 } },
+  { 7412, { 100, 330, 0, 0, 0, 0, 0 }, false, {} },
   // Heated Clean Shot
-  { 7413, { 100, 440, 0, 0, 0, 0, 0 } },
+  { 7413, { 100, 440, 0, 0, 0, 0, 0 }, false, {} },
   // Barrel Stabilizer
-  { 7414, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7414, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rook Overdrive
-  { 7415, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7415, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flamethrower
-  { 7418, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7418, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Between the Lines
-  { 7419, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7419, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunder IV
-  { 7420, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 7420, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Triplecast
-  { 7421, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7421, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Foul
-  { 7422, { 650, 0, 0, 0, 0, 0, 0 } },
+  { 7422, { 650, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherpact
-  { 7423, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7423, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bio III
-  { 7424, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7424, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Miasma III
-  { 7425, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 7425, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin IV
-  { 7426, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 7426, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon Bahamut
-  { 7427, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7427, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle Bahamut
-  { 7429, { 650, 0, 0, 0, 0, 0, 0 } },
+  { 7429, { 650, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thin Air
-  { 7430, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7430, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stone IV
-  { 7431, { 280, 0, 0, 0, 0, 0, 0 } },
+  { 7431, { 280, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Divine Benison
-  { 7432, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7432, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Plenary Indulgence
-  { 7433, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 7433, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Excogitation
-  { 7434, { 0, 0, 0, 0, 0, 800, 0 } },
+  { 7434, { 0, 0, 0, 0, 0, 800, 0 }, false, {} },
   // Broil II
-  { 7435, { 260, 0, 0, 0, 0, 0, 0 } },
+  { 7435, { 260, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chain Stratagem
-  { 7436, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7436, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherpact
-  { 7437, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7437, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Earthly Star
-  { 7439, { 100, 0, 0, 0, 0, 540, 0 } },
+  { 7439, { 100, 0, 0, 0, 0, 540, 0 }, false, {} },
   // Malefic III
-  { 7442, { 210, 0, 0, 0, 0, 0, 0 } },
+  { 7442, { 210, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Minor Arcana
-  { 7443, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7443, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Lord of Crowns
-  { 7444, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7444, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Lady of Crowns
-  { 7445, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7445, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunder II
-  { 7447, { 30, 0, 0, 0, 0, 0, 0 } },
+  { 7447, { 30, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sleeve Draw
-  { 7448, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7448, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hakaze
-  { 7477, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 7477, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jinpu
-  { 7478, { 100, 320, 0, 0, 0, 0, 0 } },
+  { 7478, { 100, 320, 0, 0, 0, 0, 0 }, false, {} },
   // Shifu
-  { 7479, { 100, 320, 0, 0, 0, 0, 0 } },
+  { 7479, { 100, 320, 0, 0, 0, 0, 0 }, false, {} },
   // Yukikaze
-  { 7480, { 100, 360, 0, 0, 0, 0, 0 } },
+  { 7480, { 100, 360, 0, 0, 0, 0, 0 }, false, {} },
   // Gekko
-  { 7481, { 100, 480, 0, 0, 0, 0, 0 } },
+  { 7481, { 100, 480, 0, 0, 0, 0, 0 }, false, {} },
   // Kasha
-  { 7482, { 100, 480, 0, 0, 0, 0, 0 } },
+  { 7482, { 100, 480, 0, 0, 0, 0, 0 }, false, {} },
   // Fuga
-  { 7483, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7483, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mangetsu
-  { 7484, { 100, 160, 0, 0, 0, 0, 0 } },
+  { 7484, { 100, 160, 0, 0, 0, 0, 0 }, false, {} },
   // Oka
-  { 7485, { 100, 160, 0, 0, 0, 0, 0 } },
+  { 7485, { 100, 160, 0, 0, 0, 0, 0 }, false, {} },
   // Enpi
-  { 7486, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7486, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Midare Setsugekka
-  { 7487, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 7487, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tenka Goken
-  { 7488, { 360, 0, 0, 0, 0, 0, 0 } },
+  { 7488, { 360, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Higanbana
-  { 7489, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 7489, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Shinten
-  { 7490, { 320, 0, 0, 0, 0, 0, 0 } },
+  { 7490, { 320, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Kyuten
-  { 7491, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 7491, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Gyoten
-  { 7492, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7492, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Yaten
-  { 7493, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 7493, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Kaiten
-  { 7494, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7494, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hagakure
-  { 7495, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7495, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Guren
-  { 7496, { 850, 0, 0, 0, 0, 0, 0 } },
+  { 7496, { 850, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Meditate
-  { 7497, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7497, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Third Eye
-  { 7498, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7498, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Meikyo Shisui
-  { 7499, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7499, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Seigan
-  { 7501, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 7501, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Merciful Eyes
-  { 7502, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 7502, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Jolt
-  { 7503, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 7503, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Riposte
-  { 7504, { 130, 0, 0, 0, 0, 0, 0 } },
+  { 7504, { 130, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verthunder
-  { 7505, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7505, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Corps-a-corps
-  { 7506, { 130, 0, 0, 0, 0, 0, 0 } },
+  { 7506, { 130, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Veraero
-  { 7507, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7507, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Scatter
-  { 7509, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 7509, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verfire
-  { 7510, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7510, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verstone
-  { 7511, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7511, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Zwerchhau
-  { 7512, { 100, 150, 0, 0, 0, 0, 0 } },
+  { 7512, { 100, 150, 0, 0, 0, 0, 0 }, false, {} },
   // Moulinet
-  { 7513, { 60, 0, 0, 0, 0, 0, 0 } },
+  { 7513, { 60, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Vercure
-  { 7514, { 0, 0, 0, 0, 0, 350, 0 } },
+  { 7514, { 0, 0, 0, 0, 0, 350, 0 }, false, {} },
   // Displacement
-  { 7515, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7515, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Redoublement
-  { 7516, { 100, 230, 0, 0, 0, 0, 0 } },
+  { 7516, { 100, 230, 0, 0, 0, 0, 0 }, false, {} },
   // Fleche
-  { 7517, { 420, 0, 0, 0, 0, 0, 0 } },
+  { 7517, { 420, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Acceleration
-  { 7518, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7518, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Contre Sixte
-  { 7519, { 380, 0, 0, 0, 0, 0, 0 } },
+  { 7519, { 380, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Embolden
-  { 7520, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7520, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Manafication
-  { 7521, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7521, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verraise
-  { 7523, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7523, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jolt II
-  { 7524, { 280, 0, 0, 0, 0, 0, 0 } },
+  { 7524, { 280, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verflare
-  { 7525, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 7525, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verholy
-  { 7526, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 7526, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enchanted Riposte
-  { 7527, { 210, 0, 0, 0, 0, 0, 0 } },
+  { 7527, { 210, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enchanted Zwerchhau
-  { 7528, { 100, 290, 0, 0, 0, 0, 0 } },
+  { 7528, { 100, 290, 0, 0, 0, 0, 0 }, false, {} },
   // Enchanted Redoublement
-  { 7529, { 100, 470, 0, 0, 0, 0, 0 } },
+  { 7529, { 100, 470, 0, 0, 0, 0, 0 }, false, {} },
   // Enchanted Moulinet
-  { 7530, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 7530, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Magitek Cannon
-  { 7619, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7619, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Photon Stream
-  { 7620, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7620, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Diffractive Magitek Cannon
-  { 7621, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7621, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // High-powered Magitek Cannon
-  { 7622, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7622, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doom of the Living
-  { 7861, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7861, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Vermilion Scourge
-  { 7862, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7862, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Iaijutsu
-  { 7867, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7867, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dissolve Union
-  { 7869, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 7869, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stellar Detonation
-  { 8324, { 100, 0, 0, 0, 0, 540, 0 } },
+  { 8324, { 100, 0, 0, 0, 0, 540, 0 }, false, {} },
   // Broken Ridge
-  { 8395, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 8395, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Magitek Pulse
-  { 8624, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 8624, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Magitek Thunder
-  { 8625, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 8625, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 8687, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 8687, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Katon
-  { 9012, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9012, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Remove Barrel
-  { 9015, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9015, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tenka Goken
-  { 9143, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9143, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunderous Force
-  { 9294, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9294, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 9301, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9301, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 9302, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9302, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bishop Overdrive
-  { 9372, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9372, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Undraw
-  { 9629, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9629, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Self-detonate
-  { 9775, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9775, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shatterstone
-  { 9823, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9823, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 9996, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 9996, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ungarmax
-  { 10001, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 10001, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Starstorm
-  { 10894, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 10894, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 10946, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 10946, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 10947, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 10947, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin III
-  { 11191, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11191, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Physick
-  { 11192, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 11192, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Starstorm
-  { 11193, { 3600, 0, 0, 0, 0, 0, 0 } },
+  { 11193, { 3600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Snort
-  { 11383, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11383, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // 4-tonze Weight
-  { 11384, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11384, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Water Cannon
-  { 11385, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11385, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Song of Torment
-  { 11386, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 11386, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // High Voltage
-  { 11387, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 11387, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bad Breath
-  { 11388, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11388, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flying Frenzy
-  { 11389, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 11389, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aqua Breath
-  { 11390, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 11390, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Plaincracker
-  { 11391, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11391, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Acorn Bomb
-  { 11392, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11392, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bristle
-  { 11393, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11393, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mind Blast
-  { 11394, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11394, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blood Drain
-  { 11395, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 11395, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bomb Toss
-  { 11396, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11396, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // 1000 Needles
-  { 11397, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11397, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Drill Cannons
-  { 11398, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11398, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Look
-  { 11399, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11399, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sharpened Knife
-  { 11400, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11400, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Loom
-  { 11401, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11401, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flame Thrower
-  { 11402, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11402, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Faze
-  { 11403, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11403, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Glower
-  { 11404, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11404, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Missile
-  { 11405, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11405, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // White Wind
-  { 11406, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11406, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Final Sting
-  { 11407, { 2000, 0, 0, 0, 0, 0, 0 } },
+  { 11407, { 2000, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Self-destruct
-  { 11408, { 1500, 0, 0, 0, 0, 0, 0 } },
+  { 11408, { 1500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Transfusion
-  { 11409, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11409, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Toad Oil
-  { 11410, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11410, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Off-guard
-  { 11411, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11411, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sticky Tongue
-  { 11412, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11412, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tail Screw
-  { 11413, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11413, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Level 5 Petrify
-  { 11414, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11414, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Moon Flute
-  { 11415, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11415, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doom
-  { 11416, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11416, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mighty Guard
-  { 11417, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11417, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ice Spikes
-  { 11418, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11418, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Ram's Voice
-  { 11419, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11419, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // the Dragon's Voice
-  { 11420, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11420, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Peculiar Light
-  { 11421, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11421, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ink Jet
-  { 11422, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11422, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flying Sardine
-  { 11423, { 10, 0, 0, 0, 0, 0, 0 } },
+  { 11423, { 10, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Diamondback
-  { 11424, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11424, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fire Angon
-  { 11425, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 11425, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Feather Rain
-  { 11426, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 11426, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Eruption
-  { 11427, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 11427, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mountain Buster
-  { 11428, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 11428, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shock Strike
-  { 11429, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 11429, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Glass Dance
-  { 11430, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 11430, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Veil of the Whorl
-  { 11431, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11431, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tri-shackle
-  { 11482, { 30, 0, 0, 0, 0, 0, 0 } },
+  { 11482, { 30, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 11784, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 11784, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stone IV of the Seventh Dawn
-  { 13423, { 140, 0, 0, 0, 0, 0, 0 } },
+  { 13423, { 140, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aero II of the Seventh Dawn
-  { 13424, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 13424, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cure II of the Seventh Dawn
-  { 13425, { 0, 0, 0, 0, 0, 700, 0 } },
+  { 13425, { 0, 0, 0, 0, 0, 700, 0 }, false, {} },
   // Aetherwell
-  { 13426, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 13426, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Thunderous Force
-  { 14587, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 14587, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kyokufu
-  { 14840, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 14840, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ajisai
-  { 14841, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 14841, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Gyoten
-  { 14842, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 14842, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // 冥界恐叫打
-  { 14843, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 14843, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Second Wind
-  { 15375, { 0, 0, 0, 0, 0, 500, 0 } },
+  { 15375, { 0, 0, 0, 0, 0, 500, 0 }, false, {} },
   // Interject
-  { 15537, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 15537, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fight or Flight
-  { 15870, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 15870, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cascade
-  { 15989, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 15989, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fountain
-  { 15990, { 100, 300, 0, 0, 0, 0, 0 } },
+  { 15990, { 100, 300, 0, 0, 0, 0, 0 }, false, {} },
   // Reverse Cascade
-  { 15991, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 15991, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fountainfall
-  { 15992, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 15992, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Windmill
-  { 15993, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 15993, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bladeshower
-  { 15994, { 100, 200, 0, 0, 0, 0, 0 } },
+  { 15994, { 100, 200, 0, 0, 0, 0, 0 }, false, {} },
   // Rising Windmill
-  { 15995, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 15995, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bloodshower
-  { 15996, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 15996, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Standard Step
-  { 15997, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 15997, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Technical Step
-  { 15998, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 15998, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Emboite
-  { 15999, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 15999, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Entrechat
-  { 16000, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16000, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jete
-  { 16001, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16001, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Pirouette
-  { 16002, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16002, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Standard Finish
-  { 16003, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16003, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Technical Finish
-  { 16004, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16004, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Saber Dance
-  { 16005, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 16005, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Closed Position
-  { 16006, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16006, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fan Dance
-  { 16007, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 16007, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fan Dance II
-  { 16008, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 16008, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fan Dance III
-  { 16009, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16009, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // En Avant
-  { 16010, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16010, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Devilment
-  { 16011, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16011, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shield Samba
-  { 16012, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16012, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flourish
-  { 16013, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16013, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Improvisation
-  { 16014, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16014, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Curing Waltz
-  { 16015, { 0, 0, 0, 0, 0, 300, 0 } },
+  { 16015, { 0, 0, 0, 0, 0, 300, 0 }, false, {} },
   // Keen Edge
-  { 16137, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16137, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // No Mercy
-  { 16138, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16138, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Brutal Shell
-  { 16139, { 100, 300, 0, 0, 0, 150, 0 } },
+  { 16139, { 100, 300, 0, 0, 0, 150, 0 }, false, {} },
   // Camouflage
-  { 16140, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16140, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Demon Slice
-  { 16141, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 16141, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Royal Guard
-  { 16142, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16142, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Lightning Shot
-  { 16143, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 16143, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Danger Zone
-  { 16144, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 16144, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Solid Barrel
-  { 16145, { 100, 400, 0, 0, 0, 0, 0 } },
+  { 16145, { 100, 400, 0, 0, 0, 0, 0 }, false, {} },
   // Gnashing Fang
-  { 16146, { 450, 0, 0, 0, 0, 0, 0 } },
+  { 16146, { 450, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Savage Claw
-  { 16147, { 550, 0, 0, 0, 0, 0, 0 } },
+  { 16147, { 550, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Nebula
-  { 16148, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16148, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Demon Slaughter
-  { 16149, { 100, 250, 0, 0, 0, 0, 0 } },
+  { 16149, { 100, 250, 0, 0, 0, 0, 0 }, false, {} },
   // Wicked Talon
-  { 16150, { 650, 0, 0, 0, 0, 0, 0 } },
+  { 16150, { 650, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aurora
-  { 16151, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 16151, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Superbolide
-  { 16152, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16152, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sonic Break
-  { 16153, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16153, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rough Divide
-  { 16154, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16154, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Continuation
-  { 16155, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16155, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jugular Rip
-  { 16156, { 260, 0, 0, 0, 0, 0, 0 } },
+  { 16156, { 260, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Abdomen Tear
-  { 16157, { 280, 0, 0, 0, 0, 0, 0 } },
+  { 16157, { 280, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Eye Gouge
-  { 16158, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16158, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bow Shock
-  { 16159, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16159, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heart of Light
-  { 16160, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16160, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heart of Stone
-  { 16161, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16161, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Burst Strike
-  { 16162, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 16162, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fated Circle
-  { 16163, { 320, 0, 0, 0, 0, 0, 0 } },
+  { 16163, { 320, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bloodfest
-  { 16164, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16164, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Blasting Zone
-  { 16165, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 16165, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Single Standard Finish
-  { 16191, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16191, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Double Standard Finish
-  { 16192, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16192, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Single Technical Finish
-  { 16193, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16193, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Double Technical Finish
-  { 16194, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16194, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Triple Technical Finish
-  { 16195, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16195, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Quadruple Technical Finish
-  { 16196, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16196, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Physick
-  { 16230, { 0, 0, 0, 0, 0, 400, 0 } },
+  { 16230, { 0, 0, 0, 0, 0, 400, 0 }, false, {} },
   // Rightful Sword
-  { 16269, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16269, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Brutal Shell
-  { 16418, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16418, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Keen Edge
-  { 16434, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16434, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Solid Barrel
-  { 16435, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16435, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Soothing Potion
-  { 16436, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16436, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shining Blade
-  { 16437, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16437, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Perfect Deception
-  { 16438, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16438, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Leap of Faith
-  { 16439, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16439, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Prominence
-  { 16457, { 100, 220, 0, 0, 0, 0, 5 } },
+  { 16457, { 100, 220, 0, 0, 0, 0, 5 }, false, {} },
   // Holy Circle
-  { 16458, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16458, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Confiteor
-  { 16459, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 16459, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Atonement
-  { 16460, { 550, 0, 0, 0, 0, 0, 0 } },
+  { 16460, { 550, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Intervene
-  { 16461, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16461, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Mythril Tempest
-  { 16462, { 100, 200, 0, 0, 0, 0, 0 } },
+  { 16462, { 100, 200, 0, 0, 0, 0, 0 }, false, {} },
   // Chaotic Cyclone
-  { 16463, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 16463, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Nascent Flash
-  { 16464, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16464, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Inner Chaos
-  { 16465, { 920, 0, 0, 0, 0, 0, 0 } },
+  { 16465, { 920, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Flood of Darkness
-  { 16466, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16466, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Edge of Darkness
-  { 16467, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 16467, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stalwart Soul
-  { 16468, { 100, 160, 0, 0, 0, 0, 6 } },
+  { 16468, { 100, 160, 0, 0, 0, 0, 6 }, false, {} },
   // Flood of Shadow
-  { 16469, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16469, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Edge of Shadow
-  { 16470, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 16470, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dark Missionary
-  { 16471, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16471, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Living Shadow
-  { 16472, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16472, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Four-point Fury
-  { 16473, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 16473, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enlightenment
-  { 16474, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 16474, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Anatman
-  { 16475, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16475, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Six-sided Star
-  { 16476, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 16476, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Coerthan Torment
-  { 16477, { 100, 230, 0, 0, 0, 0, 0 } },
+  { 16477, { 100, 230, 0, 0, 0, 0, 0 }, false, {} },
   // High Jump
-  { 16478, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 16478, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiden Thrust
-  { 16479, { 330, 0, 0, 0, 0, 0, 0 } },
+  { 16479, { 330, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stardiver
-  { 16480, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 16480, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hissatsu: Senei
-  { 16481, { 1100, 0, 0, 0, 0, 0, 0 } },
+  { 16481, { 1100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ikishoten
-  { 16482, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16482, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tsubame-gaeshi
-  { 16483, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16483, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kaeshi: Higanbana
-  { 16484, { 375, 0, 0, 0, 0, 0, 0 } },
+  { 16484, { 375, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kaeshi: Goken
-  { 16485, { 540, 0, 0, 0, 0, 0, 0 } },
+  { 16485, { 540, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kaeshi: Setsugekka
-  { 16486, { 1200, 0, 0, 0, 0, 0, 0 } },
+  { 16486, { 1200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shoha
-  { 16487, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 16487, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hakke Mujinsatsu
-  { 16488, { 100, 140, 0, 0, 0, 0, 0 } },
+  { 16488, { 100, 140, 0, 0, 0, 0, 0 }, false, {} },
   // Meisui
-  { 16489, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16489, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Goka Mekkyaku
-  { 16491, { 750, 0, 0, 0, 0, 0, 0 } },
+  { 16491, { 750, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hyosho Ranryu
-  { 16492, { 1200, 0, 0, 0, 0, 0, 0 } },
+  { 16492, { 1200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bunshin
-  { 16493, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16493, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shadowbite
-  { 16494, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 16494, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Burst Shot
-  { 16495, { 230, 0, 0, 0, 0, 0, 0 } },
+  { 16495, { 230, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Apex Arrow
-  { 16496, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 16496, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Auto Crossbow
-  { 16497, { 180, 0, 0, 0, 0, 0, 0 } },
+  { 16497, { 180, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Drill
-  { 16498, { 700, 0, 0, 0, 0, 0, 0 } },
+  { 16498, { 700, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bioblaster
-  { 16499, { 60, 0, 0, 0, 0, 0, 0 } },
+  { 16499, { 60, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Air Anchor
-  { 16500, { 700, 0, 0, 0, 0, 0, 0 } },
+  { 16500, { 700, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Automaton Queen
-  { 16501, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16501, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Queen Overdrive
-  { 16502, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16502, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Despair
-  { 16505, { 380, 0, 0, 0, 0, 0, 0 } },
+  { 16505, { 380, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Umbral Soul
-  { 16506, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16506, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Xenoglossy
-  { 16507, { 750, 0, 0, 0, 0, 0, 0 } },
+  { 16507, { 750, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Energy Drain
-  { 16508, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 16508, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Egi Assault
-  { 16509, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16509, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Energy Siphon
-  { 16510, { 40, 0, 0, 0, 0, 0, 0 } },
+  { 16510, { 40, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Outburst
-  { 16511, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16511, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Egi Assault II
-  { 16512, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16512, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Firebird Trance
-  { 16513, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16513, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fountain of Fire
-  { 16514, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16514, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Brand of Purgatory
-  { 16515, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 16515, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle Phoenix
-  { 16516, { 650, 0, 0, 0, 0, 0, 0 } },
+  { 16516, { 650, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Verthunder II
-  { 16524, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16524, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Veraero II
-  { 16525, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16525, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Impact
-  { 16526, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 16526, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Engagement
-  { 16527, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 16527, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enchanted Reprise
-  { 16528, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16528, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Reprise
-  { 16529, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 16529, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Scorch
-  { 16530, { 700, 0, 0, 0, 0, 0, 0 } },
+  { 16530, { 700, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Afflatus Solace
-  { 16531, { 0, 0, 0, 0, 0, 700, 0 } },
+  { 16531, { 0, 0, 0, 0, 0, 700, 0 }, false, {} },
   // Dia
-  { 16532, { 120, 0, 0, 0, 0, 0, 0 } },
+  { 16532, { 120, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Glare
-  { 16533, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16533, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Afflatus Rapture
-  { 16534, { 0, 0, 0, 0, 0, 300, 0 } },
+  { 16534, { 0, 0, 0, 0, 0, 300, 0 }, false, {} },
   // Afflatus Misery
-  { 16535, { 900, 0, 0, 0, 0, 0, 0 } },
+  { 16535, { 900, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Temperance
-  { 16536, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16536, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Whispering Dawn
-  { 16537, { 0, 0, 0, 0, 0, 120, 0 } },
+  { 16537, { 0, 0, 0, 0, 0, 120, 0 }, false, {} },
   // Fey Illumination
-  { 16538, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16538, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Art of War
-  { 16539, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16539, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Biolysis
-  { 16540, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16540, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Broil III
-  { 16541, { 280, 0, 0, 0, 0, 0, 0 } },
+  { 16541, { 280, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Recitation
-  { 16542, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16542, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fey Blessing
-  { 16543, { 0, 0, 0, 0, 0, 350, 0 } },
+  { 16543, { 0, 0, 0, 0, 0, 350, 0 }, false, {} },
   // Summon Seraph
-  { 16545, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16545, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Consolation
-  { 16546, { 0, 0, 0, 0, 0, 300, 0 } },
+  { 16546, { 0, 0, 0, 0, 0, 300, 0 }, false, {} },
   // Firebird Trance
-  { 16549, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16549, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Divination
-  { 16552, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16552, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Celestial Opposition
-  { 16553, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 16553, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Combust III
-  { 16554, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16554, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Malefic IV
-  { 16555, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16555, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Celestial Intersection
-  { 16556, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 16556, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Horoscope
-  { 16557, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 16557, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Horoscope
-  { 16558, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16558, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Neutral Sect
-  { 16559, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16559, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Fire III
-  { 16574, { 430, 0, 0, 0, 0, 0, 0 } },
+  { 16574, { 430, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Blizzard III
-  { 16575, { 240, 0, 0, 0, 0, 0, 0 } },
+  { 16575, { 240, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Thunder III
-  { 16576, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16576, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Flare
-  { 16577, { 460, 0, 0, 0, 0, 0, 0 } },
+  { 16577, { 460, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Falling Star
-  { 16578, { 1500, 0, 0, 0, 0, 0, 0 } },
+  { 16578, { 1500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Detonator
-  { 16766, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16766, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fast Blade
-  { 16788, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16788, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sunshadow
-  { 16789, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16789, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault I: Glittering Topaz
-  { 16791, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16791, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault II: Shining Topaz
-  { 16792, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16792, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault I: Downburst
-  { 16793, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 16793, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault II: Glittering Emerald
-  { 16794, { 30, 0, 0, 0, 0, 0, 0 } },
+  { 16794, { 30, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault I: Earthen Armor
-  { 16795, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16795, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault II: Mountain Buster
-  { 16796, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16796, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault I: Aerial Slash
-  { 16797, { 150, 0, 0, 0, 0, 0, 0 } },
+  { 16797, { 150, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault II: Slipstream
-  { 16798, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 16798, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault I: Crimson Cyclone
-  { 16799, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16799, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Assault II: Flaming Crush
-  { 16800, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 16800, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle: Earthen Fury
-  { 16801, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16801, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle: Aerial Blast
-  { 16802, { 350, 0, 0, 0, 0, 0, 0 } },
+  { 16802, { 350, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Enkindle: Inferno
-  { 16803, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 16803, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Rough Divide
-  { 16804, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 16804, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Tactician
-  { 16889, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16889, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Swashbuckler
-  { 16984, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16984, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Greatest Eclipse
-  { 16985, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 16985, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Cure II
-  { 17000, { 0, 0, 0, 0, 0, 1300, 0 } },
+  { 17000, { 0, 0, 0, 0, 0, 1300, 0 }, false, {} },
   // Ronkan Medica
-  { 17001, { 0, 0, 0, 0, 0, 500, 0 } },
+  { 17001, { 0, 0, 0, 0, 0, 500, 0 }, false, {} },
   // Ronkan Esuna
-  { 17002, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17002, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Stone II
-  { 17003, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 17003, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ronkan Renew
-  { 17004, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17004, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Play
-  { 17055, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17055, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Gunmetal Soul
-  { 17105, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17105, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Crimson Lotus
-  { 17106, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17106, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Acidic Bite
-  { 17122, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 17122, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Heavy Shot
-  { 17123, { 550, 0, 0, 0, 0, 0, 0 } },
+  { 17123, { 550, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Radiant Arrow
-  { 17124, { 1100, 0, 0, 0, 0, 0, 0 } },
+  { 17124, { 1100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dulling Arrow
-  { 17125, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17125, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aspected Benefic
-  { 17151, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 17151, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Aspected Helios
-  { 17152, { 0, 0, 0, 0, 0, 200, 0 } },
+  { 17152, { 0, 0, 0, 0, 0, 200, 0 }, false, {} },
   // Hypercharge
-  { 17209, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17209, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon Eos
-  { 17215, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17215, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Summon Selene
-  { 17216, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17216, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 17222, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17222, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chivalrous Spirit
-  { 17236, { 0, 0, 0, 0, 0, 1200, 0 } },
+  { 17236, { 0, 0, 0, 0, 0, 1200, 0 }, false, {} },
   // Souldeep Invisibility
-  { 17291, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17291, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Spinning Edge
-  { 17413, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17413, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Gust Slash
-  { 17414, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17414, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aeolian Edge
-  { 17415, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17415, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Shadow Fang
-  { 17416, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17416, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Armor Crush
-  { 17417, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17417, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Throwing Dagger
-  { 17418, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17418, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Death Blossom
-  { 17419, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17419, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hakke Mujinsatsu
-  { 17420, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17420, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hunter's Prudence
-  { 17596, { 0, 0, 0, 0, 0, 1000, 0 } },
+  { 17596, { 0, 0, 0, 0, 0, 1000, 0 }, false, {} },
   // Nebula
-  { 17839, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17839, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bio
-  { 17864, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17864, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Bio II
-  { 17865, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17865, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin
-  { 17869, { 160, 0, 0, 0, 0, 0, 0 } },
+  { 17869, { 160, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ruin II
-  { 17870, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17870, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Smackdown
-  { 17901, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 17901, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // 攻撃
-  { 18034, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18034, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ending
-  { 18073, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18073, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Alpine Draft
-  { 18295, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18295, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Protean Wave
-  { 18296, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18296, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Northerlies
-  { 18297, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18297, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Electrogenesis
-  { 18298, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18298, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Kaltstrahl
-  { 18299, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18299, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Abyssal Transfixion
-  { 18300, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18300, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chirp
-  { 18301, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18301, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Eerie Soundwave
-  { 18302, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18302, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Pom Cure
-  { 18303, { 0, 0, 0, 0, 0, 100, 0 } },
+  { 18303, { 0, 0, 0, 0, 0, 100, 0 }, false, {} },
   // Gobskin
-  { 18304, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18304, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Magic Hammer
-  { 18305, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 18305, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Avail
-  { 18306, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18306, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Frog Legs
-  { 18307, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18307, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sonic Boom
-  { 18308, { 210, 0, 0, 0, 0, 0, 0 } },
+  { 18308, { 210, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Whistle
-  { 18309, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18309, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // White Knight's Tour
-  { 18310, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 18310, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Black Knight's Tour
-  { 18311, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 18311, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Level 5 Death
-  { 18312, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18312, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Launcher
-  { 18313, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18313, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Perpetual Ray
-  { 18314, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18314, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Cactguard
-  { 18315, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18315, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Revenge Blast
-  { 18316, { 50, 0, 0, 0, 0, 0, 0 } },
+  { 18316, { 50, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Angel Whisper
-  { 18317, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18317, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Exuviation
-  { 18318, { 0, 0, 0, 0, 0, 50, 0 } },
+  { 18318, { 0, 0, 0, 0, 0, 50, 0 }, false, {} },
   // Reflux
-  { 18319, { 220, 0, 0, 0, 0, 0, 0 } },
+  { 18319, { 220, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Devour
-  { 18320, { 250, 0, 0, 0, 0, 0, 0 } },
+  { 18320, { 250, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Condensed Libra
-  { 18321, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18321, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherial Mimicry
-  { 18322, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18322, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Surpanakha
-  { 18323, { 200, 0, 0, 0, 0, 0, 0 } },
+  { 18323, { 200, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Quasar
-  { 18324, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 18324, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // J Kick
-  { 18325, { 300, 0, 0, 0, 0, 0, 0 } },
+  { 18325, { 300, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doom Spike
-  { 18772, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18772, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Sonic Thrust
-  { 18773, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18773, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Coerthan Torment
-  { 18774, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18774, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Skydragon Dive
-  { 18775, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 18775, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ala Morn
-  { 18776, { 3000, 0, 0, 0, 0, 0, 0 } },
+  { 18776, { 3000, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Drachenlance
-  { 18777, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 18777, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Horrid Roar
-  { 18778, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 18778, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Stardiver
-  { 18780, { 1500, 0, 0, 0, 0, 0, 0 } },
+  { 18780, { 1500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dragonshadow Dive
-  { 18781, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18781, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Dragonshadow Dive
-  { 18782, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18782, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Ten
-  { 18805, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18805, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Chi
-  { 18806, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18806, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Jin
-  { 18807, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18807, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fuma Shuriken
-  { 18873, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 18873, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fuma Shuriken
-  { 18874, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 18874, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Fuma Shuriken
-  { 18875, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 18875, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Katon
-  { 18876, { 500, 0, 0, 0, 0, 0, 0 } },
+  { 18876, { 500, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Raiton
-  { 18877, { 800, 0, 0, 0, 0, 0, 0 } },
+  { 18877, { 800, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Hyoton
-  { 18878, { 400, 0, 0, 0, 0, 0, 0 } },
+  { 18878, { 400, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Huton
-  { 18879, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 18879, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Doton
-  { 18880, { 100, 0, 0, 0, 0, 0, 0 } },
+  { 18880, { 100, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Suiton
-  { 18881, { 600, 0, 0, 0, 0, 0, 0 } },
+  { 18881, { 600, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Gofu
-  { 19046, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19046, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Yagetsu
-  { 19047, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19047, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aqua Vitae
-  { 19218, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19218, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // attack
-  { 19221, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19221, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherial Mimicry
-  { 19238, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19238, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherial Mimicry
-  { 19239, { 0, 0, 0, 0, 0, 0, 0 } },
+  { 19239, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
   // Aetherial Mimicry
-  { 19240, { 0, 0, 0, 0, 0, 0, 0 } },
-};
\ No newline at end of file
+  { 19240, { 0, 0, 0, 0, 0, 0, 0 }, false, {} },
+};
+
+static constexpr auto actionLutIndex = ActionLut::buildIndex< 19241 >( actionLut );
+
+const ActionLutEntry* const ActionLut::m_entries = actionLut;
+const uint16_t* const ActionLut::m_index = actionLutIndex.data();
+const std::size_t ActionLut::m_indexSize = actionLutIndex.size();
@@ -11,6 +11,7 @@
 #include <Util/UtilMath.h>
 
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 
 using namespace Sapphire;
 using namespace Sapphire::World::Action;
@@ -101,8 +102,11 @@ void EffectBuilder::mount( Entity::CharaPtr& target, uint16_t mountId )
 void EffectBuilder::buildAndSendPackets()
 {
   auto targetCount = m_resolvedEffects.size();
-  Logger::debug( "EffectBuilder result: " );
-  Logger::debug( "Targets afflicted: {}", targetCount );
+  SAPPHIRE_LOG_DEBUG( "EffectBuilder result: " );
+  SAPPHIRE_LOG_DEBUG( "Targets afflicted: {}", targetCount );
+
+  static auto& effectPackets = Common::Metrics::Registry::counter( "sapphire_world_effect_packets",
+                                                                   "Effect packets built for actions" );
 
   auto globalSequence = m_sourceChara->getCurrentTerritory()->getNextEffectSequence();
 
@@ -110,6 +114,7 @@ void EffectBuilder::buildAndSendPackets()
   {
     auto packet = buildNextEffectPacket( globalSequence );
     m_sourceChara->sendToInRangeSet( packet, true );
+    effectPackets.inc();
   }
   while( !m_resolvedEffects.empty() );
 }
@@ -191,7 +196,7 @@ std::shared_ptr< FFXIVPacketBase > EffectBuilder::buildNextEffectPacket( uint32_
       assert( !resultList->empty() );
       auto firstResult = resultList->data()[ 0 ];
       pEffectTargetId[ targetIndex ] = firstResult->getTarget()->getId();
-      Logger::debug( " - id: {}", pEffectTargetId[ targetIndex ] );
+      SAPPHIRE_LOG_DEBUG( " - id: {}", pEffectTargetId[ targetIndex ] );
 
       for( auto i = 0; i < resultList->size(); i++ )
       {
@@ -220,7 +225,7 @@ std::shared_ptr< FFXIVPacketBase > EffectBuilder::buildNextEffectPacket( uint32_
     auto resultList = m_resolvedEffects.begin()->second;
     assert( !resultList->empty() );
     auto firstResult = resultList->data()[ 0 ];
-    Logger::debug( " - id: {}", firstResult->getTarget()->getId() );
+    SAPPHIRE_LOG_DEBUG( " - id: {}", firstResult->getTarget()->getId() );
 
     auto seq = m_sourceChara->getCurrentTerritory()->getNextEffectSequence();
 
@@ -15,8 +15,8 @@ using namespace Sapphire::Network::Packets::Server;
 using namespace Sapphire::Network::ActorControl;
 using namespace Sapphire::World::Action;
 
-MountAction::MountAction( Sapphire::Entity::CharaPtr source, uint16_t mountId, uint16_t sequence, Data::ActionPtr actionData ) :
-  Action::Action( source, 4, sequence, actionData ),
+MountAction::MountAction( Sapphire::Entity::CharaPtr source, uint16_t mountId, uint16_t sequence ) :
+  Action::Action( source, 4, sequence ),
   m_mountId( mountId )
 {
 }
@@ -4,6 +4,7 @@
 
 #include <Util/Util.h>
 #include <Util/UtilMath.h>
+#include <Service.h>
 #include <utility>
 
 #include "Territory/Territory.h"
@@ -19,6 +20,7 @@
 #include "Session.h"
 
 #include "Manager/TerritoryMgr.h"
+#include "Manager/RNGMgr.h"
 
 #include "StatusEffect/StatusEffect.h"
 
@@ -283,6 +285,27 @@ Sapphire::Entity::CharaPtr Sapphire::Entity::Actor::getClosestChara()
   return tmpActor;
 }
 
+/*! \return PlayerPtr of the closest player in range, if none, nullptr */
+Sapphire::Entity::PlayerPtr Sapphire::Entity::Actor::getClosestPlayer()
+{
+  PlayerPtr pClosestPlayer = nullptr;
+  float minDistanceSq = 0;
+
+  for( const auto& pPlayer : m_inRangePlayers )
+  {
+    float distanceSq = Util::distanceSq( getPos().x, getPos().y, getPos().z,
+                                         pPlayer->getPos().x, pPlayer->getPos().y, pPlayer->getPos().z );
+
+    if( !pClosestPlayer || distanceSq < minDistanceSq )
+    {
+      minDistanceSq = distanceSq;
+      pClosestPlayer = pPlayer;
+    }
+  }
+
+  return pClosestPlayer;
+}
+
 /*! Clear the whole in range set, this does no cleanup */
 void Sapphire::Entity::Actor::clearInRangeSet()
 {
@@ -336,6 +359,14 @@ Sapphire::TerritoryPtr Sapphire::Entity::Actor::getCurrentTerritory() const
   return m_pCurrentTerritory;
 }
 
+Sapphire::Common::Util::RandomEngine& Sapphire::Entity::Actor::getRandomEngine() const
+{
+  if( m_pCurrentTerritory )
+    return m_pCurrentTerritory->getRandomEngine();
+
+  return Common::Service< World::Manager::RNGMgr >::ref().getThreadEngine();
+}
+
 /*! \param TerritoryPtr to the zone to be set as current */
 void Sapphire::Entity::Actor::setCurrentZone( TerritoryPtr currZone )
 {
@@ -2,6 +2,7 @@
 #define _GAME_OBJECT_H_
 
 #include <Common.h>
+#include <Util/RandomEngine.h>
 #include <memory>
 
 #include "ForwardsZone.h"
@@ -94,6 +95,20 @@ namespace Sapphire::Entity
 
     CharaPtr getClosestChara();
 
+    /*! walks the in range set without copying it, func must not add or remove in range actors */
+    template< typename Func >
+    void forEachInRangeActor( Func&& func, bool includeSelf = false )
+    {
+      if( includeSelf )
+        func( shared_from_this() );
+
+      for( const auto& pActor : m_inRangeActor )
+        func( pActor );
+    }
+
+    /*! only walks the players in range, which is what ai checks care about */
+    PlayerPtr getClosestPlayer();
+
     void sendToInRangeSet( Network::Packets::FFXIVPacketBasePtr pPacket, bool bToSelf = false );
 
     // add an actor to in range set
@@ -124,6 +139,9 @@ namespace Sapphire::Entity
 
     TerritoryPtr getCurrentTerritory() const;
 
+    /*! @return the engine of the current territory, or the engine of the calling thread outside of one */
+    Common::Util::RandomEngine& getRandomEngine() const;
+
     void setCurrentZone( TerritoryPtr currZone );
 
     InstanceContentPtr getCurrentInstance() const;
@@ -3,6 +3,7 @@
 #include <Network/PacketContainer.h>
 #include <Exd/ExdDataGenerated.h>
 #include <utility>
+#include <algorithm>
 #include <Network/CommonActorControl.h>
 #include <Network/PacketWrappers/EffectPacket.h>
 #include <Network/PacketDef/Zone/ClientZoneDef.h>
@@ -39,7 +40,6 @@
 #include <Manager/TerritoryMgr.h>
 #include <Manager/NaviMgr.h>
 #include <Manager/TerritoryMgr.h>
-#include <Manager/RNGMgr.h>
 #include <Service.h>
 
 using namespace Sapphire::Common;
@@ -48,7 +48,9 @@ using namespace Sapphire::Network::Packets::Server;
 using namespace Sapphire::Network::ActorControl;
 
 Sapphire::Entity::BNpc::BNpc() :
-  Npc( ObjKind::BattleNpc )
+  Npc( ObjKind::BattleNpc ),
+  m_aiLod( BNpcAiLod::Full ),
+  m_lastAiUpdate( 0 )
 {
 }
 
@@ -92,6 +94,8 @@ Sapphire::Entity::BNpc::BNpc( uint32_t id, BNpcTemplatePtr pTemplate, float posX
 
   m_state = BNpcState::Idle;
   m_status = ActorStatus::Idle;
+  m_aiLod = BNpcAiLod::Full;
+  m_lastAiUpdate = 0;
 
   m_baseStats.max_hp = maxHp;
   m_baseStats.max_mp = 200;
@@ -210,7 +214,7 @@ bool Sapphire::Entity::BNpc::moveTo( const FFXIVARR_POSITION3& pos )
     // Reached destination
     face( pos );
     setPos( pos1 );
-    sendPositionUpdate();
+    markStateDirty( StatePosition );
     pNaviProvider->updateAgentPosition( *this );
     return true;
   }
@@ -218,7 +222,7 @@ bool Sapphire::Entity::BNpc::moveTo( const FFXIVARR_POSITION3& pos )
   m_pCurrentTerritory->updateActorPosition( *this );
   face( pos );
   setPos( pos1 );
-  sendPositionUpdate();
+  markStateDirty( StatePosition );
   return false;
 }
 
@@ -242,7 +246,7 @@ bool Sapphire::Entity::BNpc::moveTo( const Entity::Chara& targetChara )
     // Reached destination
     face( targetChara.getPos() );
     setPos( pos1 );
-    sendPositionUpdate();
+    markStateDirty( StatePosition );
     pNaviProvider->updateAgentPosition( *this );
     return true;
   }
@@ -250,7 +254,7 @@ bool Sapphire::Entity::BNpc::moveTo( const Entity::Chara& targetChara )
   m_pCurrentTerritory->updateActorPosition( *this );
   face( targetChara.getPos() );
   setPos( pos1 );
-  sendPositionUpdate();
+  markStateDirty( StatePosition );
   return false;
 }
 
@@ -268,42 +272,39 @@ void Sapphire::Entity::BNpc::sendPositionUpdate()
 
 void Sapphire::Entity::BNpc::hateListClear()
 {
-  auto it = m_hateList.begin();
-  for( auto& listEntry : m_hateList )
+  m_pendingHate.clear();
+
+  // deaggro calls back into the hate list
+  auto hateList = std::move( m_hateList );
+  m_hateList.clear();
+
+  for( auto& listEntry : hateList )
   {
-    if( isInRangeSet( listEntry->m_pChara ) )
-      deaggro( listEntry->m_pChara );
+    auto pChara = listEntry.m_pChara.lock();
+    if( pChara && isInRangeSet( pChara ) )
+      deaggro( pChara );
   }
-  m_hateList.clear();
 }
 
 Sapphire::Entity::CharaPtr Sapphire::Entity::BNpc::hateListGetHighest()
 {
-  auto it = m_hateList.begin();
-  uint32_t maxHate = 0;
-  std::shared_ptr< HateListEntry > entry;
-  for( ; it != m_hateList.end(); ++it )
+  // hate queued since the last update is merged at the start of the next one
+  while( !m_hateList.empty() && m_hateList.front().m_hateAmount != 0 )
   {
-    if( ( *it )->m_hateAmount > maxHate )
-    {
-      maxHate = ( *it )->m_hateAmount;
-      entry = *it;
-    }
-  }
+    if( auto pChara = m_hateList.front().m_pChara.lock() )
+      return pChara;
 
-  if( entry && maxHate != 0 )
-    return entry->m_pChara;
+    // the actor is gone, drop it once it would have been picked
+    m_hateList.erase( m_hateList.begin() );
+  }
 
   return nullptr;
 }
 
 void Sapphire::Entity::BNpc::hateListAdd( Sapphire::Entity::CharaPtr pChara, int32_t hateAmount )
 {
-  auto hateEntry = std::make_shared< HateListEntry >();
-  hateEntry->m_hateAmount = static_cast< uint32_t >( hateAmount );
-  hateEntry->m_pChara = pChara;
+  hateListUpdate( pChara, hateAmount );
 
-  m_hateList.insert( hateEntry );
   if( pChara->isPlayer() )
   {
     auto pPlayer = pChara->getAsPlayer();
@@ -313,53 +314,104 @@ void Sapphire::Entity::BNpc::hateListAdd( Sapphire::Entity::CharaPtr pChara, int
 
 void Sapphire::Entity::BNpc::hateListUpdate( Sapphire::Entity::CharaPtr pChara, int32_t hateAmount )
 {
-  for( auto listEntry : m_hateList )
+  hateListFlush();
+
+  auto it = hateListFind( pChara->getId() );
+  if( it != m_hateList.end() )
   {
-    if( listEntry->m_pChara == pChara )
-    {
-      listEntry->m_hateAmount += static_cast< uint32_t >( hateAmount );
-      return;
-    }
+    it->m_hateAmount += static_cast< uint32_t >( hateAmount );
+    // same id but possibly a new object, e.g. a player who logged back in
+    it->m_pChara = pChara;
   }
+  else
+    m_hateList.push_back( { pChara->getId(), static_cast< uint32_t >( hateAmount ), pChara } );
 
-  auto hateEntry = std::make_shared< HateListEntry >();
-  hateEntry->m_hateAmount = static_cast< uint32_t >( hateAmount );
-  hateEntry->m_pChara = pChara;
-  m_hateList.insert( hateEntry );
+  hateListSort();
+}
+
+void Sapphire::Entity::BNpc::hateListQueue( Sapphire::Entity::CharaPtr pChara, uint32_t hateAmount )
+{
+  m_pendingHate.push_back( { pChara->getId(), hateAmount, pChara } );
 }
 
 void Sapphire::Entity::BNpc::hateListRemove( Sapphire::Entity::CharaPtr pChara )
 {
-  for( auto listEntry : m_hateList )
+  hateListFlush();
+
+  auto it = hateListFind( pChara->getId() );
+  if( it == m_hateList.end() )
+    return;
+
+  m_hateList.erase( it );
+  if( pChara->isPlayer() )
+  {
+    PlayerPtr tmpPlayer = pChara->getAsPlayer();
+    tmpPlayer->onMobDeaggro( getAsBNpc() );
+  }
+}
+
+bool Sapphire::Entity::BNpc::hateListHasActor( Sapphire::Entity::CharaPtr pChara )
+{
+  hateListFlush();
+
+  return hateListFind( pChara->getId() ) != m_hateList.end();
+}
+
+std::vector< Sapphire::Entity::HateListEntry >::iterator Sapphire::Entity::BNpc::hateListFind( uint32_t actorId )
+{
+  return std::find_if( m_hateList.begin(), m_hateList.end(), [ actorId ]( const HateListEntry& entry )
   {
-    if( listEntry->m_pChara == pChara )
-    {
+    return entry.m_actorId == actorId;
+  } );
+}
 
-      m_hateList.erase( listEntry );
-      if( pChara->isPlayer() )
-      {
-        PlayerPtr tmpPlayer = pChara->getAsPlayer();
-        tmpPlayer->onMobDeaggro( getAsBNpc() );
-      }
-      return;
+void Sapphire::Entity::BNpc::hateListFlush()
+{
+  if( m_pendingHate.empty() )
+    return;
+
+  for( auto& pending : m_pendingHate )
+  {
+    auto it = hateListFind( pending.m_actorId );
+    if( it != m_hateList.end() )
+    {
+      it->m_hateAmount += pending.m_hateAmount;
+      it->m_pChara = std::move( pending.m_pChara );
     }
+    else
+      m_hateList.push_back( std::move( pending ) );
   }
+  m_pendingHate.clear();
+
+  // drop actors that are gone before they can collect any more hate
+  m_hateList.erase( std::remove_if( m_hateList.begin(), m_hateList.end(), []( const HateListEntry& entry )
+  {
+    return entry.m_pChara.expired();
+  } ), m_hateList.end() );
+
+  hateListSort();
 }
 
-bool Sapphire::Entity::BNpc::hateListHasActor( Sapphire::Entity::CharaPtr pChara )
+void Sapphire::Entity::BNpc::hateListSort()
 {
-  for( auto& listEntry : m_hateList )
+  // the list is nearly sorted at all times, an insertion sort only moves the entries that gained hate.
+  // it is also stable, on a tie whoever got on the list first keeps the top spot
+  for( std::size_t i = 1; i < m_hateList.size(); ++i )
   {
-    if( listEntry->m_pChara == pChara )
-      return true;
+    if( m_hateList[ i - 1 ].m_hateAmount >= m_hateList[ i ].m_hateAmount )
+      continue;
+
+    auto entry = std::move( m_hateList[ i ] );
+    auto j = i;
+    for( ; j > 0 && m_hateList[ j - 1 ].m_hateAmount < entry.m_hateAmount; --j )
+      m_hateList[ j ] = std::move( m_hateList[ j - 1 ] );
+    m_hateList[ j ] = std::move( entry );
   }
-  return false;
 }
 
 void Sapphire::Entity::BNpc::aggro( Sapphire::Entity::CharaPtr pChara )
 {
-  auto& pRNGMgr = Common::Service< World::Manager::RNGMgr >::ref();
-  auto variation = static_cast< uint32_t >( pRNGMgr.getRandGenerator< float >( 500, 1000 ).next() );
+  auto variation = 500 + getRandomEngine().nextUInt( 500 );
 
   m_lastAttack = Util::getTimeMs() + variation;
   hateListUpdate( pChara, 1 );
@@ -406,6 +458,20 @@ void Sapphire::Entity::BNpc::update( uint64_t tickCount )
 {
   const uint8_t maxDistanceToOrigin = 40;
   const uint32_t roamTick = 20;
+  const uint32_t reducedAiInterval = 1000;
+
+  // every hit taken since the last update costs one merge and sort here
+  hateListFlush();
+
+  // mobs far away from any player think less often, mobs no player can see not at all
+  m_aiLod = calculateAiLod();
+  if( m_aiLod == BNpcAiLod::Dormant )
+    return;
+
+  if( m_aiLod == BNpcAiLod::Reduced && ( tickCount - m_lastAiUpdate ) < reducedAiInterval )
+    return;
+
+  m_lastAiUpdate = tickCount;
 
   auto pNaviProvider = m_pCurrentTerritory->getNaviProvider();
 
@@ -465,7 +531,7 @@ void Sapphire::Entity::BNpc::update( uint64_t tickCount )
         aggro( pHatedActor );
 
       if( pNaviProvider->syncPosToChara( *this ) )
-        sendPositionUpdate();
+        markStateDirty( StatePosition );
 
       if( !hasFlag( Immobile ) && ( Util::getTimeSeconds() - m_lastRoamTargetReached > roamTick ) )
       {
@@ -501,7 +567,7 @@ void Sapphire::Entity::BNpc::update( uint64_t tickCount )
       }
 
       if( pNaviProvider->syncPosToChara( *this ) )
-        sendPositionUpdate();
+        markStateDirty( StatePosition );
 
       if( pHatedActor )
       {
@@ -532,7 +598,7 @@ void Sapphire::Entity::BNpc::update( uint64_t tickCount )
         if( distance < ( getRadius() + pHatedActor->getRadius() + 3.f ) )
         {
           if( !hasFlag( TurningDisabled ) && face( pHatedActor->getPos() ) )
-            sendPositionUpdate();
+            markStateDirty( StatePosition );
 
           // in combat range. ATTACK!
           autoAttack( pHatedActor );
@@ -553,6 +619,38 @@ void Sapphire::Entity::BNpc::update( uint64_t tickCount )
   Chara::update( tickCount );
 }
 
+Sapphire::Entity::BNpcAiLod Sapphire::Entity::BNpc::calculateAiLod()
+{
+  const float fullAiRange = 50.f;
+
+  // fighting, retreating or dying has to carry on even once every player is gone
+  if( m_state != BNpcState::Idle && m_state != BNpcState::Roaming )
+    return BNpcAiLod::Full;
+
+  // a script may have put something on the hate list, the idle state picks it up
+  if( !m_hateList.empty() || !m_pendingHate.empty() )
+    return BNpcAiLod::Full;
+
+  auto pClosestPlayer = getClosestPlayer();
+  if( !pClosestPlayer )
+    return BNpcAiLod::Dormant;
+
+  if( Util::distance( getPos(), pClosestPlayer->getPos() ) <= fullAiRange )
+    return BNpcAiLod::Full;
+
+  return BNpcAiLod::Reduced;
+}
+
+Sapphire::Entity::BNpcAiLod Sapphire::Entity::BNpc::getAiLod() const
+{
+  return m_aiLod;
+}
+
+void Sapphire::Entity::BNpc::wake()
+{
+  m_lastAiUpdate = 0;
+}
+
 void Sapphire::Entity::BNpc::regainHp()
 {
   if( this->m_hp < this->getMaxHp() )
@@ -565,14 +663,18 @@ void Sapphire::Entity::BNpc::regainHp()
       this->m_hp = this->getMaxHp();
   }
 
-  this->sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
-void Sapphire::Entity::BNpc::onActionHostile( Sapphire::Entity::CharaPtr pSource )
+void Sapphire::Entity::BNpc::onActionHostile( Sapphire::Entity::CharaPtr pSource, uint32_t hateAmount )
 {
-  if( !hateListGetHighest() )
+  // checked without flushing, the queued hate is merged once on the next update
+  if( m_hateList.empty() && m_pendingHate.empty() )
     aggro( pSource );
 
+  if( hateAmount > 0 )
+    hateListQueue( pSource, hateAmount );
+
   if( !m_pOwner )
     setOwner( pSource );
 }
@@ -585,14 +687,22 @@ void Sapphire::Entity::BNpc::onDeath()
   m_timeOfDeath = Util::getTimeSeconds();
   setOwner( nullptr );
 
-  for( auto& pHateEntry : m_hateList )
+  hateListFlush();
+  for( auto& hateEntry : m_hateList )
   {
     // TODO: handle drops 
-    auto pPlayer = pHateEntry->m_pChara->getAsPlayer();
-    if( pPlayer )
+    auto pChara = hateEntry.m_pChara.lock();
+    if( !pChara )
+      continue;
+
+    if( auto pPlayer = pChara->getAsPlayer() )
       pPlayer->onMobKill( static_cast< uint16_t >( m_bNpcNameId ) );
   }
   hateListClear();
+
+  // despawn and respawn are driven by the timer wheel of the zone
+  if( auto pZone = getCurrentTerritory() )
+    pZone->onBNpcDeath( *this );
 }
 
 uint32_t Sapphire::Entity::BNpc::getTimeOfDeath() const
@@ -611,9 +721,9 @@ void Sapphire::Entity::BNpc::checkAggro()
   if( m_aggressionMode == 1 )
     return;
 
-  CharaPtr pClosestChara = getClosestChara();
+  CharaPtr pClosestChara = getClosestPlayer();
 
-  if( pClosestChara && pClosestChara->isAlive() && pClosestChara->isPlayer() )
+  if( pClosestChara && pClosestChara->isAlive() )
   {
     // will use this range if chara level is lower than bnpc, otherwise diminishing equation applies
     float range = 13.f;
@@ -689,7 +799,6 @@ void Sapphire::Entity::BNpc::autoAttack( CharaPtr pTarget )
   {
     pTarget->onActionHostile( getAsChara() );
     m_lastAttack = tick;
-    srand( static_cast< uint32_t >( tick ) );
 
     auto damage = Math::CalcStats::calcAutoAttackDamage( *this );
 
@@ -712,33 +821,32 @@ void Sapphire::Entity::BNpc::autoAttack( CharaPtr pTarget )
 void Sapphire::Entity::BNpc::calculateStats()
 {
   uint8_t level = getLevel();
-  uint8_t job = static_cast< uint8_t >( getClass() );
-
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
 
-  auto classInfo = exdData.get< Sapphire::Data::ClassJob >( job );
-  auto paramGrowthInfo = exdData.get< Sapphire::Data::ParamGrow >( level );
+  const auto& levelStats = Math::CalcStats::getLevelStats( level );
+  const auto& classLevelStats = Math::CalcStats::getClassLevelStats( getClass(), level );
 
-  float base = Math::CalcStats::calculateBaseStat( *this );
+  float base = levelStats.main;
 
-  m_baseStats.str = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierStrength ) / 100 ) );
-  m_baseStats.dex = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierDexterity ) / 100 ) );
-  m_baseStats.vit = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierVitality ) / 100 ) );
-  m_baseStats.inte = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierIntelligence ) / 100 ) );
-  m_baseStats.mnd = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierMind ) / 100 ) );
+  m_baseStats.str = static_cast< uint32_t >( classLevelStats.str );
+  m_baseStats.dex = static_cast< uint32_t >( classLevelStats.dex );
+  m_baseStats.vit = static_cast< uint32_t >( classLevelStats.vit );
+  m_baseStats.inte = static_cast< uint32_t >( classLevelStats.inte );
+  m_baseStats.mnd = static_cast< uint32_t >( classLevelStats.mnd );
   //m_baseStats.pie = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierPiety ) / 100 ) );
 
   m_baseStats.determination = static_cast< uint32_t >( base );
   m_baseStats.pie = static_cast< uint32_t >( base );
-  m_baseStats.skillSpeed = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.spellSpeed = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.accuracy = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.critHitRate = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.attackPotMagic = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.healingPotMagic = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
-  m_baseStats.tenacity = static_cast< uint32_t >( paramGrowthInfo->baseSpeed );
+  m_baseStats.skillSpeed = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.spellSpeed = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.accuracy = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.critHitRate = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.attackPotMagic = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.healingPotMagic = static_cast< uint32_t >( levelStats.baseSpeed );
+  m_baseStats.tenacity = static_cast< uint32_t >( levelStats.baseSpeed );
 
   m_baseStats.attack = m_baseStats.str;
   m_baseStats.attackPotMagic = m_baseStats.inte;
   m_baseStats.healingPotMagic = m_baseStats.mnd;
+
+  invalidateAttributes();
 }
\ No newline at end of file
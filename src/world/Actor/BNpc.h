@@ -15,8 +15,10 @@ namespace Sapphire::Entity
 
   struct HateListEntry
   {
+    uint32_t m_actorId;
     uint32_t m_hateAmount;
-    CharaPtr m_pChara;
+    // the hate list must not keep dead or logged out actors alive
+    std::weak_ptr< Chara > m_pChara;
   };
 
   enum class BNpcState
@@ -29,6 +31,14 @@ namespace Sapphire::Entity
     Dead,
   };
 
+  /*! how often the ai of a bnpc runs, picked from the distance to the closest player */
+  enum class BNpcAiLod : uint8_t
+  {
+    Full,
+    Reduced,
+    Dormant,
+  };
+
   enum BNpcFlag
   {
     None = 0,
@@ -79,7 +89,7 @@ namespace Sapphire::Entity
 
     bool moveTo( const Entity::Chara& targetChara );
 
-    void sendPositionUpdate();
+    void sendPositionUpdate() override;
 
     BNpcState getState() const;
     void setState( BNpcState state );
@@ -88,6 +98,8 @@ namespace Sapphire::Entity
     CharaPtr hateListGetHighest();
     void hateListAdd( CharaPtr pChara, int32_t hateAmount );
     void hateListUpdate( CharaPtr pChara, int32_t hateAmount );
+    /*! queues hate to be merged the next time the list is read, cheap enough to call for every hit */
+    void hateListQueue( CharaPtr pChara, uint32_t hateAmount );
     void hateListRemove( CharaPtr pChara );
     bool hateListHasActor( CharaPtr pChara );
 
@@ -95,9 +107,13 @@ namespace Sapphire::Entity
     void deaggro( CharaPtr pChara );
 
     void update( uint64_t tickCount ) override;
+
+    BNpcAiLod getAiLod() const;
+    /*! makes the ai run on the next update regardless of its level of detail */
+    void wake();
     void onTick() override;
 
-    void onActionHostile( CharaPtr pSource ) override;
+    void onActionHostile( CharaPtr pSource, uint32_t hateAmount = 0 ) override;
 
     void onDeath() override;
 
@@ -121,6 +137,12 @@ namespace Sapphire::Entity
     void calculateStats() override;
 
   private:
+    std::vector< HateListEntry >::iterator hateListFind( uint32_t actorId );
+    void hateListFlush();
+    void hateListSort();
+
+    BNpcAiLod calculateAiLod();
+
     uint32_t m_bNpcBaseId;
     uint32_t m_bNpcNameId;
     uint64_t m_weaponMain;
@@ -145,7 +167,11 @@ namespace Sapphire::Entity
     Common::FFXIVARR_POSITION3 m_roamPos;
 
     BNpcState m_state;
-    std::set< std::shared_ptr< HateListEntry > > m_hateList;
+    BNpcAiLod m_aiLod;
+    uint64_t m_lastAiUpdate;
+    /*! sorted by hate, highest first, so the current target is always the front entry */
+    std::vector< HateListEntry > m_hateList;
+    std::vector< HateListEntry > m_pendingHate;
 
     uint64_t m_naviLastUpdate;
     std::vector< Common::FFXIVARR_POSITION3 > m_naviLastPath;
@@ -4,6 +4,7 @@
 #include <Exd/ExdDataGenerated.h>
 #include <utility>
 #include <Network/CommonActorControl.h>
+#include <Metrics/Metrics.h>
 #include <Service.h>
 
 
@@ -33,12 +34,42 @@ using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
 using namespace Sapphire::Network::ActorControl;
 
+namespace
+{
+  // one counter per part of the state, bit n of the state flags counts into counter n
+  using StateCounters = std::array< Metrics::Counter*, 4 >;
+
+  StateCounters makeStateCounters( const std::string& name, const std::string& help )
+  {
+    const char* parts[] = { "hp", "status", "position", "target" };
+
+    StateCounters counters{};
+    for( std::size_t i = 0; i < counters.size(); ++i )
+      counters[ i ] = &Metrics::Registry::counter( name, help, std::string( "part=\"" ) + parts[ i ] + "\"" );
+
+    return counters;
+  }
+
+  void countStateParts( const StateCounters& counters, uint8_t stateFlags )
+  {
+    for( std::size_t i = 0; i < counters.size(); ++i )
+    {
+      if( stateFlags & ( 1u << i ) )
+        counters[ i ]->inc();
+    }
+  }
+}
+
 Sapphire::Entity::Chara::Chara( ObjKind type ) :
   Actor( type ),
   m_pose( 0 ),
   m_targetId( INVALID_GAME_OBJECT_ID64 ),
   m_directorId( 0 ),
-  m_radius( 1.f )
+  m_radius( 1.f ),
+  m_attributes{},
+  m_attributesDirty( true ),
+  m_dirtyState( 0 ),
+  m_statusEffectMask( 0 )
 {
 
   m_lastTickTime = 0;
@@ -46,12 +77,7 @@ Sapphire::Entity::Chara::Chara( ObjKind type ) :
   m_lastAttack = Util::getTimeMs();
 
   m_bonusStats.fill( 0 );
-
-  // initialize the free slot queue
-  for( uint8_t i = 0; i < MAX_STATUS_EFFECTS; i++ )
-  {
-    m_statusEffectFreeSlotQueue.push( i );
-  }
+  m_statusEffectIds.fill( 0 );
 }
 
 Sapphire::Entity::Chara::~Chara()
@@ -71,7 +97,7 @@ Sapphire::Common::Stance Sapphire::Entity::Chara::getStance() const
 }
 
 /*! \return actor stats */
-Sapphire::Entity::Chara::ActorStats Sapphire::Entity::Chara::getStats() const
+const Sapphire::Entity::Chara::ActorStats& Sapphire::Entity::Chara::getStats() const
 {
   return m_baseStats;
 }
@@ -121,6 +147,7 @@ Sapphire::Common::ClassJob Sapphire::Entity::Chara::getClass() const
 void Sapphire::Entity::Chara::setClass( Common::ClassJob classJob )
 {
   m_class = classJob;
+  invalidateAttributes();
 }
 
 Sapphire::Common::Role Sapphire::Entity::Chara::getRole() const
@@ -218,42 +245,42 @@ uint32_t Sapphire::Entity::Chara::getMaxMp() const
 void Sapphire::Entity::Chara::resetHp()
 {
   m_hp = getMaxHp();
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \return reset mp to current max mp */
 void Sapphire::Entity::Chara::resetMp()
 {
   m_mp = getMaxMp();
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \param hp amount to set ( caps to maxHp ) */
 void Sapphire::Entity::Chara::setHp( uint32_t hp )
 {
   m_hp = hp < getMaxHp() ? hp : getMaxHp();
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \param mp amount to set ( caps to maxMp ) */
 void Sapphire::Entity::Chara::setMp( uint32_t mp )
 {
   m_mp = mp < getMaxMp() ? mp : getMaxMp();
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \param gp amount to set*/
 void Sapphire::Entity::Chara::setGp( uint32_t gp )
 {
   m_gp = static_cast< uint16_t >( gp );
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \param tp amount to set*/
 void Sapphire::Entity::Chara::setTp( uint32_t tp )
 {
   m_tp = static_cast< uint16_t >( tp );
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*! \param type invincibility type to set */
@@ -285,6 +312,10 @@ void Sapphire::Entity::Chara::die()
   m_mp = 0;
   m_tp = 0;
 
+  // the final hp has to arrive before the death itself
+  markStateDirty( StateHpMpTp );
+  flushStateUpdates();
+
   // fire onDeath event
   onDeath();
 
@@ -354,8 +385,6 @@ bool Sapphire::Entity::Chara::checkAction()
 
 void Sapphire::Entity::Chara::update( uint64_t tickCount )
 {
-  updateStatusEffects();
-
   if( std::difftime( static_cast< time_t >( tickCount ), m_lastTickTime ) > 3000 )
   {
     onTick();
@@ -374,8 +403,7 @@ Change the current target and propagate to in range players
 void Sapphire::Entity::Chara::changeTarget( uint64_t targetId )
 {
   setTargetId( targetId );
-  FFXIVPacketBasePtr packet = makeActorControlTarget( m_id, SetTarget, 0, 0, 0, 0, targetId );
-  sendToInRangeSet( packet );
+  markStateDirty( StateTarget );
 }
 
 /*!
@@ -418,7 +446,7 @@ void Sapphire::Entity::Chara::takeDamage( uint32_t damage )
   else
     m_hp -= damage;
 
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*!
@@ -437,7 +465,7 @@ void Sapphire::Entity::Chara::heal( uint32_t amount )
   else
     m_hp += amount;
 
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 void Sapphire::Entity::Chara::restoreMP( uint32_t amount )
@@ -449,7 +477,7 @@ void Sapphire::Entity::Chara::restoreMP( uint32_t amount )
   else
     m_mp += amount;
 
-  sendStatusUpdate();
+  markStateDirty( StateHpMpTp );
 }
 
 /*!
@@ -465,6 +493,49 @@ void Sapphire::Entity::Chara::sendStatusUpdate()
   sendToInRangeSet( packet );
 }
 
+void Sapphire::Entity::Chara::markStateDirty( uint8_t stateFlags )
+{
+  // every change used to be sent on its own, against the updates below this is what coalescing saves
+  static const auto stateChanges = makeStateCounters( "sapphire_world_state_changes", "Actor state changes by part" );
+  countStateParts( stateChanges, stateFlags );
+
+  auto pZone = getCurrentTerritory();
+  if( !pZone )
+  {
+    m_dirtyState |= stateFlags;
+    flushStateUpdates();
+    return;
+  }
+
+  // only queued once per tick, later changes just add their bits
+  if( m_dirtyState == 0 )
+    pZone->queueStateUpdate( getAsChara() );
+
+  m_dirtyState |= stateFlags;
+}
+
+void Sapphire::Entity::Chara::flushStateUpdates()
+{
+  static const auto stateUpdates = makeStateCounters( "sapphire_world_state_updates",
+                                                      "Actor state updates sent by part, at most one per tick" );
+
+  auto dirtyState = m_dirtyState;
+  m_dirtyState = 0;
+  countStateParts( stateUpdates, dirtyState );
+
+  if( dirtyState & StateHpMpTp )
+    sendStatusUpdate();
+
+  if( dirtyState & StateStatusEffects )
+    sendStatusEffectUpdate();
+
+  if( dirtyState & StatePosition )
+    sendPositionUpdate();
+
+  if( dirtyState & StateTarget )
+    sendToInRangeSet( makeActorControlTarget( m_id, SetTarget, 0, 0, 0, 0, getTargetId() ) );
+}
+
 /*! \return ActionPtr of the currently registered action, or nullptr */
 Sapphire::World::Action::ActionPtr Sapphire::Entity::Chara::getCurrentAction() const
 {
@@ -501,9 +572,8 @@ void Sapphire::Entity::Chara::autoAttack( CharaPtr pTarget )
   {
     pTarget->onActionHostile( getAsChara() );
     m_lastAttack = tick;
-    srand( static_cast< uint32_t >( tick ) );
 
-    auto damage = static_cast< uint16_t >( 10 + rand() % 12 );
+    auto damage = static_cast< uint16_t >( 10 + getRandomEngine().nextUInt( 12 ) );
 
     auto effectPacket = std::make_shared< Server::EffectPacket >( getId(), pTarget->getId(), 7 );
     effectPacket->setRotation( Util::floatToUInt16Rot( getRot() ) );
@@ -530,7 +600,15 @@ void Sapphire::Entity::Chara::addStatusEffect( StatusEffect::StatusEffectPtr pEf
     return;
 
   pEffect->applyStatus();
-  m_statusEffectMap[ nextSlot ] = pEffect;
+  m_statusEffects[ nextSlot ] = pEffect;
+  m_statusEffectIds[ nextSlot ] = pEffect->getId();
+  m_statusEffectMask |= 1u << nextSlot;
+
+  if( auto pZone = getCurrentTerritory() )
+  {
+    scheduleStatusEffectTick( *pZone, static_cast< uint8_t >( nextSlot ), pEffect );
+    scheduleStatusEffectExpiry( *pZone, static_cast< uint8_t >( nextSlot ), pEffect );
+  }
 
   auto statusEffectAdd = makeZonePacket< FFXIVIpcEffectResult >( getId() );
 
@@ -574,57 +652,67 @@ void Sapphire::Entity::Chara::addStatusEffectByIdIfNotExist( uint32_t id, int32_
 
 }
 
-int8_t Sapphire::Entity::Chara::getStatusEffectFreeSlot()
+int8_t Sapphire::Entity::Chara::getStatusEffectFreeSlot() const
 {
-  int8_t freeEffectSlot = -1;
-
-  if( m_statusEffectFreeSlotQueue.empty() )
-    return freeEffectSlot;
-
-  freeEffectSlot = static_cast< int8_t >( m_statusEffectFreeSlotQueue.front() );
-  m_statusEffectFreeSlotQueue.pop();
+  for( uint8_t slot = 0; slot < MAX_STATUS_EFFECTS; ++slot )
+  {
+    if( !( m_statusEffectMask & ( 1u << slot ) ) )
+      return static_cast< int8_t >( slot );
+  }
 
-  return freeEffectSlot;
+  return -1;
 }
 
-void Sapphire::Entity::Chara::statusEffectFreeSlot( uint8_t slotId )
+int8_t Sapphire::Entity::Chara::getStatusEffectSlot( uint32_t id ) const
 {
-  m_statusEffectFreeSlotQueue.push( slotId );
+  for( uint8_t slot = 0; ( m_statusEffectMask >> slot ) != 0; ++slot )
+  {
+    if( ( m_statusEffectMask & ( 1u << slot ) ) && m_statusEffectIds[ slot ] == id )
+      return static_cast< int8_t >( slot );
+  }
+
+  return -1;
 }
 
 void Sapphire::Entity::Chara::removeSingleStatusEffectById( uint32_t id )
 {
-  for( auto effectIt : m_statusEffectMap )
-  {
-    if( effectIt.second->getId() == id )
-    {
-      removeStatusEffect( effectIt.first );
-      break;
-    }
-  }
+  auto slot = getStatusEffectSlot( id );
+  if( slot != -1 )
+    removeStatusEffect( static_cast< uint8_t >( slot ) );
 }
 
 void Sapphire::Entity::Chara::removeStatusEffect( uint8_t effectSlotId )
 {
-  auto pEffectIt = m_statusEffectMap.find( effectSlotId );
-  if( pEffectIt == m_statusEffectMap.end() )
+  if( effectSlotId >= MAX_STATUS_EFFECTS || !m_statusEffects[ effectSlotId ] )
     return;
 
-  statusEffectFreeSlot( effectSlotId );
+  // take the effect out first, removeStatus may call back into the actor
+  auto pEffect = std::move( m_statusEffects[ effectSlotId ] );
+  m_statusEffectIds[ effectSlotId ] = 0;
+  m_statusEffectMask &= ~( 1u << effectSlotId );
+
+  if( auto pZone = getCurrentTerritory() )
+  {
+    auto& timerWheel = pZone->getTimerWheel();
+    timerWheel.cancel( pEffect->getTickTimerId() );
+    timerWheel.cancel( pEffect->getExpiryTimerId() );
+  }
+  pEffect->setTickTimerId( 0 );
+  pEffect->setExpiryTimerId( 0 );
 
-  auto pEffect = pEffectIt->second;
   pEffect->removeStatus();
 
   sendToInRangeSet( makeActorControl( getId(), StatusEffectLose, pEffect->getId() ), isPlayer() );
 
-  m_statusEffectMap.erase( effectSlotId );
-
-  sendStatusEffectUpdate();
+  markStateDirty( StateStatusEffects );
 }
 
-std::map< uint8_t, Sapphire::StatusEffect::StatusEffectPtr > Sapphire::Entity::Chara::getStatusEffectMap() const
+Sapphire::StatusEffect::StatusEffectPtr Sapphire::Entity::Chara::getStatusEffect( uint8_t slot ) const
 {
-  return m_statusEffectMap;
+  if( slot >= MAX_STATUS_EFFECTS )
+    return nullptr;
+
+  return m_statusEffects[ slot ];
 }
 
 const uint8_t* Sapphire::Entity::Chara::getLookArray() const
@@ -660,54 +748,109 @@ void Sapphire::Entity::Chara::sendStatusEffectUpdate()
   statusEffectList->data().current_mp = getMp();
   statusEffectList->data().max_hp = getMaxHp();
   statusEffectList->data().max_mp = getMaxMp();
-  uint8_t slot = 0;
-  for( auto effectIt : m_statusEffectMap )
+  forEachStatusEffect( [ &statusEffectList, currentTimeMs ]( uint8_t slot,
+                                                             const StatusEffect::StatusEffectPtr& pEffect )
   {
-    float timeLeft = static_cast< float >( effectIt.second->getDuration() -
-                                           ( currentTimeMs - effectIt.second->getStartTimeMs() ) ) / 1000;
+    float timeLeft = static_cast< float >( pEffect->getDuration() -
+                                           ( currentTimeMs - pEffect->getStartTimeMs() ) ) / 1000;
     statusEffectList->data().effect[ slot ].duration = timeLeft;
-    statusEffectList->data().effect[ slot ].effect_id = effectIt.second->getId();
-    statusEffectList->data().effect[ slot ].sourceActorId = effectIt.second->getSrcActorId();
-    slot++;
-  }
+    statusEffectList->data().effect[ slot ].effect_id = pEffect->getId();
+    statusEffectList->data().effect[ slot ].sourceActorId = pEffect->getSrcActorId();
+  } );
 
   sendToInRangeSet( statusEffectList, isPlayer() );
 
 }
 
-void Sapphire::Entity::Chara::updateStatusEffects()
+void Sapphire::Entity::Chara::scheduleStatusEffectTick( Territory& zone, uint8_t slot,
+                                                        StatusEffect::StatusEffectPtr pEffect )
 {
-  uint64_t currentTimeMs = Util::getTimeMs();
-
-  for( auto effectIt : m_statusEffectMap )
-  {
-    uint8_t effectIndex = effectIt.first;
-    auto effect = effectIt.second;
+  if( pEffect->getTickRate() == 0 )
+    return;
 
-    uint64_t lastTick = effect->getLastTickMs();
-    uint64_t startTime = effect->getStartTimeMs();
-    uint32_t duration = effect->getDuration();
-    uint32_t tickRate = effect->getTickRate();
+  std::weak_ptr< Chara > weakChara = getAsChara();
+  std::weak_ptr< StatusEffect::StatusEffect > weakEffect = pEffect;
 
-    if( duration > 0 && ( currentTimeMs - startTime ) > duration )
+  auto timerId = zone.getTimerWheel().scheduleAt( pEffect->getLastTickMs() + pEffect->getTickRate(),
+    [ weakChara, weakEffect, slot ]()
     {
-      // remove status effect
-      removeStatusEffect( effectIndex );
-      // break because removing invalidates iterators
-      break;
-    }
+      auto pChara = weakChara.lock();
+      auto pEffect = weakEffect.lock();
+      if( !pChara || !pEffect )
+        return;
+
+      pEffect->setTickTimerId( 0 );
+
+      auto pZone = pChara->getCurrentTerritory();
+      if( !pZone || pChara->m_statusEffects[ slot ] != pEffect )
+        return;
+
+      // onTick updates the last tick time the next tick is scheduled from
+      pEffect->onTick();
+
+      // the tick may have removed the effect
+      if( pChara->m_statusEffects[ slot ] == pEffect )
+        pChara->scheduleStatusEffectTick( *pZone, slot, pEffect );
+    } );
+
+  pEffect->setTickTimerId( timerId );
+}
+
+void Sapphire::Entity::Chara::scheduleStatusEffectExpiry( Territory& zone, uint8_t slot,
+                                                          StatusEffect::StatusEffectPtr pEffect )
+{
+  // effects without a duration never expire
+  if( pEffect->getDuration() == 0 )
+    return;
+
+  std::weak_ptr< Chara > weakChara = getAsChara();
+  std::weak_ptr< StatusEffect::StatusEffect > weakEffect = pEffect;
 
-    if( ( currentTimeMs - lastTick ) > tickRate )
+  auto timerId = zone.getTimerWheel().scheduleAt( pEffect->getStartTimeMs() + pEffect->getDuration(),
+    [ weakChara, weakEffect, slot ]()
     {
-      effect->setLastTick( currentTimeMs );
-      effect->onTick();
-    }
-  }
+      auto pChara = weakChara.lock();
+      auto pEffect = weakEffect.lock();
+      if( !pChara || !pEffect )
+        return;
+
+      pEffect->setExpiryTimerId( 0 );
+
+      if( pChara->m_statusEffects[ slot ] == pEffect )
+        pChara->removeStatusEffect( slot );
+    } );
+
+  pEffect->setExpiryTimerId( timerId );
+}
+
+void Sapphire::Entity::Chara::armStatusEffectTimers( Territory& zone )
+{
+  forEachStatusEffect( [ this, &zone ]( uint8_t slot, const StatusEffect::StatusEffectPtr& pEffect )
+  {
+    // already armed when the effect was added after the actor was placed in the zone
+    if( pEffect->getTickTimerId() == 0 )
+      scheduleStatusEffectTick( zone, slot, pEffect );
+    if( pEffect->getExpiryTimerId() == 0 )
+      scheduleStatusEffectExpiry( zone, slot, pEffect );
+  } );
+}
+
+void Sapphire::Entity::Chara::disarmStatusEffectTimers( Territory& zone )
+{
+  auto& timerWheel = zone.getTimerWheel();
+
+  forEachStatusEffect( [ &timerWheel ]( uint8_t, const StatusEffect::StatusEffectPtr& pEffect )
+  {
+    timerWheel.cancel( pEffect->getTickTimerId() );
+    timerWheel.cancel( pEffect->getExpiryTimerId() );
+    pEffect->setTickTimerId( 0 );
+    pEffect->setExpiryTimerId( 0 );
+  } );
 }
 
-bool Sapphire::Entity::Chara::hasStatusEffect( uint32_t id )
+bool Sapphire::Entity::Chara::hasStatusEffect( uint32_t id ) const
 {
-  return m_statusEffectMap.find( id ) != m_statusEffectMap.end();
+  return getStatusEffectSlot( id ) != -1;
 }
 
 int64_t Sapphire::Entity::Chara::getLastUpdateTime() const
@@ -762,12 +905,26 @@ float Sapphire::Entity::Chara::getRadius() const
 
 Sapphire::Common::BaseParam Sapphire::Entity::Chara::getPrimaryStat() const
 {
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-
-  auto classJob = exdData.get< Data::ClassJob >( static_cast< uint16_t >( getClass() ) );
+  auto classJob = Math::CalcStats::getClassJobStats( getClass() );
   assert( classJob );
 
-  return static_cast< Sapphire::Common::BaseParam >( classJob->primaryStat );
+  return classJob->primaryStat;
+}
+
+const Sapphire::Math::CombatAttributes& Sapphire::Entity::Chara::getAttributes() const
+{
+  if( m_attributesDirty )
+  {
+    m_attributes = Math::CalcStats::calculateAttributes( *this );
+    m_attributesDirty = false;
+  }
+
+  return m_attributes;
+}
+
+void Sapphire::Entity::Chara::invalidateAttributes()
+{
+  m_attributesDirty = true;
 }
 
 uint32_t Sapphire::Entity::Chara::getStatValue( Sapphire::Common::BaseParam baseParam ) const
@@ -910,9 +1067,9 @@ void Sapphire::Entity::Chara::onTick()
   uint32_t thisTickDmg = 0;
   uint32_t thisTickHeal = 0;
 
-  for( auto effectIt : m_statusEffectMap )
+  forEachStatusEffect( [ &thisTickDmg, &thisTickHeal ]( uint8_t, const StatusEffect::StatusEffectPtr& pEffect )
   {
-    auto thisEffect = effectIt.second->getTickEffect();
+    auto thisEffect = pEffect->getTickEffect();
     switch( thisEffect.first )
     {
       case 1:
@@ -927,7 +1084,7 @@ void Sapphire::Entity::Chara::onTick()
         break;
       }
     }
-  }
+  } );
 
   if( thisTickDmg != 0 )
   {
@@ -5,6 +5,7 @@
 
 #include "Forwards.h"
 #include "Actor.h"
+#include "Math/CalcStats.h"
 #include <set>
 #include <map>
 #include <queue>
@@ -21,6 +22,17 @@ namespace Sapphire::Entity
   class Chara : public Actor
   {
   public:
+    static constexpr uint8_t MAX_STATUS_EFFECTS = 30;
+
+    /*! parts of the actor state that are replicated at most once per territory tick */
+    enum StateFlag : uint8_t
+    {
+      StateHpMpTp = 0x01,
+      StateStatusEffects = 0x02,
+      StatePosition = 0x04,
+      StateTarget = 0x08,
+    };
+
     struct ActorStats
     {
       uint32_t max_mp = 0;
@@ -121,11 +133,23 @@ namespace Sapphire::Entity
 
     uint8_t m_pose;
 
-    /*! Status effects */
-    const uint8_t MAX_STATUS_EFFECTS = 30;
-    std::queue< uint8_t > m_statusEffectFreeSlotQueue;
-    std::vector< std::pair< uint8_t, uint32_t > > m_statusEffectList;
-    std::map< uint8_t, StatusEffect::StatusEffectPtr > m_statusEffectMap;
+    /*! derived from the stats on first use, see getAttributes */
+    mutable Math::CombatAttributes m_attributes;
+    mutable bool m_attributesDirty;
+
+    /*! StateFlag bits that changed since the last flush */
+    uint8_t m_dirtyState;
+
+    /*! Status effects, kept in the slot the client knows them by */
+    std::array< StatusEffect::StatusEffectPtr, MAX_STATUS_EFFECTS > m_statusEffects;
+    /*! status id of every slot, so lookups by id never touch the effects themselves */
+    std::array< uint32_t, MAX_STATUS_EFFECTS > m_statusEffectIds;
+    /*! bit n is set while slot n is in use */
+    uint32_t m_statusEffectMask;
+
+    void scheduleStatusEffectTick( Territory& zone, uint8_t slot, StatusEffect::StatusEffectPtr pEffect );
+
+    void scheduleStatusEffectExpiry( Territory& zone, uint8_t slot, StatusEffect::StatusEffectPtr pEffect );
 
     /*! Detour Crowd AgentId */
     uint32_t m_agentId;
@@ -149,19 +173,40 @@ namespace Sapphire::Entity
 
     void removeSingleStatusEffectById( uint32_t id );
 
-    void updateStatusEffects();
+    /*! schedules the ticks and expiry of every status effect on the wheel of the given territory */
+    void armStatusEffectTimers( Territory& zone );
+
+    /*! cancels every status effect timer, has to be called on the territory that armed them */
+    void disarmStatusEffectTimers( Territory& zone );
 
-    bool hasStatusEffect( uint32_t id );
+    bool hasStatusEffect( uint32_t id ) const;
 
-    int8_t getStatusEffectFreeSlot();
+    /*! @return slot of the first effect with the given status id, -1 if there is none */
+    int8_t getStatusEffectSlot( uint32_t id ) const;
 
-    void statusEffectFreeSlot( uint8_t slotId );
+    /*! @return lowest unused slot, -1 if all of them are taken */
+    int8_t getStatusEffectFreeSlot() const;
 
     uint8_t getPose() const;
 
     void setPose( uint8_t pose );
 
-    std::map< uint8_t, Sapphire::StatusEffect::StatusEffectPtr > getStatusEffectMap() const;
+    StatusEffect::StatusEffectPtr getStatusEffect( uint8_t slot ) const;
+
+    /*!
+     * @brief Calls func( slot, pEffect ) for every active status effect in slot order
+     *
+     * func must not add or remove status effects of this actor.
+     */
+    template< typename Func >
+    void forEachStatusEffect( Func&& func ) const
+    {
+      for( uint8_t slot = 0; ( m_statusEffectMask >> slot ) != 0; ++slot )
+      {
+        if( m_statusEffectMask & ( 1u << slot ) )
+          func( slot, m_statusEffects[ slot ] );
+      }
+    }
 
     void sendStatusEffectUpdate();
 
@@ -188,7 +233,7 @@ namespace Sapphire::Entity
 
     void setStance( Common::Stance stance );
 
-    ActorStats getStats() const;
+    const ActorStats& getStats() const;
 
     uint32_t getStatValue( Common::BaseParam baseParam ) const;
 
@@ -246,7 +291,7 @@ namespace Sapphire::Entity
 
     virtual void onDamageTaken( Chara& pSource ) {};
 
-    virtual void onActionHostile( CharaPtr pSource ) {};
+    virtual void onActionHostile( CharaPtr pSource, uint32_t hateAmount = 0 ) {};
 
     virtual void onActionFriendly( Chara& pSource ) {};
 
@@ -258,6 +303,19 @@ namespace Sapphire::Entity
 
     virtual void sendStatusUpdate();
 
+    virtual void sendPositionUpdate() {};
+
+    /*!
+     * @brief Marks parts of the state to be sent to the players in range at the end of the territory tick
+     *
+     * Any number of changes within a tick end up as a single packet per part. Outside of a territory there
+     * is no tick to wait for, the update goes out right away.
+     */
+    void markStateDirty( uint8_t stateFlags );
+
+    /*! sends every part of the state that was marked dirty */
+    void flushStateUpdates();
+
     virtual void takeDamage( uint32_t damage );
 
     virtual void heal( uint32_t amount );
@@ -287,6 +345,12 @@ namespace Sapphire::Entity
 
     Common::BaseParam getPrimaryStat() const;
 
+    /*! @return the combat attributes, recalculated first if the stats, level or class changed since the last call */
+    const Math::CombatAttributes& getAttributes() const;
+
+    /*! has to be called whenever something getAttributes depends on changes */
+    void invalidateAttributes();
+
   };
 
 }
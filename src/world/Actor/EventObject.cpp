@@ -124,7 +124,7 @@ void Sapphire::Entity::EventObject::spawn( Sapphire::Entity::PlayerPtr pTarget )
   if( !pTarget->isObjSpawnIndexValid( spawnIndex ) )
     return;
 
-  Logger::debug( "Spawning EObj: id#{0} name={1}", getId(), getName() );
+  SAPPHIRE_LOG_DEBUG( "Spawning EObj: id#{0} name={1}", getId(), getName() );
 
   auto eobjStatePacket = makeZonePacket< FFXIVIpcObjectSpawn >( getId(), pTarget->getId() );
   eobjStatePacket->data().spawnIndex = spawnIndex;
@@ -144,7 +144,7 @@ void Sapphire::Entity::EventObject::spawn( Sapphire::Entity::PlayerPtr pTarget )
 
 void Sapphire::Entity::EventObject::despawn( Sapphire::Entity::PlayerPtr pTarget )
 {
-  Logger::debug( "despawn eobj#{0}", getId() );
+  SAPPHIRE_LOG_DEBUG( "despawn eobj#{0}", getId() );
 
   pTarget->freeObjSpawnIndexForActorId( getId() );
 }
@@ -18,7 +18,6 @@
 
 #include "Manager/HousingMgr.h"
 #include "Manager/TerritoryMgr.h"
-#include "Manager/RNGMgr.h"
 
 #include "Territory/Territory.h"
 #include "Territory/ZonePosition.h"
@@ -193,6 +192,7 @@ uint8_t Sapphire::Entity::Player::getStartTown() const
 void Sapphire::Entity::Player::setMarkedForRemoval()
 {
   m_markedForRemoval = true;
+  Common::Service< World::ServerMgr >::ref().requestSessionCheck( getId() );
 }
 
 bool Sapphire::Entity::Player::isMarkedForRemoval() const
@@ -253,38 +253,33 @@ void Sapphire::Entity::Player::calculateStats()
 {
   uint8_t tribe = getLookAt( Common::CharaLook::Tribe );
   uint8_t level = getLevel();
-  uint8_t job = static_cast< uint8_t >( getClass() );
 
   auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
 
-  auto classInfo = exdData.get< Sapphire::Data::ClassJob >( job );
   auto tribeInfo = exdData.get< Sapphire::Data::Tribe >( tribe );
-  auto paramGrowthInfo = exdData.get< Sapphire::Data::ParamGrow >( level );
-
-  float base = Math::CalcStats::calculateBaseStat( *this );
-
-  m_baseStats.str = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierStrength ) / 100 ) +
-                                             tribeInfo->sTR );
-  m_baseStats.dex = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierDexterity ) / 100 ) +
-                                             tribeInfo->dEX );
-  m_baseStats.vit = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierVitality ) / 100 ) +
-                                             tribeInfo->vIT );
-  m_baseStats.inte = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierIntelligence ) / 100 ) +
-                                              tribeInfo->iNT );
-  m_baseStats.mnd = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierMind ) / 100 ) +
-                                             tribeInfo->mND );
+  const auto& levelStats = Math::CalcStats::getLevelStats( level );
+  // main stat scaled by the class modifiers, precalculated by CalcStats::init
+  const auto& classLevelStats = Math::CalcStats::getClassLevelStats( getClass(), level );
+
+  float base = levelStats.main;
+
+  m_baseStats.str = static_cast< uint32_t >( classLevelStats.str + tribeInfo->sTR );
+  m_baseStats.dex = static_cast< uint32_t >( classLevelStats.dex + tribeInfo->dEX );
+  m_baseStats.vit = static_cast< uint32_t >( classLevelStats.vit + tribeInfo->vIT );
+  m_baseStats.inte = static_cast< uint32_t >( classLevelStats.inte + tribeInfo->iNT );
+  m_baseStats.mnd = static_cast< uint32_t >( classLevelStats.mnd + tribeInfo->mND );
   /*m_baseStats.pie = static_cast< uint32_t >( base * ( static_cast< float >( classInfo->modifierPiety ) / 100 ) +
                                              tribeInfo->pIE );*/
 
   m_baseStats.determination = static_cast< uint32_t >( base );
   m_baseStats.pie = static_cast< uint32_t >( base );
-  m_baseStats.skillSpeed = paramGrowthInfo->baseSpeed;
-  m_baseStats.spellSpeed = paramGrowthInfo->baseSpeed;
-  m_baseStats.accuracy = paramGrowthInfo->baseSpeed;
-  m_baseStats.critHitRate = paramGrowthInfo->baseSpeed;
-  m_baseStats.attackPotMagic = paramGrowthInfo->baseSpeed;
-  m_baseStats.healingPotMagic = paramGrowthInfo->baseSpeed;
-  m_baseStats.tenacity = paramGrowthInfo->baseSpeed;
+  m_baseStats.skillSpeed = levelStats.baseSpeed;
+  m_baseStats.spellSpeed = levelStats.baseSpeed;
+  m_baseStats.accuracy = levelStats.baseSpeed;
+  m_baseStats.critHitRate = levelStats.baseSpeed;
+  m_baseStats.attackPotMagic = levelStats.baseSpeed;
+  m_baseStats.healingPotMagic = levelStats.baseSpeed;
+  m_baseStats.tenacity = levelStats.baseSpeed;
 
   m_baseStats.attack = m_baseStats.str;
   m_baseStats.attackPotMagic = m_baseStats.inte;
@@ -300,6 +295,7 @@ void Sapphire::Entity::Player::calculateStats()
   if( m_hp > m_baseStats.max_hp )
     m_hp = m_baseStats.max_hp;
 
+  invalidateAttributes();
 }
 
 
@@ -803,8 +799,7 @@ void Sapphire::Entity::Player::sendStatusUpdate()
 
 uint8_t Sapphire::Entity::Player::getLevel() const
 {
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-  uint8_t classJobIndex = exdData.get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( getClass() ) )->expArrayIndex;
+  uint8_t classJobIndex = Math::CalcStats::getClassJobStats( getClass() )->expArrayIndex;
   return static_cast< uint8_t >( m_classArray[ classJobIndex ] );
 }
 
@@ -849,6 +844,7 @@ void Sapphire::Entity::Player::setInCombat( bool mode )
 void Sapphire::Entity::Player::setClassJob( Common::ClassJob classJob )
 {
   m_class = classJob;
+  invalidateAttributes();
   uint8_t level = getLevel();
 
   if( getHp() > getMaxHp() )
@@ -875,20 +871,23 @@ void Sapphire::Entity::Player::setClassJob( Common::ClassJob classJob )
 
 void Sapphire::Entity::Player::setLevel( uint8_t level )
 {
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-  uint8_t classJobIndex = exdData.get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( getClass() ) )->expArrayIndex;
+  uint8_t classJobIndex = Math::CalcStats::getClassJobStats( getClass() )->expArrayIndex;
   m_classArray[ classJobIndex ] = level;
+  invalidateAttributes();
 }
 
 void Sapphire::Entity::Player::setLevelForClass( uint8_t level, Common::ClassJob classjob )
 {
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-  uint8_t classJobIndex = exdData.get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( classjob ) )->expArrayIndex;
+  uint8_t classJobIndex = Math::CalcStats::getClassJobStats( classjob )->expArrayIndex;
 
   if( m_classArray[ classJobIndex ] == 0 )
     insertDbClass( classJobIndex );
 
   m_classArray[ classJobIndex ] = level;
+
+  // a job shares its level with its base class
+  if( classJobIndex == Math::CalcStats::getClassJobStats( getClass() )->expArrayIndex )
+    invalidateAttributes();
 }
 
 void Sapphire::Entity::Player::sendModel()
@@ -951,7 +950,7 @@ void Sapphire::Entity::Player::setLookAt( uint8_t index, uint8_t value )
 // spawn this player for pTarget
 void Sapphire::Entity::Player::spawn( Entity::PlayerPtr pTarget )
 {
-  Logger::debug( "[{0}] Spawning {1} for {2}", pTarget->getId(), getName(), pTarget->getName() );
+  SAPPHIRE_LOG_DEBUG( "[{0}] Spawning {1} for {2}", pTarget->getId(), getName(), pTarget->getName() );
 
   pTarget->queuePacket( std::make_shared< PlayerSpawnPacket >( *getAsPlayer(), *pTarget ) );
 }
@@ -960,7 +959,7 @@ void Sapphire::Entity::Player::spawn( Entity::PlayerPtr pTarget )
 void Sapphire::Entity::Player::despawn( Entity::PlayerPtr pTarget )
 {
   auto pPlayer = pTarget;
-  Logger::debug( "Despawning {0} for {1}", getName(), pTarget->getName() );
+  SAPPHIRE_LOG_DEBUG( "Despawning {0} for {1}", getName(), pTarget->getName() );
 
   pPlayer->freePlayerSpawnId( getId() );
 
@@ -1615,8 +1614,7 @@ void Sapphire::Entity::Player::autoAttack( CharaPtr pTarget )
   //uint64_t tick = Util::getTimeMs();
   //srand(static_cast< uint32_t >(tick));
 
-  auto& RNGMgr = Common::Service< World::Manager::RNGMgr >::ref();
-  auto variation = static_cast< uint32_t >( RNGMgr.getRandGenerator< float >( 0, 3 ).next() );
+  auto variation = getRandomEngine().nextUInt( 3 );
 
   auto damage = Math::CalcStats::calcAutoAttackDamage( *this );
 
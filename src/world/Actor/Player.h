@@ -915,6 +915,7 @@ namespace Sapphire::Entity
 
     // Inventory Handling
     //////////////////////////////////////////////////////////////////////////////////////////////////////
+    /*! sets up the empty containers, loadInventory fills them from the db */
     void initInventory();
 
     using InvSlotPair = std::pair< uint16_t, int8_t >;
@@ -942,6 +943,8 @@ namespace Sapphire::Entity
 
     ItemPtr getItemAt( uint16_t containerId, uint8_t slotId );
 
+    ItemContainerPtr getInventoryContainer( uint16_t containerId );
+
     bool updateContainer( uint16_t storageId, uint8_t slotId, ItemPtr pItem );
 
     /*! calculate and return player ilvl based off equipped gear */
@@ -15,6 +15,7 @@
 #include "Inventory/Item.h"
 #include "Territory/Territory.h"
 #include "ServerMgr.h"
+#include "Manager/ChatChannelMgr.h"
 
 #include "Action/EventAction.h"
 
@@ -382,6 +383,9 @@ void Sapphire::Entity::Player::onLogin()
   {
     sendNotice( msg );
   }
+
+  auto& chatChannelMgr = Common::Service< World::Manager::ChatChannelMgr >::ref();
+  chatChannelMgr.joinLinkshells( *this );
 }
 
 void Sapphire::Entity::Player::onZoneStart()
@@ -455,5 +459,5 @@ void Sapphire::Entity::Player::onTick()
   }
 
   if( sendUpdate )
-    sendStatusUpdate();
+    markStateDirty( StateHpMpTp );
 }
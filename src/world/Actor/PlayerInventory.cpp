@@ -100,9 +100,6 @@ void Sapphire::Entity::Player::initInventory()
   // item hand in container
   // non-persistent container, will not save its contents
   setupContainer( HandIn, 10, "", true, false );
-
-  loadInventory();
-
 }
 
 void Sapphire::Entity::Player::sendItemLevel()
@@ -469,6 +466,15 @@ Sapphire::ItemPtr Sapphire::Entity::Player::getItemAt( uint16_t containerId, uin
   return m_storageMap[ containerId ]->getItem( slotId );
 }
 
+Sapphire::ItemContainerPtr Sapphire::Entity::Player::getInventoryContainer( uint16_t containerId )
+{
+  auto it = m_storageMap.find( containerId );
+  if( it == m_storageMap.end() )
+    return nullptr;
+
+  return it->second;
+}
+
 
 uint32_t Sapphire::Entity::Player::getCurrency( CurrencyType type )
 {
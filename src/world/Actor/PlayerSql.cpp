@@ -35,6 +35,9 @@ bool Sapphire::Entity::Player::load( uint32_t charId, World::SessionPtr pSession
 
   const std::string char_id_str = std::to_string( charId );
 
+  // column indices resolved when CHARA_SEL was prepared
+  const auto& col = db.getColumnIndices( Db::CHARA_SEL );
+
   auto stmt = db.getPreparedStatement( Db::ZoneDbStatements::CHARA_SEL );
 
   stmt->setUInt( 1, charId );
@@ -45,24 +48,24 @@ bool Sapphire::Entity::Player::load( uint32_t charId, World::SessionPtr pSession
 
   m_id = charId;
 
-  auto name = res->getString( "Name" );
+  auto name = res->getString( col[ Db::CharaSel::Name ] );
   strcpy( m_name, name.c_str() );
 
-  auto zoneId = res->getUInt( "TerritoryType" );
-  m_territoryId = res->getUInt( "TerritoryId" );
-  m_prevTerritoryTypeId = res->getUInt( "OTerritoryType" );
-  m_prevTerritoryId = res->getUInt( "OTerritoryId" );
+  auto zoneId = res->getUInt( col[ Db::CharaSel::TerritoryType ] );
+  m_territoryId = res->getUInt( col[ Db::CharaSel::TerritoryId ] );
+  m_prevTerritoryTypeId = res->getUInt( col[ Db::CharaSel::OTerritoryType ] );
+  m_prevTerritoryId = res->getUInt( col[ Db::CharaSel::OTerritoryId ] );
 
   // Position
-  m_pos.x = res->getFloat( "PosX" );
-  m_pos.y = res->getFloat( "PosY" );
-  m_pos.z = res->getFloat( "PosZ" );
-  setRot( res->getFloat( "PosR" ) );
+  m_pos.x = res->getFloat( col[ Db::CharaSel::PosX ] );
+  m_pos.y = res->getFloat( col[ Db::CharaSel::PosY ] );
+  m_pos.z = res->getFloat( col[ Db::CharaSel::PosZ ] );
+  setRot( res->getFloat( col[ Db::CharaSel::PosR ] ) );
 
-  m_prevPos.x = res->getFloat( "OPosX" );
-  m_prevPos.y = res->getFloat( "OPosY" );
-  m_prevPos.z = res->getFloat( "OPosZ" );
-  m_prevRot = res->getFloat( "OPosR" );
+  m_prevPos.x = res->getFloat( col[ Db::CharaSel::OPosX ] );
+  m_prevPos.y = res->getFloat( col[ Db::CharaSel::OPosY ] );
+  m_prevPos.z = res->getFloat( col[ Db::CharaSel::OPosZ ] );
+  m_prevRot = res->getFloat( col[ Db::CharaSel::OPosR ] );
 
   TerritoryPtr pCurrZone = nullptr;
 
@@ -122,77 +125,77 @@ bool Sapphire::Entity::Player::load( uint32_t charId, World::SessionPtr pSession
   }
 
   // Model
-  auto custom = res->getBlobVector( "Customize" );
+  auto custom = res->getBlobVector( col[ Db::CharaSel::Customize ] );
   memcpy( reinterpret_cast< char* >( m_customize ), custom.data(), custom.size() );
 
-  m_modelMainWeapon = res->getUInt64( "ModelMainWeapon" );
+  m_modelMainWeapon = res->getUInt64( col[ Db::CharaSel::ModelMainWeapon ] );
 
-  auto modelEq = res->getBlobVector( "ModelEquip" );
+  auto modelEq = res->getBlobVector( col[ Db::CharaSel::ModelEquip ] );
   memcpy( reinterpret_cast< char* >( m_modelEquip ), modelEq.data(), modelEq.size() );
 
   // Minimal info
 
-  m_guardianDeity = res->getUInt8( "GuardianDeity" );
-  m_birthDay = res->getUInt8( "BirthDay" );
-  m_birthMonth = res->getUInt8( "BirthMonth" );
-  m_status = static_cast< ActorStatus >( res->getUInt( "Status" ) );
-  m_emoteMode = res->getUInt( "EmoteModeType" );
+  m_guardianDeity = res->getUInt8( col[ Db::CharaSel::GuardianDeity ] );
+  m_birthDay = res->getUInt8( col[ Db::CharaSel::BirthDay ] );
+  m_birthMonth = res->getUInt8( col[ Db::CharaSel::BirthMonth ] );
+  m_status = static_cast< ActorStatus >( res->getUInt( col[ Db::CharaSel::Status ] ) );
+  m_emoteMode = res->getUInt( col[ Db::CharaSel::EmoteModeType ] );
 
-  m_activeTitle = res->getUInt16( "ActiveTitle" );
+  m_activeTitle = res->getUInt16( col[ Db::CharaSel::ActiveTitle ] );
 
-  m_class = static_cast< ClassJob >( res->getUInt( "Class" ) );
-  m_homePoint = res->getUInt8( "Homepoint" );
+  m_class = static_cast< ClassJob >( res->getUInt( col[ Db::CharaSel::Class ] ) );
+  m_homePoint = res->getUInt8( col[ Db::CharaSel::Homepoint ] );
 
   // Additional data
-  m_contentId = res->getUInt64( "ContentId" );
-  m_voice = res->getUInt8( "Voice" );
-  m_startTown = res->getUInt8( "StartTown" );
-  m_playTime = res->getUInt( "TotalPlayTime" );
+  m_contentId = res->getUInt64( col[ Db::CharaSel::ContentId ] );
+  m_voice = res->getUInt8( col[ Db::CharaSel::Voice ] );
+  m_startTown = res->getUInt8( col[ Db::CharaSel::StartTown ] );
+  m_playTime = res->getUInt( col[ Db::CharaSel::TotalPlayTime ] );
 
-  m_bNewGame = res->getBoolean( "IsNewGame" );
-  m_bNewAdventurer = res->getBoolean( "IsNewAdventurer" );
-  m_openingSequence = res->getUInt8( "OpeningSequence" );
+  m_bNewGame = res->getBoolean( col[ Db::CharaSel::IsNewGame ] );
+  m_bNewAdventurer = res->getBoolean( col[ Db::CharaSel::IsNewAdventurer ] );
+  m_openingSequence = res->getUInt8( col[ Db::CharaSel::OpeningSequence ] );
 
-  m_gc = res->getUInt8( "GrandCompany" );
-  m_cfPenaltyUntil = res->getUInt( "CFPenaltyUntil" );
-  m_activeTitle = res->getUInt16( "ActiveTitle" );
+  m_gc = res->getUInt8( col[ Db::CharaSel::GrandCompany ] );
+  m_cfPenaltyUntil = res->getUInt( col[ Db::CharaSel::CFPenaltyUntil ] );
+  m_activeTitle = res->getUInt16( col[ Db::CharaSel::ActiveTitle ] );
 
-  m_gmRank = res->getUInt8( "GMRank" );
+  m_gmRank = res->getUInt8( col[ Db::CharaSel::GMRank ] );
 
-  m_equipDisplayFlags = res->getUInt8( "EquipDisplayFlags" );
+  m_equipDisplayFlags = res->getUInt8( col[ Db::CharaSel::EquipDisplayFlags ] );
 
-  m_pose = res->getUInt8( "Pose" );
+  m_pose = res->getUInt8( col[ Db::CharaSel::Pose ] );
 
   // Blobs
 
-  auto howTo = res->getBlobVector( "HowTo" );
+  auto howTo = res->getBlobVector( col[ Db::CharaSel::HowTo ] );
   memcpy( reinterpret_cast< char* >( m_howTo ), howTo.data(), howTo.size() );
 
-  auto questCompleteFlags = res->getBlobVector( "QuestCompleteFlags" );
+  auto questCompleteFlags = res->getBlobVector( col[ Db::CharaSel::QuestCompleteFlags ] );
   memcpy( reinterpret_cast< char* >( m_questCompleteFlags ), questCompleteFlags.data(), questCompleteFlags.size() );
 
-  auto questTracking = res->getBlobVector( "QuestTracking" );
+  auto questTracking = res->getBlobVector( col[ Db::CharaSel::QuestTracking ] );
   memcpy( reinterpret_cast< char* >( m_questTracking ), questTracking.data(), questTracking.size() );
 
-  auto aetheryte = res->getBlobVector( "Aetheryte" );
+  auto aetheryte = res->getBlobVector( col[ Db::CharaSel::Aetheryte ] );
   memcpy( reinterpret_cast< char* >( m_aetheryte ), aetheryte.data(), aetheryte.size() );
 
-  auto unlocks = res->getBlobVector( "Unlocks" );
+  auto unlocks = res->getBlobVector( col[ Db::CharaSel::Unlocks ] );
   memcpy( reinterpret_cast< char* >( m_unlocks ), unlocks.data(), unlocks.size() );
 
-  auto discovery = res->getBlobVector( "Discovery" );
+  auto discovery = res->getBlobVector( col[ Db::CharaSel::Discovery ] );
   memcpy( reinterpret_cast< char* >( m_discovery ), discovery.data(), discovery.size() );
 
-  auto titleList = res->getBlobVector( "TitleList" );
+  auto titleList = res->getBlobVector( col[ Db::CharaSel::TitleList ] );
   memcpy( reinterpret_cast< char* >( m_titleList ), titleList.data(), titleList.size() );
 
-  auto mountGuide = res->getBlobVector( "Mounts" );
+  auto mountGuide = res->getBlobVector( col[ Db::CharaSel::Mounts ] );
   memcpy( reinterpret_cast< char* >( m_mountGuide ), mountGuide.data(), mountGuide.size() );
 
-  auto orchestrion = res->getBlobVector( "Orchestrion" );
+  auto orchestrion = res->getBlobVector( col[ Db::CharaSel::Orchestrion ] );
   memcpy( reinterpret_cast< char* >( m_orchestrion ), orchestrion.data(), orchestrion.size() );
 
-  auto gcRank = res->getBlobVector( "GrandCompanyRank" );
+  auto gcRank = res->getBlobVector( col[ Db::CharaSel::GrandCompanyRank ] );
   memcpy( reinterpret_cast< char* >( m_gcRank ), gcRank.data(), gcRank.size() );
 
   res->free();
@@ -203,16 +206,17 @@ bool Sapphire::Entity::Player::load( uint32_t charId, World::SessionPtr pSession
     Logger::error( "Player #{0}  data corrupt!", char_id_str );
 
   initInventory();
+  loadInventory();
   calculateStats();
 
   // Stats
-  m_hp = res->getUInt( "Hp" );
-  m_mp = res->getUInt( "Mp" );
+  m_hp = res->getUInt( col[ Db::CharaSel::Hp ] );
+  m_mp = res->getUInt( col[ Db::CharaSel::Mp ] );
   m_tp = 0;
   m_maxHp = getMaxHp();
   m_maxMp = getMaxMp();
 
-  m_mount = res->getUInt8( "Mount" );
+  m_mount = res->getUInt8( col[ Db::CharaSel::Mount ] );
 
   m_modelSubWeapon = getModelSubWeapon();
   m_lastTickTime = 0;
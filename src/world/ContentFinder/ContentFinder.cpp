@@ -0,0 +1,189 @@
+#include "ContentFinder.h"
+
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+#include <Network/GamePacket.h>
+#include <Network/PacketDef/Zone/ServerZoneDef.h>
+#include <Service.h>
+
+#include "Actor/Player.h"
+#include "Manager/TerritoryMgr.h"
+#include "Territory/InstanceContent.h"
+
+#include "ServerMgr.h"
+#include "Session.h"
+
+#include <algorithm>
+
+using namespace Sapphire::Network::Packets;
+using namespace Sapphire::Network::Packets::Server;
+
+bool Sapphire::World::ContentFinder::registerPlayer( Entity::Player& player, const std::vector< uint16_t >& contentIds )
+{
+  QueueRole role;
+  if( !getRole( player, role ) || !MatchQueue::registerPlayer( player.getId(), role, contentIds ) )
+    return false;
+
+  // the client shows the counts of the first content the player got queued for
+  for( auto contentId : contentIds )
+  {
+    if( getQueuedCounts( contentId )[ static_cast< std::size_t >( role ) ] != 0 )
+    {
+      sendMemberStatus( player, contentId );
+      break;
+    }
+  }
+
+  return true;
+}
+
+void Sapphire::World::ContentFinder::withdrawPlayer( Entity::Player& player )
+{
+  if( MatchQueue::withdrawPlayer( player.getId() ) )
+    sendCancel( player.getId(), 890 );
+}
+
+void Sapphire::World::ContentFinder::acceptDuty( Entity::Player& player )
+{
+  MatchQueue::acceptDuty( player.getId() );
+}
+
+Sapphire::World::MatchQueue::RoleCounts Sapphire::World::ContentFinder::getPartySize( uint16_t contentId )
+{
+  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+
+  RoleCounts partySize{};
+
+  auto pCondition = exdData.get< Data::ContentFinderCondition >( contentId );
+  if( !pCondition )
+    return partySize;
+
+  auto pMemberType = exdData.get< Data::ContentMemberType >( pCondition->contentMemberType );
+  if( !pMemberType )
+    return partySize;
+
+  partySize[ static_cast< std::size_t >( QueueRole::Tank ) ] = pMemberType->tanksPerParty;
+  partySize[ static_cast< std::size_t >( QueueRole::Healer ) ] = pMemberType->healersPerParty;
+  partySize[ static_cast< std::size_t >( QueueRole::Dps ) ] = pMemberType->meleesPerParty + pMemberType->rangedPerParty;
+
+  return partySize;
+}
+
+bool Sapphire::World::ContentFinder::isOnline( uint32_t playerId ) const
+{
+  return getPlayer( playerId ) != nullptr;
+}
+
+void Sapphire::World::ContentFinder::onMatched( uint16_t contentId, const std::vector< uint32_t >& playerIds )
+{
+  for( auto playerId : playerIds )
+  {
+    auto pPlayer = getPlayer( playerId );
+    if( !pPlayer )
+      continue;
+
+    auto readyPacket = makeZonePacket< FFXIVIpcCFNotify >( playerId );
+    readyPacket->data().state1 = 4; // duty ready
+    readyPacket->data().contents[ 0 ] = contentId;
+    pPlayer->queuePacket( readyPacket );
+  }
+}
+
+void Sapphire::World::ContentFinder::onRequeued( uint16_t contentId, uint32_t playerId )
+{
+  if( auto pPlayer = getPlayer( playerId ) )
+    sendMemberStatus( *pPlayer, contentId );
+}
+
+void Sapphire::World::ContentFinder::onDropped( uint32_t playerId )
+{
+  sendCancel( playerId, 890 );
+}
+
+void Sapphire::World::ContentFinder::onCommence( uint16_t contentId, const std::vector< uint32_t >& playerIds )
+{
+  auto& teriMgr = Common::Service< Manager::TerritoryMgr >::ref();
+
+  auto instance = teriMgr.createInstanceContent( contentId );
+  auto pInstance = instance ? instance->getAsInstanceContent() : nullptr;
+
+  if( !pInstance )
+    Logger::error( "ContentFinder: failed to create instance for content#{0}", contentId );
+
+  for( auto playerId : playerIds )
+  {
+    if( !pInstance )
+    {
+      sendCancel( playerId, 890 );
+      continue;
+    }
+
+    auto pPlayer = getPlayer( playerId );
+    if( !pPlayer )
+      continue;
+
+    pInstance->bindPlayer( playerId );
+    pPlayer->setInstance( instance );
+  }
+}
+
+bool Sapphire::World::ContentFinder::getRole( Entity::Player& player, QueueRole& role )
+{
+  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+
+  auto pClassJob = exdData.get< Data::ClassJob >( static_cast< uint8_t >( player.getClass() ) );
+  if( !pClassJob )
+    return false;
+
+  switch( pClassJob->role )
+  {
+    case 1:
+      role = QueueRole::Tank;
+      return true;
+    case 2:
+    case 3:
+      role = QueueRole::Dps;
+      return true;
+    case 4:
+      role = QueueRole::Healer;
+      return true;
+    default:
+      return false;
+  }
+}
+
+void Sapphire::World::ContentFinder::sendMemberStatus( Entity::Player& player, uint16_t contentId )
+{
+  auto queuedCounts = getQueuedCounts( contentId );
+  auto getQueuedCount = [ &queuedCounts ]( QueueRole role )
+  {
+    return static_cast< uint8_t >( std::min< uint32_t >( queuedCounts[ static_cast< std::size_t >( role ) ], 0xFF ) );
+  };
+
+  auto statusPacket = makeZonePacket< FFXIVIpcCFMemberStatus >( player.getId() );
+  statusPacket->data().contentId = contentId;
+  statusPacket->data().currentTank = getQueuedCount( QueueRole::Tank );
+  statusPacket->data().currentHealer = getQueuedCount( QueueRole::Healer );
+  statusPacket->data().currentDps = getQueuedCount( QueueRole::Dps );
+  player.queuePacket( statusPacket );
+}
+
+void Sapphire::World::ContentFinder::sendCancel( uint32_t playerId, uint32_t reason )
+{
+  auto pPlayer = getPlayer( playerId );
+  if( !pPlayer )
+    return;
+
+  auto packet = makeZonePacket< FFXIVIpcCFCancel >( playerId );
+  packet->data().cancelReason = reason;
+  pPlayer->queuePacket( packet );
+}
+
+Sapphire::Entity::PlayerPtr Sapphire::World::ContentFinder::getPlayer( uint32_t playerId ) const
+{
+  auto pSession = Common::Service< World::ServerMgr >::ref().getSession( playerId );
+  if( !pSession )
+    return nullptr;
+
+  return pSession->getPlayer();
+}
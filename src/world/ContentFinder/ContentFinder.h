@@ -3,5 +3,62 @@
 
 #include "../ForwardsZone.h"
 
+#include "MatchQueue.h"
+
+#include <vector>
+
+namespace Sapphire::World
+{
+
+  /*!
+   * @brief Duty finder matchmaking
+   *
+   * Queues players by the role of their class through MatchQueue, with party sizes taken from
+   * ContentMemberType. Players are kept up to date with packets and a party that passed the
+   * readiness check gets its instance created from update() a few per tick instead of from the
+   * packet handlers.
+   */
+  class ContentFinder : public MatchQueue
+  {
+  public:
+    ContentFinder() = default;
+
+    /*!
+     * @brief Queues a player for one or more contents
+     * @return false if the player is already queued or none of the contents can be matched for
+     */
+    bool registerPlayer( Entity::Player& player, const std::vector< uint16_t >& contentIds );
+
+    /*! withdraws the registration of the player, breaks up the party it was matched into */
+    void withdrawPlayer( Entity::Player& player );
+
+    /*! a matched player confirmed the readiness check */
+    void acceptDuty( Entity::Player& player );
+
+  protected:
+    RoleCounts getPartySize( uint16_t contentId ) override;
+
+    bool isOnline( uint32_t playerId ) const override;
+
+    void onMatched( uint16_t contentId, const std::vector< uint32_t >& playerIds ) override;
+
+    void onRequeued( uint16_t contentId, uint32_t playerId ) override;
+
+    void onDropped( uint32_t playerId ) override;
+
+    void onCommence( uint16_t contentId, const std::vector< uint32_t >& playerIds ) override;
+
+  private:
+    static bool getRole( Entity::Player& player, QueueRole& role );
+
+    /*! how many players of each role are waiting for contentId */
+    void sendMemberStatus( Entity::Player& player, uint16_t contentId );
+
+    void sendCancel( uint32_t playerId, uint32_t reason );
+
+    Entity::PlayerPtr getPlayer( uint32_t playerId ) const;
+  };
+
+}
 
 #endif
@@ -0,0 +1,367 @@
+#include "MatchQueue.h"
+
+#include <Logging/Logger.h>
+
+#include <algorithm>
+
+Sapphire::World::MatchQueue::MatchQueue() :
+  m_nextRegistrationId( 1 ),
+  m_nextMatchId( 1 )
+{
+}
+
+bool Sapphire::World::MatchQueue::registerPlayer( uint32_t playerId, QueueRole role,
+                                                  const std::vector< uint16_t >& contentIds )
+{
+  if( isQueued( playerId ) )
+    return false;
+
+  Registration registration{};
+  registration.playerId = playerId;
+  registration.role = role;
+  registration.state = RegistrationState::Queued;
+
+  for( auto contentId : contentIds )
+  {
+    auto pQueue = getContentQueue( contentId );
+    if( !pQueue || pQueue->partySize[ static_cast< std::size_t >( role ) ] == 0 )
+      continue;
+
+    if( std::find( registration.contentIds.begin(), registration.contentIds.end(), contentId ) ==
+        registration.contentIds.end() )
+      registration.contentIds.push_back( contentId );
+  }
+
+  if( registration.contentIds.empty() )
+    return false;
+
+  registration.id = m_nextRegistrationId++;
+
+  auto& entry = m_registrations[ registration.id ] = std::move( registration );
+  m_playerRegistrations[ entry.playerId ] = entry.id;
+
+  enqueue( entry, false );
+
+  return true;
+}
+
+bool Sapphire::World::MatchQueue::withdrawPlayer( uint32_t playerId )
+{
+  auto it = m_playerRegistrations.find( playerId );
+  if( it == m_playerRegistrations.end() )
+    return false;
+
+  auto registrationId = it->second;
+  auto matchId = m_registrations.at( registrationId ).matchId;
+
+  removeRegistration( registrationId );
+
+  // everybody else in the party goes back to the front of the queue
+  auto matchIt = m_matches.find( matchId );
+  if( matchIt != m_matches.end() )
+    breakMatch( matchIt->second, true );
+
+  return true;
+}
+
+void Sapphire::World::MatchQueue::acceptDuty( uint32_t playerId )
+{
+  auto it = m_playerRegistrations.find( playerId );
+  if( it == m_playerRegistrations.end() )
+    return;
+
+  auto& registration = m_registrations.at( it->second );
+  if( registration.state != RegistrationState::Matched )
+    return;
+
+  registration.state = RegistrationState::Ready;
+
+  auto& match = m_matches.at( registration.matchId );
+  for( auto memberId : match.registrationIds )
+  {
+    auto memberIt = m_registrations.find( memberId );
+    if( memberIt == m_registrations.end() || memberIt->second.state != RegistrationState::Ready )
+      return;
+  }
+
+  m_pendingCommences.push_back( match.id );
+}
+
+bool Sapphire::World::MatchQueue::isQueued( uint32_t playerId ) const
+{
+  return m_playerRegistrations.find( playerId ) != m_playerRegistrations.end();
+}
+
+Sapphire::World::MatchQueue::RoleCounts Sapphire::World::MatchQueue::getQueuedCounts( uint16_t contentId ) const
+{
+  auto it = m_contentQueues.find( contentId );
+  if( it == m_contentQueues.end() )
+    return {};
+
+  return it->second.queuedCounts;
+}
+
+void Sapphire::World::MatchQueue::update( uint64_t tickCount )
+{
+  // only contents that got new registrations since the last update can form a party
+  auto dirtyContents = std::move( m_dirtyContents );
+  m_dirtyContents.clear();
+
+  for( auto contentId : dirtyContents )
+  {
+    auto& queue = m_contentQueues[ contentId ];
+    queue.isDirty = false;
+    matchContent( contentId, queue, tickCount );
+  }
+
+  std::vector< uint32_t > expiredMatches;
+  for( auto& match : m_matches )
+  {
+    if( tickCount > match.second.readyDeadline )
+      expiredMatches.push_back( match.first );
+  }
+
+  for( auto matchId : expiredMatches )
+  {
+    auto it = m_matches.find( matchId );
+    // a match that is about to commence is not broken up anymore
+    if( it == m_matches.end() ||
+        std::find( m_pendingCommences.begin(), m_pendingCommences.end(), matchId ) != m_pendingCommences.end() )
+      continue;
+
+    SAPPHIRE_LOG_DEBUG( "MatchQueue: readiness check of match#{0} timed out", matchId );
+    breakMatch( it->second, false );
+  }
+
+  for( std::size_t i = 0; i < MaxCommencesPerUpdate && !m_pendingCommences.empty(); ++i )
+  {
+    auto matchId = m_pendingCommences.front();
+    m_pendingCommences.pop_front();
+
+    auto it = m_matches.find( matchId );
+    if( it != m_matches.end() )
+      commence( it->second );
+  }
+}
+
+Sapphire::World::MatchQueue::ContentQueue* Sapphire::World::MatchQueue::getContentQueue( uint16_t contentId )
+{
+  auto it = m_contentQueues.find( contentId );
+  if( it == m_contentQueues.end() )
+  {
+    // contents that can't be matched for are cached as well, with an empty party
+    ContentQueue queue;
+    queue.partySize = getPartySize( contentId );
+    it = m_contentQueues.emplace( contentId, std::move( queue ) ).first;
+  }
+
+  auto& partySize = it->second.partySize;
+  if( std::all_of( partySize.begin(), partySize.end(), []( uint32_t size ) { return size == 0; } ) )
+    return nullptr;
+
+  return &it->second;
+}
+
+void Sapphire::World::MatchQueue::enqueue( Registration& registration, bool toFront )
+{
+  auto roleIdx = static_cast< std::size_t >( registration.role );
+
+  for( auto contentId : registration.contentIds )
+  {
+    auto& queue = m_contentQueues[ contentId ];
+    auto& roleQueue = queue.roleQueues[ roleIdx ];
+
+    if( toFront )
+      roleQueue.push_front( registration.id );
+    else
+      roleQueue.push_back( registration.id );
+
+    queue.queuedCounts[ roleIdx ]++;
+
+    if( !queue.isDirty )
+    {
+      queue.isDirty = true;
+      m_dirtyContents.push_back( contentId );
+    }
+  }
+}
+
+void Sapphire::World::MatchQueue::dequeue( Registration& registration )
+{
+  auto roleIdx = static_cast< std::size_t >( registration.role );
+
+  for( auto contentId : registration.contentIds )
+    m_contentQueues[ contentId ].queuedCounts[ roleIdx ]--;
+}
+
+void Sapphire::World::MatchQueue::matchContent( uint16_t contentId, ContentQueue& queue, uint64_t tickCount )
+{
+  auto hasParty = [ &queue ]()
+  {
+    for( std::size_t role = 0; role < queue.partySize.size(); ++role )
+    {
+      if( queue.queuedCounts[ role ] < queue.partySize[ role ] )
+        return false;
+    }
+    return true;
+  };
+
+  while( hasParty() )
+  {
+    std::vector< uint32_t > members;
+    bool isComplete = true;
+
+    for( std::size_t role = 0; role < queue.partySize.size() && isComplete; ++role )
+    {
+      for( uint32_t i = 0; i < queue.partySize[ role ]; ++i )
+      {
+        auto registrationId = popRegistration( queue, static_cast< QueueRole >( role ) );
+        if( registrationId == 0 )
+        {
+          isComplete = false;
+          break;
+        }
+        members.push_back( registrationId );
+      }
+    }
+
+    // players went offline while waiting, put the others back where they were and retry next update
+    if( !isComplete )
+    {
+      for( auto it = members.rbegin(); it != members.rend(); ++it )
+      {
+        auto& registration = m_registrations.at( *it );
+        queue.roleQueues[ static_cast< std::size_t >( registration.role ) ].push_front( *it );
+      }
+
+      queue.isDirty = true;
+      m_dirtyContents.push_back( contentId );
+      break;
+    }
+
+    Match match{};
+    match.id = m_nextMatchId++;
+    match.contentId = contentId;
+    match.registrationIds = std::move( members );
+    match.readyDeadline = tickCount + ReadyCheckTimeoutMs;
+
+    std::vector< uint32_t > playerIds;
+    playerIds.reserve( match.registrationIds.size() );
+
+    for( auto registrationId : match.registrationIds )
+    {
+      auto& registration = m_registrations.at( registrationId );
+      dequeue( registration );
+      registration.state = RegistrationState::Matched;
+      registration.matchId = match.id;
+      playerIds.push_back( registration.playerId );
+    }
+
+    SAPPHIRE_LOG_DEBUG( "MatchQueue: formed match#{0} for content#{1}", match.id, contentId );
+
+    m_matches.emplace( match.id, std::move( match ) );
+
+    onMatched( contentId, playerIds );
+  }
+}
+
+uint32_t Sapphire::World::MatchQueue::popRegistration( ContentQueue& queue, QueueRole role )
+{
+  auto& roleQueue = queue.roleQueues[ static_cast< std::size_t >( role ) ];
+
+  while( !roleQueue.empty() )
+  {
+    auto registrationId = roleQueue.front();
+    roleQueue.pop_front();
+
+    auto it = m_registrations.find( registrationId );
+    if( it == m_registrations.end() || it->second.state != RegistrationState::Queued )
+      continue;
+
+    if( !isOnline( it->second.playerId ) )
+    {
+      removeRegistration( registrationId );
+      continue;
+    }
+
+    return registrationId;
+  }
+
+  return 0;
+}
+
+void Sapphire::World::MatchQueue::breakMatch( Match& match, bool requeueUnready )
+{
+  auto registrationIds = std::move( match.registrationIds );
+  auto contentId = match.contentId;
+  auto matchId = match.id;
+  m_matches.erase( matchId );
+
+  for( auto registrationId : registrationIds )
+  {
+    auto it = m_registrations.find( registrationId );
+    if( it == m_registrations.end() )
+      continue;
+
+    if( it->second.state != RegistrationState::Ready && !requeueUnready )
+    {
+      auto playerId = it->second.playerId;
+      removeRegistration( registrationId );
+      onDropped( playerId );
+      continue;
+    }
+
+    // requeued under a new id, old queue entries of the registration stay stale
+    auto registration = std::move( it->second );
+    m_registrations.erase( it );
+
+    registration.id = m_nextRegistrationId++;
+    registration.state = RegistrationState::Queued;
+    registration.matchId = 0;
+
+    auto& entry = m_registrations[ registration.id ] = std::move( registration );
+    m_playerRegistrations[ entry.playerId ] = entry.id;
+
+    enqueue( entry, true );
+    onRequeued( contentId, entry.playerId );
+  }
+}
+
+void Sapphire::World::MatchQueue::commence( Match& match )
+{
+  auto registrationIds = std::move( match.registrationIds );
+  auto contentId = match.contentId;
+  auto matchId = match.id;
+  m_matches.erase( matchId );
+
+  std::vector< uint32_t > playerIds;
+  playerIds.reserve( registrationIds.size() );
+
+  for( auto registrationId : registrationIds )
+  {
+    auto it = m_registrations.find( registrationId );
+    if( it == m_registrations.end() )
+      continue;
+
+    playerIds.push_back( it->second.playerId );
+    removeRegistration( registrationId );
+  }
+
+  onCommence( contentId, playerIds );
+}
+
+void Sapphire::World::MatchQueue::removeRegistration( uint32_t registrationId )
+{
+  auto it = m_registrations.find( registrationId );
+  if( it == m_registrations.end() )
+    return;
+
+  if( it->second.state == RegistrationState::Queued )
+    dequeue( it->second );
+
+  auto playerIt = m_playerRegistrations.find( it->second.playerId );
+  if( playerIt != m_playerRegistrations.end() && playerIt->second == registrationId )
+    m_playerRegistrations.erase( playerIt );
+
+  m_registrations.erase( it );
+}
@@ -0,0 +1,152 @@
+#ifndef _MATCHQUEUE_H
+#define _MATCHQUEUE_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::World
+{
+
+  /*!
+   * @brief Role queues of the duty finder, without the players and packets behind them
+   *
+   * Every content gets a queue per role. Registrations can be queued for several contents at once, once matched
+   * they are skipped lazily by the other queues, so forming a party only ever touches the registrations that end
+   * up in it. A formed party has to pass the readiness check before it is let into its content, a few parties per
+   * update.
+   * Subclasses provide the party sizes and who is still online and are told what happened to their players.
+   */
+  class MatchQueue
+  {
+  public:
+    enum class QueueRole : uint8_t
+    {
+      Tank,
+      Healer,
+      Dps,
+      Count
+    };
+
+    using RoleCounts = std::array< uint32_t, static_cast< std::size_t >( QueueRole::Count ) >;
+
+    static constexpr uint64_t ReadyCheckTimeoutMs = 45000;
+    static constexpr std::size_t MaxCommencesPerUpdate = 2;
+
+    MatchQueue();
+
+    virtual ~MatchQueue() = default;
+
+    /*!
+     * @brief Queues a player for one or more contents
+     * @return false if the player is already queued or none of the contents can be matched for
+     */
+    bool registerPlayer( uint32_t playerId, QueueRole role, const std::vector< uint16_t >& contentIds );
+
+    /*!
+     * @brief Withdraws the registration of the player, the rest of the party it was matched into is requeued
+     * @return false if the player wasn't queued
+     */
+    bool withdrawPlayer( uint32_t playerId );
+
+    /*! a matched player confirmed the readiness check */
+    void acceptDuty( uint32_t playerId );
+
+    bool isQueued( uint32_t playerId ) const;
+
+    /*! registrations per role still waiting for contentId */
+    RoleCounts getQueuedCounts( uint16_t contentId ) const;
+
+    void update( uint64_t tickCount );
+
+  protected:
+    /*! party composition of contentId, all zero if nobody can be matched for it. Asked once per content */
+    virtual RoleCounts getPartySize( uint16_t contentId ) = 0;
+
+    /*! players that went offline are dropped once their queue reaches them */
+    virtual bool isOnline( uint32_t playerId ) const = 0;
+
+    /*! a party was formed, its members have to pass the readiness check */
+    virtual void onMatched( uint16_t contentId, const std::vector< uint32_t >& playerIds ) = 0;
+
+    /*! the party of the player for contentId broke up and it went back to the front of its queues */
+    virtual void onRequeued( uint16_t contentId, uint32_t playerId ) = 0;
+
+    /*! the player didn't confirm the readiness check in time and was removed from the duty finder */
+    virtual void onDropped( uint32_t playerId ) = 0;
+
+    /*! everybody confirmed, the players are no longer queued */
+    virtual void onCommence( uint16_t contentId, const std::vector< uint32_t >& playerIds ) = 0;
+
+  private:
+    enum class RegistrationState : uint8_t
+    {
+      Queued,
+      Matched,
+      Ready
+    };
+
+    struct Registration
+    {
+      uint32_t id;
+      uint32_t playerId;
+      QueueRole role;
+      std::vector< uint16_t > contentIds;
+      RegistrationState state;
+      uint32_t matchId;
+    };
+
+    struct ContentQueue
+    {
+      // registration ids, entries that were matched elsewhere or withdrawn are skipped when reached
+      std::array< std::deque< uint32_t >, static_cast< std::size_t >( QueueRole::Count ) > roleQueues;
+      // registrations per role that are still waiting
+      RoleCounts queuedCounts{};
+      RoleCounts partySize{};
+      bool isDirty{ false };
+    };
+
+    struct Match
+    {
+      uint32_t id;
+      uint16_t contentId;
+      std::vector< uint32_t > registrationIds;
+      uint64_t readyDeadline;
+    };
+
+    std::unordered_map< uint16_t, ContentQueue > m_contentQueues;
+    std::unordered_map< uint32_t, Registration > m_registrations;
+    std::unordered_map< uint32_t, uint32_t > m_playerRegistrations;
+    std::unordered_map< uint32_t, Match > m_matches;
+
+    // matches that passed the readiness check and wait to be let in
+    std::deque< uint32_t > m_pendingCommences;
+    std::vector< uint16_t > m_dirtyContents;
+
+    uint32_t m_nextRegistrationId;
+    uint32_t m_nextMatchId;
+
+    ContentQueue* getContentQueue( uint16_t contentId );
+
+    void enqueue( Registration& registration, bool toFront );
+
+    /*! takes the registration out of the waiting counts of every content it is queued for */
+    void dequeue( Registration& registration );
+
+    void matchContent( uint16_t contentId, ContentQueue& queue, uint64_t tickCount );
+
+    uint32_t popRegistration( ContentQueue& queue, QueueRole role );
+
+    /*! requeues the members that were still waiting and drops the ones that withdrew or timed out */
+    void breakMatch( Match& match, bool requeueUnready );
+
+    void commence( Match& match );
+
+    void removeRegistration( uint32_t registrationId );
+  };
+
+}
+
+#endif
@@ -38,6 +38,8 @@ TYPE_FORWARD( Session );
 namespace World::Navi
 {
 TYPE_FORWARD( NaviProvider );
+TYPE_FORWARD( PathQueue );
+TYPE_FORWARD( PathWorkerPool );
 }
 
 namespace World::Territory::Housing
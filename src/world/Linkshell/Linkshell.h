@@ -8,6 +8,16 @@
 namespace Sapphire
 {
 
+  /*! rank of a character in a linkshell, as stored in linkshellmember */
+  enum class LinkshellMemberRank : uint8_t
+  {
+    Invite = 0,
+    Member = 1,
+    Leader = 2,
+    // the master is also in infolinkshell, the row makes sure the membership is found by character
+    Master = 3
+  };
+
   class Linkshell
   {
   private:
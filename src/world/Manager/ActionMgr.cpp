@@ -13,34 +13,34 @@
 using namespace Sapphire;
 
 void World::Manager::ActionMgr::handlePlacedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                                          Data::ActionPtr actionData, Common::FFXIVARR_POSITION3 pos,
-                                                          uint16_t sequence )
+                                                          const Action::ActionSheetEntry& sheet,
+                                                          Common::FFXIVARR_POSITION3 pos, uint16_t sequence )
 {
-  player.sendDebug( "got aoe act: {0}", actionData->name );
+  player.sendDebug( "got aoe act: {0}", actionId );
 
 
-  auto action = Action::make_Action( player.getAsPlayer(), actionId, sequence, actionData );
+  auto action = Action::make_Action( player.getAsPlayer(), actionId, sequence, &sheet );
 
   action->setPos( pos );
 
   if( !action->init() )
     return;
 
-  if( !actionData->targetArea )
+  if( !sheet.targetArea )
   {
     // not an action that has an aoe, cancel it
     action->interrupt();
     return;
   }
 
-  bootstrapAction( player, action, *actionData );
+  bootstrapAction( player, action );
 }
 
 void World::Manager::ActionMgr::handleTargetedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                                            Data::ActionPtr actionData, uint64_t targetId,
+                                                            const Action::ActionSheetEntry& sheet, uint64_t targetId,
                                                             uint16_t sequence )
 {
-  auto action = Action::make_Action( player.getAsPlayer(), actionId, sequence, actionData );
+  auto action = Action::make_Action( player.getAsPlayer(), actionId, sequence, &sheet );
 
   action->setTargetId( targetId );
 
@@ -50,13 +50,13 @@ void World::Manager::ActionMgr::handleTargetedPlayerAction( Entity::Player& play
     return;
 
   // cancel any aoe actions casted with this packet
-  if( actionData->targetArea )
+  if( sheet.targetArea )
   {
     action->interrupt();
     return;
   }
 
-  bootstrapAction( player, action, *actionData );
+  bootstrapAction( player, action );
 }
 
 void World::Manager::ActionMgr::handleItemAction( Sapphire::Entity::Player& player, uint32_t itemId,
@@ -73,24 +73,22 @@ void World::Manager::ActionMgr::handleItemAction( Sapphire::Entity::Player& play
 }
 
 void World::Manager::ActionMgr::handleMountAction( Entity::Player& player, uint16_t mountId,
-                                                   Data::ActionPtr actionData, uint64_t targetId,
-                                                   uint16_t sequence )
+                                                   uint64_t targetId, uint16_t sequence )
 {
   player.sendDebug( "mount: {0}", mountId );
 
-  auto action = Action::make_MountAction( player.getAsPlayer(), mountId, sequence, actionData );
+  auto action = Action::make_MountAction( player.getAsPlayer(), mountId, sequence );
 
   action->setTargetId( targetId );
 
   if( !action->init() )
     return;
 
-  bootstrapAction( player, action, *actionData );
+  bootstrapAction( player, action );
 }
 
 void World::Manager::ActionMgr::bootstrapAction( Entity::Player& player,
-                                                 Action::ActionPtr currentAction,
-                                                 Data::Action& actionData )
+                                                 Action::ActionPtr currentAction )
 {
   if( !currentAction->preCheck() )
   {
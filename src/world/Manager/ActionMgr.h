@@ -2,12 +2,10 @@
 #define SAPPHIRE_ACTIONMGR_H
 
 #include "ForwardsZone.h"
+#include "Action/ActionLut.h"
 
 namespace Sapphire::Data
 {
-  struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
-
   struct ItemAction;
   using ItemActionPtr = std::shared_ptr< ItemAction >;
 }
@@ -21,18 +19,18 @@ namespace Sapphire::World::Manager
     ~ActionMgr() = default;
 
     void handleTargetedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                     Data::ActionPtr actionData, uint64_t targetId, uint16_t sequence );
+                                     const Action::ActionSheetEntry& sheet, uint64_t targetId, uint16_t sequence );
     void handlePlacedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                   Data::ActionPtr actionData, Common::FFXIVARR_POSITION3 pos, uint16_t sequence );
+                                   const Action::ActionSheetEntry& sheet, Common::FFXIVARR_POSITION3 pos,
+                                   uint16_t sequence );
 
     void handleItemAction( Entity::Player& player, uint32_t itemId, Data::ItemActionPtr itemActionData,
                            uint16_t itemSourceSlot, uint16_t itemSourceContainer );
 
-    void handleMountAction( Entity::Player& player, uint16_t mountId,
-                            Data::ActionPtr actionData, uint64_t targetId, uint16_t sequence );
+    void handleMountAction( Entity::Player& player, uint16_t mountId, uint64_t targetId, uint16_t sequence );
 
   private:
-    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction, Data::Action& actionData );
+    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction );
 
     // item action handlers
     void handleItemActionVFX( Entity::Player& player, uint32_t itemId, uint16_t vfxId );
@@ -0,0 +1,195 @@
+#include <algorithm>
+
+#include <Network/GamePacket.h>
+#include <Service.h>
+
+#include "Actor/Player.h"
+#include "Linkshell/Linkshell.h"
+#include "Network/GameConnection.h"
+
+#include "ChatChannelMgr.h"
+#include "LinkshellMgr.h"
+#include "ServerMgr.h"
+#include "Session.h"
+
+void Sapphire::World::Manager::ChatChannelMgr::join( ChannelType type, uint64_t channelId, Entity::Player& player )
+{
+  auto& serverMgr = Common::Service< World::ServerMgr >::ref();
+
+  auto pSession = serverMgr.getSession( player.getId() );
+  if( !pSession )
+    return;
+
+  join( type, channelId, player.getId(), std::move( pSession ) );
+}
+
+void Sapphire::World::Manager::ChatChannelMgr::join( ChannelType type, uint64_t channelId, uint32_t playerId,
+                                                     World::SessionPtr pSession )
+{
+  auto key = makeKey( type, channelId );
+  auto& channel = m_channels[ key ];
+
+  if( channel.indices.find( playerId ) != channel.indices.end() )
+    return;
+
+  channel.indices[ playerId ] = channel.subscribers.size();
+  channel.subscribers.push_back( { playerId, pSession } );
+
+  m_memberships[ playerId ].push_back( key );
+}
+
+void Sapphire::World::Manager::ChatChannelMgr::leave( ChannelType type, uint64_t channelId, uint32_t playerId )
+{
+  auto key = makeKey( type, channelId );
+  if( !removeSubscriber( key, playerId ) )
+    return;
+
+  auto it = m_memberships.find( playerId );
+  if( it == m_memberships.end() )
+    return;
+
+  auto& channels = it->second;
+  channels.erase( std::remove( channels.begin(), channels.end(), key ), channels.end() );
+
+  if( channels.empty() )
+    m_memberships.erase( it );
+}
+
+void Sapphire::World::Manager::ChatChannelMgr::leaveAll( uint32_t playerId )
+{
+  auto it = m_memberships.find( playerId );
+  if( it == m_memberships.end() )
+    return;
+
+  for( auto key : it->second )
+    removeSubscriber( key, playerId );
+
+  m_memberships.erase( it );
+}
+
+void Sapphire::World::Manager::ChatChannelMgr::joinLinkshells( Entity::Player& player )
+{
+  auto& lsMgr = Common::Service< LinkshellMgr >::ref();
+
+  for( auto& pLinkshell : lsMgr.getPlayerLinkshells( player.getId() ) )
+    join( ChannelType::Linkshell, pLinkshell->getId(), player );
+}
+
+std::size_t Sapphire::World::Manager::ChatChannelMgr::broadcast( ChannelType type, uint64_t channelId, uint32_t senderId,
+                                                                 Network::Packets::FFXIVPacketBasePtr pPacket )
+{
+  auto it = m_channels.find( makeKey( type, channelId ) );
+  if( it == m_channels.end() )
+    return 0;
+
+  std::size_t count = 0;
+
+  for( const auto& subscriber : it->second.subscribers )
+  {
+    if( subscriber.playerId == senderId )
+      continue;
+
+    auto pSession = subscriber.pSession.lock();
+    if( !pSession )
+      continue;
+
+    auto pZoneCon = pSession->getZoneConnection();
+    if( !pZoneCon )
+      continue;
+
+    pZoneCon->queueOutPacket( pPacket );
+    ++count;
+  }
+
+  return count;
+}
+
+uint64_t Sapphire::World::Manager::ChatChannelMgr::getLinkshellChannel( uint32_t playerId, uint8_t index ) const
+{
+  auto it = m_memberships.find( playerId );
+  if( it == m_memberships.end() )
+    return 0;
+
+  for( auto key : it->second )
+  {
+    if( getType( key ) != ChannelType::Linkshell )
+      continue;
+
+    if( index == 0 )
+      return getChannelId( key );
+
+    --index;
+  }
+
+  return 0;
+}
+
+uint64_t Sapphire::World::Manager::ChatChannelMgr::getPartyChannel( uint32_t playerId ) const
+{
+  auto it = m_memberships.find( playerId );
+  if( it == m_memberships.end() )
+    return 0;
+
+  for( auto key : it->second )
+  {
+    if( getType( key ) == ChannelType::Party )
+      return getChannelId( key );
+  }
+
+  return 0;
+}
+
+std::size_t Sapphire::World::Manager::ChatChannelMgr::getSubscriberCount( ChannelType type, uint64_t channelId ) const
+{
+  auto it = m_channels.find( makeKey( type, channelId ) );
+  if( it == m_channels.end() )
+    return 0;
+
+  return it->second.subscribers.size();
+}
+
+Sapphire::World::Manager::ChatChannelMgr::ChannelKey
+  Sapphire::World::Manager::ChatChannelMgr::makeKey( ChannelType type, uint64_t channelId )
+{
+  // linkshell ids fit well within the lower 56 bits
+  return ( static_cast< uint64_t >( type ) << 56 ) | ( channelId & 0x00FFFFFFFFFFFFFF );
+}
+
+Sapphire::World::Manager::ChatChannelMgr::ChannelType
+  Sapphire::World::Manager::ChatChannelMgr::getType( ChannelKey key )
+{
+  return static_cast< ChannelType >( key >> 56 );
+}
+
+uint64_t Sapphire::World::Manager::ChatChannelMgr::getChannelId( ChannelKey key )
+{
+  return key & 0x00FFFFFFFFFFFFFF;
+}
+
+bool Sapphire::World::Manager::ChatChannelMgr::removeSubscriber( ChannelKey key, uint32_t playerId )
+{
+  auto channelIt = m_channels.find( key );
+  if( channelIt == m_channels.end() )
+    return false;
+
+  auto& channel = channelIt->second;
+
+  auto it = channel.indices.find( playerId );
+  if( it == channel.indices.end() )
+    return false;
+
+  auto index = it->second;
+  channel.indices.erase( it );
+
+  if( index != channel.subscribers.size() - 1 )
+  {
+    channel.subscribers[ index ] = std::move( channel.subscribers.back() );
+    channel.indices[ channel.subscribers[ index ].playerId ] = index;
+  }
+  channel.subscribers.pop_back();
+
+  if( channel.subscribers.empty() )
+    m_channels.erase( channelIt );
+
+  return true;
+}
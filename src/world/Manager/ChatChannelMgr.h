@@ -0,0 +1,94 @@
+#ifndef SAPPHIRE_CHATCHANNELMGR_H
+#define SAPPHIRE_CHATCHANNELMGR_H
+
+#include "ForwardsZone.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::World::Manager
+{
+
+  /*!
+   * @brief Subscriber lists for the chat channels that are not range based
+   *
+   * Players join the channel of their territory when they are pushed into it, the channels of their
+   * linkshells on login and the channel of their party once parties exist.
+   * Every subscriber keeps a handle to its session, so sending a message to a channel doesn't
+   * scan a territory or look up sessions, the same packet is queued to every subscriber.
+   */
+  class ChatChannelMgr
+  {
+  public:
+    enum class ChannelType : uint8_t
+    {
+      Territory,
+      Linkshell,
+      Party
+    };
+
+    ChatChannelMgr() = default;
+
+    void join( ChannelType type, uint64_t channelId, Entity::Player& player );
+
+    /*! subscribes a session that was already looked up */
+    void join( ChannelType type, uint64_t channelId, uint32_t playerId, World::SessionPtr pSession );
+
+    void leave( ChannelType type, uint64_t channelId, uint32_t playerId );
+
+    /*! removes the player from every channel it is subscribed to */
+    void leaveAll( uint32_t playerId );
+
+    /*! subscribes the player to the channels of all linkshells it is a member of */
+    void joinLinkshells( Entity::Player& player );
+
+    /*!
+     * @brief Queues a packet to every subscriber of a channel except the sender
+     * @return number of subscribers the packet was queued for
+     */
+    std::size_t broadcast( ChannelType type, uint64_t channelId, uint32_t senderId,
+                           Network::Packets::FFXIVPacketBasePtr pPacket );
+
+    /*!
+     * @brief Gets the linkshell channel the player uses for the chat type LS1 + index
+     * @return 0 if the player has no linkshell in that slot
+     */
+    uint64_t getLinkshellChannel( uint32_t playerId, uint8_t index ) const;
+
+    /*! @return 0 if the player is not in a party */
+    uint64_t getPartyChannel( uint32_t playerId ) const;
+
+    std::size_t getSubscriberCount( ChannelType type, uint64_t channelId ) const;
+
+  private:
+    struct Subscriber
+    {
+      uint32_t playerId;
+      std::weak_ptr< World::Session > pSession;
+    };
+
+    struct Channel
+    {
+      std::vector< Subscriber > subscribers;
+      // index of a player in subscribers, removal swaps the last subscriber into its place
+      std::unordered_map< uint32_t, std::size_t > indices;
+    };
+
+    using ChannelKey = uint64_t;
+
+    static ChannelKey makeKey( ChannelType type, uint64_t channelId );
+
+    static ChannelType getType( ChannelKey key );
+
+    static uint64_t getChannelId( ChannelKey key );
+
+    bool removeSubscriber( ChannelKey key, uint32_t playerId );
+
+    std::unordered_map< ChannelKey, Channel > m_channels;
+    // channels of each player in the order they were joined, linkshell slots follow that order
+    std::unordered_map< uint32_t, std::vector< ChannelKey > > m_memberships;
+  };
+
+}
+
+#endif //SAPPHIRE_CHATCHANNELMGR_H
@@ -33,6 +33,7 @@
 #include "Territory/InstanceContent.h"
 #include "Territory/QuestBattle.h"
 #include "Manager/TerritoryMgr.h"
+#include "Manager/MarketMgr.h"
 #include "Event/EventDefs.h"
 
 #include "ServerMgr.h"
@@ -62,6 +63,7 @@ Sapphire::World::Manager::DebugCommandMgr::DebugCommandMgr()
   registerCommand( "questbattle", &DebugCommandMgr::questBattle, "Quest battle utilities", 1 );
   registerCommand( "qb", &DebugCommandMgr::questBattle, "Quest battle utilities", 1 );
   registerCommand( "housing", &DebugCommandMgr::housing, "Housing utilities", 1 );
+  registerCommand( "market", &DebugCommandMgr::market, "Market board utilities", 1 );
 }
 
 // clear all loaded commands
@@ -668,6 +670,29 @@ void Sapphire::World::Manager::DebugCommandMgr::replay( char* data, Entity::Play
     if( pSession )
       pSession->sendReplayInfo();
   }
+  else if( subCommand == "speed" )
+  {
+    float speed = 1.0f;
+    sscanf( params.c_str(), "%f", &speed );
+
+    if( speed <= 0.0f )
+    {
+      player.sendUrgent( "Replay speed has to be above 0." );
+      return;
+    }
+
+    auto pSession = serverMgr.getSession( player.getId() );
+    if( pSession )
+      pSession->setReplaySpeed( speed );
+  }
+  else if( subCommand == "loop" )
+  {
+    auto loopMode = params == "off" ? Network::ReplayLoopMode::Once : Network::ReplayLoopMode::Loop;
+
+    auto pSession = serverMgr.getSession( player.getId() );
+    if( pSession )
+      pSession->setReplayLoopMode( loopMode );
+  }
   else
   {
     player.sendUrgent( "{0} is not a valid replay command.", subCommand );
@@ -732,6 +757,24 @@ Sapphire::World::Manager::DebugCommandMgr::serverInfo( char* data, Entity::Playe
   player.sendDebug( "SapphireZone {0} \nRev: {1}", Version::VERSION, Version::GIT_HASH );
   player.sendDebug( "Compiled: " __DATE__ " " __TIME__ );
   player.sendDebug( "Sessions: {0}", serverMgr.getSessionCount() );
+
+  auto loopStats = serverMgr.getMainLoopStats();
+  player.sendDebug( "Main loop: last {0}us, avg {1}us, max {2}us", loopStats.lastUs, loopStats.avgUs,
+                    loopStats.maxUs );
+
+  // the zone handlers that took up the most time so far
+  auto handlerStats = Network::GameConnection::getHandlerStats( Network::ConnectionType::Zone );
+  std::sort( handlerStats.begin(), handlerStats.end(), []( const auto& a, const auto& b )
+  {
+    return a.totalTimeUs > b.totalTimeUs;
+  } );
+
+  for( std::size_t i = 0; i < std::min< std::size_t >( handlerStats.size(), 5 ); i++ )
+  {
+    const auto& stats = handlerStats[ i ];
+    player.sendDebug( "{0} ( {1:04X} ): {2} calls, {3}us", stats.name, stats.opcode, stats.callCount,
+                      stats.totalTimeUs );
+  }
 }
 
 void Sapphire::World::Manager::DebugCommandMgr::script( char* data, Entity::Player& player,
@@ -1290,3 +1333,99 @@ void Sapphire::World::Manager::DebugCommandMgr::housing( char* data, Entity::Pla
     player.sendDebug( "Unknown sub command." );
   }
 }
+
+void Sapphire::World::Manager::DebugCommandMgr::market( char* data, Entity::Player& player,
+                                                        std::shared_ptr< DebugCommand > command )
+{
+  auto& marketMgr = Common::Service< MarketMgr >::ref();
+  std::string cmd( data ), params, subCommand;
+  auto cmdPos = cmd.find_first_of( ' ' );
+
+  if( cmdPos != std::string::npos )
+  {
+    params = cmd.substr( cmdPos + 1 );
+
+    auto p = params.find_first_of( ' ' );
+
+    if( p != std::string::npos )
+    {
+      subCommand = params.substr( 0, p );
+      params = params.substr( subCommand.length() + 1 );
+    }
+    else
+      subCommand = params;
+  }
+
+  if( subCommand == "list" )
+  {
+    uint32_t catalogId = 0;
+    uint32_t price = 0;
+    uint32_t quantity = 1;
+    uint32_t isHq = 0;
+
+    if( sscanf( params.c_str(), "%u %u %u %u", &catalogId, &price, &quantity, &isHq ) < 2 || quantity == 0 )
+    {
+      player.sendDebug( "Usage: !market list <catalogId> <pricePerUnit> [quantity] [hq]" );
+      return;
+    }
+
+    // listed in the name of the player until retainers can sell
+    MarketMgr::MarketListing listing {};
+    listing.catalogId = catalogId;
+    listing.retainerOwnerId = player.getContentId();
+    listing.retainerName = player.getName();
+    listing.pricePerUnit = price;
+    listing.quantity = quantity;
+    listing.isHq = isHq != 0;
+
+    auto listingId = marketMgr.addListing( std::move( listing ) );
+    if( listingId == 0 )
+      player.sendDebug( "Item#{0} can't be listed on the market board.", catalogId );
+    else
+      player.sendDebug( "Listed item#{0} as listing#{1}.", catalogId, listingId );
+  }
+  else if( subCommand == "price" )
+  {
+    uint32_t catalogId = 0;
+    uint64_t listingId = 0;
+    uint32_t price = 0;
+
+    if( sscanf( params.c_str(), "%u %" SCNu64 " %u", &catalogId, &listingId, &price ) < 3 )
+    {
+      player.sendDebug( "Usage: !market price <catalogId> <listingId> <pricePerUnit>" );
+      return;
+    }
+
+    if( marketMgr.updateListingPrice( catalogId, listingId, price ) )
+      player.sendDebug( "Listing#{0} now sells for {1} gil each.", listingId, price );
+    else
+      player.sendDebug( "No listing#{0} for item#{1}.", listingId, catalogId );
+  }
+  else if( subCommand == "cancel" || subCommand == "buy" )
+  {
+    uint32_t catalogId = 0;
+    uint64_t listingId = 0;
+
+    if( sscanf( params.c_str(), "%u %" SCNu64, &catalogId, &listingId ) < 2 )
+    {
+      player.sendDebug( "Usage: !market {0} <catalogId> <listingId>", subCommand );
+      return;
+    }
+
+    if( subCommand == "cancel" )
+    {
+      if( marketMgr.removeListing( catalogId, listingId ) )
+        player.sendDebug( "Removed listing#{0}.", listingId );
+      else
+        player.sendDebug( "No listing#{0} for item#{1}.", listingId, catalogId );
+    }
+    else if( marketMgr.purchaseListing( player, catalogId, listingId ) )
+      player.sendDebug( "Bought listing#{0}.", listingId );
+    else
+      player.sendDebug( "Couldn't buy listing#{0} of item#{1}.", listingId, catalogId );
+  }
+  else
+  {
+    player.sendDebug( "Unknown sub command." );
+  }
+}
@@ -56,6 +56,8 @@ namespace Sapphire::World::Manager
 
     void housing( char* data, Entity::Player& player, std::shared_ptr< DebugCommand > command) ;
 
+    void market( char* data, Entity::Player& player, std::shared_ptr< DebugCommand > command );
+
     void script( char* data, Entity::Player& player, std::shared_ptr< DebugCommand > command );
 
   };
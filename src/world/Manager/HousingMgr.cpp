@@ -117,17 +117,19 @@ bool Sapphire::World::Manager::HousingMgr::loadEstateInventories()
   auto stmt = db.getPreparedStatement( Db::LAND_INV_SEL_ALL );
   auto res = db.query( stmt );
 
+  // column indices resolved when LAND_INV_SEL_ALL was prepared
+  const auto& col = db.getColumnIndices( Db::LAND_INV_SEL_ALL );
+
   uint32_t itemCount = 0;
   while( res->next() )
   {
     //uint64_t uId, uint32_t catalogId, uint64_t model1, uint64_t model2, bool isHq
-    auto ident = res->getUInt64( "LandIdent" );
-    auto containerId = res->getUInt16( "ContainerId" );
-    auto itemId = res->getUInt64( "ItemId" );
-    auto slot = res->getUInt16( "SlotId" );
-    auto catalogId = res->getUInt( "catalogId" );
-    auto stain = res->getUInt8( "stain" );
-    auto characterId = res->getUInt64( "CharacterId" );
+    auto ident = res->getUInt64( col[ Db::LandInvSelAll::LandIdent ] );
+    auto containerId = res->getUInt16( col[ Db::LandInvSelAll::ContainerId ] );
+    auto itemId = res->getUInt64( col[ Db::LandInvSelAll::ItemId ] );
+    auto slot = res->getUInt16( col[ Db::LandInvSelAll::SlotId ] );
+    auto catalogId = res->getUInt( col[ Db::LandInvSelAll::CatalogId ] );
+    auto stain = res->getUInt8( col[ Db::LandInvSelAll::Stain ] );
 
     auto item = Inventory::make_HousingItem( itemId, catalogId );
     item->setStain( stain );
@@ -138,12 +140,12 @@ bool Sapphire::World::Manager::HousingMgr::loadEstateInventories()
     if( isPlacedItemsInventory( static_cast< Common::InventoryType >( containerId ) ) )
     {
       item->setPos( {
-        res->getFloat( "PosX" ),
-        res->getFloat( "PosY" ),
-        res->getFloat( "PosZ" )
+        res->getFloat( col[ Db::LandInvSelAll::PosX ] ),
+        res->getFloat( col[ Db::LandInvSelAll::PosY ] ),
+        res->getFloat( col[ Db::LandInvSelAll::PosZ ] )
       } );
 
-      item->setRot( res->getFloat( "Rotation" ) );
+      item->setRot( res->getFloat( col[ Db::LandInvSelAll::Rotation ] ) );
     }
 
     ContainerIdToContainerMap& estateInv = m_estateInventories[ ident ];
@@ -175,30 +177,33 @@ void Sapphire::World::Manager::HousingMgr::initLandCache()
   auto stmt = db.getPreparedStatement( Db::LAND_SEL_ALL );
   auto res = db.query( stmt );
 
+  // column indices resolved when LAND_SEL_ALL was prepared
+  const auto& col = db.getColumnIndices( Db::LAND_SEL_ALL );
+
   while( res->next() )
   {
     LandCacheEntry entry;
 
     // land stuff
-    entry.m_landSetId = res->getUInt64( "LandSetId" );
-    entry.m_landId = static_cast< uint16_t >( res->getUInt( "LandId" ) );
+    entry.m_landSetId = res->getUInt64( col[ Db::LandSelAll::LandSetId ] );
+    entry.m_landId = static_cast< uint16_t >( res->getUInt( col[ Db::LandSelAll::LandId ] ) );
 
-    entry.m_type = static_cast< Common::LandType >( res->getUInt( "Type" ) );
-    entry.m_size = static_cast< Common::HouseSize >( res->getUInt8( "Size" ) );
-    entry.m_status = static_cast< Common::HouseStatus >( res->getUInt8( "Status" ) );
-    entry.m_currentPrice = res->getUInt64( "LandPrice" );
-    entry.m_updateTime = res->getUInt64( "UpdateTime" );
-    entry.m_ownerId = res->getUInt64( "OwnerId" );
+    entry.m_type = static_cast< Common::LandType >( res->getUInt( col[ Db::LandSelAll::Type ] ) );
+    entry.m_size = static_cast< Common::HouseSize >( res->getUInt8( col[ Db::LandSelAll::Size ] ) );
+    entry.m_status = static_cast< Common::HouseStatus >( res->getUInt8( col[ Db::LandSelAll::Status ] ) );
+    entry.m_currentPrice = res->getUInt64( col[ Db::LandSelAll::LandPrice ] );
+    entry.m_updateTime = res->getUInt64( col[ Db::LandSelAll::UpdateTime ] );
+    entry.m_ownerId = res->getUInt64( col[ Db::LandSelAll::OwnerId ] );
 
-    entry.m_houseId = res->getUInt64( "HouseId" );
+    entry.m_houseId = res->getUInt64( col[ Db::LandSelAll::HouseId ] );
 
     // house stuff
-    entry.m_estateWelcome = res->getString( "Welcome" );
-    entry.m_estateComment = res->getString( "Comment" );
-    entry.m_estateName = res->getString( "HouseName" );
-    entry.m_buildTime = res->getUInt64( "BuildTime" );
-    entry.m_endorsements = res->getUInt64( "Endorsements" );
-    entry.m_hasAetheryte = res->getBoolean( "Aetheryte" );
+    entry.m_estateWelcome = res->getString( col[ Db::LandSelAll::Welcome ] );
+    entry.m_estateComment = res->getString( col[ Db::LandSelAll::Comment ] );
+    entry.m_estateName = res->getString( col[ Db::LandSelAll::HouseName ] );
+    entry.m_buildTime = res->getUInt64( col[ Db::LandSelAll::BuildTime ] );
+    entry.m_endorsements = res->getUInt64( col[ Db::LandSelAll::Endorsements ] );
+    entry.m_hasAetheryte = res->getBoolean( col[ Db::LandSelAll::Aetheryte ] );
 
     m_landCache[ entry.m_landSetId ].push_back( entry );
 
@@ -2,6 +2,9 @@
 #include <Database/DatabaseDef.h>
 #include <Service.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "Linkshell/Linkshell.h"
 #include "LinkshellMgr.h"
 
@@ -9,50 +12,154 @@ bool Sapphire::World::Manager::LinkshellMgr::loadLinkshells()
 {
   auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
 
-  auto res = db.query( "SELECT LinkshellId, MasterCharacterId, CharacterIdList, "
-                         "LinkshellName, LeaderIdList, InviteIdList "
-                         "FROM infolinkshell "
-                         "ORDER BY LinkshellId ASC;" );
+  struct LegacyIdLists
+  {
+    std::vector< char > members;
+    std::vector< char > leaders;
+    std::vector< char > invites;
+  };
+
+  // id lists of linkshells that may not have been converted to linkshellmember yet
+  std::unordered_map< uint64_t, LegacyIdLists > legacyIdLists;
 
+  // column indices resolved when the statements were prepared
+  const auto& col = db.getColumnIndices( Db::LINKSHELL_SEL_ALL );
+  const auto& memberCol = db.getColumnIndices( Db::LINKSHELL_MEMBER_SEL_ALL );
+
+  auto stmt = db.getPreparedStatement( Db::LINKSHELL_SEL_ALL );
+  auto res = db.query( stmt );
 
   while( res->next() )
   {
-    uint64_t linkshellId = res->getUInt64( 1 );
-    uint32_t masterId = res->getUInt( 2 );
-    std::string name = res->getString( 4 );
+    uint64_t linkshellId = res->getUInt64( col[ Db::LinkshellSelAll::LinkshellId ] );
+    uint64_t masterId = res->getUInt64( col[ Db::LinkshellSelAll::MasterCharacterId ] );
+    std::string name = res->getString( col[ Db::LinkshellSelAll::LinkshellName ] );
+
+    auto membersBin = res->getBlobVector( col[ Db::LinkshellSelAll::CharacterIdList ] );
+    auto leadersBin = res->getBlobVector( col[ Db::LinkshellSelAll::LeaderIdList ] );
+    auto invitesBin = res->getBlobVector( col[ Db::LinkshellSelAll::InviteIdList ] );
+
+    // converted unless rows turn up in linkshellmember, even with empty lists the master needs a row
+    legacyIdLists[ linkshellId ] = { std::move( membersBin ), std::move( leadersBin ), std::move( invitesBin ) };
+
+    restoreLinkshell( linkshellId, name, masterId );
+  }
+
+  auto memberStmt = db.getPreparedStatement( Db::LINKSHELL_MEMBER_SEL_ALL );
+  auto memberRes = db.query( memberStmt );
 
-    auto func = []( std::set< uint64_t >& outList, std::vector< char >& inData )
+  while( memberRes->next() )
+  {
+    uint64_t linkshellId = memberRes->getUInt64( memberCol[ Db::LinkshellMemberSelAll::LinkshellId ] );
+    uint64_t characterId = memberRes->getUInt64( memberCol[ Db::LinkshellMemberSelAll::CharacterId ] );
+    auto rankValue = memberRes->getUInt8( memberCol[ Db::LinkshellMemberSelAll::MemberRank ] );
+    auto rank = static_cast< LinkshellMemberRank >( rankValue );
+
+    if( !restoreMember( linkshellId, characterId, rank ) )
     {
-      if( inData.size() )
-      {
-        std::vector< uint64_t > list( inData.size() / 8 );
-        outList.insert( list.begin(), list.end() );
-      }
-    };
-
-    std::set< uint64_t > members;
-    std::vector< char > membersBin;
-    membersBin = res->getBlobVector( 3 );
-    func( members, membersBin );
-
-    std::set< uint64_t > leaders;
-    std::vector< char > leadersBin;
-    leadersBin = res->getBlobVector( 5 );
-    func( members, leadersBin );
-
-    std::set< uint64_t > invites;
-    std::vector< char > invitesBin;
-    invitesBin = res->getBlobVector( 6 );
-    func( members, invitesBin );
-
-    auto lsPtr = std::make_shared< Linkshell >( linkshellId, name, masterId, members, leaders, invites );
-    m_linkshellIdMap[ linkshellId ] = lsPtr;
-    m_linkshellNameMap[ name ] = lsPtr;
+      Logger::warn( "LinkshellMgr: member#{0} of unknown linkshell#{1}", characterId, linkshellId );
+      continue;
+    }
+
+    // rows exist, the id lists of infolinkshell are outdated
+    legacyIdLists.erase( linkshellId );
+  }
+
+  uint32_t convertedCount = 0;
+
+  for( const auto& entry : legacyIdLists )
+  {
+    auto linkshellId = entry.first;
+    auto masterId = m_linkshellIdMap[ linkshellId ]->getMasterId();
+
+    auto ranks = resolveLegacyRanks( masterId, entry.second.members, entry.second.leaders, entry.second.invites );
+
+    for( const auto& rankEntry : ranks )
+      restoreMember( linkshellId, rankEntry.first, rankEntry.second );
+
+    // the lists are kept if the rows couldn't be written, the next load tries again
+    if( persistConversion( linkshellId, ranks ) )
+      ++convertedCount;
+    else
+      Logger::error( "LinkshellMgr: Could not convert linkshell#{0} to per member rows", linkshellId );
+  }
+
+  if( convertedCount != 0 )
+    Logger::info( "LinkshellMgr: Converted {0} linkshells to per member rows", convertedCount );
+
+  return true;
+
+}
+
+Sapphire::LinkshellPtr Sapphire::World::Manager::LinkshellMgr::restoreLinkshell( uint64_t lsId,
+                                                                                const std::string& name,
+                                                                                uint64_t masterId )
+{
+  auto lsPtr = std::make_shared< Linkshell >( lsId, name, masterId, std::set< uint64_t >(),
+                                              std::set< uint64_t >(), std::set< uint64_t >() );
+  m_linkshellIdMap[ lsId ] = lsPtr;
+  m_linkshellNameMap[ name ] = lsPtr;
+
+  return lsPtr;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::restoreMember( uint64_t lsId, uint64_t characterId,
+                                                            LinkshellMemberRank rank )
+{
+  auto it = m_linkshellIdMap.find( lsId );
+  if( it == m_linkshellIdMap.end() )
+    return false;
+
+  auto& linkshell = *it->second;
 
+  switch( rank )
+  {
+    case LinkshellMemberRank::Invite:
+      linkshell.addInvite( characterId );
+      break;
+
+    case LinkshellMemberRank::Leader:
+      linkshell.addLeader( characterId );
+      linkshell.addMember( characterId );
+      indexMember( characterId, lsId );
+      break;
+
+    // Master and Member, the master id itself comes from infolinkshell
+    default:
+      linkshell.addMember( characterId );
+      indexMember( characterId, lsId );
+      break;
   }
 
   return true;
+}
 
+std::map< uint64_t, Sapphire::LinkshellMemberRank >
+  Sapphire::World::Manager::LinkshellMgr::resolveLegacyRanks( uint64_t masterId,
+                                                              const std::vector< char >& members,
+                                                              const std::vector< char >& leaders,
+                                                              const std::vector< char >& invites )
+{
+  std::map< uint64_t, LinkshellMemberRank > ranks;
+
+  for( auto characterId : decodeIdList( members ) )
+    ranks[ characterId ] = LinkshellMemberRank::Member;
+
+  // older lists don't always contain the master
+  if( masterId != 0 )
+    ranks[ masterId ] = LinkshellMemberRank::Master;
+
+  for( auto characterId : decodeIdList( leaders ) )
+  {
+    auto it = ranks.find( characterId );
+    if( it != ranks.end() && it->second == LinkshellMemberRank::Member )
+      it->second = LinkshellMemberRank::Leader;
+  }
+
+  for( auto characterId : decodeIdList( invites ) )
+    ranks.emplace( characterId, LinkshellMemberRank::Invite );
+
+  return ranks;
 }
 
 Sapphire::LinkshellPtr Sapphire::World::Manager::LinkshellMgr::getLinkshellByName( const std::string& name )
@@ -72,3 +179,197 @@ Sapphire::LinkshellPtr Sapphire::World::Manager::LinkshellMgr::getLinkshellById(
   else
     return it->second;
 }
+
+std::vector< Sapphire::LinkshellPtr >
+  Sapphire::World::Manager::LinkshellMgr::getPlayerLinkshells( uint64_t characterId ) const
+{
+  std::vector< LinkshellPtr > linkshells;
+
+  auto it = m_characterLinkshells.find( characterId );
+  if( it == m_characterLinkshells.end() )
+    return linkshells;
+
+  linkshells.reserve( it->second.size() );
+
+  for( auto lsId : it->second )
+    linkshells.push_back( m_linkshellIdMap.at( lsId ) );
+
+  return linkshells;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::addMember( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getMemberIdList().count( characterId ) != 0 )
+    return false;
+
+  pLinkshell->removeInvite( characterId );
+  pLinkshell->addMember( characterId );
+  indexMember( characterId, lsId );
+
+  persistMember( lsId, characterId, LinkshellMemberRank::Member );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::removeMember( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getMemberIdList().count( characterId ) == 0 ||
+      pLinkshell->getMasterId() == characterId )
+    return false;
+
+  pLinkshell->removeLeader( characterId );
+  pLinkshell->removeMember( characterId );
+  unindexMember( characterId, lsId );
+
+  persistMemberRemoval( lsId, characterId );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::addLeader( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getMemberIdList().count( characterId ) == 0 ||
+      pLinkshell->getLeaderIdList().count( characterId ) != 0 || pLinkshell->getMasterId() == characterId )
+    return false;
+
+  pLinkshell->addLeader( characterId );
+
+  persistMember( lsId, characterId, LinkshellMemberRank::Leader );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::removeLeader( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getLeaderIdList().count( characterId ) == 0 )
+    return false;
+
+  pLinkshell->removeLeader( characterId );
+
+  persistMember( lsId, characterId, LinkshellMemberRank::Member );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::addInvite( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getMemberIdList().count( characterId ) != 0 ||
+      pLinkshell->getInviteIdList().count( characterId ) != 0 )
+    return false;
+
+  pLinkshell->addInvite( characterId );
+
+  persistMember( lsId, characterId, LinkshellMemberRank::Invite );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::removeInvite( uint64_t lsId, uint64_t characterId )
+{
+  auto pLinkshell = getLinkshellById( lsId );
+  if( !pLinkshell || pLinkshell->getInviteIdList().count( characterId ) == 0 )
+    return false;
+
+  pLinkshell->removeInvite( characterId );
+
+  persistMemberRemoval( lsId, characterId );
+
+  return true;
+}
+
+std::set< uint64_t > Sapphire::World::Manager::LinkshellMgr::decodeIdList( const std::vector< char >& data )
+{
+  std::set< uint64_t > ids;
+
+  for( std::size_t offset = 0; offset + sizeof( uint64_t ) <= data.size(); offset += sizeof( uint64_t ) )
+  {
+    uint64_t id;
+    std::memcpy( &id, &data[ offset ], sizeof( uint64_t ) );
+
+    // fixed size lists are padded with zeros
+    if( id != 0 )
+      ids.insert( id );
+  }
+
+  return ids;
+}
+
+void Sapphire::World::Manager::LinkshellMgr::indexMember( uint64_t characterId, uint64_t lsId )
+{
+  auto& lsIds = m_characterLinkshells[ characterId ];
+
+  auto it = std::lower_bound( lsIds.begin(), lsIds.end(), lsId );
+  if( it == lsIds.end() || *it != lsId )
+    lsIds.insert( it, lsId );
+}
+
+void Sapphire::World::Manager::LinkshellMgr::unindexMember( uint64_t characterId, uint64_t lsId )
+{
+  auto charIt = m_characterLinkshells.find( characterId );
+  if( charIt == m_characterLinkshells.end() )
+    return;
+
+  auto& lsIds = charIt->second;
+
+  auto it = std::lower_bound( lsIds.begin(), lsIds.end(), lsId );
+  if( it != lsIds.end() && *it == lsId )
+    lsIds.erase( it );
+
+  if( lsIds.empty() )
+    m_characterLinkshells.erase( charIt );
+}
+
+bool Sapphire::World::Manager::LinkshellMgr::persistConversion( uint64_t lsId,
+                                                                const std::map< uint64_t, LinkshellMemberRank >& ranks )
+{
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+
+  std::vector< std::shared_ptr< Db::PreparedStatement > > stmts;
+  stmts.reserve( ranks.size() );
+
+  for( const auto& entry : ranks )
+  {
+    auto stmt = db.getPreparedStatement( Db::LINKSHELL_MEMBER_INS );
+    stmt->setUInt64( 1, lsId );
+    stmt->setUInt64( 2, entry.first );
+    stmt->setUInt( 3, static_cast< uint8_t >( entry.second ) );
+    stmts.push_back( std::move( stmt ) );
+  }
+
+  if( !db.directExecuteTransaction( stmts ) )
+    return false;
+
+  // so a linkshell that loses all of its members isn't converted again on the next load
+  auto clearStmt = db.getPreparedStatement( Db::LINKSHELL_UP_CLEAR_ID_LISTS );
+  clearStmt->setUInt64( 1, lsId );
+  db.directExecute( clearStmt );
+
+  return true;
+}
+
+void Sapphire::World::Manager::LinkshellMgr::persistMember( uint64_t lsId, uint64_t characterId,
+                                                            LinkshellMemberRank rank )
+{
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+
+  auto stmt = db.getPreparedStatement( Db::LINKSHELL_MEMBER_INS );
+  stmt->setUInt64( 1, lsId );
+  stmt->setUInt64( 2, characterId );
+  stmt->setUInt( 3, static_cast< uint8_t >( rank ) );
+  db.directExecute( stmt );
+}
+
+void Sapphire::World::Manager::LinkshellMgr::persistMemberRemoval( uint64_t lsId, uint64_t characterId )
+{
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+
+  auto stmt = db.getPreparedStatement( Db::LINKSHELL_MEMBER_DEL );
+  stmt->setUInt64( 1, lsId );
+  stmt->setUInt64( 2, characterId );
+  db.directExecute( stmt );
+}
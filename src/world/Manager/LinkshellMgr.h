@@ -1,27 +1,93 @@
 #ifndef SAPPHIRE_LINKSHELLMGR_H
 #define SAPPHIRE_LINKSHELLMGR_H
 
-#include <memory>
 #include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "ForwardsZone.h"
+#include "Linkshell/Linkshell.h"
 
 namespace Sapphire::World::Manager
 {
 
+  /*!
+   * @brief Keeps every linkshell and the linkshells of every character
+   *
+   * Memberships are stored one row per character in linkshellmember, every change only writes that row.
+   * The rows are written on a synchronous connection, the async workers may run statements out of order and
+   * a promotion must not overtake the join it follows.
+   *
+   * Linkshells that have no rows there yet are converted from the id lists of infolinkshell on load. The rows
+   * of a linkshell are written in one transaction and its id lists are only cleared once that committed.
+   */
   class LinkshellMgr
   {
   private:
-    std::map< uint64_t, LinkshellPtr > m_linkshellIdMap;
-    std::map< std::string, LinkshellPtr > m_linkshellNameMap;
+    std::unordered_map< uint64_t, LinkshellPtr > m_linkshellIdMap;
+    std::unordered_map< std::string, LinkshellPtr > m_linkshellNameMap;
+    // ids of the linkshells a character is a member of, sorted, pending invites are not included
+    std::unordered_map< uint64_t, std::vector< uint64_t > > m_characterLinkshells;
 
-    LinkshellPtr getLinkshellByName( const std::string& name );
+    void indexMember( uint64_t characterId, uint64_t lsId );
 
-    LinkshellPtr getLinkshellById( uint64_t lsId );
+    void unindexMember( uint64_t characterId, uint64_t lsId );
+
+    /*! writes the rows of a converted linkshell and clears its id lists once they are committed */
+    bool persistConversion( uint64_t lsId, const std::map< uint64_t, LinkshellMemberRank >& ranks );
+
+    void persistMember( uint64_t lsId, uint64_t characterId, LinkshellMemberRank rank );
+
+    void persistMemberRemoval( uint64_t lsId, uint64_t characterId );
 
   public:
     LinkshellMgr() = default;
 
     bool loadLinkshells();
+
+    /*! decodes an id list blob, little endian uint64 ids without separators */
+    static std::set< uint64_t > decodeIdList( const std::vector< char >& data );
+
+    /*!
+     * @brief Resolves the id lists of infolinkshell to the rank every character ends up with
+     *
+     * The master is always a member, also when older lists don't contain it. Leaders have to be members and
+     * invites of characters that are members already are dropped.
+     */
+    static std::map< uint64_t, LinkshellMemberRank > resolveLegacyRanks( uint64_t masterId,
+                                                                         const std::vector< char >& members,
+                                                                         const std::vector< char >& leaders,
+                                                                         const std::vector< char >& invites );
+
+    /*! adds a loaded linkshell without members, they are added through restoreMember */
+    LinkshellPtr restoreLinkshell( uint64_t lsId, const std::string& name, uint64_t masterId );
+
+    /*! adds a loaded membership without writing it back */
+    bool restoreMember( uint64_t lsId, uint64_t characterId, LinkshellMemberRank rank );
+
+    LinkshellPtr getLinkshellByName( const std::string& name );
+
+    LinkshellPtr getLinkshellById( uint64_t lsId );
+
+    /*! gets the linkshells the character is a member of, ordered by linkshell id */
+    std::vector< LinkshellPtr > getPlayerLinkshells( uint64_t characterId ) const;
+
+    /*! adds a member, a pending invite of the character is consumed */
+    bool addMember( uint64_t lsId, uint64_t characterId );
+
+    /*! removes a member, the master can't leave its own linkshell */
+    bool removeMember( uint64_t lsId, uint64_t characterId );
+
+    /*! promotes a member to leader */
+    bool addLeader( uint64_t lsId, uint64_t characterId );
+
+    bool removeLeader( uint64_t lsId, uint64_t characterId );
+
+    bool addInvite( uint64_t lsId, uint64_t characterId );
+
+    bool removeInvite( uint64_t lsId, uint64_t characterId );
   };
 
 }
@@ -2,63 +2,300 @@
 
 #include <Exd/ExdDataGenerated.h>
 #include <Logging/Logger.h>
+#include <Database/DatabaseDef.h>
+#include <Database/StatementTask.h>
+#include <Service.h>
 
 #include <Network/CommonNetwork.h>
 #include <Network/GamePacket.h>
 #include <Network/PacketDef/Zone/ServerZoneDef.h>
 
 #include "Actor/Player.h"
+#include "Inventory/Item.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstring>
 
 using namespace Sapphire::Network::Packets;
 
+namespace
+{
+  std::string toLowerAscii( const std::string_view& str )
+  {
+    std::string result( str );
+    std::transform( result.begin(), result.end(), result.begin(), []( unsigned char c )
+    {
+      return static_cast< char >( std::tolower( c ) );
+    } );
+    return result;
+  }
+}
+
+Sapphire::World::Manager::MarketMgr::MarketMgr() :
+  m_pWriteStrand( std::make_shared< Db::PreparedStatementStrand >() )
+{
+}
+
 bool Sapphire::World::Manager::MarketMgr::init()
 {
-//  Logger::info( "MarketMgr: warming up marketable item cache..." );
-//
-//  // build item cache
-//  auto& exdData = Common::Service< Sapphire::Data::ExdDataGenerated >::ref();
-//  auto idList = exdData.getItemIdList();
-//
-//  for( auto id : idList )
-//  {
-//    if( id > 10000 )
-//      break;
-//
-//    auto item = exdData.get< Sapphire::Data::Item >( id );
-//    if( !item )
-//      continue;
-//
-//    if( item->isUntradable )
-//      continue;
-//
-//    MarketableItem cacheEntry {};
-//    cacheEntry.catalogId = id;
-//    cacheEntry.itemSearchCategory = item->itemSearchCategory;
-//    cacheEntry.maxEquipLevel = item->levelEquip;
-//    cacheEntry.name = item->name;
-//    cacheEntry.classJob = item->classJobUse;
-//    cacheEntry.itemLevel = item->levelItem;
-//
-//    m_marketItemCache.push_back( std::move( cacheEntry ) );
-//  }
-//
-//  std::sort( m_marketItemCache.begin(), m_marketItemCache.end(), []( const MarketableItem& a, const MarketableItem& b )
-//  {
-//    return a.itemLevel > b.itemLevel;
-//  } );
-//
-//  Logger::info( "MarketMgr: Cached " + std::to_string( m_marketItemCache.size() ) + " marketable items" );
+  Logger::info( "MarketMgr: warming up marketable item cache..." );
+
+  MarketableItemCacheList items;
+
+  // build item cache
+  auto& exdData = Common::Service< Sapphire::Data::ExdDataGenerated >::ref();
+  auto idList = exdData.getItemIdList();
+
+  for( auto id : idList )
+  {
+    auto item = exdData.get< Sapphire::Data::Item >( id );
+    if( !item )
+      continue;
+
+    // items without a search category can't be listed on the market board
+    if( item->isUntradable || item->itemSearchCategory == 0 )
+      continue;
+
+    MarketableItem cacheEntry {};
+    cacheEntry.catalogId = id;
+    cacheEntry.itemSearchCategory = item->itemSearchCategory;
+    cacheEntry.maxEquipLevel = item->levelEquip;
+    cacheEntry.name = item->name;
+    cacheEntry.classJob = item->classJobUse;
+    cacheEntry.itemLevel = item->levelItem;
+
+    items.push_back( std::move( cacheEntry ) );
+  }
+
+  setMarketableItems( std::move( items ) );
+
+  Logger::info( "MarketMgr: Cached {0} marketable items", m_marketItemCache.size() );
+
+  loadOrderBooks();
+
+  return true;
+}
+
+void Sapphire::World::Manager::MarketMgr::setMarketableItems( MarketableItemCacheList items )
+{
+  m_marketItemCache = std::move( items );
+
+  std::stable_sort( m_marketItemCache.begin(), m_marketItemCache.end(),
+                    []( const MarketableItem& a, const MarketableItem& b )
+  {
+    return a.itemLevel > b.itemLevel;
+  } );
+
+  for( auto& indexList : m_itemsBySearchCategory )
+    indexList.clear();
+  m_itemsByCategoryClassJob.clear();
+  m_orderBooks.clear();
+
+  buildIndices();
+}
+
+bool Sapphire::World::Manager::MarketMgr::restoreListing( MarketListing listing )
+{
+  auto it = m_orderBooks.find( listing.catalogId );
+  if( it == m_orderBooks.end() )
+    return false;
+
+  m_nextListingId = std::max( m_nextListingId, listing.listingId + 1 );
+
+  // rows come cheapest first, this only appends
+  insertByPrice( it->second.listings, std::move( listing ) );
 
   return true;
 }
 
+void Sapphire::World::Manager::MarketMgr::buildIndices()
+{
+  m_nameTrie.clear();
+  m_nameTrie.emplace_back();
+
+  for( uint32_t i = 0; i < m_marketItemCache.size(); i++ )
+  {
+    const auto& item = m_marketItemCache[ i ];
+
+    m_itemsBySearchCategory[ item.itemSearchCategory ].push_back( i );
+
+    if( item.classJob != 0 )
+      m_itemsByCategoryClassJob[ ( item.itemSearchCategory << 8 ) | item.classJob ].push_back( i );
+
+    insertName( toLowerAscii( item.name ), i );
+
+    m_orderBooks[ item.catalogId ];
+  }
+
+  collectSubtreeNames();
+
+  // keep the item level order within the same equip level
+  auto byEquipLevel = [ this ]( uint32_t a, uint32_t b )
+  {
+    return m_marketItemCache[ a ].maxEquipLevel < m_marketItemCache[ b ].maxEquipLevel;
+  };
+
+  for( auto& indexList : m_itemsBySearchCategory )
+    std::stable_sort( indexList.begin(), indexList.end(), byEquipLevel );
+
+  for( auto& indexList : m_itemsByCategoryClassJob )
+    std::stable_sort( indexList.second.begin(), indexList.second.end(), byEquipLevel );
+}
+
+void Sapphire::World::Manager::MarketMgr::loadOrderBooks()
+{
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+
+  std::size_t listingCount = 0;
+
+  {
+    auto stmt = db.getPreparedStatement( Db::MARKET_LISTING_SEL_ALL );
+    auto res = db.query( stmt );
+
+    while( res->next() )
+    {
+      MarketListing listing {};
+      listing.listingId = res->getUInt64( 1 );
+      listing.catalogId = res->getUInt( 2 );
+      listing.retainerId = res->getUInt64( 3 );
+      listing.retainerOwnerId = res->getUInt64( 4 );
+      listing.artisanId = res->getUInt64( 5 );
+      listing.retainerName = res->getString( 6 );
+      listing.pricePerUnit = res->getUInt( 7 );
+      listing.quantity = res->getUInt( 8 );
+      listing.isHq = res->getBoolean( 9 );
+      listing.marketCity = res->getUInt8( 10 );
+      listing.listTime = res->getUInt( 11 );
+
+      auto listingId = listing.listingId;
+      auto catalogId = listing.catalogId;
+
+      if( !restoreListing( std::move( listing ) ) )
+      {
+        Logger::warn( "MarketMgr: listing#{0} is for unmarketable item#{1}", listingId, catalogId );
+        continue;
+      }
+
+      listingCount++;
+    }
+  }
+
+  {
+    auto stmt = db.getPreparedStatement( Db::MARKET_HISTORY_SEL_ALL );
+    auto res = db.query( stmt );
+
+    while( res->next() )
+    {
+      auto it = m_orderBooks.find( res->getUInt( 1 ) );
+      if( it == m_orderBooks.end() )
+        continue;
+
+      // rows are ordered newest first, older sales are never sent
+      auto& history = it->second.history;
+      if( history.size() >= MaxSaleHistoryEntries )
+        continue;
+
+      MarketSaleHistoryEntry entry {};
+      entry.buyerName = res->getString( 2 );
+      entry.salePrice = res->getUInt( 3 );
+      entry.quantity = res->getUInt( 4 );
+      entry.isHq = res->getBoolean( 5 );
+      entry.onMannequin = res->getBoolean( 6 );
+      entry.purchaseTime = res->getUInt( 7 );
+
+      history.push_back( std::move( entry ) );
+    }
+  }
+
+  Logger::info( "MarketMgr: Loaded {0} market listings", listingCount );
+}
+
+void Sapphire::World::Manager::MarketMgr::insertName( const std::string& name, uint32_t itemIdx )
+{
+  // every word of a name is a valid start for a search, so "potion" finds "Hi-Potion" as well as "Super Potion"
+  for( std::size_t start = 0; start < name.size(); start++ )
+  {
+    if( start > 0 && name[ start - 1 ] != ' ' && name[ start - 1 ] != '-' )
+      continue;
+
+    uint32_t nodeIdx = 0;
+
+    for( auto pos = start; pos < name.size(); pos++ )
+    {
+      auto c = name[ pos ];
+      auto& children = m_nameTrie[ nodeIdx ].children;
+
+      auto it = std::find_if( children.begin(), children.end(), [ c ]( const std::pair< char, uint32_t >& child )
+      {
+        return child.first == c;
+      } );
+
+      if( it != children.end() )
+      {
+        nodeIdx = it->second;
+        continue;
+      }
+
+      auto childIdx = static_cast< uint32_t >( m_nameTrie.size() );
+      children.emplace_back( c, childIdx );
+      // children is invalidated here
+      m_nameTrie.emplace_back();
+      nodeIdx = childIdx;
+    }
+
+    m_nameTrie[ nodeIdx ].items.push_back( itemIdx );
+  }
+}
+
+const Sapphire::World::Manager::MarketMgr::ItemIndexList*
+  Sapphire::World::Manager::MarketMgr::findByNamePrefix( const std::string& prefix ) const
+{
+  uint32_t nodeIdx = 0;
+
+  for( auto c : prefix )
+  {
+    const auto& children = m_nameTrie[ nodeIdx ].children;
+
+    auto it = std::find_if( children.begin(), children.end(), [ c ]( const std::pair< char, uint32_t >& child )
+    {
+      return child.first == c;
+    } );
+
+    if( it == children.end() )
+      return nullptr;
+
+    nodeIdx = it->second;
+  }
+
+  return &m_nameTrie[ nodeIdx ].items;
+}
+
+void Sapphire::World::Manager::MarketMgr::collectSubtreeNames()
+{
+  // children are always added after their parent, walking backwards every child is complete before its parent
+  for( auto nodeIdx = m_nameTrie.size(); nodeIdx-- > 0; )
+  {
+    auto& node = m_nameTrie[ nodeIdx ];
+
+    for( const auto& child : node.children )
+    {
+      const auto& childItems = m_nameTrie[ child.second ].items;
+      node.items.insert( node.items.end(), childItems.begin(), childItems.end() );
+    }
+
+    // a name can match with more than one of its words, results are kept in catalog order for stable paging
+    std::sort( node.items.begin(), node.items.end() );
+    node.items.erase( std::unique( node.items.begin(), node.items.end() ), node.items.end() );
+    node.items.shrink_to_fit();
+  }
+}
+
 void Sapphire::World::Manager::MarketMgr::requestItemListingInfo( Sapphire::Entity::Player& player, uint32_t catalogId,
                                                                   uint32_t requestId )
 {
   auto countPkt = makeZonePacket< Server::FFFXIVIpcMarketBoardItemListingCount >( player.getId() );
-  countPkt->data().quantity = 1 << 8;
+  countPkt->data().quantity = static_cast< uint16_t >( std::min< uint16_t >( getListingCount( catalogId ), 0xFF ) << 8 );
   countPkt->data().itemCatalogId = catalogId;
   countPkt->data().requestId = requestId;
 
@@ -68,20 +305,26 @@ void Sapphire::World::Manager::MarketMgr::requestItemListingInfo( Sapphire::Enti
   historyPkt->data().itemCatalogId = catalogId;
   historyPkt->data().itemCatalogId2 = catalogId;
 
-  std::string name = "fix game pls se :(((";
-
-  for( int i = 0; i < 10; i++ )
+  auto it = m_orderBooks.find( catalogId );
+  if( it != m_orderBooks.end() )
   {
-    auto& listing = historyPkt->data().listing[ i ];
+    const auto& history = it->second.history;
+    auto count = std::min< std::size_t >( history.size(), MaxSaleHistoryEntries );
+
+    for( std::size_t i = 0; i < count; i++ )
+    {
+      const auto& entry = history[ i ];
+      auto& listing = historyPkt->data().listing[ i ];
 
-    listing.itemCatalogId = catalogId;
-    listing.quantity = i + 1;
-    listing.purchaseTime = Common::Util::getTimeSeconds();
-    listing.salePrice = 69420420;
-    listing.isHq = 1;
-    listing.onMannequin = 1;
+      listing.itemCatalogId = catalogId;
+      listing.quantity = entry.quantity;
+      listing.purchaseTime = entry.purchaseTime;
+      listing.salePrice = entry.salePrice;
+      listing.isHq = entry.isHq;
+      listing.onMannequin = entry.onMannequin;
 
-    strcpy( listing.buyerName, name.c_str() );
+      strncpy( listing.buyerName, entry.buyerName.c_str(), sizeof( listing.buyerName ) - 1 );
+    }
   }
 
   player.queuePacket( historyPkt );
@@ -94,58 +337,321 @@ void Sapphire::World::Manager::MarketMgr::searchMarketboard( Entity::Player& pla
                                                              uint32_t startIdx )
 {
   ItemSearchResultList resultList;
-  findItems( searchStr, itemSearchCategory, maxEquipLevel, classJob, resultList );
-
-  auto numResults = resultList.size();
-
-  if( startIdx > numResults )
-    return;
-
-  auto endIdx = std::min< size_t >( startIdx + 20, numResults );
-  auto size = endIdx - startIdx;
+  auto hasMore = findItems( searchStr, itemSearchCategory, maxEquipLevel, classJob, startIdx, resultList );
 
   auto resultPkt = makeZonePacket< Server::FFXIVIpcMarketBoardSearchResult >( player.getId() );
   resultPkt->data().itemIndexStart = startIdx;
   resultPkt->data().requestId = requestId;
 
-  for( auto i = 0; i < size; i++ )
+  for( std::size_t i = 0; i < resultList.size(); i++ )
   {
-    auto& item = resultList.at( startIdx + i );
+    auto& item = resultList[ i ];
     auto& data = resultPkt->data().items[ i ];
 
     data.itemCatalogId = item.catalogId;
     data.quantity = item.quantity;
-    data.demand = 420;
+    data.demand = 0;
   }
 
-  if( size < 20 )
-    resultPkt->data().itemIndexEnd = 0;
+  if( hasMore )
+    resultPkt->data().itemIndexEnd = startIdx + SearchResultsPerPage;
   else
-    resultPkt->data().itemIndexEnd = startIdx + 20;
+    resultPkt->data().itemIndexEnd = 0;
 
   player.queuePacket( resultPkt );
 }
 
 void Sapphire::World::Manager::MarketMgr::requestItemListings( Sapphire::Entity::Player& player, uint16_t catalogId )
 {
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return;
+
+  const auto& listings = it->second.listings;
+  auto currentTime = Common::Util::getTimeSeconds();
+
+  // listing indices are sent as a single byte
+  auto count = std::min< std::size_t >( listings.size(), 0xFF - ListingsPerPacket );
+  std::size_t startIdx = 0;
+
+  do
+  {
+    auto listingPkt = makeZonePacket< Server::FFXIVIpcMarketBoardItemListing >( player.getId() );
+    auto endIdx = std::min< std::size_t >( startIdx + ListingsPerPacket, count );
+
+    for( auto i = startIdx; i < endIdx; i++ )
+    {
+      const auto& listing = listings[ i ];
+      auto& data = listingPkt->data().listing[ i - startIdx ];
+
+      data.listingId = listing.listingId;
+      data.retainerId = listing.retainerId;
+      data.retainerOwnerId = listing.retainerOwnerId;
+      data.artisanId = listing.artisanId;
+      data.pricePerUnit = listing.pricePerUnit;
+      data.totalTax = static_cast< uint32_t >( static_cast< uint64_t >( listing.pricePerUnit ) * listing.quantity * 5 / 100 );
+      data.itemQuantity = listing.quantity;
+      data.itemId = listing.catalogId;
+      data.lastReviewTime = static_cast< uint16_t >( std::min< uint32_t >( ( currentTime - listing.listTime ) / 60, 0xFFFF ) );
+      data.hq = listing.isHq;
+      data.marketCity = static_cast< Common::Town >( listing.marketCity );
 
+      strncpy( data.retainerName, listing.retainerName.c_str(), sizeof( data.retainerName ) - 1 );
+    }
+
+    listingPkt->data().listingIndexStart = static_cast< uint8_t >( startIdx );
+    listingPkt->data().listingIndexEnd = endIdx < count ? static_cast< uint8_t >( endIdx ) : 0;
+
+    player.queuePacket( listingPkt );
+
+    startIdx = endIdx;
+  } while( startIdx < count );
 }
 
-void Sapphire::World::Manager::MarketMgr::findItems( const std::string_view& searchStr, uint8_t itemSearchCat,
-                                                     uint8_t maxEquipLevel, uint8_t classJob,
-                                                     Sapphire::World::Manager::MarketMgr::ItemSearchResultList& resultList )
+bool Sapphire::World::Manager::MarketMgr::purchaseListing( Entity::Player& player, uint32_t catalogId,
+                                                           uint64_t listingId )
 {
-  for( const auto& item : m_marketItemCache )
+  auto pListings = getListings( catalogId );
+  if( !pListings )
+    return false;
+
+  auto listingIt = std::find_if( pListings->begin(), pListings->end(), [ listingId ]( const MarketListing& listing )
   {
-    if( item.itemSearchCategory != itemSearchCat )
-      continue;
+    return listing.listingId == listingId;
+  } );
+
+  if( listingIt == pListings->end() )
+    return false;
+
+  // copied, removing the listing invalidates the iterator
+  auto listing = *listingIt;
+
+  auto price = static_cast< uint64_t >( listing.pricePerUnit ) * listing.quantity;
+  auto total = price + price * 5 / 100;
+
+  if( total > UINT32_MAX || player.getCurrency( Common::CurrencyType::Gil ) < total )
+    return false;
+
+  if( !player.addItem( listing.catalogId, listing.quantity, listing.isHq ) )
+    return false;
+
+  player.removeCurrency( Common::CurrencyType::Gil, static_cast< uint32_t >( total ) );
+
+  // todo: the gil of the sale goes to the retainer once retainers are handled
+  removeListing( catalogId, listingId );
+
+  MarketSaleHistoryEntry entry {};
+  entry.buyerName = player.getName();
+  entry.salePrice = listing.pricePerUnit;
+  entry.quantity = listing.quantity;
+  entry.isHq = listing.isHq;
+  addSaleHistoryEntry( catalogId, std::move( entry ) );
+
+  return true;
+}
+
+uint64_t Sapphire::World::Manager::MarketMgr::addListing( MarketListing listing )
+{
+  auto it = m_orderBooks.find( listing.catalogId );
+  if( it == m_orderBooks.end() )
+    return 0;
+
+  listing.listingId = m_nextListingId++;
+  if( listing.listTime == 0 )
+    listing.listTime = Common::Util::getTimeSeconds();
+
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+  auto stmt = db.getPreparedStatement( Db::MARKET_LISTING_INS );
+  stmt->setUInt64( 1, listing.listingId );
+  stmt->setUInt( 2, listing.catalogId );
+  stmt->setUInt64( 3, listing.retainerId );
+  stmt->setUInt64( 4, listing.retainerOwnerId );
+  stmt->setUInt64( 5, listing.artisanId );
+  stmt->setString( 6, listing.retainerName );
+  stmt->setUInt( 7, listing.pricePerUnit );
+  stmt->setUInt( 8, listing.quantity );
+  stmt->setBool( 9, listing.isHq );
+  stmt->setUInt( 10, listing.marketCity );
+  stmt->setUInt( 11, listing.listTime );
+  db.execute( m_pWriteStrand, stmt );
+
+  auto listingId = listing.listingId;
+  insertByPrice( it->second.listings, std::move( listing ) );
+
+  return listingId;
+}
+
+bool Sapphire::World::Manager::MarketMgr::removeListing( uint32_t catalogId, uint64_t listingId )
+{
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return false;
+
+  auto& listings = it->second.listings;
+  auto listingIt = std::find_if( listings.begin(), listings.end(), [ listingId ]( const MarketListing& listing )
+  {
+    return listing.listingId == listingId;
+  } );
+
+  if( listingIt == listings.end() )
+    return false;
+
+  listings.erase( listingIt );
+
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+  auto stmt = db.getPreparedStatement( Db::MARKET_LISTING_DEL );
+  stmt->setUInt64( 1, listingId );
+  db.execute( m_pWriteStrand, stmt );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::MarketMgr::updateListingPrice( uint32_t catalogId, uint64_t listingId,
+                                                              uint32_t pricePerUnit )
+{
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return false;
+
+  auto& listings = it->second.listings;
+  auto listingIt = std::find_if( listings.begin(), listings.end(), [ listingId ]( const MarketListing& listing )
+  {
+    return listing.listingId == listingId;
+  } );
+
+  if( listingIt == listings.end() )
+    return false;
+
+  // move the listing to its new place in the book
+  auto listing = std::move( *listingIt );
+  listings.erase( listingIt );
+
+  listing.pricePerUnit = pricePerUnit;
+  insertByPrice( listings, std::move( listing ) );
+
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+  auto stmt = db.getPreparedStatement( Db::MARKET_LISTING_UP_PRICE );
+  stmt->setUInt( 1, pricePerUnit );
+  stmt->setUInt64( 2, listingId );
+  db.execute( m_pWriteStrand, stmt );
+
+  return true;
+}
+
+void Sapphire::World::Manager::MarketMgr::addSaleHistoryEntry( uint32_t catalogId, MarketSaleHistoryEntry entry )
+{
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return;
+
+  if( entry.purchaseTime == 0 )
+    entry.purchaseTime = Common::Util::getTimeSeconds();
+
+  auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
+  auto stmt = db.getPreparedStatement( Db::MARKET_HISTORY_INS );
+  stmt->setUInt( 1, catalogId );
+  stmt->setString( 2, entry.buyerName );
+  stmt->setUInt( 3, entry.salePrice );
+  stmt->setUInt( 4, entry.quantity );
+  stmt->setBool( 5, entry.isHq );
+  stmt->setBool( 6, entry.onMannequin );
+  stmt->setUInt( 7, entry.purchaseTime );
+  db.execute( m_pWriteStrand, stmt );
+
+  auto& history = it->second.history;
+  history.push_front( std::move( entry ) );
+
+  if( history.size() > MaxSaleHistoryEntries )
+    history.pop_back();
+}
+
+const std::vector< Sapphire::World::Manager::MarketMgr::MarketListing >*
+  Sapphire::World::Manager::MarketMgr::getListings( uint32_t catalogId ) const
+{
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return nullptr;
+
+  return &it->second.listings;
+}
+
+void Sapphire::World::Manager::MarketMgr::insertByPrice( std::vector< MarketListing >& listings,
+                                                         MarketListing listing )
+{
+  auto pos = std::upper_bound( listings.begin(), listings.end(), listing.pricePerUnit,
+                               []( uint32_t price, const MarketListing& other )
+  {
+    return price < other.pricePerUnit;
+  } );
+
+  listings.insert( pos, std::move( listing ) );
+}
+
+uint16_t Sapphire::World::Manager::MarketMgr::getListingCount( uint32_t catalogId ) const
+{
+  auto it = m_orderBooks.find( catalogId );
+  if( it == m_orderBooks.end() )
+    return 0;
+
+  return static_cast< uint16_t >( std::min< std::size_t >( it->second.listings.size(), UINT16_MAX ) );
+}
+
+bool Sapphire::World::Manager::MarketMgr::findItems( const std::string_view& searchStr, uint8_t itemSearchCat,
+                                                     uint8_t maxEquipLevel, uint8_t classJob, uint32_t startIdx,
+                                                     Sapphire::World::Manager::MarketMgr::ItemSearchResultList& resultList ) const
+{
+  const ItemIndexList* pCandidates = nullptr;
+
+  auto nameLen = std::find( searchStr.begin(), searchStr.end(), '\0' ) - searchStr.begin();
+
+  if( nameLen > 0 )
+  {
+    pCandidates = findByNamePrefix( toLowerAscii( searchStr.substr( 0, nameLen ) ) );
+    if( !pCandidates )
+      return false;
+  }
+  else if( classJob > 0 )
+  {
+    auto it = m_itemsByCategoryClassJob.find( ( itemSearchCat << 8 ) | classJob );
+    if( it == m_itemsByCategoryClassJob.end() )
+      return false;
+
+    pCandidates = &it->second;
+  }
+  else
+  {
+    pCandidates = &m_itemsBySearchCategory[ itemSearchCat ];
+  }
+
+  uint32_t matchIdx = 0;
+
+  for( auto itemIdx : *pCandidates )
+  {
+    const auto& item = m_marketItemCache[ itemIdx ];
 
     if( maxEquipLevel > 0 && item.maxEquipLevel > maxEquipLevel )
+    {
+      // the indices are sorted by equip level, nothing after this can match anymore
+      if( nameLen == 0 )
+        break;
+      continue;
+    }
+
+    // a name search is not limited to a single category
+    if( itemSearchCat > 0 && item.itemSearchCategory != itemSearchCat )
       continue;
 
     if( classJob > 0 && item.classJob != classJob )
       continue;
 
-    resultList.push_back( { item.catalogId, 1 } );
+    if( matchIdx++ < startIdx )
+      continue;
+
+    if( resultList.size() == SearchResultsPerPage )
+      return true;
+
+    resultList.push_back( { item.catalogId, getListingCount( item.catalogId ) } );
   }
+
+  return false;
 }
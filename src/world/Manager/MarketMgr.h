@@ -3,17 +3,84 @@
 
 #include "ForwardsZone.h"
 
+#include <array>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+namespace Sapphire::Db
+{
+  class PreparedStatementStrand;
+}
+
 namespace Sapphire::World::Manager
 {
+  /*!
+   * @brief Keeps the marketable items and the order book of every item
+   *
+   * Listings and sales change the order books right away, the database is written asynchronously on a
+   * single strand so an update of a listing never overtakes its insert.
+   */
   class MarketMgr
   {
   public:
-    MarketMgr() = default;
+    struct MarketListing
+    {
+      uint64_t listingId;
+      uint32_t catalogId;
+      uint64_t retainerId;
+      uint64_t retainerOwnerId;
+      uint64_t artisanId;
+      std::string retainerName;
+      uint32_t pricePerUnit;
+      uint32_t quantity;
+      bool isHq;
+      uint8_t marketCity;
+      uint32_t listTime;
+    };
+
+    struct MarketSaleHistoryEntry
+    {
+      std::string buyerName;
+      uint32_t salePrice;
+      uint32_t quantity;
+      bool isHq;
+      bool onMannequin;
+      uint32_t purchaseTime;
+    };
+
+    struct MarketableItem
+    {
+      uint32_t catalogId;
+      uint8_t itemSearchCategory;
+      uint8_t maxEquipLevel;
+      uint16_t itemLevel;
+      uint8_t classJob;
+      std::string name;
+    };
+
+    struct ItemSearchResult
+    {
+      uint32_t catalogId;
+      uint16_t quantity;
+    };
+
+    using ItemSearchResultList = std::vector< ItemSearchResult >;
+    using MarketableItemCacheList = std::vector< MarketableItem >;
+
+    MarketMgr();
 
     bool init();
 
+    /*! replaces the marketable items and builds the search indices, every item starts with an empty order book */
+    void setMarketableItems( MarketableItemCacheList items );
+
+    /*! adds a loaded listing without writing it back, listings of an item have to come cheapest first */
+    bool restoreListing( MarketListing listing );
+
     void searchMarketboard( Entity::Player& player, uint8_t itemSearchCategory,
                                 uint8_t maxEquipLevel, uint8_t classJob,
                                 const std::string_view& searchStr, uint32_t requestId,
@@ -23,32 +90,86 @@ namespace Sapphire::World::Manager
 
     void requestItemListings( Entity::Player& player, uint16_t catalogId );
 
+    /*!
+     * @brief Buys a listing for the player
+     *
+     * The player pays the price of the whole stack and the tax, the items are added to the inventory and the
+     * sale goes into the history of the item.
+     */
+    bool purchaseListing( Entity::Player& player, uint32_t catalogId, uint64_t listingId );
+
+    /*!
+     * @brief Puts a listing up on the market board
+     * @return the id assigned to the listing, 0 if the item is not marketable
+     */
+    uint64_t addListing( MarketListing listing );
+
+    bool removeListing( uint32_t catalogId, uint64_t listingId );
+
+    bool updateListingPrice( uint32_t catalogId, uint64_t listingId, uint32_t pricePerUnit );
+
+    void addSaleHistoryEntry( uint32_t catalogId, MarketSaleHistoryEntry entry );
+
+    /*! gets the listings of an item, cheapest first, nullptr if the item is not marketable */
+    const std::vector< MarketListing >* getListings( uint32_t catalogId ) const;
+
+    /*!
+     * @brief Collects a single page of search results
+     * @return true if there are more results after the page
+     */
+    bool findItems( const std::string_view& searchStr, uint8_t itemSearchCat, uint8_t maxEquipLevel, uint8_t classJob,
+                    uint32_t startIdx, ItemSearchResultList& resultList ) const;
+
   private:
-    struct ItemSearchResult
+    struct ItemOrderBook
     {
-      uint32_t catalogId;
-      uint16_t quantity;
+      // cheapest listing first
+      std::vector< MarketListing > listings;
+      // newest sale first
+      std::deque< MarketSaleHistoryEntry > history;
     };
 
-    struct MarketableItem
+    struct NameTrieNode
     {
-      uint32_t catalogId;
-      uint8_t itemSearchCategory;
-      uint8_t maxEquipLevel;
-      uint16_t itemLevel;
-      uint8_t classJob;
-      std::string name;
+      std::vector< std::pair< char, uint32_t > > children;
+      // indices into m_marketItemCache of every name starting with the prefix of this node, sorted
+      std::vector< uint32_t > items;
     };
 
-    using ItemSearchResultList = std::vector< ItemSearchResult >;
-    using MarketableItemCacheList = std::vector< MarketableItem >;
+    using ItemIndexList = std::vector< uint32_t >;
+
+    static constexpr uint32_t SearchResultsPerPage = 20;
+    static constexpr uint32_t ListingsPerPacket = 10;
+    static constexpr std::size_t MaxSaleHistoryEntries = 20;
 
     MarketableItemCacheList m_marketItemCache;
 
+    // every index list is sorted by equip level so level filters only cut off the tail
+    std::array< ItemIndexList, 256 > m_itemsBySearchCategory;
+    std::unordered_map< uint16_t, ItemIndexList > m_itemsByCategoryClassJob;
+    std::vector< NameTrieNode > m_nameTrie;
+
+    std::unordered_map< uint32_t, ItemOrderBook > m_orderBooks;
+    uint64_t m_nextListingId{ 1 };
+
+    std::shared_ptr< Db::PreparedStatementStrand > m_pWriteStrand;
+
+    void buildIndices();
+
+    void loadOrderBooks();
+
+    void insertName( const std::string& name, uint32_t itemIdx );
+
+    /*! gets the items with a word starting with prefix, nullptr if there are none */
+    const ItemIndexList* findByNamePrefix( const std::string& prefix ) const;
+
+    /*! adds the items below every trie node to the node, a prefix search then only has to find the node */
+    void collectSubtreeNames();
 
+    /*! inserts after every listing with the same price so older listings stay in front */
+    static void insertByPrice( std::vector< MarketListing >& listings, MarketListing listing );
 
-    void findItems( const std::string_view& searchStr, uint8_t itemSearchCat, uint8_t maxEquipLevel, uint8_t classJob,
-                    ItemSearchResultList& resultList );
+    uint16_t getListingCount( uint32_t catalogId ) const;
 
   };
 }
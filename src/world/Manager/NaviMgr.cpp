@@ -1,6 +1,15 @@
 #include "NaviMgr.h"
 #include "Navi/NaviProvider.h"
+#include "Navi/PathWorkerPool.h"
 #include <Logging/Logger.h>
+#include <Service.h>
+
+#include "ServerMgr.h"
+
+Sapphire::World::Manager::NaviMgr::NaviMgr() = default;
+
+// defined here where PathWorkerPool is complete
+Sapphire::World::Manager::NaviMgr::~NaviMgr() = default;
 
 bool Sapphire::World::Manager::NaviMgr::setupTerritory( const std::string& bgPath )
 {
@@ -31,6 +40,32 @@ Sapphire::World::Navi::NaviProviderPtr Sapphire::World::Manager::NaviMgr::getNav
   return nullptr;
 }
 
+Sapphire::World::Navi::PathWorkerPool& Sapphire::World::Manager::NaviMgr::getPathWorkers()
+{
+  if( !m_pPathWorkers )
+  {
+    auto& cfg = Common::Service< World::ServerMgr >::ref().getConfig();
+    auto workerCount = std::max< uint32_t >( 1, cfg.navigation.pathWorkers );
+
+    m_pPathWorkers = std::make_unique< Navi::PathWorkerPool >( workerCount );
+    Logger::info( "Started {0} path workers", workerCount );
+  }
+
+  return *m_pPathWorkers;
+}
+
+void Sapphire::World::Manager::NaviMgr::updateCrowds( uint64_t tickCount )
+{
+  auto dt = m_lastCrowdUpdate == 0 ? 0.f : static_cast< float >( tickCount - m_lastCrowdUpdate ) / 1000.f;
+  m_lastCrowdUpdate = tickCount;
+
+  for( auto& entry : m_naviProviderTerritoryMap )
+  {
+    entry.second->applyPathResults();
+    entry.second->updateCrowd( dt );
+  }
+}
+
 std::string Sapphire::World::Manager::NaviMgr::getBgName( const std::string& bgPath )
 {
   auto findPos = bgPath.find_last_of( '/' );
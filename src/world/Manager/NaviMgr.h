@@ -10,16 +10,30 @@ namespace Sapphire::World::Manager
   class NaviMgr
   {
   public:
-    NaviMgr() = default;
-    virtual ~NaviMgr() = default;
+    NaviMgr();
+    virtual ~NaviMgr();
 
     bool setupTerritory( const std::string& bgPath );
     Navi::NaviProviderPtr getNaviProvider( const std::string& bgPath );
 
+    /*! @brief threads searching the paths of every navmesh, started on first use */
+    Navi::PathWorkerPool& getPathWorkers();
+
+    /*!
+     * @brief Hands the finished paths to their agents and moves the crowd of every navmesh
+     *
+     * Instances of the same territory share a provider, this runs once per server tick before the territories
+     * are updated.
+     */
+    void updateCrowds( uint64_t tickCount );
+
   private:
     std::string getBgName( const std::string& bgPath );
 
     std::unordered_map< std::string, Navi::NaviProviderPtr > m_naviProviderTerritoryMap;
+    uint64_t m_lastCrowdUpdate = 0;
+    // declared last so the workers are stopped before the navmeshes go away
+    Navi::PathWorkerPoolUPtr m_pPathWorkers;
   };
 
 }
@@ -1,9 +1,42 @@
 #include "RNGMgr.h"
 #include <Logging/Logger.h>
 
-Sapphire::World::Manager::RNGMgr::RNGMgr() :
-  m_engine( *engineSeed< std::mt19937::state_size >() )
+// thread streams are kept apart from the territory guids
+static constexpr uint64_t ThreadStreamBase = 1ull << 63;
+
+// picked by the thread itself so it doesn't depend on the order threads start in
+static thread_local uint64_t t_threadStream = 0;
+
+Sapphire::World::Manager::RNGMgr::RNGMgr( uint64_t seed ) :
+  m_seed( seed )
 {
+  if( m_seed == 0 )
+  {
+    std::random_device rd;
+    m_seed = ( static_cast< uint64_t >( rd() ) << 32 ) | rd();
+  }
 
+  Logger::info( "RNGMgr: using seed {0}", m_seed );
 }
 
+uint64_t Sapphire::World::Manager::RNGMgr::getSeed() const
+{
+  return m_seed;
+}
+
+Sapphire::Common::Util::RandomEngine Sapphire::World::Manager::RNGMgr::createEngine( uint64_t stream ) const
+{
+  uint64_t state = m_seed ^ ( stream * 0xD1B54A32D192ED03 );
+  return Common::Util::RandomEngine( Common::Util::RandomEngine::splitMix64( state ) );
+}
+
+void Sapphire::World::Manager::RNGMgr::setThreadStream( uint64_t stream )
+{
+  t_threadStream = stream;
+}
+
+Sapphire::Common::Util::RandomEngine& Sapphire::World::Manager::RNGMgr::getThreadEngine()
+{
+  thread_local auto engine = createEngine( ThreadStreamBase | t_threadStream );
+  return engine;
+}
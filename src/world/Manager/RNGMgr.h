@@ -3,24 +3,26 @@
 
 #include "Forwards.h"
 
-#include <array>
-#include <algorithm>
-#include <chrono>
+#include <Util/RandomEngine.h>
+
 #include <random>
-#include <memory>
 #include <type_traits>
 
 namespace Sapphire::World::Manager
 {
   /*!
    * @brief Generator object that is used on multiple state situations
+   *
+   * Draws from an engine owned by someone else, usually a territory or the calling thread,
+   * and must not outlive it.
    */
   template< typename T, typename = typename std::enable_if< std::is_arithmetic< T >::value, T >::type >
   class RandGenerator
   {
   public:
-    RandGenerator( T minRange = std::numeric_limits< T >::min(), T maxRange = std::numeric_limits< T >::max() )
-      : m_engine( *engineSeed< std::mt19937::state_size >() ), m_dist( minRange, maxRange )
+    RandGenerator( Common::Util::RandomEngine& engine, T minRange = std::numeric_limits< T >::min(),
+                   T maxRange = std::numeric_limits< T >::max() )
+      : m_engine( engine ), m_dist( minRange, maxRange )
     {
 
     }
@@ -30,59 +32,67 @@ namespace Sapphire::World::Manager
       return m_dist( m_engine );
     }
   private:
-    template< std::size_t STATE_SIZE >
-    std::unique_ptr< std::seed_seq > engineSeed()
-    {
-      std::array< uint32_t, STATE_SIZE > seedArray;
-      std::random_device rd;
-
-      std::generate_n( seedArray.data(), seedArray.size(), std::ref( rd ) );
-      auto pSeq = std::make_unique< std::seed_seq >( std::begin( seedArray ), std::end( seedArray ) );
-
-      return pSeq;
-    }
+    using Distribution = typename std::conditional< std::is_integral< T >::value,
+                                                    std::uniform_int_distribution< T >,
+                                                    std::uniform_real_distribution< T > >::type;
 
-    std::uniform_real_distribution< T > m_dist;
-    std::mt19937 m_engine;
+    Common::Util::RandomEngine& m_engine;
+    Distribution m_dist;
   };
 
   class RNGMgr
   {
   public:
-    RNGMgr();
+    /*! @param seed master seed every engine is derived from, 0 picks one from std::random_device */
+    explicit RNGMgr( uint64_t seed = 0 );
     virtual ~RNGMgr() = default;
 
     RNGMgr( const RNGMgr& pRNGMgr ) = delete;
     RNGMgr& operator=( const RNGMgr& pRNGMgr ) = delete;
 
+    uint64_t getSeed() const;
+
+    /*!
+     * @brief Creates an engine for its own stream of numbers
+     *
+     * The same master seed and stream always give the same sequence, territories use their guid
+     * so a replay with the same seed rolls the same numbers.
+     */
+    Common::Util::RandomEngine createEngine( uint64_t stream ) const;
+
+    /*!
+     * @brief Sets the stream the engine of the calling thread is created from
+     *
+     * Has to be called before the thread draws its first number. Threads that never call it use stream 0,
+     * so only one of them should roll anything that has to replay the same way.
+     */
+    static void setThreadStream( uint64_t stream );
+
+    /*! @return the engine of the calling thread, created on first use */
+    Common::Util::RandomEngine& getThreadEngine();
+
     /*!
      * @brief Creates a RNG with specified parameters for multiple uses
      * @tparam Numeric type to be used for the generator
      * @param Minimum value possible for the random value
      * @param Maximum value possible for the random value
-     * @return Random number generator object 
+     * @return Random number generator object drawing from the engine of the calling thread
      */
     template< typename T, typename = typename std::enable_if< std::is_arithmetic< T >::value, T >::type >
     RandGenerator< T > getRandGenerator( T minRange, T maxRange )
     {
-      return RandGenerator< T >( minRange, maxRange );
+      return RandGenerator< T >( getThreadEngine(), minRange, maxRange );
     }
 
-  private:
-
-    template< std::size_t STATE_SIZE >
-    std::unique_ptr< std::seed_seq > engineSeed()
+    /*! @return a RNG drawing from engine, see Territory::getRandomEngine */
+    template< typename T, typename = typename std::enable_if< std::is_arithmetic< T >::value, T >::type >
+    RandGenerator< T > getRandGenerator( Common::Util::RandomEngine& engine, T minRange, T maxRange )
     {
-      std::array< uint32_t, STATE_SIZE > seedArray;
-      std::random_device rd;
-
-      std::generate_n( seedArray.data(), seedArray.size(), std::ref( rd ) );
-      auto pSeq = std::make_unique< std::seed_seq >( std::begin( seedArray ), std::end( seedArray ) );
-
-      return pSeq;
+      return RandGenerator< T >( engine, minRange, maxRange );
     }
 
-    std::mt19937 m_engine;
+  private:
+    uint64_t m_seed;
   };
 
 }
@@ -1,6 +1,7 @@
 #include <Logging/Logger.h>
 #include <Database/DatabaseDef.h>
 #include <Exd/ExdDataGenerated.h>
+#include <Metrics/Metrics.h>
 
 #include "ServerMgr.h"
 
@@ -22,7 +23,8 @@
 #include "NaviMgr.h"
 
 Sapphire::World::Manager::TerritoryMgr::TerritoryMgr() :
-  m_lastInstanceId( 10000 )
+  m_lastInstanceId( 10000 ),
+  m_lastMetricsUpdate( 0 )
 {
 
 }
@@ -513,8 +515,54 @@ Sapphire::TerritoryPtr Sapphire::World::Manager::TerritoryMgr::getZoneByLandSetI
   return zoneMap->second;
 }
 
+void Sapphire::World::Manager::TerritoryMgr::updateMetrics()
+{
+  // counted up front so a scrape never sees a partially summed value
+  std::unordered_map< uint32_t, std::pair< std::size_t, std::size_t > > actorCounts;
+
+  auto countActors = [ &actorCounts ]( const TerritoryPtr& pZone )
+  {
+    auto& counts = actorCounts[ pZone->getTerritoryTypeId() ];
+    counts.first += pZone->getPopCount();
+    counts.second += pZone->getBNpcCount();
+  };
+
+  for( const auto& pZone : m_territorySet )
+    countActors( pZone );
+
+  for( const auto& pZone : m_instanceZoneSet )
+    countActors( pZone );
+
+  for( const auto& entry : actorCounts )
+  {
+    if( m_territoryGauges.count( entry.first ) )
+      continue;
+
+    auto label = "territory=\"" + std::to_string( entry.first ) + "\"";
+    TerritoryGauges gauges{};
+    gauges.pPlayers = &Common::Metrics::Registry::gauge( "sapphire_world_territory_players",
+                                                        "Players in all instances of a territory", label );
+    gauges.pBNpcs = &Common::Metrics::Registry::gauge( "sapphire_world_territory_bnpcs",
+                                                      "Battle npcs in all instances of a territory", label );
+    m_territoryGauges.emplace( entry.first, gauges );
+  }
+
+  // types that lost their last instance drop to zero
+  for( auto& entry : m_territoryGauges )
+  {
+    auto it = actorCounts.find( entry.first );
+    auto players = it != actorCounts.end() ? it->second.first : 0;
+    auto bnpcs = it != actorCounts.end() ? it->second.second : 0;
+
+    entry.second.pPlayers->set( static_cast< int64_t >( players ) );
+    entry.second.pBNpcs->set( static_cast< int64_t >( bnpcs ) );
+  }
+}
+
 void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint64_t tickCount )
 {
+  Common::Service< NaviMgr >::ref().updateCrowds( tickCount );
+
   for( auto& zone : m_territorySet )
   {
     zone->update( tickCount );
@@ -525,6 +573,12 @@ void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint64_t
     zone->update( tickCount );
   }
 
+  if( tickCount - m_lastMetricsUpdate >= 1000 )
+  {
+    m_lastMetricsUpdate = tickCount;
+    updateMetrics();
+  }
+
   // remove internal house zones with nobody in them
   for( auto it = m_landIdentToTerritoryPtrMap.begin(); it != m_landIdentToTerritoryPtrMap.end(); )
   {
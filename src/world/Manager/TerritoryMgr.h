@@ -17,6 +17,11 @@ namespace Sapphire::Data
   using InstanceContentPtr = std::shared_ptr< InstanceContent >;
 }
 
+namespace Sapphire::Common::Metrics
+{
+  class Gauge;
+}
+
 namespace Sapphire::World::Manager
 {
   /*!
@@ -172,6 +177,9 @@ namespace Sapphire::World::Manager
     float getInRangeDistance() const;
 
   private:
+    /*! refreshes the player and bnpc gauges of every territory type, summed over its instances */
+    void updateMetrics();
+
     using TerritoryTypeDetailCache = std::unordered_map< uint16_t, Data::TerritoryTypePtr >;
     using InstanceIdToTerritoryPtrMap = std::unordered_map< uint32_t, TerritoryPtr >;
     using LandSetIdToTerritoryPtrMap = std::unordered_map< uint32_t, TerritoryPtr >;
@@ -229,6 +237,16 @@ namespace Sapphire::World::Manager
     /*! Map used to find a contentFinderConditionID to a questBattle */
     QuestBattleIdToContentFinderCondMap m_questBattleToContentFinderMap;
 
+    struct TerritoryGauges
+    {
+      Common::Metrics::Gauge* pPlayers;
+      Common::Metrics::Gauge* pBNpcs;
+    };
+
+    /*! actor gauges by territory type, created the first time a type has an instance */
+    std::unordered_map< uint32_t, TerritoryGauges > m_territoryGauges;
+    uint64_t m_lastMetricsUpdate;
+
   public:
     /*! returns a list of instanceContent InstanceIds currently active */
     InstanceIdList getInstanceContentIdList( uint16_t instanceContentId ) const;
@@ -104,9 +104,6 @@ const int levelTable[81][6] =
   { 340, 380, 3300, 3600, 569, 569 },
 };
 
-std::random_device CalcStats::dev;
-std::mt19937 CalcStats::rng( dev() );
-std::uniform_int_distribution< std::mt19937::result_type > CalcStats::range100( 0, 99 );
 
 /*
    Class used for battle-related formulas and calculations.
@@ -124,18 +121,129 @@ std::uniform_int_distribution< std::mt19937::result_type > CalcStats::range100(
    Reduce repeated code (more specifically the data we pull from exd)
 */
 
-// 3 Versions. SB and HW are linear, ARR is polynomial.
-// Originally from Player.cpp, calculateStats().
+std::array< LevelStats, Sapphire::Common::MAX_PLAYER_LEVEL + 1 > CalcStats::m_levels{};
+std::vector< ClassJobStats > CalcStats::m_classJobs;
+std::vector< ClassLevelStats > CalcStats::m_classLevels;
 
-float CalcStats::calculateBaseStat( const Chara& chara )
+bool CalcStats::init()
 {
-  float base = 0.0f;
-  uint8_t level = chara.getLevel();
+  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+
+  for( uint8_t level = 0; level <= Common::MAX_PLAYER_LEVEL; ++level )
+  {
+    auto& entry = m_levels[ level ];
+    entry.main = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
+    entry.sub = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
+    entry.div = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+    entry.hp = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::HP ] );
+
+    auto paramGrowthInfo = exdData.get< Sapphire::Data::ParamGrow >( level );
+    entry.valid = static_cast< bool >( paramGrowthInfo );
+    entry.hpModifier = paramGrowthInfo ? paramGrowthInfo->hpModifier : 0;
+    entry.baseSpeed = paramGrowthInfo ? paramGrowthInfo->baseSpeed : 0;
+  }
+
+  auto& classJobIds = exdData.getClassJobIdList();
+  if( classJobIds.empty() )
+  {
+    Logger::error( "CalcStats: ClassJob sheet is empty" );
+    return false;
+  }
+
+  auto classJobCount = *classJobIds.rbegin() + 1;
+  m_classJobs.assign( classJobCount, ClassJobStats{} );
+  m_classLevels.assign( classJobCount * m_levels.size(), ClassLevelStats{} );
+
+  for( auto classJobId : classJobIds )
+  {
+    auto classInfo = exdData.get< Sapphire::Data::ClassJob >( classJobId );
+    if( !classInfo )
+      continue;
+
+    auto& classJob = m_classJobs[ classJobId ];
+    classJob.valid = true;
+    classJob.expArrayIndex = classInfo->expArrayIndex;
+    classJob.classJobParent = classInfo->classJobParent;
+    classJob.primaryStat = static_cast< Common::BaseParam >( classInfo->primaryStat );
+    classJob.modifierHitPoints = classInfo->modifierHitPoints;
+
+    for( uint8_t level = 0; level <= Common::MAX_PLAYER_LEVEL; ++level )
+    {
+      auto& entry = m_classLevels[ classJobId * m_levels.size() + level ];
+      float base = m_levels[ level ].main;
+
+      entry.str = base * ( static_cast< float >( classInfo->modifierStrength ) / 100 );
+      entry.dex = base * ( static_cast< float >( classInfo->modifierDexterity ) / 100 );
+      entry.vit = base * ( static_cast< float >( classInfo->modifierVitality ) / 100 );
+      entry.inte = base * ( static_cast< float >( classInfo->modifierIntelligence ) / 100 );
+      entry.mnd = base * ( static_cast< float >( classInfo->modifierMind ) / 100 );
 
+      // TODO: Replace the level table hp with something that can get us an accurate BaseHP, see calculateMaxHp
+      entry.baseHp = std::floor( classInfo->modifierHitPoints * ( m_levels[ level ].hp / 100.0f ) );
+    }
+  }
+
+  Logger::info( "CalcStats: cached {0} classjobs over {1} levels", classJobIds.size(), m_levels.size() );
+
+  return true;
+}
+
+const LevelStats& CalcStats::getLevelStats( uint8_t level )
+{
   if( level > Common::MAX_PLAYER_LEVEL )
     level = Common::MAX_PLAYER_LEVEL;
 
-  return static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
+  return m_levels[ level ];
+}
+
+const ClassJobStats* CalcStats::getClassJobStats( Common::ClassJob classJob )
+{
+  auto classJobId = static_cast< uint8_t >( classJob );
+
+  if( classJobId >= m_classJobs.size() || !m_classJobs[ classJobId ].valid )
+    return nullptr;
+
+  return &m_classJobs[ classJobId ];
+}
+
+const ClassLevelStats& CalcStats::getClassLevelStats( Common::ClassJob classJob, uint8_t level )
+{
+  static const ClassLevelStats empty{};
+
+  auto classJobId = static_cast< uint8_t >( classJob );
+
+  if( classJobId >= m_classJobs.size() )
+    return empty;
+
+  if( level > Common::MAX_PLAYER_LEVEL )
+    level = Common::MAX_PLAYER_LEVEL;
+
+  return m_classLevels[ classJobId * m_levels.size() + level ];
+}
+
+CombatAttributes CalcStats::calculateAttributes( const Chara& chara )
+{
+  CombatAttributes attributes{};
+
+  attributes.primaryStat = chara.getPrimaryStat();
+  attributes.primaryAttackPower = getPrimaryAttackPower( chara );
+  attributes.weaponDamageBase = weaponDamageBase( chara );
+  attributes.determination = determination( chara );
+  attributes.tenacity = tenacity( chara );
+  attributes.speed = speed( chara );
+  attributes.criticalHitProbability = criticalHitProbability( chara );
+  attributes.criticalHitBonus = criticalHitBonus( chara );
+  attributes.directHitProbability = directHitProbability( chara );
+
+  return attributes;
+}
+
+// 3 Versions. SB and HW are linear, ARR is polynomial.
+// Originally from Player.cpp, calculateStats().
+
+float CalcStats::calculateBaseStat( const Chara& chara )
+{
+  return getLevelStats( chara.getLevel() ).main;
 }
 
 // Leggerless' HP Formula
@@ -143,40 +251,26 @@ float CalcStats::calculateBaseStat( const Chara& chara )
 
 uint32_t CalcStats::calculateMaxHp( PlayerPtr pPlayer )
 {
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
   // TODO: Replace ApproxBaseHP with something that can get us an accurate BaseHP.
   // Is there any way to pull reliable BaseHP without having to manually use a pet for every level, and using the values from a table?
   // More info here: https://docs.google.com/spreadsheets/d/1de06KGT0cNRUvyiXNmjNgcNvzBCCQku7jte5QxEQRbs/edit?usp=sharing
 
-  auto classInfo = exdData.get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( pPlayer->getClass() ) );
-  auto paramGrowthInfo = exdData.get< Sapphire::Data::ParamGrow >( pPlayer->getLevel() );
+  uint8_t level = pPlayer->getLevel();
 
-  if( !classInfo || !paramGrowthInfo )
-    return 0;
+  const auto& levelStats = getLevelStats( level );
 
-  uint8_t level = pPlayer->getLevel();
+  if( !getClassJobStats( pPlayer->getClass() ) || !levelStats.valid )
+    return 0;
 
   auto vitMod = pPlayer->getBonusStat( Common::BaseParam::Vitality );
-  float baseStat = calculateBaseStat( *pPlayer );
+  float baseStat = levelStats.main;
   uint16_t vitStat = static_cast< uint16_t >( pPlayer->getStats().vit ) + static_cast< uint16_t >( vitMod );
-  uint16_t hpMod = paramGrowthInfo->hpModifier;
-  uint16_t jobModHp = classInfo->modifierHitPoints;
-  float approxBaseHp = 0.0f; // Read above
-
-  // These values are not precise.
-  /*
-  if( level >= 60 )
-    approxBaseHp = static_cast< float >( 2600 + ( level - 60 ) * 100 );
-  else if( level >= 50 )
-    approxBaseHp = 1700 + ( ( level - 50 ) * ( 1700 * 1.04325f ) );
-  else
-    approxBaseHp = paramGrowthInfo->mpModifier * 0.7667f;
-  */
-  // just use the table at least better than what it was
-  approxBaseHp = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::HP ] );
+  uint16_t hpMod = levelStats.hpModifier;
 
-  uint16_t result = static_cast< uint16_t >( floor( jobModHp * ( approxBaseHp / 100.0f ) ) +
-                                             floor( hpMod / 100.0f * ( vitStat - baseStat ) ) );
+  // job hp modifier applied to the level table hp, precalculated by init
+  float baseHp = getClassLevelStats( pPlayer->getClass(), level ).baseHp;
+
+  uint16_t result = static_cast< uint16_t >( baseHp + std::floor( hpMod / 100.0f * ( vitStat - baseStat ) ) );
 
   return result;
 }
@@ -185,7 +279,7 @@ float CalcStats::blockProbability( const Chara& chara )
 {
   auto level = chara.getLevel();
   auto blockRate = static_cast< float >( chara.getStatValue( Common::BaseParam::BlockRate ) );
-  auto levelVal =  static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto levelVal =  getLevelStats( level ).div;
 
   return std::floor( ( 30 * blockRate ) / levelVal + 10 );
 }
@@ -197,8 +291,8 @@ float CalcStats::directHitProbability( const Chara& chara )
 
   float dhRate = chara.getStatValue( Common::BaseParam::DirectHitRate );
 
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
-  auto subVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
+  auto divVal = getLevelStats( level ).div;
+  auto subVal = getLevelStats( level ).sub;
 
   return std::floor( 550.f * ( dhRate - subVal ) / divVal ) / 10.f;
 }
@@ -210,8 +304,8 @@ float CalcStats::criticalHitProbability( const Chara& chara )
 
   float chRate = chara.getStatValue( Common::BaseParam::CriticalHit );
 
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
-  auto subVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
+  auto divVal = getLevelStats( level ).div;
+  auto subVal = getLevelStats( level ).sub;
 
   return std::floor( 200.f * ( chRate - subVal ) / divVal + 50.f ) / 10.f;
 }
@@ -250,11 +344,16 @@ float CalcStats::autoAttackPotency( const Sapphire::Entity::Chara& chara )
 }
 
 float CalcStats::weaponDamage( const Sapphire::Entity::Chara& chara, float weaponDamage )
+{
+  return std::floor( weaponDamageBase( chara ) + weaponDamage );
+}
+
+float CalcStats::weaponDamageBase( const Sapphire::Entity::Chara& chara )
 {
   const auto& baseStats = chara.getStats();
   auto level = chara.getLevel();
 
-  auto mainVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
+  auto mainVal = getLevelStats( level ).main;
 
   uint32_t jobAttribute = 1;
 
@@ -278,14 +377,14 @@ float CalcStats::weaponDamage( const Sapphire::Entity::Chara& chara, float weapo
     }
   }
 
-  return std::floor( ( ( mainVal * jobAttribute ) / 1000.f ) + weaponDamage );
+  return ( mainVal * jobAttribute ) / 1000.f;
 }
 
 float CalcStats::calcAttackPower( const Sapphire::Entity::Chara& chara, uint32_t attackPower )
 {
   auto level = chara.getLevel();
-  auto mainVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto mainVal = getLevelStats( level ).main;
+  auto divVal = getLevelStats( level ).div;
 
   // todo: not sure if its ( ap - mv ) / mv or ( ap - mv ) / dv
   return std::floor( ( 125.f * ( attackPower - mainVal ) / divVal ) + 100.f ) / 100.f;
@@ -332,8 +431,8 @@ float CalcStats::determination( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto mainVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto mainVal = getLevelStats( level ).main;
+  auto divVal = getLevelStats( level ).div;
 
   return std::floor( 130.f * ( chara.getStatValue( Common::BaseParam::Determination ) - mainVal ) / divVal + 1000.f ) / 1000.f;
 }
@@ -342,8 +441,8 @@ float CalcStats::tenacity( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto subVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto subVal = getLevelStats( level ).sub;
+  auto divVal = getLevelStats( level ).div;
 
   return std::floor( 100.f * ( chara.getStatValue( Common::BaseParam::Tenacity ) - subVal ) / divVal + 1000.f ) / 1000.f;
 }
@@ -352,8 +451,8 @@ float CalcStats::speed( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto subVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto subVal = getLevelStats( level ).sub;
+  auto divVal = getLevelStats( level ).div;
 
   uint32_t speedVal = 0;
 
@@ -376,8 +475,8 @@ float CalcStats::criticalHitBonus( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto subVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::SUB ] );
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto subVal = getLevelStats( level ).sub;
+  auto divVal = getLevelStats( level ).div;
 
   return std::floor( 200.f * ( chara.getStatValue( Common::BaseParam::CriticalHit ) - subVal ) / divVal + 1400.f ) / 1000.f;
 }
@@ -386,7 +485,7 @@ float CalcStats::physicalDefence( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto divVal = getLevelStats( level ).div;
 
   return std::floor( 15.f * chara.getStatValue( Common::BaseParam::Defense ) ) / 100.f;
 }
@@ -395,7 +494,7 @@ float CalcStats::magicDefence( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
 
-  auto divVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto divVal = getLevelStats( level ).div;
 
   return std::floor( 15.f * chara.getStatValue( Common::BaseParam::MagicDefense ) ) / 100.f;
 }
@@ -404,7 +503,7 @@ float CalcStats::blockStrength( const Sapphire::Entity::Chara& chara )
 {
   auto level = chara.getLevel();
   auto blockStrength = static_cast< float >( chara.getBonusStat( Common::BaseParam::BlockStrength ) );
-  auto levelVal =  static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::DIV ] );
+  auto levelVal =  getLevelStats( level ).div;
 
   return std::floor( ( 30 * blockStrength ) / levelVal + 10 ) / 100.f;
 }
@@ -430,7 +529,7 @@ float CalcStats::autoAttack( const Sapphire::Entity::Chara& chara )
   }
 
   auto level = chara.getLevel();
-  auto mainVal = static_cast< float >( levelTable[ level ][ Common::LevelTableEntry::MAIN ] );
+  auto mainVal = getLevelStats( level ).main;
 
   auto innerCalc = std::floor( ( mainVal * primaryStatValue( chara ) / 1000.f ) + weaponDamage );
 
@@ -447,30 +546,33 @@ std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcAutoA
   // D = ⌊ f(ptc) × f(aa) × f(ap) × f(det) × f(tnc) × traits ⌋ × f(ss) ⌋ ×
   // f(chr) ⌋ × f(dhr) ⌋ × rand[ 0.95, 1.05 ] ⌋ × buff_1 ⌋ × buff... ⌋
 
+  const auto& attributes = chara.getAttributes();
+
   auto pot = autoAttackPotency( chara );
   auto aa = autoAttack( chara );
-  auto ap = getPrimaryAttackPower( chara );
-  auto det = determination( chara );
+  auto ap = attributes.primaryAttackPower;
+  auto det = attributes.determination;
 
   auto ten = 1.f;
   if( chara.getRole() == Common::Role::Tank )
-    ten = tenacity( chara );
+    ten = attributes.tenacity;
 
   // todo: everything after tenacity
   auto factor = std::floor( pot * aa * ap * det * ten );
+  auto& rng = chara.getRandomEngine();
   Sapphire::Common::ActionHitSeverityType hitType = Sapphire::Common::ActionHitSeverityType::NormalDamage;
 
   // todo: traits
 
-  factor = std::floor( factor * speed( chara ) );
+  factor = std::floor( factor * attributes.speed );
 
-  if( criticalHitProbability( chara ) > range100( rng ) )
+  if( attributes.criticalHitProbability > rng.nextUInt( 100 ) )
   {
-    factor *= criticalHitBonus( chara );
+    factor *= attributes.criticalHitBonus;
     hitType = Sapphire::Common::ActionHitSeverityType::CritDamage;
   }
 
-  if( directHitProbability( chara ) > range100( rng ) )
+  if( attributes.directHitProbability > rng.nextUInt( 100 ) )
   {
     factor *= 1.25f;
     hitType = hitType == Sapphire::Common::ActionHitSeverityType::CritDamage ?
@@ -478,7 +580,7 @@ std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcAutoA
                          Sapphire::Common::ActionHitSeverityType::DirectHitDamage;
   }
 
-  factor *= 1.0f + ( ( range100( rng ) - 50.0f ) / 1000.0f );
+  factor *= 1.0f + ( ( rng.nextUInt( 100 ) - 50.0f ) / 1000.0f );
 
   // todo: buffs
 
@@ -501,25 +603,28 @@ std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcActio
   // D = ⌊ f(pot) × f(wd) × f(ap) × f(det) × f(tnc) × traits ⌋
   // × f(chr) ⌋ × f(dhr) ⌋ × rand[ 0.95, 1.05 ] ⌋ buff_1 ⌋ × buff_1 ⌋ × buff... ⌋
 
+  const auto& attributes = chara.getAttributes();
+
   auto pot = potency( static_cast< uint16_t >( ptc ) );
-  auto wd = weaponDamage( chara, wepDmg );
-  auto ap = getPrimaryAttackPower( chara );
-  auto det = determination( chara );
+  auto wd = std::floor( attributes.weaponDamageBase + wepDmg );
+  auto ap = attributes.primaryAttackPower;
+  auto det = attributes.determination;
 
   auto ten = 1.f;
   if( chara.getRole() == Common::Role::Tank )
-    ten = tenacity( chara );
+    ten = attributes.tenacity;
 
   auto factor = std::floor( pot * wd * ap * det * ten );
+  auto& rng = chara.getRandomEngine();
   Sapphire::Common::ActionHitSeverityType hitType = Sapphire::Common::ActionHitSeverityType::NormalDamage;
 
-  if( criticalHitProbability( chara ) > range100( rng ) )
+  if( attributes.criticalHitProbability > rng.nextUInt( 100 ) )
   {
-    factor *= criticalHitBonus( chara );
+    factor *= attributes.criticalHitBonus;
     hitType = Sapphire::Common::ActionHitSeverityType::CritDamage;
   }
 
-  if( directHitProbability( chara ) > range100( rng ) )
+  if( attributes.directHitProbability > rng.nextUInt( 100 ) )
   {
     factor *= 1.25f;
     hitType = hitType == Sapphire::Common::ActionHitSeverityType::CritDamage ?
@@ -527,7 +632,7 @@ std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcActio
                          Sapphire::Common::ActionHitSeverityType::DirectHitDamage;
   }
 
-  factor *= 1.0f + ( ( range100( rng ) - 50.0f ) / 1000.0f );
+  factor *= 1.0f + ( ( rng.nextUInt( 100 ) - 50.0f ) / 1000.0f );
 
   // todo: buffs
 
@@ -548,16 +653,19 @@ std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcActio
 std::pair< float, Sapphire::Common::ActionHitSeverityType > CalcStats::calcActionHealing( const Sapphire::Entity::Chara& chara, uint32_t ptc, float wepDmg )
 {
   // lol just for testing
+  const auto& attributes = chara.getAttributes();
+
   auto factor = std::floor( ptc * ( wepDmg / 10.0f ) + ptc );
+  auto& rng = chara.getRandomEngine();
   Sapphire::Common::ActionHitSeverityType hitType = Sapphire::Common::ActionHitSeverityType::NormalHeal;
 
-  if( criticalHitProbability( chara ) > range100( rng ) )
+  if( attributes.criticalHitProbability > rng.nextUInt( 100 ) )
   {
-    factor *= criticalHitBonus( chara );
+    factor *= attributes.criticalHitBonus;
     hitType = Sapphire::Common::ActionHitSeverityType::CritHeal;
   }
 
-  factor *= 1.0f + ( ( range100( rng ) - 50.0f ) / 1000.0f );
+  factor *= 1.0f + ( ( rng.nextUInt( 100 ) - 50.0f ) / 1000.0f );
 
   return std::pair( factor, hitType );
 }
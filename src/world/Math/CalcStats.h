@@ -1,19 +1,97 @@
 #ifndef _CALCSTATS_H
 #define _CALCSTATS_H
 
-#include <random>
 #include <Common.h>
 #include "Forwards.h"
 
+#include <array>
+#include <vector>
+
 namespace Sapphire::Math
 {
 
+  /*! @brief The level table and ParamGrow values for one level */
+  struct LevelStats
+  {
+    // false if the level has no ParamGrow row
+    bool valid;
+    float main;
+    float sub;
+    float div;
+    float hp;
+    uint16_t hpModifier;
+    int32_t baseSpeed;
+  };
+
+  /*! @brief The ClassJob columns used by the stat and action code */
+  struct ClassJobStats
+  {
+    // false if the class has no ClassJob row
+    bool valid;
+    int8_t expArrayIndex;
+    uint8_t classJobParent;
+    Common::BaseParam primaryStat;
+    uint16_t modifierHitPoints;
+  };
+
+  /*! @brief Values that only depend on class and level */
+  struct ClassLevelStats
+  {
+    // main stat of the level scaled by the class modifiers, without the tribe bonus
+    float str;
+    float dex;
+    float vit;
+    float inte;
+    float mnd;
+    // hp before vitality is taken into account
+    float baseHp;
+  };
+
+  /*!
+   * @brief Everything the damage and healing formulas need from a chara that doesn't change between two actions
+   *
+   * Cached on Chara, see Chara::getAttributes.
+   */
+  struct CombatAttributes
+  {
+    Common::BaseParam primaryStat;
+    float primaryAttackPower;
+    // main stat contribution to weapon damage, the weapon damage itself is added per action
+    float weaponDamageBase;
+    float determination;
+    float tenacity;
+    float speed;
+    float criticalHitProbability;
+    float criticalHitBonus;
+    float directHitProbability;
+    float autoAttackPotency;
+    float autoAttack;
+  };
+
   class CalcStats
   {
   public:
     static const uint32_t AUTO_ATTACK_POTENCY = 110;
     static const uint32_t RANGED_AUTO_ATTACK_POTENCY = 100;
 
+    /*!
+     * @brief Builds the per level and per class tables from the level table and the ClassJob and ParamGrow sheets
+     *
+     * Needs the exd data service, has to run before any stats are calculated.
+     */
+    static bool init();
+
+    /*! @return the values for level, levels above the max player level use the max player level */
+    static const LevelStats& getLevelStats( uint8_t level );
+
+    /*! @return the values for classJob or nullptr if it has no ClassJob row */
+    static const ClassJobStats* getClassJobStats( Common::ClassJob classJob );
+
+    static const ClassLevelStats& getClassLevelStats( Common::ClassJob classJob, uint8_t level );
+
+    /*! @brief Calculates everything in CombatAttributes from the current stats of chara */
+    static CombatAttributes calculateAttributes( const Entity::Chara& chara );
+
     static float calculateBaseStat( const Entity::Chara& chara );
 
     static uint32_t calculateMaxHp( Sapphire::Entity::PlayerPtr pPlayer );
@@ -145,9 +223,14 @@ namespace Sapphire::Math
      */
     static float calcAttackPower( const Sapphire::Entity::Chara& chara, uint32_t attackPower );
 
-    static std::random_device dev;
-    static std::mt19937 rng;
-    static std::uniform_int_distribution< std::mt19937::result_type > range100;
+    /*! @brief The part of weaponDamage that doesn't depend on the weapon */
+    static float weaponDamageBase( const Sapphire::Entity::Chara& chara );
+
+    static std::array< LevelStats, Common::MAX_PLAYER_LEVEL + 1 > m_levels;
+    // indexed by classjob id
+    static std::vector< ClassJobStats > m_classJobs;
+    // indexed by classjob id * ( MAX_PLAYER_LEVEL + 1 ) + level
+    static std::vector< ClassLevelStats > m_classLevels;
   };
 
 }
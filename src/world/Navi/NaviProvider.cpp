@@ -8,15 +8,19 @@
 #include "Actor/BNpc.h"
 
 #include <Manager/RNGMgr.h>
+#include <Manager/NaviMgr.h>
 
 #include "NaviProvider.h"
+#include "PathQueue.h"
 
 #include <recastnavigation/Detour/Include/DetourNavMesh.h>
 #include <recastnavigation/Detour/Include/DetourNavMeshQuery.h>
 #include <DetourCommon.h>
 #include <recastnavigation/Recast/Include/Recast.h>
+#include <algorithm>
 #include <filesystem>
 #include <Service.h>
+#include <Util/Util.h>
 
 Sapphire::World::Navi::NaviProvider::NaviProvider( const std::string& internalName ) :
   m_naviMesh( nullptr ),
@@ -46,7 +50,7 @@ bool Sapphire::World::Navi::NaviProvider::init()
 
     m_pCrowd = std::make_unique< dtCrowd >();
 
-    if( !m_pCrowd->init( 1000, 10.f, m_naviMesh ) )
+    if( !m_pCrowd->init( MAX_AGENTS, 10.f, m_naviMesh ) )
       return false;
 
     dtObstacleAvoidanceParams params;
@@ -87,6 +91,11 @@ bool Sapphire::World::Navi::NaviProvider::init()
 
     initQuery();
 
+    auto& naviMgr = Common::Service< World::Manager::NaviMgr >::ref();
+    m_pPathQueue = std::make_shared< PathQueue >( naviMgr.getPathWorkers(), *m_naviMesh, *m_pCrowd->getFilter( 0 ),
+                                                  m_pCrowd->getQueryExtents(), cfg.navigation.pathCacheSize );
+    m_agentPaths.resize( MAX_AGENTS );
+
     return true;
   }
 
@@ -98,6 +107,11 @@ bool Sapphire::World::Navi::NaviProvider::hasNaviMesh() const
   return m_naviMesh != nullptr;
 }
 
+const dtNavMesh* Sapphire::World::Navi::NaviProvider::getNaviMesh() const
+{
+  return m_naviMesh;
+}
+
 void Sapphire::World::Navi::NaviProvider::initQuery()
 {
   if( m_naviMeshQuery )
@@ -258,7 +272,8 @@ bool Sapphire::World::Navi::NaviProvider::getSteerTarget( dtNavMeshQuery* navQue
 
 static float frand()
 {
-  return ( float ) rand() / (float)RAND_MAX;
+  // detour only takes a plain function pointer, so draw from the engine of the calling thread
+  return Sapphire::Common::Service< Sapphire::World::Manager::RNGMgr >::ref().getThreadEngine().nextFloat();
 }
 
 
@@ -297,8 +312,6 @@ Sapphire::Common::FFXIVARR_POSITION3
     return {};
   }
 
-  auto& RNGMgr = Common::Service< World::Manager::RNGMgr >::ref();
-  auto rng = RNGMgr.getRandGenerator< float >( 0.f, 1.f );
   status = m_naviMeshQuery->findRandomPointAroundCircle( startRef, spos, maxRadius, &filter, frand,
              &randomRef, randomPt );
 
@@ -580,7 +593,9 @@ int32_t Sapphire::World::Navi::NaviProvider::addAgent( Entity::Chara& chara )
   params.updateFlags = 0;
   params.updateFlags |= DT_CROWD_ANTICIPATE_TURNS;
   float position[] = { chara.getPos().x, chara.getPos().y, chara.getPos().z };
-  return m_pCrowd->addAgent( position, &params );
+  auto agentId = m_pCrowd->addAgent( position, &params );
+  resetAgentPath( agentId );
+  return agentId;
 }
 
 void Sapphire::World::Navi::NaviProvider::updateAgentParameters( Entity::BNpc& bnpc )
@@ -610,6 +625,7 @@ void Sapphire::World::Navi::NaviProvider::updateCrowd( float timeInSeconds )
 void Sapphire::World::Navi::NaviProvider::removeAgent( Sapphire::Entity::Chara& chara )
 {
   m_pCrowd->removeAgent( chara.getAgentId() );
+  resetAgentPath( chara.getAgentId() );
 }
 
 void Sapphire::World::Navi::NaviProvider::calcVel( float* vel, const float* pos, const float* tgt, const float speed )
@@ -623,30 +639,90 @@ void Sapphire::World::Navi::NaviProvider::calcVel( float* vel, const float* pos,
 void Sapphire::World::Navi::NaviProvider::setMoveTarget( Entity::Chara& chara,
                                                          const Sapphire::Common::FFXIVARR_POSITION3& endPos )
 {
-  // Find nearest point on navmesh and set move request to that location.
-  dtNavMeshQuery* navquery = m_naviMeshQuery;
+  auto agentId = chara.getAgentId();
 
-  const dtQueryFilter* filter = m_pCrowd->getFilter( 0 );
-  const float* halfExtents = m_pCrowd->getQueryExtents();
+  const dtCrowdAgent* ag = m_pCrowd->getAgent( agentId );
+  if( !ag || !ag->active || agentId >= static_cast< int32_t >( m_agentPaths.size() ) )
+    return;
 
   float p[ 3 ] = { endPos.x, endPos.y, endPos.z };
 
-  dtPolyRef ref;
+  auto& agentPath = m_agentPaths[ agentId ];
 
-  auto status = m_naviMeshQuery->findNearestPoly( p, halfExtents, filter, &ref, nullptr );
-
-  if( !dtStatusSucceed( status ) )
-  {
-    Logger::error( "Failed to find nearest poly for Chara#{} for pos X: {} Y: {} Z: {}",
-                   chara.getId(), endPos.x, endPos.y, endPos.z );
+  // bnpcs ask every tick, don't search again while the target barely moved
+  if( ( agentPath.pending || ag->targetState != DT_CROWDAGENT_TARGET_NONE ) &&
+      inRange( agentPath.target, p, REPATH_DISTANCE, 2.f ) )
+    return;
 
+  // bnpcs chasing an unreachable target would search every tick
+  if( agentPath.failedTime != 0 && Common::Util::getTimeMs() < agentPath.failedTime + FAILED_PATH_RETRY_DELAY &&
+      inRange( agentPath.failedTarget, p, REPATH_DISTANCE, 2.f ) )
     return;
-  }
 
-  const dtCrowdAgent* ag = m_pCrowd->getAgent( chara.getAgentId() );
-  if( ag && ag->active )
+  dtVcopy( agentPath.target, p );
+  agentPath.pending = true;
+  ++agentPath.sequence;
+
+  m_pPathQueue->request( agentId, agentPath.sequence, ag->npos, p );
+}
+
+void Sapphire::World::Navi::NaviProvider::applyPathResults()
+{
+  m_pPathQueue->takeResults( m_pathResults );
+
+  for( const auto& result : m_pathResults )
   {
-    m_pCrowd->requestMoveTarget( chara.getAgentId(), ref, p );
+    auto& agentPath = m_agentPaths[ result.agentId ];
+
+    // the agent asked for another target or was removed in the meantime
+    if( !agentPath.pending || result.sequence != agentPath.sequence )
+      continue;
+
+    agentPath.pending = false;
+
+    dtCrowdAgent* ag = m_pCrowd->getEditableAgent( result.agentId );
+    if( !ag || !ag->active )
+      continue;
+
+    const auto& pCorridor = result.pCorridor;
+    if( !pCorridor )
+    {
+      Logger::debug( "No path for agent#{} to X: {} Y: {} Z: {}",
+                     result.agentId, agentPath.target[ 0 ], agentPath.target[ 1 ], agentPath.target[ 2 ] );
+      agentPath.failedTime = Common::Util::getTimeMs();
+      dtVcopy( agentPath.failedTarget, agentPath.target );
+      continue;
+    }
+
+    agentPath.failedTime = 0;
+
+    // the corridor may come from the cache, end on the target of this request
+    // or, same as the crowd does for partial paths, as close to it as possible
+    float endPos[ 3 ];
+    if( dtStatusFailed( m_naviMeshQuery->closestPointOnPoly( pCorridor->endRef, agentPath.target, endPos, nullptr ) ) )
+      continue;
+
+    // the agent kept moving while the search ran, continue the corridor from the poly it is on now
+    auto firstPoly = ag->corridor.getFirstPoly();
+    auto it = std::find( pCorridor->polys.begin(), pCorridor->polys.end(), firstPoly );
+
+    if( it == pCorridor->polys.end() )
+    {
+      // left the corridor already, let the crowd search from where it is
+      m_pCrowd->requestMoveTarget( result.agentId, pCorridor->endRef, endPos );
+      continue;
+    }
+
+    auto count = static_cast< int32_t >( std::distance( it, pCorridor->polys.end() ) );
+    ag->corridor.setCorridor( endPos, &*it, count );
+
+    ag->partial = pCorridor->partial;
+    ag->targetRef = pCorridor->endRef;
+    dtVcopy( ag->targetPos, endPos );
+    ag->targetPathqRef = DT_PATHQ_INVALID;
+    ag->targetReplan = false;
+    ag->targetReplanTime = 0;
+    ag->targetState = DT_CROWDAGENT_TARGET_VALID;
   }
 }
 
@@ -674,6 +750,18 @@ bool Sapphire::World::Navi::NaviProvider::hasTargetState( Entity::Chara& chara )
 void Sapphire::World::Navi::NaviProvider::resetMoveTarget( Entity::Chara& chara )
 {
   m_pCrowd->resetMoveTarget( chara.getAgentId() );
+  resetAgentPath( chara.getAgentId() );
+}
+
+void Sapphire::World::Navi::NaviProvider::resetAgentPath( int32_t agentId )
+{
+  if( agentId < 0 || agentId >= static_cast< int32_t >( m_agentPaths.size() ) )
+    return;
+
+  auto& agentPath = m_agentPaths[ agentId ];
+  ++agentPath.sequence;
+  agentPath.pending = false;
+  agentPath.failedTime = 0;
 }
 
 void Sapphire::World::Navi::NaviProvider::updateAgentPosition( Entity::Chara& chara )
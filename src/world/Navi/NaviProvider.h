@@ -7,10 +7,17 @@
 #include <recastnavigation/Detour/Include/DetourNavMeshQuery.h>
 #include <recastnavigation/DetourCrowd/Include/DetourCrowd.h>
 
+#include "PathQueue.h"
+
 namespace Sapphire::World::Navi
 {
   const int32_t MAX_POLYS = 32;
   const int32_t MAX_SMOOTH = 2048;
+  const int32_t MAX_AGENTS = 1000;
+  // a new move target closer than this to the pending or current one is ignored
+  const float REPATH_DISTANCE = 1.f;
+  // a target without a path is not searched again for this long, in ms
+  const uint64_t FAILED_PATH_RETRY_DELAY = 2000;
 
   const int32_t NAVMESHSET_MAGIC = 'M' << 24 | 'S' << 16 | 'E' << 8 | 'T'; //'MSET'
   const int32_t NAVMESHSET_VERSION = 1;
@@ -48,6 +55,8 @@ namespace Sapphire::World::Navi
 
     bool hasNaviMesh() const;
 
+    const dtNavMesh* getNaviMesh() const;
+
     int32_t addAgent( Entity::Chara& chara );
 
     void removeAgent( Entity::Chara& chara );
@@ -56,8 +65,16 @@ namespace Sapphire::World::Navi
 
     static void calcVel( float* vel, const float* pos, const float* tgt, const float speed );
 
+    /*!
+     * @brief Queues a path search to endPos for the agent of chara
+     *
+     * The search runs on a path worker, the agent starts moving once applyPathResults picked up the corridor.
+     */
     void setMoveTarget( Entity::Chara& chara, const Common::FFXIVARR_POSITION3& endPos );
 
+    /*! @brief hands the corridors found since the last tick to their agents, call before updateCrowd */
+    void applyPathResults();
+
     Common::FFXIVARR_POSITION3 getMovePos( Entity::Chara& chara );
 
     bool isAgentActive( Entity::Chara& chara ) const;
@@ -85,6 +102,23 @@ namespace Sapphire::World::Navi
     float m_polyFindRange[ 3 ];
 
   private:
+    struct AgentPath
+    {
+      // bumped on every request, results with an older sequence are dropped
+      uint32_t sequence;
+      bool pending;
+      float target[ 3 ];
+      // last target without a path, 0 if there is none
+      uint64_t failedTime;
+      float failedTarget[ 3 ];
+    };
+
+    void resetAgentPath( int32_t agentId );
+
+    PathQueuePtr m_pPathQueue;
+    std::vector< AgentPath > m_agentPaths;
+    std::vector< PathQueue::Result > m_pathResults;
+
     int32_t fixupCorridor( dtPolyRef* path, int32_t npath, int32_t maxPath, const dtPolyRef* visited, int32_t nvisited );
     int32_t fixupShortcuts( dtPolyRef* path, int32_t npath, dtNavMeshQuery* navQuery );
     inline bool inRange( const float* v1, const float* v2, const float r, const float h );
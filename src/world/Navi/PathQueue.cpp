@@ -0,0 +1,246 @@
+#include "PathQueue.h"
+#include "PathWorkerPool.h"
+
+#include <Metrics/Metrics.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+Sapphire::World::Navi::PathQueue::PathQueue( PathWorkerPool& workers, const dtNavMesh& naviMesh,
+                                             const dtQueryFilter& filter, const float* halfExtents,
+                                             size_t cacheSize ) :
+  m_workers( workers ),
+  m_naviMesh( naviMesh ),
+  m_filter( filter ),
+  m_scheduled( false ),
+  m_cacheSize( cacheSize ),
+  m_searchCount( Common::Metrics::Registry::counter( "sapphire_world_path_searches",
+                                                     "Corridor searches run by the path workers" ) ),
+  m_cacheHits( Common::Metrics::Registry::counter( "sapphire_world_path_cache_hits",
+                                                   "Corridor requests answered from the path cache" ) ),
+  m_searchTime( Common::Metrics::Registry::histogram( "sapphire_world_path_search_us",
+                                                      "Time of a corridor search in microseconds" ) )
+{
+  std::copy( halfExtents, halfExtents + 3, m_halfExtents );
+}
+
+void Sapphire::World::Navi::PathQueue::request( int32_t agentId, uint32_t sequence,
+                                                const float* startPos, const float* endPos )
+{
+  if( auto pCorridor = findCached( makeCacheKey( startPos, endPos ) ) )
+  {
+    m_cacheHits.inc();
+
+    std::lock_guard< std::mutex > lock( m_resultMutex );
+    m_results.push_back( { agentId, sequence, std::move( pCorridor ) } );
+    return;
+  }
+
+  bool schedule = false;
+
+  {
+    std::lock_guard< std::mutex > lock( m_requestMutex );
+
+    auto it = m_requests.find( agentId );
+    if( it == m_requests.end() )
+    {
+      it = m_requests.emplace( agentId, Request{} ).first;
+      m_requestOrder.push_back( agentId );
+    }
+
+    auto& request = it->second;
+    request.agentId = agentId;
+    request.sequence = sequence;
+    std::copy( startPos, startPos + 3, request.startPos );
+    std::copy( endPos, endPos + 3, request.endPos );
+
+    if( !m_scheduled )
+    {
+      m_scheduled = true;
+      schedule = true;
+    }
+  }
+
+  if( schedule )
+    m_workers.schedule( shared_from_this() );
+}
+
+void Sapphire::World::Navi::PathQueue::takeResults( std::vector< Result >& results )
+{
+  results.clear();
+
+  std::lock_guard< std::mutex > lock( m_resultMutex );
+  std::swap( results, m_results );
+}
+
+const dtNavMesh& Sapphire::World::Navi::PathQueue::getNaviMesh() const
+{
+  return m_naviMesh;
+}
+
+void Sapphire::World::Navi::PathQueue::process( dtNavMeshQuery& query )
+{
+  std::vector< Request > batch;
+  batch.reserve( BATCH_SIZE );
+
+  bool reschedule = false;
+
+  {
+    std::lock_guard< std::mutex > lock( m_requestMutex );
+
+    while( batch.size() < BATCH_SIZE && !m_requestOrder.empty() )
+    {
+      auto it = m_requests.find( m_requestOrder.front() );
+      m_requestOrder.pop_front();
+
+      batch.push_back( it->second );
+      m_requests.erase( it );
+    }
+
+    // let another worker start on the rest while this one searches
+    reschedule = !m_requestOrder.empty();
+    m_scheduled = reschedule;
+  }
+
+  if( reschedule )
+    m_workers.schedule( shared_from_this() );
+
+  std::vector< Result > results;
+  results.reserve( batch.size() );
+
+  for( const auto& request : batch )
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    auto pCorridor = search( query, request );
+
+    m_searchCount.inc();
+    m_searchTime.record( static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+      std::chrono::steady_clock::now() - start ).count() ) );
+
+    if( pCorridor )
+      addCached( makeCacheKey( request.startPos, request.endPos ), pCorridor );
+
+    results.push_back( { request.agentId, request.sequence, std::move( pCorridor ) } );
+  }
+
+  std::lock_guard< std::mutex > lock( m_resultMutex );
+  m_results.insert( m_results.end(), std::make_move_iterator( results.begin() ),
+                    std::make_move_iterator( results.end() ) );
+}
+
+void Sapphire::World::Navi::PathQueue::discard()
+{
+  std::vector< Result > results;
+
+  {
+    std::lock_guard< std::mutex > lock( m_requestMutex );
+
+    for( auto agentId : m_requestOrder )
+    {
+      const auto& request = m_requests[ agentId ];
+      results.push_back( { request.agentId, request.sequence, nullptr } );
+    }
+
+    m_requestOrder.clear();
+    m_requests.clear();
+    m_scheduled = false;
+  }
+
+  std::lock_guard< std::mutex > lock( m_resultMutex );
+  m_results.insert( m_results.end(), std::make_move_iterator( results.begin() ),
+                    std::make_move_iterator( results.end() ) );
+}
+
+Sapphire::World::Navi::PathQueue::CorridorPtr
+  Sapphire::World::Navi::PathQueue::search( dtNavMeshQuery& query, const Request& request ) const
+{
+  dtPolyRef startRef = 0;
+  dtPolyRef endRef = 0;
+
+  query.findNearestPoly( request.startPos, m_halfExtents, &m_filter, &startRef, nullptr );
+  query.findNearestPoly( request.endPos, m_halfExtents, &m_filter, &endRef, nullptr );
+
+  // Couldn't find any close polys to navigate from
+  if( !startRef || !endRef )
+    return nullptr;
+
+  dtPolyRef polys[ MAX_PATH_POLYS ];
+  int32_t numPolys = 0;
+
+  auto status = query.findPath( startRef, endRef, request.startPos, request.endPos, &m_filter,
+                                polys, &numPolys, MAX_PATH_POLYS );
+
+  if( dtStatusFailed( status ) || numPolys == 0 )
+    return nullptr;
+
+  auto pCorridor = std::make_shared< Corridor >();
+  pCorridor->polys.assign( polys, polys + numPolys );
+  pCorridor->endRef = polys[ numPolys - 1 ];
+  pCorridor->partial = pCorridor->endRef != endRef;
+
+  return pCorridor;
+}
+
+Sapphire::World::Navi::PathQueue::CacheKey
+  Sapphire::World::Navi::PathQueue::makeCacheKey( const float* startPos, const float* endPos )
+{
+  CacheKey key;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    key.cells[ i ] = static_cast< int32_t >( std::floor( startPos[ i ] / CACHE_CELL_SIZE ) );
+    key.cells[ i + 3 ] = static_cast< int32_t >( std::floor( endPos[ i ] / CACHE_CELL_SIZE ) );
+  }
+
+  return key;
+}
+
+size_t Sapphire::World::Navi::PathQueue::CacheKeyHash::operator()( const CacheKey& key ) const
+{
+  size_t hash = 0;
+
+  for( auto cell : key.cells )
+    hash = hash * 31 + std::hash< int32_t >()( cell );
+
+  return hash;
+}
+
+Sapphire::World::Navi::PathQueue::CorridorPtr Sapphire::World::Navi::PathQueue::findCached( const CacheKey& key )
+{
+  std::lock_guard< std::mutex > lock( m_cacheMutex );
+
+  auto it = m_cache.find( key );
+  if( it == m_cache.end() )
+    return nullptr;
+
+  m_cacheList.splice( m_cacheList.begin(), m_cacheList, it->second );
+
+  return it->second->second;
+}
+
+void Sapphire::World::Navi::PathQueue::addCached( const CacheKey& key, CorridorPtr pCorridor )
+{
+  if( m_cacheSize == 0 )
+    return;
+
+  std::lock_guard< std::mutex > lock( m_cacheMutex );
+
+  auto it = m_cache.find( key );
+  if( it != m_cache.end() )
+  {
+    it->second->second = std::move( pCorridor );
+    m_cacheList.splice( m_cacheList.begin(), m_cacheList, it->second );
+    return;
+  }
+
+  m_cacheList.emplace_front( key, std::move( pCorridor ) );
+  m_cache.emplace( key, m_cacheList.begin() );
+
+  if( m_cache.size() > m_cacheSize )
+  {
+    m_cache.erase( m_cacheList.back().first );
+    m_cacheList.pop_back();
+  }
+}
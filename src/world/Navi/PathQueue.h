@@ -0,0 +1,146 @@
+#ifndef SAPPHIRE_PATHQUEUE_H
+#define SAPPHIRE_PATHQUEUE_H
+
+#include "ForwardsZone.h"
+
+#include <recastnavigation/Detour/Include/DetourNavMesh.h>
+#include <recastnavigation/Detour/Include/DetourNavMeshQuery.h>
+
+#include <array>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Common::Metrics
+{
+  class Counter;
+  class Histogram;
+}
+
+namespace Sapphire::World::Navi
+{
+  /*!
+   * @brief Queue of corridor searches for the crowd agents of one navmesh
+   *
+   * The searches run on the threads of a PathWorkerPool, each with its own dtNavMeshQuery. The navmesh is never
+   * modified once loaded, so they can run next to the crowd update of the territory. Finished corridors are picked
+   * up by the territory on its next tick through takeResults.
+   *
+   * Corridors are cached by the cells their start and end position fall into, a cache hit skips the workers. Only
+   * the polys are cached, the exact end position is up to the requester since it differs inside a cell.
+   */
+  class PathQueue : public std::enable_shared_from_this< PathQueue >
+  {
+  public:
+    // has to stay below the corridor size of the crowd agents
+    static const int32_t MAX_PATH_POLYS = 128;
+    // searches a worker takes at once before it looks for other work
+    static const size_t BATCH_SIZE = 16;
+    // size of the cells used as cache key, in yalms
+    static constexpr float CACHE_CELL_SIZE = 1.f;
+
+    struct Corridor
+    {
+      std::vector< dtPolyRef > polys;
+      // last poly of the corridor
+      dtPolyRef endRef;
+      // the poly of the requested end wasn't reachable, endRef is the closest reachable one
+      bool partial;
+    };
+
+    using CorridorPtr = std::shared_ptr< const Corridor >;
+
+    struct Request
+    {
+      int32_t agentId;
+      uint32_t sequence;
+      float startPos[ 3 ];
+      float endPos[ 3 ];
+    };
+
+    struct Result
+    {
+      int32_t agentId;
+      uint32_t sequence;
+      // nullptr if there is no path
+      CorridorPtr pCorridor;
+    };
+
+    PathQueue( PathWorkerPool& workers, const dtNavMesh& naviMesh, const dtQueryFilter& filter,
+               const float* halfExtents, size_t cacheSize );
+
+    /*!
+     * @brief Queues a search from startPos to endPos
+     *
+     * Replaces the search of the same agent if no worker picked it up yet, sequence is handed back with the result.
+     */
+    void request( int32_t agentId, uint32_t sequence, const float* startPos, const float* endPos );
+
+    /*! moves every result finished since the last call into results */
+    void takeResults( std::vector< Result >& results );
+
+    const dtNavMesh& getNaviMesh() const;
+
+    /*! called by the workers, runs one batch of searches with query */
+    void process( dtNavMeshQuery& query );
+
+    /*! called by the workers if they can't search, every queued search ends without a path */
+    void discard();
+
+  private:
+    struct CacheKey
+    {
+      std::array< int32_t, 6 > cells;
+
+      bool operator==( const CacheKey& other ) const
+      {
+        return cells == other.cells;
+      }
+    };
+
+    struct CacheKeyHash
+    {
+      size_t operator()( const CacheKey& key ) const;
+    };
+
+    using CacheList = std::list< std::pair< CacheKey, CorridorPtr > >;
+
+    static CacheKey makeCacheKey( const float* startPos, const float* endPos );
+
+    CorridorPtr search( dtNavMeshQuery& query, const Request& request ) const;
+
+    CorridorPtr findCached( const CacheKey& key );
+    void addCached( const CacheKey& key, CorridorPtr pCorridor );
+
+    PathWorkerPool& m_workers;
+    const dtNavMesh& m_naviMesh;
+    dtQueryFilter m_filter;
+    float m_halfExtents[ 3 ];
+
+    std::mutex m_requestMutex;
+    // agents in the order they asked, the latest request of every agent is kept in m_requests
+    std::deque< int32_t > m_requestOrder;
+    std::unordered_map< int32_t, Request > m_requests;
+    // waiting in the queue of the worker pool
+    bool m_scheduled;
+
+    std::mutex m_resultMutex;
+    std::vector< Result > m_results;
+
+    std::mutex m_cacheMutex;
+    size_t m_cacheSize;
+    // most recently used first
+    CacheList m_cacheList;
+    std::unordered_map< CacheKey, CacheList::iterator, CacheKeyHash > m_cache;
+
+    Common::Metrics::Counter& m_searchCount;
+    Common::Metrics::Counter& m_cacheHits;
+    Common::Metrics::Histogram& m_searchTime;
+  };
+
+}
+
+#endif // SAPPHIRE_PATHQUEUE_H
@@ -0,0 +1,63 @@
+#include "PathWorkerPool.h"
+#include "PathQueue.h"
+
+#include <recastnavigation/Detour/Include/DetourNavMeshQuery.h>
+#include <Logging/Logger.h>
+
+#include <unordered_map>
+
+Sapphire::World::Navi::PathWorkerPool::PathWorkerPool( uint32_t workerCount ) :
+  m_cancelationToken( false )
+{
+  for( uint32_t i = 0; i < workerCount; ++i )
+    m_workerThreads.emplace_back( &PathWorkerPool::workerThread, this );
+}
+
+Sapphire::World::Navi::PathWorkerPool::~PathWorkerPool()
+{
+  m_cancelationToken = true;
+  m_queue.cancel();
+
+  for( auto& thread : m_workerThreads )
+    thread.join();
+}
+
+void Sapphire::World::Navi::PathWorkerPool::schedule( PathQueuePtr pQueue )
+{
+  m_queue.push( pQueue );
+}
+
+void Sapphire::World::Navi::PathWorkerPool::workerThread()
+{
+  // a query is bound to one navmesh, keep one for every navmesh this worker searched on
+  std::unordered_map< const dtNavMesh*, dtNavMeshQuery* > queries;
+
+  while( true )
+  {
+    PathQueuePtr pQueue;
+
+    m_queue.waitAndPop( pQueue );
+
+    if( m_cancelationToken || !pQueue )
+      break;
+
+    auto& pQuery = queries[ &pQueue->getNaviMesh() ];
+    if( !pQuery )
+    {
+      pQuery = dtAllocNavMeshQuery();
+      if( !pQuery || dtStatusFailed( pQuery->init( &pQueue->getNaviMesh(), 2048 ) ) )
+      {
+        Logger::error( "PathWorkerPool: Could not init navmesh query" );
+        dtFreeNavMeshQuery( pQuery );
+        queries.erase( &pQueue->getNaviMesh() );
+        pQueue->discard();
+        continue;
+      }
+    }
+
+    pQueue->process( *pQuery );
+  }
+
+  for( auto& entry : queries )
+    dtFreeNavMeshQuery( entry.second );
+}
@@ -0,0 +1,45 @@
+#ifndef SAPPHIRE_PATHWORKERPOOL_H
+#define SAPPHIRE_PATHWORKERPOOL_H
+
+#include "ForwardsZone.h"
+
+#include <Util/LockedWaitQueue.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Sapphire::World::Navi
+{
+  /*!
+   * @brief Threads running the searches of every PathQueue
+   *
+   * Shared by all navmeshes so the thread count doesn't grow with the number of loaded meshes. A queue with
+   * pending searches is scheduled once, the worker that takes it reschedules it if there is more than one batch.
+   */
+  class PathWorkerPool
+  {
+  public:
+    explicit PathWorkerPool( uint32_t workerCount );
+
+    ~PathWorkerPool();
+
+    void schedule( PathQueuePtr pQueue );
+
+  private:
+    void workerThread();
+
+    Common::Util::LockedWaitQueue< PathQueuePtr > m_queue;
+
+    std::vector< std::thread > m_workerThreads;
+
+    std::atomic< bool > m_cancelationToken;
+
+    PathWorkerPool( PathWorkerPool const& right ) = delete;
+
+    PathWorkerPool& operator=( PathWorkerPool const& right ) = delete;
+  };
+
+}
+
+#endif // SAPPHIRE_PATHWORKERPOOL_H
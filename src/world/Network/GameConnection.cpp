@@ -2,11 +2,14 @@
 #include <Network/CommonNetwork.h>
 #include <Util/Util.h>
 #include <Logging/Logger.h>
+#include <chrono>
+#include <mutex>
 #include <utility>
 
 #include <Network/Acceptor.h>
 #include <Network/PacketContainer.h>
 #include <Network/GamePacketParser.h>
+#include <Metrics/Metrics.h>
 #include <Service.h>
 
 #include "Territory/Territory.h"
@@ -24,22 +27,51 @@ using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
 
+Sapphire::Network::GameConnection::HandlerTable Sapphire::Network::GameConnection::s_zoneHandlers;
+Sapphire::Network::GameConnection::HandlerTable Sapphire::Network::GameConnection::s_chatHandlers;
+
+namespace
+{
+  Metrics::OpcodeCounters& getInTraffic( Sapphire::Network::ConnectionType type )
+  {
+    static auto& zone = Metrics::Registry::opcodeCounters( "sapphire_world_in", "Inbound ipc traffic by opcode",
+                                                           "connection=\"zone\"" );
+    static auto& chat = Metrics::Registry::opcodeCounters( "sapphire_world_in", "Inbound ipc traffic by opcode",
+                                                           "connection=\"chat\"" );
+    return type == Sapphire::Network::ConnectionType::Chat ? chat : zone;
+  }
+
+  Metrics::OpcodeCounters& getOutTraffic( Sapphire::Network::ConnectionType type )
+  {
+    static auto& zone = Metrics::Registry::opcodeCounters( "sapphire_world_out", "Outbound ipc traffic by opcode",
+                                                           "connection=\"zone\"" );
+    static auto& chat = Metrics::Registry::opcodeCounters( "sapphire_world_out", "Outbound ipc traffic by opcode",
+                                                           "connection=\"chat\"" );
+    return type == Sapphire::Network::ConnectionType::Chat ? chat : zone;
+  }
+}
+
 Sapphire::Network::GameConnection::GameConnection( Sapphire::Network::HivePtr pHive,
                                                    Sapphire::Network::AcceptorPtr pAcceptor ) :
   Connection( pHive ),
   m_pAcceptor( pAcceptor ),
   m_conType( ConnectionType::None )
 {
-  auto setZoneHandler = [ = ]( uint16_t opcode, std::string handlerName, GameConnection::Handler pHandler )
+  // the tables are shared, only the first connection fills them
+  static std::once_flag handlersRegistered;
+  std::call_once( handlersRegistered, &GameConnection::registerHandlers );
+}
+
+void Sapphire::Network::GameConnection::registerHandlers()
+{
+  auto setZoneHandler = []( uint16_t opcode, const char* handlerName, GameConnection::Handler pHandler )
   {
-    m_zoneHandlerMap[ opcode ] = pHandler;
-    m_zoneHandlerStrMap[ opcode ] = handlerName;
+    s_zoneHandlers.set( opcode, handlerName, pHandler );
   };
 
-  auto setChatHandler = [ = ]( uint16_t opcode, std::string handlerName, GameConnection::Handler pHandler )
+  auto setChatHandler = []( uint16_t opcode, const char* handlerName, GameConnection::Handler pHandler )
   {
-    m_chatHandlerMap[ opcode ] = pHandler;
-    m_chatHandlerStrMap[ opcode ] = handlerName;
+    s_chatHandlers.set( opcode, handlerName, pHandler );
   };
 
   setZoneHandler( ClientZoneIpcType::PingHandler, "PingHandler", &GameConnection::pingHandler );
@@ -136,6 +168,69 @@ Sapphire::Network::GameConnection::GameConnection( Sapphire::Network::HivePtr pH
 
   setChatHandler( ClientChatIpcType::TellReq, "TellReq", &GameConnection::tellHandler );
 
+  // nothing else waits on these, handled ahead of the packets queued before them
+  s_zoneHandlers.setPriority( ClientZoneIpcType::PingHandler, PacketPriority::High );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::LogoutHandler, PacketPriority::High );
+
+  // cosmetic or informational, handled last and dropped first when a client floods the server
+  s_zoneHandlers.setPriority( ClientZoneIpcType::ChatHandler, PacketPriority::Low );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::SetSearchInfoHandler, PacketPriority::Low );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::ReqSearchInfoHandler, PacketPriority::Low );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::ReqExamineSearchCommentHandler, PacketPriority::Low );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::PerformNoteHandler, PacketPriority::Low );
+  s_zoneHandlers.setPriority( ClientZoneIpcType::MarketBoardSearch, PacketPriority::Low );
+}
+
+void Sapphire::Network::GameConnection::HandlerTable::set( uint16_t opcode, const char* name, Handler pHandler )
+{
+  if( slots[ opcode ] != 0 )
+  {
+    auto& descriptor = descriptors[ slots[ opcode ] - 1 ];
+    descriptor.pHandler = pHandler;
+    descriptor.name = name;
+    return;
+  }
+
+  assert( descriptors.size() < UINT8_MAX );
+
+  auto& descriptor = descriptors.emplace_back();
+  descriptor.pHandler = pHandler;
+  descriptor.name = name;
+  descriptor.opcode = opcode;
+  descriptor.priority = PacketPriority::Normal;
+  descriptor.callCount = 0;
+  descriptor.totalTimeUs = 0;
+
+  slots[ opcode ] = static_cast< uint8_t >( descriptors.size() );
+}
+
+void Sapphire::Network::GameConnection::HandlerTable::setPriority( uint16_t opcode, PacketPriority priority )
+{
+  if( auto pHandler = find( opcode ) )
+    pHandler->priority = priority;
+}
+
+Sapphire::Network::GameConnection::HandlerDescriptor*
+  Sapphire::Network::GameConnection::HandlerTable::find( uint16_t opcode )
+{
+  auto slot = slots[ opcode ];
+  return slot != 0 ? &descriptors[ slot - 1 ] : nullptr;
+}
+
+std::vector< Sapphire::Network::PacketHandlerStats >
+  Sapphire::Network::GameConnection::getHandlerStats( ConnectionType type )
+{
+  std::vector< PacketHandlerStats > stats;
+
+  auto& table = type == ConnectionType::Chat ? s_chatHandlers : s_zoneHandlers;
+  for( const auto& descriptor : table.descriptors )
+  {
+    stats.push_back( { descriptor.opcode, descriptor.name,
+                       descriptor.callCount.load( std::memory_order_relaxed ),
+                       descriptor.totalTimeUs.load( std::memory_order_relaxed ) } );
+  }
+
+  return stats;
 }
 
 Sapphire::Network::GameConnection::~GameConnection() = default;
@@ -200,6 +295,9 @@ void Sapphire::Network::GameConnection::onError( const asio::error_code& error )
 
 void Sapphire::Network::GameConnection::queueInPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW inPacket )
 {
+  if( inPacket.data.size() >= 4 )
+    getInTraffic( m_conType ).add( *reinterpret_cast< uint16_t* >( &inPacket.data[ 0x02 ] ), inPacket.segHdr.size );
+
   m_inQueue.push( inPacket );
 }
 
@@ -208,48 +306,55 @@ void Sapphire::Network::GameConnection::queueOutPacket( Sapphire::Network::Packe
   m_outQueue.push( outPacket );
 }
 
+void Sapphire::Network::GameConnection::dispatch( HandlerDescriptor& handler,
+                                                  Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
+{
+  auto start = std::chrono::steady_clock::now();
+
+  ( this->*( handler.pHandler ) )( pPacket, *m_pSession->getPlayer() );
+
+  auto elapsed = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - start );
+
+  handler.callCount.fetch_add( 1, std::memory_order_relaxed );
+  handler.totalTimeUs.fetch_add( static_cast< uint64_t >( elapsed.count() ), std::memory_order_relaxed );
+}
+
 void Sapphire::Network::GameConnection::handleZonePacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
-  auto it = m_zoneHandlerMap.find( opcode );
+  auto pHandler = s_zoneHandlers.find( opcode );
 
-  if( it != m_zoneHandlerMap.end() )
+  if( pHandler )
   {
-    auto itStr = m_zoneHandlerStrMap.find( opcode );
-    std::string name = itStr != m_zoneHandlerStrMap.end() ? itStr->second : "unknown";
     // dont display packet notification if it is a ping or pos update, don't want the spam
     if( opcode != PingHandler && opcode != UpdatePositionHandler )
-      Logger::debug( "[{0}] Handling World IPC : {1} ( {2:04X} )", m_pSession->getId(), name, opcode );
+      SAPPHIRE_LOG_DEBUG( "[{0}] Handling World IPC : {1} ( {2:04X} )", m_pSession->getId(), pHandler->name, opcode );
 
-    ( this->*( it->second ) )( pPacket, *m_pSession->getPlayer() );
+    dispatch( *pHandler, pPacket );
   }
   else
   {
-    Logger::debug( "[{0}] Undefined World IPC : Unknown ( {1:04X} )", m_pSession->getId(), opcode );
+    SAPPHIRE_LOG_DEBUG( "[{0}] Undefined World IPC : Unknown ( {1:04X} )", m_pSession->getId(), opcode );
 
-    Logger::debug( "Dump:\n{0}", Util::binaryToHexDump( const_cast< uint8_t* >( &pPacket.data[ 0 ] ),
-                                                       static_cast< uint16_t >( pPacket.segHdr.size) ) );
+    SAPPHIRE_LOG_DEBUG( "Dump:\n{0}", Util::binaryToHexDump( const_cast< uint8_t* >( &pPacket.data[ 0 ] ),
+                                                             static_cast< uint16_t >( pPacket.segHdr.size) ) );
   }
 }
 
 void Sapphire::Network::GameConnection::handleChatPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
-  auto it = m_chatHandlerMap.find( opcode );
+  auto pHandler = s_chatHandlers.find( opcode );
 
-  if( it != m_chatHandlerMap.end() )
+  if( pHandler )
   {
-    auto itStr = m_chatHandlerStrMap.find( opcode );
-    std::string name = itStr != m_chatHandlerStrMap.end() ? itStr->second : "unknown";
-    // dont display packet notification if it is a ping or pos update, don't want the spam
-
-    Logger::debug( "[{0}] Handling Chat IPC : {1} ( {2:04X} )", m_pSession->getId(), name, opcode );
+    SAPPHIRE_LOG_DEBUG( "[{0}] Handling Chat IPC : {1} ( {2:04X} )", m_pSession->getId(), pHandler->name, opcode );
 
-    ( this->*( it->second ) )( pPacket, *m_pSession->getPlayer() );
+    dispatch( *pHandler, pPacket );
   }
   else
   {
-    Logger::debug( "[{0}] Undefined Chat IPC : Unknown ( {1:04X} )", m_pSession->getId(), opcode );
+    SAPPHIRE_LOG_DEBUG( "[{0}] Undefined Chat IPC : Unknown ( {1:04X} )", m_pSession->getId(), opcode );
   }
 }
 
@@ -282,21 +387,83 @@ void Sapphire::Network::GameConnection::sendPackets( Packets::PacketContainer* p
   send( sendBuffer );
 }
 
-void Sapphire::Network::GameConnection::processInQueue()
+bool Sapphire::Network::GameConnection::drainInQueue( const InPacketBudget& budget )
 {
-  // handle the incoming game packets
+  auto currTime = Util::getTimeSeconds();
+
   while( m_inQueue.size() )
   {
-    auto pPacket = m_inQueue.pop();
-    handlePacket( pPacket );
+    auto packet = m_inQueue.pop();
+
+    // the session is flagged once per second, when it goes over the limit
+    if( m_pendingInPackets.countArrival( currTime, budget.rateLimit ) && m_pSession &&
+        !m_pSession->onInPacketRateExceeded( m_pendingInPackets.getArrivalCount() ) )
+    {
+      m_pendingInPackets.clear();
+      return false;
+    }
+
+    auto opcode = *reinterpret_cast< const uint16_t* >( &packet.data[ 0x02 ] );
+    auto isPosition = m_conType == ConnectionType::Zone && opcode == UpdatePositionHandler;
+
+    m_pendingInPackets.push( std::move( packet ), getPacketPriority( opcode ), isPosition );
   }
+
+  if( budget.maxQueued == 0 || m_pendingInPackets.size() <= budget.maxQueued )
+    return true;
+
+  static auto& droppedPackets = Metrics::Registry::counter( "sapphire_world_in_packets_dropped",
+                                                            "Low priority inbound packets dropped on backlog overflow" );
+
+  droppedPackets.inc( m_pendingInPackets.dropLowPriority() );
+
+  if( m_pendingInPackets.size() <= budget.maxQueued )
+    return true;
+
+  Logger::warn( "[{0}] Inbound backlog of {1} packets over the limit of {2}, disconnecting",
+                m_pSession ? m_pSession->getId() : 0, m_pendingInPackets.size(), budget.maxQueued );
+
+  m_pendingInPackets.clear();
+  disconnect();
+
+  return false;
+}
+
+Sapphire::Network::PacketPriority Sapphire::Network::GameConnection::getPacketPriority( uint16_t opcode ) const
+{
+  auto pHandler = m_conType == ConnectionType::Chat ? s_chatHandlers.find( opcode ) : s_zoneHandlers.find( opcode );
+
+  // nothing is done for unknown packets except logging them
+  return pHandler ? pHandler->priority : PacketPriority::Low;
+}
+
+bool Sapphire::Network::GameConnection::processInQueue( const InPacketBudget& budget )
+{
+  static auto& queueDepth = Metrics::Registry::histogram( "sapphire_world_in_queue_depth",
+                                                          "Inbound packets waiting on a connection per session update" );
+  queueDepth.record( m_inQueue.size() );
+
+  if( !drainInQueue( budget ) )
+    return false;
+
+  // whatever is left once the budget is spent waits for the next update
+  return m_pendingInPackets.process( budget, [ this ]( Packets::FFXIVARR_PACKET_RAW& packet )
+  {
+    handlePacket( packet );
+  } );
 }
 
 void Sapphire::Network::GameConnection::processOutQueue()
 {
+  static auto& queueDepth = Metrics::Registry::histogram( "sapphire_world_out_queue_depth",
+                                                          "Outbound packets waiting on a connection per session update" );
+  queueDepth.record( m_outQueue.size() );
+
   if( m_outQueue.size() < 1 )
     return;
 
+  auto& outTraffic = getOutTraffic( m_conType );
+
   int32_t totalSize = 0;
 
   // create a new packet container
@@ -313,6 +480,7 @@ void Sapphire::Network::GameConnection::processOutQueue()
 
     pRP.addPacket( pPacket );
     totalSize += pPacket->getSize();
+    outTraffic.add( pPacket->getIpcOpcode(), pPacket->getSize() );
 
     // todo: figure out a good max set size and make it configurable
     if( totalSize > 10000 )
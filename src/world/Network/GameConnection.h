@@ -5,9 +5,13 @@
 
 #include <Network/CommonNetwork.h>
 #include <Util/LockedQueue.h>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <map>
 
 #include "ForwardsZone.h"
+#include "InPacketQueue.h"
 
 #define DECLARE_HANDLER( x ) void x( const Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& inPacket, Entity::Player& player )
 
@@ -28,6 +32,14 @@ namespace Sapphire::Network
     None
   };
 
+  struct PacketHandlerStats
+  {
+    uint16_t opcode;
+    const char* name;
+    uint64_t callCount;
+    uint64_t totalTimeUs;
+  };
+
   class GameConnection : public Network::Connection
   {
 
@@ -35,22 +47,57 @@ namespace Sapphire::Network
     typedef void ( GameConnection::* Handler )( const Network::Packets::FFXIVARR_PACKET_RAW& inPacket,
                                                 Entity::Player& player );
 
-    using HandlerMap = std::map< uint16_t, Handler >;
-    using HandlerStrMap = std::map< uint16_t, std::string >;
-
-    AcceptorPtr m_pAcceptor;
+    struct HandlerDescriptor
+    {
+      Handler pHandler;
+      const char* name;
+      uint16_t opcode;
+      PacketPriority priority;
+      std::atomic< uint64_t > callCount;
+      std::atomic< uint64_t > totalTimeUs;
+    };
+
+    /*!
+     * @brief Opcode dispatch table shared by every connection of a type
+     *
+     * Maps every possible opcode straight to the slot of its handler, a lookup is a single array access.
+     */
+    struct HandlerTable
+    {
+      // slot + 1 of the handler in descriptors, 0 if the opcode isn't handled
+      std::array< uint8_t, 0x10000 > slots{};
+      std::deque< HandlerDescriptor > descriptors;
+
+      void set( uint16_t opcode, const char* name, Handler pHandler );
+
+      void setPriority( uint16_t opcode, PacketPriority priority );
+
+      HandlerDescriptor* find( uint16_t opcode );
+    };
 
     // handler for game packets ( main type 0x03, connection type 1 )
-    HandlerMap m_zoneHandlerMap;
-    HandlerStrMap m_zoneHandlerStrMap;
+    static HandlerTable s_zoneHandlers;
 
     // handler for game packets ( main type 0x03, connection type 2 )
-    HandlerMap m_chatHandlerMap;
-    HandlerStrMap m_chatHandlerStrMap;
+    static HandlerTable s_chatHandlers;
+
+    static void registerHandlers();
+
+    void dispatch( HandlerDescriptor& handler, Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
+
+    AcceptorPtr m_pAcceptor;
 
     World::SessionPtr m_pSession;
 
     Common::Util::LockedQueue< Network::Packets::FFXIVARR_PACKET_RAW > m_inQueue;
+
+    // inbound packets waiting for the session update, only touched by the thread updating the session
+    InPacketQueue m_pendingInPackets;
+
+    /*! @return false if the backlog overflowed and the connection is being closed */
+    bool drainInQueue( const InPacketBudget& budget );
+
+    PacketPriority getPacketPriority( uint16_t opcode ) const;
     Common::Util::LockedQueue< Packets::FFXIVPacketBasePtr > m_outQueue;
     std::vector< uint8_t > m_packets;
 
@@ -77,7 +124,11 @@ namespace Sapphire::Network
 
     void queueOutPacket( Packets::FFXIVPacketBasePtr outPacket );
 
-    void processInQueue();
+    /*!
+     * @brief Handles queued inbound packets until the budget is used up
+     * @return true if packets were left over for the next update
+     */
+    bool processInQueue( const InPacketBudget& budget );
 
     void processOutQueue();
 
@@ -87,6 +138,9 @@ namespace Sapphire::Network
 
     void handleChatPacket( Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
 
+    /*! @return call counts and cumulative handler time of every opcode handled on the given connection type */
+    static std::vector< PacketHandlerStats > getHandlerStats( ConnectionType type );
+
     void sendPackets( Packets::PacketContainer* pPacket );
 
     void sendSinglePacket( Network::Packets::FFXIVPacketBasePtr pPacket );
@@ -39,13 +39,13 @@ void Sapphire::Network::GameConnection::actionHandler( const Packets::FFXIVARR_P
     }
     case Common::SkillType::Normal:
     {
-      auto action = exdData.get< Data::Action >( actionId );
+      auto pSheet = World::Action::ActionLut::getSheet( static_cast< uint16_t >( actionId ) );
 
       // ignore invalid actions
-      if( !action )
+      if( !pSheet )
         return;
 
-      actionMgr.handleTargetedPlayerAction( player, actionId, action, targetId, sequence );
+      actionMgr.handleTargetedPlayerAction( player, actionId, *pSheet, targetId, sequence );
       break;
     }
 
@@ -69,9 +69,7 @@ void Sapphire::Network::GameConnection::actionHandler( const Packets::FFXIVARR_P
 
     case Common::SkillType::MountSkill:
     {
-      auto action = exdData.get< Data::Action >( 4 );
-      assert( action );
-      actionMgr.handleMountAction( player, static_cast< uint16_t >( actionId ), action, targetId, sequence );
+      actionMgr.handleMountAction( player, static_cast< uint16_t >( actionId ), targetId, sequence );
       break;
     }
   }
@@ -100,14 +98,12 @@ void Sapphire::Network::GameConnection::placedActionHandler( const Packets::FFXI
   player.sendDebug( "Skill type: {0}, sequence: {1}, actionId: {2}, x:{3}, y:{4}, z:{5}",
                     type, sequence, actionId, pos.x, pos.y, pos.z );
 
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
-
-  auto action = exdData.get< Data::Action >( actionId );
+  auto pSheet = World::Action::ActionLut::getSheet( static_cast< uint16_t >( actionId ) );
 
   // ignore invalid actions
-  if( !action )
+  if( !pSheet )
     return;
 
   auto& actionMgr = Common::Service< World::Manager::ActionMgr >::ref();
-  actionMgr.handlePlacedPlayerAction( player, actionId, action, pos, sequence );
+  actionMgr.handlePlacedPlayerAction( player, actionId, *pSheet, pos, sequence );
 }
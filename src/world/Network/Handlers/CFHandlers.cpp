@@ -8,6 +8,7 @@
 
 #include "Manager/TerritoryMgr.h"
 #include "Territory/InstanceContent.h"
+#include "ContentFinder/ContentFinder.h"
 
 #include "Network/GameConnection.h"
 #include "Network/PacketWrappers/ServerNoticePacket.h"
@@ -43,8 +44,7 @@ void Sapphire::Network::GameConnection::cfRegisterDuty( const Packets::FFXIVARR_
                                                         Entity::Player& player )
 {
   Packets::FFXIVARR_PACKET_RAW copy = inPacket;
-  auto& teriMgr = Common::Service< TerritoryMgr >::ref();
-  auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+  auto& contentFinder = Common::Service< World::ContentFinder >::ref();
 
   std::vector< uint16_t > selectedContent;
 
@@ -59,37 +59,13 @@ void Sapphire::Network::GameConnection::cfRegisterDuty( const Packets::FFXIVARR_
     selectedContent.push_back( id );
   }
 
-  // todo: rand bias problem, will do for now tho
-  auto index = static_cast< uint32_t >( std::rand() ) % selectedContent.size();
-  auto contentId = selectedContent.at( index );
-
-  player.sendDebug( "Duty register request for contentid#{0}", contentId );
+  if( contentFinder.registerPlayer( player, selectedContent ) )
+    return;
 
-  // let's cancel it because otherwise you can't register it again
-  /*
-  auto cfCancelPacket = makeZonePacket< FFXIVIpcCFNotify >( player.getId() );
-  cfCancelPacket->data().state1 = 3;
-  cfCancelPacket->data().state2 = 1; // Your registration is withdrawn.
-  queueOutPacket( cfCancelPacket );
-  */
+  // nothing could be queued, cancel it because otherwise you can't register again
   auto packet = makeZonePacket< FFXIVIpcCFCancel >( player.getId() );
   packet->data().cancelReason = 890;
   queueOutPacket( packet );
-
-  auto cfCondition = exdData.get< Sapphire::Data::ContentFinderCondition >( contentId );
-  if( !cfCondition )
-    return;
-
-  auto instance = teriMgr.createInstanceContent( cfCondition->content );
-  if( !instance )
-    return;
-
-  auto pInstance = instance->getAsInstanceContent();
-  pInstance->bindPlayer( player.getId() );
-
-  player.sendDebug( "Created instance with id#", instance->getGuId() );
-
-  player.setInstance( instance );
 }
 
 void Sapphire::Network::GameConnection::cfRegisterRoulette( const Packets::FFXIVARR_PACKET_RAW& inPacket,
@@ -111,12 +87,20 @@ void Sapphire::Network::GameConnection::cfRegisterRoulette( const Packets::FFXIV
 void Sapphire::Network::GameConnection::cfDutyAccepted( const Packets::FFXIVARR_PACKET_RAW& inPacket,
                                                         Entity::Player& player )
 {
-  player.sendDebug( "TODO: Duty accept" );
+  auto& contentFinder = Common::Service< World::ContentFinder >::ref();
+  contentFinder.acceptDuty( player );
 }
 
 void Sapphire::Network::GameConnection::cfCancel( const Packets::FFXIVARR_PACKET_RAW& inPacket,
   Entity::Player& player )
 {
+  auto& contentFinder = Common::Service< World::ContentFinder >::ref();
+  if( contentFinder.isQueued( player.getId() ) )
+  {
+    contentFinder.withdrawPlayer( player );
+    return;
+  }
+
   auto packet = makeZonePacket< FFXIVIpcCFCancel >( player.getId() );
   packet->data().cancelReason = 890;
   queueOutPacket( packet );
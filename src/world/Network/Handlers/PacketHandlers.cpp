@@ -38,6 +38,7 @@
 #include "Network/PacketWrappers/EventFinishPacket.h"
 #include "Network/PacketWrappers/PlayerStateFlagsPacket.h"
 
+#include "Manager/ChatChannelMgr.h"
 #include "Manager/DebugCommandMgr.h"
 #include "Manager/EventMgr.h"
 #include "Manager/MarketMgr.h"
@@ -482,6 +483,7 @@ void Sapphire::Network::GameConnection::chatHandler( const Packets::FFXIVARR_PAC
                                                      Entity::Player& player )
 {
   auto& debugCommandMgr = Common::Service< DebugCommandMgr >::ref();
+  auto& chatChannelMgr = Common::Service< ChatChannelMgr >::ref();
 
   const auto packet = ZoneChannelPacket< Client::FFXIVIpcChatHandler >( inPacket );
 
@@ -512,7 +514,8 @@ void Sapphire::Network::GameConnection::chatHandler( const Packets::FFXIVARR_PAC
       if( player.isActingAsGm() )
         chatPacket->data().chatType = ChatType::GMYell;
 
-      player.getCurrentTerritory()->queuePacketForRange( player, 6000, chatPacket );
+      chatChannelMgr.broadcast( ChatChannelMgr::ChannelType::Territory, player.getCurrentTerritory()->getGuId(),
+                                player.getId(), chatPacket );
       break;
     }
     case ChatType::Shout:
@@ -520,7 +523,37 @@ void Sapphire::Network::GameConnection::chatHandler( const Packets::FFXIVARR_PAC
       if( player.isActingAsGm() )
         chatPacket->data().chatType = ChatType::GMShout;
 
-      player.getCurrentTerritory()->queuePacketForRange( player, 6000, chatPacket );
+      chatChannelMgr.broadcast( ChatChannelMgr::ChannelType::Territory, player.getCurrentTerritory()->getGuId(),
+                                player.getId(), chatPacket );
+      break;
+    }
+    case ChatType::Party:
+    {
+      if( player.isActingAsGm() )
+        chatPacket->data().chatType = ChatType::GMParty;
+
+      auto partyChannel = chatChannelMgr.getPartyChannel( player.getId() );
+      if( partyChannel != 0 )
+        chatChannelMgr.broadcast( ChatChannelMgr::ChannelType::Party, partyChannel, player.getId(), chatPacket );
+      break;
+    }
+    case ChatType::LS1:
+    case ChatType::LS2:
+    case ChatType::LS3:
+    case ChatType::LS4:
+    case ChatType::LS5:
+    case ChatType::LS6:
+    case ChatType::LS7:
+    case ChatType::LS8:
+    {
+      auto index = static_cast< uint8_t >( static_cast< uint16_t >( chatType ) - static_cast< uint16_t >( ChatType::LS1 ) );
+
+      if( player.isActingAsGm() )
+        chatPacket->data().chatType = static_cast< ChatType >( static_cast< uint16_t >( ChatType::GMLS1 ) + index );
+
+      auto lsChannel = chatChannelMgr.getLinkshellChannel( player.getId(), index );
+      if( lsChannel != 0 )
+        chatChannelMgr.broadcast( ChatChannelMgr::ChannelType::Linkshell, lsChannel, player.getId(), chatPacket );
       break;
     }
     default:
@@ -600,7 +633,10 @@ void Sapphire::Network::GameConnection::tellHandler( const Packets::FFXIVARR_PAC
     tellPacket->data().flags |= TellFlags::GmTellMsg;
   }
 
-  pTargetPlayer->queueChatPacket( tellPacket );
+  // the session is already resolved, no need to look it up again through the player
+  auto pChatCon = pSession->getChatConnection();
+  if( pChatCon )
+    pChatCon->queueOutPacket( tellPacket );
 }
 
 void Sapphire::Network::GameConnection::performNoteHandler( const Packets::FFXIVARR_PACKET_RAW& inPacket,
@@ -0,0 +1,122 @@
+#include <algorithm>
+
+#include "InPacketQueue.h"
+
+Sapphire::Network::InPacketQueue::InPacketQueue() :
+  m_normalTaken( 0 ),
+  m_positionIndex( 0 ),
+  m_hasPosition( false ),
+  m_arrivalSecond( 0 ),
+  m_arrivalCount( 0 )
+{
+}
+
+void Sapphire::Network::InPacketQueue::push( Packets::FFXIVARR_PACKET_RAW packet, PacketPriority priority,
+                                             bool isPosition )
+{
+  auto& queue = m_queues[ static_cast< std::size_t >( priority ) ];
+
+  if( !isPosition || priority != PacketPriority::Normal )
+  {
+    queue.push_back( std::move( packet ) );
+    return;
+  }
+
+  // the update still waiting is replaced in place, anything queued after it stays after it
+  if( m_hasPosition && m_positionIndex >= m_normalTaken )
+  {
+    queue[ m_positionIndex - m_normalTaken ] = std::move( packet );
+    return;
+  }
+
+  queue.push_back( std::move( packet ) );
+  m_positionIndex = m_normalTaken + queue.size() - 1;
+  m_hasPosition = true;
+}
+
+bool Sapphire::Network::InPacketQueue::countArrival( uint32_t currTime, uint32_t rateLimit )
+{
+  if( currTime != m_arrivalSecond )
+  {
+    m_arrivalSecond = currTime;
+    m_arrivalCount = 0;
+  }
+
+  ++m_arrivalCount;
+  return rateLimit != 0 && m_arrivalCount == rateLimit + 1;
+}
+
+uint32_t Sapphire::Network::InPacketQueue::getArrivalCount() const
+{
+  return m_arrivalCount;
+}
+
+std::size_t Sapphire::Network::InPacketQueue::dropLowPriority()
+{
+  auto& queue = m_queues[ static_cast< std::size_t >( PacketPriority::Low ) ];
+  auto dropped = queue.size();
+  queue.clear();
+  return dropped;
+}
+
+std::size_t Sapphire::Network::InPacketQueue::size() const
+{
+  std::size_t size = 0;
+  for( const auto& queue : m_queues )
+    size += queue.size();
+  return size;
+}
+
+bool Sapphire::Network::InPacketQueue::empty() const
+{
+  return std::all_of( m_queues.begin(), m_queues.end(), []( const auto& queue ) { return queue.empty(); } );
+}
+
+void Sapphire::Network::InPacketQueue::clear()
+{
+  auto& normalQueue = m_queues[ static_cast< std::size_t >( PacketPriority::Normal ) ];
+  m_normalTaken += normalQueue.size();
+
+  for( auto& queue : m_queues )
+    queue.clear();
+
+  m_hasPosition = false;
+}
+
+Sapphire::Network::InPacketRateGuard::InPacketRateGuard() :
+  m_strikes( 0 ),
+  m_lastStrike( 0 )
+{
+}
+
+Sapphire::Network::InPacketRateGuard::Action Sapphire::Network::InPacketRateGuard::onRateExceeded( uint32_t currTime )
+{
+  if( m_strikes != 0 && currTime - m_lastStrike > StrikeExpirySeconds )
+    m_strikes = 0;
+
+  ++m_strikes;
+  m_lastStrike = currTime;
+
+  return m_strikes >= MaxStrikes ? Action::Disconnect : Action::Throttle;
+}
+
+bool Sapphire::Network::InPacketRateGuard::isThrottled( uint32_t currTime ) const
+{
+  return m_strikes != 0 && currTime - m_lastStrike <= StrikeExpirySeconds;
+}
+
+Sapphire::Network::InPacketBudget Sapphire::Network::InPacketRateGuard::apply( const InPacketBudget& budget,
+                                                                              uint32_t currTime ) const
+{
+  if( !isThrottled( currTime ) )
+    return budget;
+
+  auto throttled = budget;
+  throttled.maxPackets = std::max< uint32_t >( 1, budget.maxPackets / ThrottleDivisor );
+  return throttled;
+}
+
+uint32_t Sapphire::Network::InPacketRateGuard::getStrikes() const
+{
+  return m_strikes;
+}
@@ -0,0 +1,160 @@
+#ifndef SAPPHIRE_INPACKETQUEUE_H
+#define SAPPHIRE_INPACKETQUEUE_H
+
+#include <Network/CommonNetwork.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+namespace Sapphire::Network
+{
+
+  /*!
+   * @brief Order in which queued inbound packets are handled, lower first
+   *
+   * Packets of one priority may depend on each other and are handled in the order they arrived, packets of
+   * different priorities don't and a higher priority may overtake a lower one. Low priority packets are also the
+   * first to be dropped when the backlog of a connection overflows.
+   */
+  enum class PacketPriority : uint8_t
+  {
+    High,
+    Normal,
+    Low,
+    Count
+  };
+
+  /*! limits on the inbound packets a connection handles per session update */
+  struct InPacketBudget
+  {
+    uint32_t maxPackets;
+    uint32_t maxTimeUs;
+    // packets per second before the session is flagged, 0 to disable
+    uint32_t rateLimit;
+    // packets a connection may have waiting, past that low priority ones are dropped and then the
+    // connection is closed, 0 to disable
+    uint32_t maxQueued;
+  };
+
+  /*!
+   * @brief Inbound packets of a connection waiting for the session update
+   *
+   * Every priority has its own queue. Position updates are normal priority and only the latest one waits,
+   * a newer update takes the place of the queued one. Movement thereby only overtakes packets the client sent
+   * after the update it replaces. Only touched by the thread updating the session.
+   */
+  class InPacketQueue
+  {
+  public:
+    InPacketQueue();
+
+    void push( Packets::FFXIVARR_PACKET_RAW packet, PacketPriority priority, bool isPosition );
+
+    /*!
+     * @brief Counts a packet arriving in the second currTime
+     * @return true for the packet that takes the second over rateLimit, 0 disables the limit
+     */
+    bool countArrival( uint32_t currTime, uint32_t rateLimit );
+
+    /*! packets that arrived in the current second */
+    uint32_t getArrivalCount() const;
+
+    /*! @return how many low priority packets were dropped */
+    std::size_t dropLowPriority();
+
+    std::size_t size() const;
+
+    bool empty() const;
+
+    void clear();
+
+    /*!
+     * @brief Calls func( FFXIVARR_PACKET_RAW& ) for queued packets, highest priority first, until the budget is spent
+     * @return true if packets were left over for the next update
+     */
+    template< typename Func >
+    bool process( const InPacketBudget& budget, Func&& func )
+    {
+      auto start = std::chrono::steady_clock::now();
+      uint32_t handledCount = 0;
+
+      for( std::size_t priority = 0; priority < m_queues.size(); ++priority )
+      {
+        auto& queue = m_queues[ priority ];
+        while( !queue.empty() )
+        {
+          if( handledCount >= budget.maxPackets )
+            return true;
+
+          auto elapsed = std::chrono::steady_clock::now() - start;
+          if( static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() ) >=
+              budget.maxTimeUs )
+            return true;
+
+          auto packet = std::move( queue.front() );
+          queue.pop_front();
+
+          if( priority == static_cast< std::size_t >( PacketPriority::Normal ) )
+            ++m_normalTaken;
+
+          func( packet );
+          ++handledCount;
+        }
+      }
+
+      return false;
+    }
+
+  private:
+    std::array< std::deque< Packets::FFXIVARR_PACKET_RAW >, static_cast< std::size_t >( PacketPriority::Count ) > m_queues;
+
+    // packets taken from the normal queue so far, locates the queued position update
+    uint64_t m_normalTaken;
+    // position of the latest update in the normal queue, counted from the first packet ever queued there
+    uint64_t m_positionIndex;
+    bool m_hasPosition;
+
+    uint32_t m_arrivalSecond;
+    uint32_t m_arrivalCount;
+  };
+
+  /*!
+   * @brief Escalates against a client that keeps going over the inbound packet rate limit
+   *
+   * Every second over the limit is a strike. The first strikes throttle the client to a fraction of the packet
+   * budget, the last one disconnects it. Strikes expire once the client stayed under the limit for a while.
+   */
+  class InPacketRateGuard
+  {
+  public:
+    enum class Action : uint8_t
+    {
+      Throttle,
+      Disconnect
+    };
+
+    static constexpr uint32_t MaxStrikes = 3;
+    static constexpr uint32_t StrikeExpirySeconds = 30;
+    static constexpr uint32_t ThrottleDivisor = 4;
+
+    InPacketRateGuard();
+
+    Action onRateExceeded( uint32_t currTime );
+
+    bool isThrottled( uint32_t currTime ) const;
+
+    /*! @return budget, with fewer packets per update while the client is throttled */
+    InPacketBudget apply( const InPacketBudget& budget, uint32_t currTime ) const;
+
+    uint32_t getStrikes() const;
+
+  private:
+    uint32_t m_strikes;
+    uint32_t m_lastStrike;
+  };
+
+}
+
+#endif //SAPPHIRE_INPACKETQUEUE_H
@@ -87,15 +87,14 @@ namespace Sapphire::Network::Packets::Server
 
       uint64_t currentTimeMs = Common::Util::getTimeMs();
 
-      for( auto const& effect : bnpc.getStatusEffectMap() )
+      bnpc.forEachStatusEffect( [ this, currentTimeMs ]( uint8_t slot, const StatusEffect::StatusEffectPtr& pEffect )
       {
-        m_data.effect[ effect.first ].effect_id = effect.second->getId();
-        m_data.effect[ effect.first ].duration = static_cast< float >( effect.second->getDuration() -
-                                                                       ( currentTimeMs -
-                                                                         effect.second->getStartTimeMs() ) ) / 1000;
-        m_data.effect[ effect.first ].sourceActorId = effect.second->getSrcActorId();
-        m_data.effect[ effect.first ].param = effect.second->getParam();
-      }
+        m_data.effect[ slot ].effect_id = pEffect->getId();
+        m_data.effect[ slot ].duration = static_cast< float >( pEffect->getDuration() -
+                                                              ( currentTimeMs - pEffect->getStartTimeMs() ) ) / 1000;
+        m_data.effect[ slot ].sourceActorId = pEffect->getSrcActorId();
+        m_data.effect[ slot ].param = pEffect->getParam();
+      } );
 
     };
   };
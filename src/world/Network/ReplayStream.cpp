@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+#include <Logging/Logger.h>
+
+#include "ReplayStream.h"
+
+namespace fs = std::filesystem;
+
+Sapphire::Network::ReplayStream::ReplayStream() :
+  m_cursor( 0 ),
+  m_startTime( 0 ),
+  m_speed( 1.0f ),
+  m_loopMode( ReplayLoopMode::Once ),
+  m_loopCount( 0 ),
+  m_isActive( false )
+{
+}
+
+bool Sapphire::Network::ReplayStream::open( const std::string& folderPath )
+{
+  stop();
+  m_sets.clear();
+  m_loopCount = 0;
+
+  std::error_code ec;
+  if( !fs::is_directory( folderPath, ec ) )
+    return false;
+
+  for( const auto& entry : fs::directory_iterator( fs::path( folderPath ), ec ) )
+  {
+    if( !entry.is_regular_file( ec ) )
+      continue;
+
+    // captured sets are named after the time they were captured at
+    auto fileName = entry.path().filename().string();
+    if( fileName.size() < 14 ||
+        !std::all_of( fileName.begin(), fileName.begin() + 14, []( unsigned char c ) { return std::isdigit( c ); } ) )
+      continue;
+
+    auto captureTime = std::stoull( fileName.substr( 0, 14 ) );
+    if( captureTime <= 1000000000 )
+      continue;
+
+    m_sets.push_back( { captureTime, entry.path().string() } );
+  }
+
+  if( m_sets.empty() )
+    return false;
+
+  std::sort( m_sets.begin(), m_sets.end(), []( const CapturedSet& left, const CapturedSet& right )
+  {
+    return left.offset < right.offset;
+  } );
+
+  auto firstCaptureTime = m_sets.front().offset;
+  for( auto& set : m_sets )
+    set.offset -= firstCaptureTime;
+
+  Logger::info( "Indexed {0} sets spanning {1}ms for replay from {2}", m_sets.size(), m_sets.back().offset, folderPath );
+
+  return true;
+}
+
+void Sapphire::Network::ReplayStream::start( uint64_t tickCount )
+{
+  m_cursor = 0;
+  m_startTime = tickCount;
+  m_isActive = !m_sets.empty();
+}
+
+void Sapphire::Network::ReplayStream::stop()
+{
+  m_isActive = false;
+  m_cursor = 0;
+}
+
+void Sapphire::Network::ReplayStream::setSpeed( float speed, uint64_t tickCount )
+{
+  if( speed <= 0.0f )
+    return;
+
+  if( m_isActive && tickCount > m_startTime )
+  {
+    // keep the current position in the capture, only rescale what is still ahead
+    auto position = static_cast< double >( tickCount - m_startTime ) * m_speed;
+    m_startTime = tickCount - static_cast< uint64_t >( position / speed );
+  }
+
+  m_speed = speed;
+}
+
+float Sapphire::Network::ReplayStream::getSpeed() const
+{
+  return m_speed;
+}
+
+void Sapphire::Network::ReplayStream::setLoopMode( ReplayLoopMode loopMode )
+{
+  m_loopMode = loopMode;
+}
+
+Sapphire::Network::ReplayLoopMode Sapphire::Network::ReplayStream::getLoopMode() const
+{
+  return m_loopMode;
+}
+
+bool Sapphire::Network::ReplayStream::isActive() const
+{
+  return m_isActive;
+}
+
+std::size_t Sapphire::Network::ReplayStream::getSetCount() const
+{
+  return m_sets.size();
+}
+
+std::size_t Sapphire::Network::ReplayStream::getRemainingCount() const
+{
+  return m_isActive ? m_sets.size() - m_cursor : 0;
+}
+
+uint32_t Sapphire::Network::ReplayStream::getLoopCount() const
+{
+  return m_loopCount;
+}
+
+uint64_t Sapphire::Network::ReplayStream::getDueTime( const CapturedSet& set ) const
+{
+  return m_startTime + static_cast< uint64_t >( static_cast< double >( set.offset ) / m_speed );
+}
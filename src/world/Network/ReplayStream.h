@@ -0,0 +1,105 @@
+#ifndef SAPPHIRE_REPLAYSTREAM_H
+#define SAPPHIRE_REPLAYSTREAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sapphire::Network
+{
+
+  enum class ReplayLoopMode : uint8_t
+  {
+    Once,
+    Loop
+  };
+
+  /*!
+   * @brief Plays back a folder of captured packet sets in capture order
+   *
+   * Only the names of the captured sets are read when a folder is opened, they are sorted once by their
+   * timestamp and a cursor walks them as they become due. The sets themselves are read by whoever
+   * consumes them, when they are due. Every session owns its own stream, any number can run at once.
+   */
+  class ReplayStream
+  {
+  public:
+    ReplayStream();
+
+    /*! indexes the captured sets of a folder, @return false if there is nothing to replay */
+    bool open( const std::string& folderPath );
+
+    void start( uint64_t tickCount );
+
+    void stop();
+
+    /*!
+     * @brief Changes the playback speed, 2.0 plays twice as fast
+     *
+     * The position in the capture is kept, only the sets that are still ahead are affected.
+     */
+    void setSpeed( float speed, uint64_t tickCount );
+
+    float getSpeed() const;
+
+    void setLoopMode( ReplayLoopMode loopMode );
+
+    ReplayLoopMode getLoopMode() const;
+
+    bool isActive() const;
+
+    std::size_t getSetCount() const;
+
+    std::size_t getRemainingCount() const;
+
+    uint32_t getLoopCount() const;
+
+    /*!
+     * @brief Calls func( const std::string& path ) for every set that is due at tickCount
+     *
+     * A looping stream restarts at most once per call, a capture that is due all at once can't keep it spinning.
+     */
+    template< typename Func >
+    void poll( uint64_t tickCount, Func&& func )
+    {
+      if( !m_isActive )
+        return;
+
+      while( m_cursor < m_sets.size() && getDueTime( m_sets[ m_cursor ] ) <= tickCount )
+        func( m_sets[ m_cursor++ ].path );
+
+      if( m_cursor < m_sets.size() )
+        return;
+
+      if( m_loopMode == ReplayLoopMode::Loop )
+      {
+        ++m_loopCount;
+        start( tickCount );
+      }
+      else
+        m_isActive = false;
+    }
+
+  private:
+    struct CapturedSet
+    {
+      // time since the first set of the capture, in ms
+      uint64_t offset;
+      std::string path;
+    };
+
+    uint64_t getDueTime( const CapturedSet& set ) const;
+
+    std::vector< CapturedSet > m_sets;
+    std::size_t m_cursor;
+    // tick at which the first set of the capture plays
+    uint64_t m_startTime;
+    float m_speed;
+    ReplayLoopMode m_loopMode;
+    uint32_t m_loopCount;
+    bool m_isActive;
+  };
+
+}
+
+#endif //SAPPHIRE_REPLAYSTREAM_H
@@ -3,6 +3,8 @@
 #include <Network/Connection.h>
 #include <Network/Hive.h>
 #include <Network/PacketContainer.h>
+#include <Metrics/Metrics.h>
+#include <Metrics/MetricsConnection.h>
 
 #include "Network/GameConnection.h"
 #include "ServerMgr.h"
@@ -41,8 +43,12 @@
 #include "Manager/RNGMgr.h"
 #include "Manager/NaviMgr.h"
 #include "Manager/ActionMgr.h"
+#include "Manager/ChatChannelMgr.h"
 
 #include "Territory/InstanceObjectCache.h"
+#include "Math/CalcStats.h"
+#include "Action/ActionLut.h"
+#include "ContentFinder/ContentFinder.h"
 
 using namespace Sapphire::World::Manager;
 
@@ -50,7 +56,11 @@ Sapphire::World::ServerMgr::ServerMgr( const std::string& configName ) :
   m_configName( configName ),
   m_bRunning( true ),
   m_lastDBPingTime( 0 ),
-  m_worldId( 67 )
+  m_loopLastUs( 0 ),
+  m_loopAvgUs( 0 ),
+  m_loopMaxUs( 0 ),
+  m_worldId( 67 ),
+  m_sessionTimeouts( 250, Common::Util::getTimeMs() )
 {
 }
 
@@ -60,7 +70,12 @@ Sapphire::World::ServerMgr::~ServerMgr()
 
 size_t Sapphire::World::ServerMgr::getSessionCount() const
 {
-  return m_sessionMapById.size();
+  return m_sessions.size();
+}
+
+Sapphire::World::MainLoopStats Sapphire::World::ServerMgr::getMainLoopStats() const
+{
+  return { m_loopLastUs.load(), m_loopAvgUs.load(), m_loopMaxUs.load() };
 }
 
 bool Sapphire::World::ServerMgr::loadSettings( int32_t argc, char* argv[] )
@@ -97,13 +112,21 @@ bool Sapphire::World::ServerMgr::loadSettings( int32_t argc, char* argv[] )
   m_config.scripts.cachePath = configMgr.getValue< std::string >( "Scripts", "CachePath", "./cache/" );
 
   m_config.navigation.meshPath = configMgr.getValue< std::string >( "Navigation", "MeshPath", "navi" );
+  m_config.navigation.pathWorkers = configMgr.getValue< uint8_t >( "Navigation", "PathWorkers", 2 );
+  m_config.navigation.pathCacheSize = configMgr.getValue< uint32_t >( "Navigation", "PathCacheSize", 256 );
 
   m_config.network.disconnectTimeout = configMgr.getValue< uint16_t >( "Network", "DisconnectTimeout", 20 );
   m_config.network.listenIp = configMgr.getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
   m_config.network.listenPort = configMgr.getValue< uint16_t >( "Network", "ListenPort", 54992 );
   m_config.network.inRangeDistance = configMgr.getValue< float >( "Network", "InRangeDistance", 80.f );
+  m_config.network.inPacketBudget = configMgr.getValue< uint32_t >( "Network", "InPacketBudget", 64 );
+  m_config.network.inPacketBudgetUs = configMgr.getValue< uint32_t >( "Network", "InPacketBudgetUs", 5000 );
+  m_config.network.inPacketRateLimit = configMgr.getValue< uint32_t >( "Network", "InPacketRateLimit", 300 );
+  m_config.network.inPacketQueueLimit = configMgr.getValue< uint32_t >( "Network", "InPacketQueueLimit", 512 );
+  m_config.network.metricsPort = configMgr.getValue< uint16_t >( "Network", "MetricsPort", 54995 );
 
   m_config.motd = configMgr.getValue< std::string >( "General", "MotD", "" );
+  m_config.rngSeed = configMgr.getValue< uint64_t >( "General", "RngSeed", 0 );
 
   m_config.housing.defaultEstateName = configMgr.getValue< std::string >( "Housing", "DefaultEstateName", "Estate #{}" );
 
@@ -142,6 +165,18 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   }
   Common::Service< Data::ExdDataGenerated >::set( pExdData );
 
+  if( !Math::CalcStats::init() )
+  {
+    Logger::fatal( "Failed to set up the stat tables" );
+    return;
+  }
+
+  if( !World::Action::ActionLut::init() )
+  {
+    Logger::fatal( "Failed to set up the action table" );
+    return;
+  }
+
   auto pDb = std::make_shared< Db::DbWorkerPool< Db::ZoneDbConnection > >();
   Sapphire::Db::DbLoader loader;
   loader.addDb( *pDb, m_config.global.database );
@@ -161,6 +196,9 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   }
   Common::Service< Manager::LinkshellMgr >::set( pLsMgr );
 
+  auto pChatChannelMgr = std::make_shared< Manager::ChatChannelMgr >();
+  Common::Service< Manager::ChatChannelMgr >::set( pChatChannelMgr );
+
   auto pScript = std::make_shared< Scripting::ScriptMgr >();
   if( !pScript->init() )
   {
@@ -181,6 +219,10 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   auto pNaviMgr = std::make_shared< Manager::NaviMgr >();
   Common::Service< Manager::NaviMgr >::set( pNaviMgr );
 
+  // territories seed their engines from it on creation
+  auto pRNGMgr = std::make_shared< Manager::RNGMgr >( m_config.rngSeed );
+  Common::Service< Manager::RNGMgr >::set( pRNGMgr );
+
   Logger::info( "TerritoryMgr: Setting up zones" );
   auto pTeriMgr = std::make_shared< Manager::TerritoryMgr >();
   auto pHousingMgr = std::make_shared< Manager::HousingMgr >();
@@ -207,11 +249,20 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
     return;
   }
 
+  auto pContentFinder = std::make_shared< World::ContentFinder >();
+  Common::Service< World::ContentFinder >::set( pContentFinder );
+
 
 
   Network::HivePtr hive( new Network::Hive() );
   Network::addServerToHive< Network::GameConnection >( m_ip, m_port, hive );
 
+  if( m_config.network.metricsPort != 0 )
+  {
+    Network::addServerToHive< Network::MetricsConnection >( "127.0.0.1", m_config.network.metricsPort, hive );
+    Logger::info( "Metrics available at http://127.0.0.1:{0}/metrics", m_config.network.metricsPort );
+  }
+
   std::vector< std::thread > thread_list;
   thread_list.emplace_back( std::thread( std::bind( &Network::Hive::run, hive.get() ) ) );
 
@@ -221,7 +272,6 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   auto pInventoryMgr = std::make_shared< Manager::InventoryMgr >();
   auto pEventMgr = std::make_shared< Manager::EventMgr >();
   auto pItemMgr = std::make_shared< Manager::ItemMgr >();
-  auto pRNGMgr = std::make_shared< Manager::RNGMgr >();
 
   Common::Service< DebugCommandMgr >::set( pDebugCom );
   Common::Service< Manager::PlayerMgr >::set( pPlayerMgr );
@@ -229,7 +279,6 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   Common::Service< Manager::InventoryMgr >::set( pInventoryMgr );
   Common::Service< Manager::EventMgr >::set( pEventMgr );
   Common::Service< Manager::ItemMgr >::set( pItemMgr );
-  Common::Service< Manager::RNGMgr >::set( pRNGMgr );
 
   Logger::info( "World server running on {0}:{1}", m_ip, m_port );
 
@@ -266,12 +315,18 @@ void Sapphire::World::ServerMgr::mainLoop()
 {
   auto& terriMgr = Common::Service< TerritoryMgr >::ref();
   auto& scriptMgr = Common::Service< Scripting::ScriptMgr >::ref();
+  auto& contentFinder = Common::Service< World::ContentFinder >::ref();
   auto& db = Common::Service< Db::DbWorkerPool< Db::ZoneDbConnection > >::ref();
 
+  auto& tickTime = Common::Metrics::Registry::histogram( "sapphire_world_tick_us",
+                                                         "Work time of a main loop iteration in microseconds" );
+  auto& sessionCount = Common::Metrics::Registry::gauge( "sapphire_world_sessions", "Open sessions" );
+
   while( isRunning() )
   {
     std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
 
+    auto loopStart = std::chrono::steady_clock::now();
     auto currTime = Common::Util::getTimeSeconds();
     auto tickCount = Common::Util::getTimeMs();
 
@@ -279,20 +334,9 @@ void Sapphire::World::ServerMgr::mainLoop()
 
     scriptMgr.update();
 
-    std::lock_guard< std::mutex > lock( m_sessionMutex );
-    for( auto sessionIt : m_sessionMapById )
-    {
-      auto session = sessionIt.second;
-      if( session && session->getPlayer() )
-      {
-
-        // if the player is in a zone, let the zone handler take care of his updates
-        // else do it here.
-        if( !session->getPlayer()->getCurrentTerritory() )
-          session->update();
+    contentFinder.update( tickCount );
 
-      }
-    }
+    updateSessions();
 
     if( currTime - m_lastDBPingTime > 3 )
     {
@@ -300,66 +344,35 @@ void Sapphire::World::ServerMgr::mainLoop()
       m_lastDBPingTime = currTime;
     }
 
-    auto it = m_sessionMapById.begin();
-    for( ; it != m_sessionMapById.end(); )
-    {
-      auto diff = std::difftime( currTime, it->second->getLastDataTime() );
-
-      auto pPlayer = it->second->getPlayer();
-
-      // remove session of players marked for removel ( logoff / kick )
-      if( pPlayer->isMarkedForRemoval() && diff > 5 )
-      {
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          Logger::info( "[{0}] Session removal", it->second->getId() );
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-          continue;
-        }
-      }
-
-      // remove sessions that simply timed out
-      if( diff > 20 )
-      {
-        Logger::info( "[{0}] Session time out", it->second->getId() );
-
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-        }
-      }
-      else
-      {
-        ++it;
-      }
-
-    }
+    auto loopUs = static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+      std::chrono::steady_clock::now() - loopStart ).count() );
+    tickTime.record( loopUs );
+    sessionCount.set( static_cast< int64_t >( m_sessions.size() ) );
 
+    auto avgUs = m_loopAvgUs.load();
+    m_loopLastUs = loopUs;
+    m_loopAvgUs = avgUs == 0 ? loopUs : avgUs - avgUs / 16 + loopUs / 16;
+    if( loopUs > m_loopMaxUs )
+      m_loopMaxUs = loopUs;
   }
 }
 
 bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
 {
-  std::lock_guard< std::mutex > lock( m_sessionMutex );
-
   const auto session_id_str = std::to_string( sessionId );
 
-  auto it = m_sessionMapById.find( sessionId );
+  std::shared_ptr< Session > newSession( new Session( sessionId ) );
 
-  if( it != m_sessionMapById.end() )
+  if( !m_sessions.insert( sessionId, newSession ) )
   {
     Logger::error( "[{0}] Error creating session", session_id_str );
     return false;
   }
 
-  Logger::info( "[{0}] Creating new session", session_id_str );
+  // queued before the player is loaded, a session that failed to load still has to time out
+  m_newSessions.push( newSession );
 
-  std::shared_ptr< Session > newSession( new Session( sessionId ) );
-  m_sessionMapById[ sessionId ] = newSession;
+  Logger::info( "[{0}] Creating new session", session_id_str );
 
   if( !newSession->loadPlayer() )
   {
@@ -367,43 +380,137 @@ bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
     return false;
   }
 
-  m_sessionMapByName[ newSession->getPlayer()->getName() ] = newSession;
+  m_sessions.insertName( newSession->getPlayer()->getName(), newSession );
 
   return true;
 
 }
 
-void Sapphire::World::ServerMgr::removeSession( uint32_t sessionId )
+void Sapphire::World::ServerMgr::requestSessionCheck( uint32_t sessionId )
 {
-  m_sessionMapById.erase( sessionId );
+  m_sessionChecks.push( sessionId );
 }
 
-Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( uint32_t id )
+void Sapphire::World::ServerMgr::updateSessions()
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
-  auto it = m_sessionMapById.find( id );
+  auto tickCount = Common::Util::getTimeMs();
 
-  if( it != m_sessionMapById.end() )
-    return ( it->second );
+  while( auto pSession = m_newSessions.pop() )
+  {
+    m_unzonedSessions.push_back( pSession );
+    scheduleSessionTimeout( pSession->getId(), tickCount );
+  }
 
-  return nullptr;
+  while( m_sessionChecks.size() > 0 )
+  {
+    auto sessionId = m_sessionChecks.pop();
+
+    // sessions without a pending timer are already on their way out
+    auto it = m_sessionTimeoutIds.find( sessionId );
+    if( it == m_sessionTimeoutIds.end() )
+      continue;
+
+    m_sessionTimeouts.cancel( it->second );
+    checkSessionTimeout( sessionId );
+  }
+
+  m_sessionTimeouts.advance( tickCount );
+
+  // if the player is in a zone, let the zone handler take care of his updates
+  // else do it here. a session only goes back to having no zone once it is closed
+  for( auto it = m_unzonedSessions.begin(); it != m_unzonedSessions.end(); )
+  {
+    auto& pSession = *it;
+    auto pPlayer = pSession->getPlayer();
+
+    if( m_sessions.find( pSession->getId() ) != pSession || ( pPlayer && pPlayer->getCurrentTerritory() ) )
+    {
+      *it = m_unzonedSessions.back();
+      m_unzonedSessions.pop_back();
+      continue;
+    }
+
+    if( pPlayer )
+      pSession->update();
+    ++it;
+  }
+
+  // closing writes the player to the database, spread bursts of disconnects over several ticks
+  const std::size_t maxClosedPerTick = 8;
+  for( std::size_t i = 0; i < maxClosedPerTick && !m_closingSessions.empty(); ++i )
+  {
+    auto pSession = m_closingSessions.front();
+    m_closingSessions.pop_front();
+
+    pSession->close();
+
+    removeSession( pSession->getId() );
+    if( auto pPlayer = pSession->getPlayer() )
+      removeSession( pPlayer->getName() );
+  }
 }
 
-Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( const std::string& playerName )
+void Sapphire::World::ServerMgr::scheduleSessionTimeout( uint32_t sessionId, uint64_t timeMs )
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
+  // a session removed elsewhere may have left its timer behind for a reconnect under the same id
+  auto it = m_sessionTimeoutIds.find( sessionId );
+  if( it != m_sessionTimeoutIds.end() )
+    m_sessionTimeouts.cancel( it->second );
 
-  auto it = m_sessionMapByName.find( playerName );
+  m_sessionTimeoutIds[ sessionId ] = m_sessionTimeouts.scheduleAt( timeMs, [ this, sessionId ]()
+  {
+    checkSessionTimeout( sessionId );
+  } );
+}
 
-  if( it != m_sessionMapByName.end() )
-    return ( it->second );
+void Sapphire::World::ServerMgr::checkSessionTimeout( uint32_t sessionId )
+{
+  m_sessionTimeoutIds.erase( sessionId );
 
-  return nullptr;
+  auto pSession = m_sessions.find( sessionId );
+  if( !pSession )
+    return;
+
+  // incoming data only bumps the timestamp, the deadline is worked out lazily whenever the timer fires
+  auto pPlayer = pSession->getPlayer();
+  bool markedForRemoval = pPlayer && pPlayer->isMarkedForRemoval();
+  int64_t timeout = markedForRemoval ? 5 : m_config.network.disconnectTimeout;
+  int64_t diff = static_cast< int64_t >( Common::Util::getTimeSeconds() ) - pSession->getLastDataTime();
+
+  if( diff > timeout )
+  {
+    // remove session of players marked for removel ( logoff / kick ) or sessions that simply timed out
+    if( markedForRemoval )
+      Logger::info( "[{0}] Session removal", sessionId );
+    else
+      Logger::info( "[{0}] Session time out", sessionId );
+
+    m_closingSessions.push_back( pSession );
+    return;
+  }
+
+  auto deadline = static_cast< uint64_t >( pSession->getLastDataTime() ) + timeout + 1;
+  scheduleSessionTimeout( sessionId, deadline * 1000 );
+}
+
+void Sapphire::World::ServerMgr::removeSession( uint32_t sessionId )
+{
+  m_sessions.erase( sessionId );
+}
+
+Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( uint32_t id )
+{
+  return m_sessions.find( id );
+}
+
+Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( const std::string& playerName )
+{
+  return m_sessions.find( playerName );
 }
 
 void Sapphire::World::ServerMgr::removeSession( const std::string& playerName )
 {
-  m_sessionMapByName.erase( playerName );
+  m_sessions.erase( playerName );
 }
 
 
@@ -3,14 +3,29 @@
 
 #include <Common.h>
 
+#include <atomic>
+#include <deque>
 #include <mutex>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include "ForwardsZone.h"
+#include "SessionRegistry.h"
 #include <Config/ConfigDef.h>
+#include <Util/LockedQueue.h>
+#include <Util/TimerWheel.h>
 
 namespace Sapphire::World
 {
 
+  /*! time spent working in the main loop per iteration, the sleep between iterations excluded */
+  struct MainLoopStats
+  {
+    uint64_t lastUs;
+    uint64_t avgUs;
+    uint64_t maxUs;
+  };
+
   class ServerMgr
   {
   public:
@@ -27,11 +42,16 @@ namespace Sapphire::World
     void removeSession( uint32_t sessionId );
     void removeSession( const std::string& playerName );
 
+    /*! re-evaluates the timeout of a session on the next tick, e.g. once its player got marked for removal */
+    void requestSessionCheck( uint32_t sessionId );
+
     World::SessionPtr getSession( uint32_t id );
     World::SessionPtr getSession( const std::string& playerName );
 
     size_t getSessionCount() const;
 
+    MainLoopStats getMainLoopStats() const;
+
     uint16_t getWorldId() const;
     void setWorldId( uint16_t worldId );
 
@@ -53,20 +73,37 @@ namespace Sapphire::World
     Sapphire::Common::Config::WorldConfig& getConfig();
 
   private:
+    void updateSessions();
+    void scheduleSessionTimeout( uint32_t sessionId, uint64_t timeMs );
+    void checkSessionTimeout( uint32_t sessionId );
+
     uint16_t m_port;
     std::string m_ip;
     int64_t m_lastDBPingTime;
+
+    std::atomic< uint64_t > m_loopLastUs;
+    // exponentially weighted, 1/16 per iteration
+    std::atomic< uint64_t > m_loopAvgUs;
+    std::atomic< uint64_t > m_loopMaxUs;
     bool m_bRunning;
     uint16_t m_worldId;
 
     std::string m_configName;
 
-    std::mutex m_sessionMutex;
-
     Sapphire::Common::Config::WorldConfig m_config;
 
-    std::map< uint32_t, SessionPtr > m_sessionMapById;
-    std::map< std::string, SessionPtr > m_sessionMapByName;
+    SessionRegistry m_sessions;
+
+    // handed over from the network threads, drained by the main loop
+    Common::Util::LockedQueue< SessionPtr > m_newSessions;
+    Common::Util::LockedQueue< uint32_t > m_sessionChecks;
+
+    // the rest is only touched by the main loop
+    std::vector< SessionPtr > m_unzonedSessions;
+    // one timer per open session, fires at its earliest possible deadline
+    Common::Util::TimerWheel m_sessionTimeouts;
+    std::unordered_map< uint32_t, Common::Util::TimerWheel::TimerId > m_sessionTimeoutIds;
+    std::deque< SessionPtr > m_closingSessions;
     std::map< uint32_t, std::string > m_playerNameMapById;
     std::map< uint32_t, uint32_t > m_zones;
     std::map< std::string, Entity::BNpcTemplatePtr > m_bNpcTemplateMap;
@@ -4,9 +4,12 @@
 #include <Util/Util.h>
 #include <Network/PacketContainer.h>
 #include <Logging/Logger.h>
+#include <Service.h>
 
 #include "Network/GameConnection.h"
 #include "Actor/Player.h"
+#include "ServerMgr.h"
+#include "Manager/ChatChannelMgr.h"
 
 #include "Session.h"
 
@@ -16,8 +19,7 @@ Sapphire::World::Session::Session( uint32_t sessionId ) :
   m_sessionId( sessionId ),
   m_lastDataTime( Common::Util::getTimeSeconds() ),
   m_lastSqlTime( Common::Util::getTimeSeconds() ),
-  m_isValid( false ),
-  m_isReplaying( false )
+  m_isValid( false )
 {
 }
 
@@ -72,6 +74,9 @@ void Sapphire::World::Session::close()
   // remove the session from the player
   if( m_pPlayer )
   {
+    auto& chatChannelMgr = Common::Service< Manager::ChatChannelMgr >::ref();
+    chatChannelMgr.leaveAll( m_pPlayer->getId() );
+
     m_pPlayer->clearBuyBackMap();
     // do one last update to db
     m_pPlayer->updateSql();
@@ -112,78 +117,53 @@ void Sapphire::World::Session::updateLastSqlTime()
 
 void Sapphire::World::Session::startReplay( const std::string& path )
 {
-  if( !fs::exists( path ) )
+  if( !m_replay.open( path ) )
   {
-    getPlayer()->sendDebug( "Couldn't find folder." );
+    getPlayer()->sendDebug( "Couldn't find any captured sets in folder." );
     return;
   }
 
-  m_replayCache.clear();
-
-  std::vector< std::tuple< uint64_t, std::string > > loadedSets;
-
-  for( auto it = fs::directory_iterator( fs::path( path ) );
-       it != fs::directory_iterator(); ++it )
-  {
-    // Get the filename of the current element
-    auto fileName = it->path().filename().string();
-    auto unixTime = std::stoull( fileName.substr( 0, 14 ).c_str() );
+  m_replay.start( Common::Util::getTimeMs() );
 
-    if( unixTime > 1000000000 )
-    {
-      loadedSets.push_back( std::tuple< uint64_t, std::string >( unixTime, it->path().string() ) );
-    }
-  }
-
-  sort( loadedSets.begin(), loadedSets.end(),
-        []( const std::tuple< uint64_t, std::string >& left, const std::tuple< uint64_t, std::string >& right )
-        {
-          return std::get< 0 >( left ) < std::get< 0 >( right );
-        } );
-
-  uint64_t startTime = std::get< 0 >( loadedSets.at( 0 ) );
-
-  for( auto set : loadedSets )
-  {
-    m_replayCache.push_back( std::tuple< uint64_t, std::string >(
-      Common::Util::getTimeMs() + ( std::get< 0 >( set ) - startTime ), std::get< 1 >( set ) ) );
+  getPlayer()->sendDebug( "Registered {0} sets for replay", m_replay.getSetCount() );
+}
 
-    Logger::info( "Registering {0} for {1}", std::get< 1 >( set ), std::get< 0 >( set ) - startTime );
-  }
+void Sapphire::World::Session::stopReplay()
+{
+  m_replay.stop();
+}
 
-  getPlayer()->sendDebug( "Registered {0} sets for replay" ), m_replayCache.size();
-  m_isReplaying = true;
+void Sapphire::World::Session::setReplaySpeed( float speed )
+{
+  m_replay.setSpeed( speed, Common::Util::getTimeMs() );
 }
 
-void Sapphire::World::Session::stopReplay()
+void Sapphire::World::Session::setReplayLoopMode( Network::ReplayLoopMode loopMode )
 {
-  m_isReplaying = false;
-  m_replayCache.clear();
+  m_replay.setLoopMode( loopMode );
 }
 
 void Sapphire::World::Session::processReplay()
 {
-  int at = 0;
-  for( const auto& set : m_replayCache )
-  {
-    if( std::get< 0 >( set ) <= Common::Util::getTimeMs() )
-    {
-      m_pZoneConnection->injectPacket( std::get< 1 >( set ), *getPlayer().get() );
-      m_replayCache.erase( m_replayCache.begin() + at );
-      //g_framework.getLogger().info( "Sent for " + std::to_string( std::get< 0 >( set ) ) + ", left: " + std::to_string( m_replayCache.size() ) );
-    }
-    at++;
-  }
+  if( !m_pZoneConnection || !m_pPlayer )
+    return;
 
-  if( m_replayCache.size() == 0 )
-    m_isReplaying = false;
+  m_replay.poll( Common::Util::getTimeMs(), [ this ]( const std::string& path )
+  {
+    m_pZoneConnection->injectPacket( path, *m_pPlayer );
+  } );
 }
 
 void Sapphire::World::Session::sendReplayInfo()
 {
-  std::string message = std::to_string( m_replayCache.size() ) + " Sets left in cache, ";
+  std::string message = std::to_string( m_replay.getRemainingCount() ) + " of " +
+                        std::to_string( m_replay.getSetCount() ) + " Sets left, speed " +
+                        std::to_string( m_replay.getSpeed() ) + "x, ";
+
+  if( m_replay.getLoopMode() == Network::ReplayLoopMode::Loop )
+    message += "looping ( " + std::to_string( m_replay.getLoopCount() ) + " loops done ), ";
 
-  if( m_isReplaying )
+  if( m_replay.isActive() )
     message += " is active";
   else
     message += " is idle";
@@ -193,12 +173,21 @@ void Sapphire::World::Session::sendReplayInfo()
 
 void Sapphire::World::Session::update()
 {
-  if( m_isReplaying )
+  if( m_replay.isActive() )
     processReplay();
 
+  auto& networkConfig = Common::Service< World::ServerMgr >::ref().getConfig().network;
+
+  Network::InPacketBudget budget{};
+  budget.maxPackets = networkConfig.inPacketBudget;
+  budget.maxTimeUs = networkConfig.inPacketBudgetUs;
+  budget.rateLimit = networkConfig.inPacketRateLimit;
+  budget.maxQueued = networkConfig.inPacketQueueLimit;
+  budget = m_inRateGuard.apply( budget, Common::Util::getTimeSeconds() );
+
   if( m_pZoneConnection )
   {
-    m_pZoneConnection->processInQueue();
+    m_pZoneConnection->processInQueue( budget );
 
     // SESSION LOGIC
     m_pPlayer->update( Common::Util::getTimeMs() );
@@ -214,7 +203,7 @@ void Sapphire::World::Session::update()
 
   if( m_pChatConnection )
   {
-    m_pChatConnection->processInQueue();
+    m_pChatConnection->processInQueue( budget );
     m_pChatConnection->processOutQueue();
   }
 
@@ -225,3 +214,32 @@ Sapphire::Entity::PlayerPtr Sapphire::World::Session::getPlayer() const
   return m_pPlayer;
 }
 
+bool Sapphire::World::Session::onInPacketRateExceeded( uint32_t packetsPerSecond )
+{
+  auto action = m_inRateGuard.onRateExceeded( Common::Util::getTimeSeconds() );
+
+  if( action == Network::InPacketRateGuard::Action::Throttle )
+  {
+    Logger::warn( "[{0}] Inbound packet rate limit exceeded ( {1} packets/s, strike {2} ), throttling",
+                  m_sessionId, packetsPerSecond, m_inRateGuard.getStrikes() );
+    return true;
+  }
+
+  Logger::warn( "[{0}] Inbound packet rate limit exceeded ( {1} packets/s, strike {2} ), disconnecting",
+                m_sessionId, packetsPerSecond, m_inRateGuard.getStrikes() );
+
+  // the connections close and the session is removed like on any other disconnect
+  if( m_pZoneConnection )
+    m_pZoneConnection->disconnect();
+
+  if( m_pChatConnection )
+    m_pChatConnection->disconnect();
+
+  return false;
+}
+
+uint32_t Sapphire::World::Session::getRateLimitStrikes() const
+{
+  return m_inRateGuard.getStrikes();
+}
+
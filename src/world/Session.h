@@ -4,6 +4,8 @@
 #include <memory>
 
 #include "ForwardsZone.h"
+#include "Network/InPacketQueue.h"
+#include "Network/ReplayStream.h"
 
 namespace Sapphire::World
 {
@@ -35,6 +37,10 @@ namespace Sapphire::World
 
     void stopReplay();
 
+    void setReplaySpeed( float speed );
+
+    void setReplayLoopMode( Network::ReplayLoopMode loopMode );
+
     void processReplay();
 
     void sendReplayInfo();
@@ -51,6 +57,18 @@ namespace Sapphire::World
 
     Entity::PlayerPtr getPlayer() const;
 
+    /*!
+     * @brief Called by the connections when the client sends more packets per second than allowed
+     *
+     * Throttles the client to a fraction of the inbound packet budget, once it keeps going over the limit the
+     * client is disconnected.
+     * @return false if the client was disconnected
+     */
+    bool onInPacketRateExceeded( uint32_t packetsPerSecond );
+
+    /*! @return how often the client went over the inbound packet rate limit */
+    uint32_t getRateLimitStrikes() const;
+
   private:
     uint32_t m_sessionId;
 
@@ -61,8 +79,8 @@ namespace Sapphire::World
     uint32_t m_lastSqlTime;
     bool m_isValid;
 
-    bool m_isReplaying;
-    std::vector< std::tuple< uint64_t, std::string > > m_replayCache;
+    Network::InPacketRateGuard m_inRateGuard;
+    Network::ReplayStream m_replay;
 
     Network::GameConnectionPtr m_pZoneConnection;
     Network::GameConnectionPtr m_pChatConnection;
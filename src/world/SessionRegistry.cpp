@@ -0,0 +1,195 @@
+#include "SessionRegistry.h"
+
+#include <algorithm>
+
+namespace
+{
+  // tells the registries apart in the reader caches, a new registry at the address of an old one doesn't
+  // pick up its snapshots
+  std::atomic< uint64_t > g_nextRegistryId( 1 );
+
+  // player names are ascii, std::tolower would look at the locale for every character
+  unsigned char lowerAscii( char c )
+  {
+    auto uc = static_cast< unsigned char >( c );
+    return uc >= 'A' && uc <= 'Z' ? static_cast< unsigned char >( uc + ( 'a' - 'A' ) ) : uc;
+  }
+}
+
+thread_local Sapphire::World::SessionRegistry::ReaderCache Sapphire::World::SessionRegistry::t_readerCache;
+
+Sapphire::World::SessionRegistry::SessionRegistry() :
+  m_id( g_nextRegistryId++ ),
+  m_sessionCount( 0 )
+{
+  for( auto& shard : m_shards )
+    shard.pSnapshot = std::make_shared< const Snapshot >();
+}
+
+bool Sapphire::World::SessionRegistry::insert( uint32_t sessionId, SessionPtr pSession )
+{
+  auto& shard = m_shards[ getShardIndex( sessionId ) ];
+  std::lock_guard< std::mutex > lock( shard.writeMutex );
+
+  if( !shard.sessionsById.emplace( sessionId, std::move( pSession ) ).second )
+    return false;
+
+  publish( shard );
+  ++m_sessionCount;
+
+  return true;
+}
+
+bool Sapphire::World::SessionRegistry::insertName( std::string_view playerName, SessionPtr pSession )
+{
+  auto& shard = m_shards[ getShardIndex( playerName ) ];
+  std::lock_guard< std::mutex > lock( shard.writeMutex );
+
+  shard.sessionsByName[ foldName( playerName ) ] = std::move( pSession );
+
+  publish( shard );
+
+  return true;
+}
+
+bool Sapphire::World::SessionRegistry::erase( uint32_t sessionId )
+{
+  auto& shard = m_shards[ getShardIndex( sessionId ) ];
+  std::lock_guard< std::mutex > lock( shard.writeMutex );
+
+  if( shard.sessionsById.erase( sessionId ) == 0 )
+    return false;
+
+  publish( shard );
+  --m_sessionCount;
+
+  return true;
+}
+
+bool Sapphire::World::SessionRegistry::erase( std::string_view playerName )
+{
+  auto& shard = m_shards[ getShardIndex( playerName ) ];
+  std::lock_guard< std::mutex > lock( shard.writeMutex );
+
+  if( shard.sessionsByName.erase( foldName( playerName ) ) == 0 )
+    return false;
+
+  publish( shard );
+
+  return true;
+}
+
+Sapphire::World::SessionPtr Sapphire::World::SessionRegistry::find( uint32_t sessionId ) const
+{
+  const auto& pSnapshot = getSnapshot( getShardIndex( sessionId ) );
+
+  auto it = pSnapshot->byId.find( sessionId );
+  if( it != pSnapshot->byId.end() )
+    return it->second.lock();
+
+  return nullptr;
+}
+
+Sapphire::World::SessionPtr Sapphire::World::SessionRegistry::find( std::string_view playerName ) const
+{
+  auto hash = hashName( playerName );
+  const auto& pSnapshot = getSnapshot( hash % ShardCount );
+
+  auto it = std::lower_bound( pSnapshot->byName.begin(), pSnapshot->byName.end(), hash,
+                              []( const NameEntry& entry, std::size_t value ) { return entry.hash < value; } );
+
+  for( ; it != pSnapshot->byName.end() && it->hash == hash; ++it )
+  {
+    if( equalsFolded( playerName, it->foldedName ) )
+      return it->pSession.lock();
+  }
+
+  return nullptr;
+}
+
+std::size_t Sapphire::World::SessionRegistry::size() const
+{
+  return m_sessionCount;
+}
+
+void Sapphire::World::SessionRegistry::publish( Shard& shard )
+{
+  auto pSnapshot = std::make_shared< Snapshot >();
+  pSnapshot->byId.insert( shard.sessionsById.begin(), shard.sessionsById.end() );
+
+  pSnapshot->byName.reserve( shard.sessionsByName.size() );
+  for( const auto& entry : shard.sessionsByName )
+    pSnapshot->byName.push_back( { hashName( entry.first ), entry.first, entry.second } );
+
+  std::sort( pSnapshot->byName.begin(), pSnapshot->byName.end(), []( const NameEntry& lhs, const NameEntry& rhs )
+  {
+    return lhs.hash < rhs.hash;
+  } );
+
+  shard.pSnapshot = std::move( pSnapshot );
+  shard.version.fetch_add( 1, std::memory_order_release );
+}
+
+const std::shared_ptr< const Sapphire::World::SessionRegistry::Snapshot >&
+  Sapphire::World::SessionRegistry::getSnapshot( std::size_t shardIndex ) const
+{
+  auto& cache = t_readerCache;
+
+  if( cache.registryId != m_id )
+  {
+    cache = ReaderCache();
+    cache.registryId = m_id;
+  }
+
+  const auto& shard = m_shards[ shardIndex ];
+
+  auto version = shard.version.load( std::memory_order_acquire );
+  if( cache.versions[ shardIndex ] != version )
+  {
+    std::lock_guard< std::mutex > lock( shard.writeMutex );
+    cache.snapshots[ shardIndex ] = shard.pSnapshot;
+    cache.versions[ shardIndex ] = shard.version.load( std::memory_order_relaxed );
+  }
+
+  return cache.snapshots[ shardIndex ];
+}
+
+std::string Sapphire::World::SessionRegistry::foldName( std::string_view playerName )
+{
+  std::string foldedName( playerName );
+  std::transform( foldedName.begin(), foldedName.end(), foldedName.begin(), []( char c )
+  {
+    return static_cast< char >( lowerAscii( c ) );
+  } );
+  return foldedName;
+}
+
+std::size_t Sapphire::World::SessionRegistry::hashName( std::string_view playerName )
+{
+  // FNV-1a over the lower case characters
+  std::size_t hash = 14695981039346656037ull;
+  for( auto c : playerName )
+  {
+    hash ^= lowerAscii( c );
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::size_t Sapphire::World::SessionRegistry::getShardIndex( uint32_t sessionId )
+{
+  return sessionId % ShardCount;
+}
+
+std::size_t Sapphire::World::SessionRegistry::getShardIndex( std::string_view playerName )
+{
+  return hashName( playerName ) % ShardCount;
+}
+
+bool Sapphire::World::SessionRegistry::equalsFolded( std::string_view playerName, std::string_view foldedName )
+{
+  return std::equal( playerName.begin(), playerName.end(), foldedName.begin(), foldedName.end(), []( char a, char b )
+  {
+    return static_cast< char >( lowerAscii( a ) ) == b;
+  } );
+}
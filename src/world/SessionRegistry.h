@@ -0,0 +1,129 @@
+#ifndef SAPPHIRE_SESSIONREGISTRY_H
+#define SAPPHIRE_SESSIONREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ForwardsZone.h"
+
+namespace Sapphire::World
+{
+
+  /*!
+   * @brief Sharded registry of the sessions connected to the world server, indexed by id and player name
+   *
+   * Writers copy the maps of a single shard under its mutex and publish the copy as an immutable snapshot with
+   * a new version. Every reader thread keeps the last snapshot of each shard it looked at, a lookup only loads
+   * the version of the shard and takes the mutex just once after each write to fetch the new snapshot.
+   * Sessions are added and removed on login and logout, lookups happen for every packet.
+   *
+   * Snapshots only hold weak references, a snapshot a thread still caches doesn't keep removed sessions alive.
+   * Player names are compared case-insensitively without building a folded copy, getSession( "foo bar" ) and
+   * getSession( "Foo Bar" ) find the same session.
+   */
+  class SessionRegistry
+  {
+  public:
+    SessionRegistry();
+
+    bool insert( uint32_t sessionId, SessionPtr pSession );
+
+    bool insertName( std::string_view playerName, SessionPtr pSession );
+
+    bool erase( uint32_t sessionId );
+
+    bool erase( std::string_view playerName );
+
+    SessionPtr find( uint32_t sessionId ) const;
+
+    SessionPtr find( std::string_view playerName ) const;
+
+    std::size_t size() const;
+
+    /*!
+     * @brief Calls func( const SessionPtr& ) for every registered session
+     *
+     * Works on a snapshot of each shard, sessions may be added or removed from within func.
+     */
+    template< typename Func >
+    void forEach( Func&& func ) const
+    {
+      for( std::size_t i = 0; i < ShardCount; ++i )
+      {
+        // a copy, func may look up sessions and replace the snapshot in the cache
+        auto pSnapshot = getSnapshot( i );
+        for( const auto& entry : pSnapshot->byId )
+        {
+          if( auto pSession = entry.second.lock() )
+            func( pSession );
+        }
+      }
+    }
+
+  private:
+    static constexpr std::size_t ShardCount = 16;
+
+    struct NameEntry
+    {
+      std::size_t hash;
+      std::string foldedName;
+      std::weak_ptr< Session > pSession;
+    };
+
+    struct Snapshot
+    {
+      std::unordered_map< uint32_t, std::weak_ptr< Session > > byId;
+      // sorted by hash, a lookup folds and hashes the name in one pass and compares only on a matching hash
+      std::vector< NameEntry > byName;
+    };
+
+    struct alignas( 64 ) Shard
+    {
+      mutable std::mutex writeMutex;
+      std::atomic< uint64_t > version{ 1 };
+      // own the sessions, only touched under writeMutex, names are folded to lower case
+      std::unordered_map< uint32_t, SessionPtr > sessionsById;
+      std::unordered_map< std::string, SessionPtr > sessionsByName;
+      // published copy of sessions, replaced under writeMutex
+      std::shared_ptr< const Snapshot > pSnapshot;
+    };
+
+    // last snapshot of every shard the calling thread looked at
+    struct ReaderCache
+    {
+      uint64_t registryId = 0;
+      std::array< uint64_t, ShardCount > versions{};
+      std::array< std::shared_ptr< const Snapshot >, ShardCount > snapshots;
+    };
+
+    static thread_local ReaderCache t_readerCache;
+
+    static std::string foldName( std::string_view playerName );
+
+    /*! hash of the lower case name, names that only differ in case hash the same */
+    static std::size_t hashName( std::string_view playerName );
+
+    static bool equalsFolded( std::string_view playerName, std::string_view foldedName );
+
+    static std::size_t getShardIndex( uint32_t sessionId );
+    static std::size_t getShardIndex( std::string_view playerName );
+
+    /*! copies the sessions of a shard into a new snapshot, writeMutex has to be held */
+    void publish( Shard& shard );
+
+    const std::shared_ptr< const Snapshot >& getSnapshot( std::size_t shardIndex ) const;
+
+    const uint64_t m_id;
+    std::array< Shard, ShardCount > m_shards;
+    std::atomic< std::size_t > m_sessionCount;
+  };
+
+}
+
+#endif //SAPPHIRE_SESSIONREGISTRY_H
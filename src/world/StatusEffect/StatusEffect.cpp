@@ -25,7 +25,9 @@ Sapphire::StatusEffect::StatusEffect::StatusEffect( uint32_t id, Entity::CharaPt
   m_duration( duration ),
   m_startTime( 0 ),
   m_tickRate( tickRate ),
-  m_lastTick( 0 )
+  m_lastTick( 0 ),
+  m_tickTimerId( 0 ),
+  m_expiryTimerId( 0 )
 {
   auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
   auto entry = exdData.get< Sapphire::Data::Status >( id );
@@ -153,3 +155,23 @@ const std::string& Sapphire::StatusEffect::StatusEffect::getName() const
 {
   return m_name;
 }
+
+uint64_t Sapphire::StatusEffect::StatusEffect::getTickTimerId() const
+{
+  return m_tickTimerId;
+}
+
+void Sapphire::StatusEffect::StatusEffect::setTickTimerId( uint64_t timerId )
+{
+  m_tickTimerId = timerId;
+}
+
+uint64_t Sapphire::StatusEffect::StatusEffect::getExpiryTimerId() const
+{
+  return m_expiryTimerId;
+}
+
+void Sapphire::StatusEffect::StatusEffect::setExpiryTimerId( uint64_t timerId )
+{
+  m_expiryTimerId = timerId;
+}
@@ -47,6 +47,15 @@ public:
 
   const std::string& getName() const;
 
+  /*! timers of the territory wheel driving this effect, 0 while not scheduled */
+  uint64_t getTickTimerId() const;
+
+  void setTickTimerId( uint64_t timerId );
+
+  uint64_t getExpiryTimerId() const;
+
+  void setExpiryTimerId( uint64_t timerId );
+
 private:
   uint32_t m_id;
   Entity::CharaPtr m_sourceActor;
@@ -58,6 +67,8 @@ private:
   uint16_t m_param;
   std::string m_name;
   std::pair< uint8_t, uint32_t > m_currTickEffect;
+  uint64_t m_tickTimerId;
+  uint64_t m_expiryTimerId;
 
 };
 
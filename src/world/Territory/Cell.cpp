@@ -1,6 +1,7 @@
 #include "Cell.h"
 
 #include "Actor/Chara.h"
+#include "Actor/BNpc.h"
 #include "Forwards.h"
 #include "Territory.h"
 #include <Logging/Logger.h>
@@ -51,11 +52,12 @@ void Sapphire::Cell::setActivity( bool state )
 {
   if( !m_bActive && state )
   {
-    // Move all objects to active set.
-    //for( auto itr = m_actors.begin(); itr != m_actors.end(); ++itr )
-    //{
-
-    //}
+    // a player came close, let the mobs in here react right away instead of on their next slow tick
+    for( const auto& pActor : m_actors )
+    {
+      if( pActor->isBattleNpc() )
+        pActor->getAsBNpc()->wake();
+    }
 
     if( m_bUnloadPending )
       cancelPendingUnload();
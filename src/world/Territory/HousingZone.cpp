@@ -153,8 +153,8 @@ bool Sapphire::HousingZone::init()
 
 void Sapphire::HousingZone::onPlayerZoneIn( Entity::Player& player )
 {
-  Logger::debug( "HousingZone::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
-                 getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "HousingZone::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
+                      getGuId(), getTerritoryTypeId(), player.getId() );
 
   auto isInSubdivision = isPlayerSubInstance( player ) ? true : false;
 
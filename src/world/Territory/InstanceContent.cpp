@@ -74,8 +74,8 @@ Sapphire::Data::ExdDataGenerated::InstanceContentPtr Sapphire::InstanceContent::
 
 void Sapphire::InstanceContent::onPlayerZoneIn( Entity::Player& player )
 {
-  Logger::debug( "InstanceContent::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
-                 getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "InstanceContent::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
+                      getGuId(), getTerritoryTypeId(), player.getId() );
 
   // mark player as "bound by duty"
   player.setStateFlag( PlayerStateFlag::BoundByDuty );
@@ -89,8 +89,8 @@ void Sapphire::InstanceContent::onPlayerZoneIn( Entity::Player& player )
 
 void Sapphire::InstanceContent::onLeaveTerritory( Entity::Player& player )
 {
-  Logger::debug( "InstanceContent::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}",
-                 getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "InstanceContent::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}",
+                      getGuId(), getTerritoryTypeId(), player.getId() );
 
   clearDirector( player );
 }
@@ -68,8 +68,8 @@ Sapphire::Data::ExdDataGenerated::QuestBattlePtr Sapphire::QuestBattle::getQuest
 
 void Sapphire::QuestBattle::onPlayerZoneIn( Entity::Player& player )
 {
-  Logger::debug( "QuestBattle::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
-                 getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "QuestBattle::onPlayerZoneIn: Territory#{0}|{1}, Entity#{2}",
+                      getGuId(), getTerritoryTypeId(), player.getId() );
 
   m_pPlayer = player.getAsPlayer();
 
@@ -82,8 +82,8 @@ void Sapphire::QuestBattle::onPlayerZoneIn( Entity::Player& player )
 
 void Sapphire::QuestBattle::onLeaveTerritory( Entity::Player& player )
 {
-  Logger::debug( "QuestBattle::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}",
-                 getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "QuestBattle::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}",
+                      getGuId(), getTerritoryTypeId(), player.getId() );
 
   clearDirector( player );
 }
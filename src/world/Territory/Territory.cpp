@@ -2,6 +2,7 @@
 #include <vector>
 #include <time.h>
 #include <random>
+#include <algorithm>
 
 #include <Logging/Logger.h>
 #include <Util/Util.h>
@@ -20,12 +21,14 @@
 #include "InstanceContent.h"
 #include "QuestBattle.h"
 #include "Manager/TerritoryMgr.h"
+#include "Manager/ChatChannelMgr.h"
 #include "Navi/NaviProvider.h"
 
 #include "Session.h"
 #include "Actor/Chara.h"
 #include "Actor/Actor.h"
 #include "Actor/BNpc.h"
+#include "Util/ShapeQuery.h"
 #include "Actor/Player.h"
 #include "Actor/EventObject.h"
 #include "Actor/SpawnGroup.h"
@@ -61,7 +64,8 @@ Sapphire::Territory::Territory() :
   m_weatherOverride( Weather::None ),
   m_lastMobUpdate( 0 ),
   m_nextEObjId( 0x400D0000 ),
-  m_nextActorId( 0x500D0000 )
+  m_nextActorId( 0x500D0000 ),
+  m_timerWheel( 10, Util::getTimeMs() )
 {
 }
 
@@ -71,10 +75,13 @@ Sapphire::Territory::Territory( uint16_t territoryTypeId, uint32_t guId,
   m_nextEObjId( 0x400D0000 ),
   m_nextActorId( 0x500D0000 ),
   m_lastUpdate( 0 ),
-  m_lastActivityTime( Util::getTimeMs() )
+  m_lastActivityTime( Util::getTimeMs() ),
+  m_timerWheel( 10, Util::getTimeMs() )
 {
   auto& exdData = Common::Service< Data::ExdDataGenerated >::ref();
+  auto& rngMgr = Common::Service< World::Manager::RNGMgr >::ref();
   m_guId = guId;
+  m_randomEngine = rngMgr.createEngine( guId );
 
   m_territoryTypeId = territoryTypeId;
   m_internalName = internalName;
@@ -137,6 +144,8 @@ bool Sapphire::Territory::init()
     Logger::warn( "No navmesh found for TerritoryType#{}", getTerritoryTypeId() );
   }
 
+  initSpawnPoints();
+
   return true;
 }
 
@@ -251,6 +260,14 @@ void Sapphire::Territory::pushActor( Entity::ActorPtr pActor )
 
     m_playerMap[ pPlayer->getId() ] = pPlayer;
     updateCellActivity( cx, cy, 2 );
+
+    // zone wide chat is not sent in private territories
+    auto& teriMgr = Common::Service< TerritoryMgr >::ref();
+    if( !teriMgr.isPrivateTerritory( getTerritoryTypeId() ) )
+    {
+      auto& chatChannelMgr = Common::Service< World::Manager::ChatChannelMgr >::ref();
+      chatChannelMgr.join( World::Manager::ChatChannelMgr::ChannelType::Territory, getGuId(), *pPlayer );
+    }
   }
   else if( pActor->isBattleNpc() )
   {
@@ -264,6 +281,9 @@ void Sapphire::Territory::pushActor( Entity::ActorPtr pActor )
     updateCellActivity( cx, cy, 2 );
 
   }
+
+  if( pActor->isChara() )
+    pActor->getAsChara()->armStatusEffectTimers( *this );
 }
 
 void Sapphire::Territory::removeActor( Entity::ActorPtr pActor )
@@ -293,6 +313,9 @@ void Sapphire::Territory::removeActor( Entity::ActorPtr pActor )
     }
     m_playerMap.erase( pActor->getId() );
 
+    auto& chatChannelMgr = Common::Service< World::Manager::ChatChannelMgr >::ref();
+    chatChannelMgr.leave( World::Manager::ChatChannelMgr::ChannelType::Territory, getGuId(), pActor->getId() );
+
     onLeaveTerritory( *pActor->getAsPlayer() );
 
   }
@@ -303,6 +326,13 @@ void Sapphire::Territory::removeActor( Entity::ActorPtr pActor )
     m_bNpcMap.erase( pActor->getId() );
   }
 
+  if( pActor->isChara() )
+  {
+    // whatever changed still goes to the players that saw it happen
+    pActor->getAsChara()->flushStateUpdates();
+    pActor->getAsChara()->disarmStatusEffectTimers( *this );
+  }
+
   // remove from lists of other actors
   pActor->removeFromInRange();
   pActor->clearInRangeSet();
@@ -388,6 +418,11 @@ std::size_t Sapphire::Territory::getPopCount() const
   return m_playerMap.size();
 }
 
+std::size_t Sapphire::Territory::getBNpcCount() const
+{
+  return m_bNpcMap.size();
+}
+
 bool Sapphire::Territory::checkWeather()
 {
   if( m_weatherOverride != Weather::None )
@@ -416,22 +451,6 @@ void Sapphire::Territory::updateBNpcs( uint64_t tickCount )
     return;
 
   m_lastMobUpdate = tickCount;
-  uint64_t currTime = Common::Util::getTimeSeconds();
-
-  for( const auto& entry : m_bNpcMap )
-  {
-    Entity::BNpcPtr pBNpc = entry.second;
-
-    if( !pBNpc )
-      continue;
-
-    if( !pBNpc->isAlive() )
-      if( currTime - pBNpc->getTimeOfDeath() > 10 )
-      {
-        removeActor( pBNpc );
-        break;
-      }
-  }
 
   // Update loop may move actors from cell to cell, breaking iterator validity
   std::vector< Entity::BNpcPtr > m_activeBNpc;
@@ -444,11 +463,8 @@ void Sapphire::Territory::updateBNpcs( uint64_t tickCount )
       if( !cell )
         continue;
 
-      // todo: this is a pretty shit because we will visit the same cells multiple times over
-      // ideally we run a pass every tick and cache active cells during that initial pass over every cell
-      // that way we don't have an expensive lookup for every actor
-
-      if( !isCellActive( x, y ) )
+      // activity is kept up to date as players move between cells, no need to look at the neighbours again
+      if( !cell->isActive() && !cell->isForcedActive() )
         continue;
 
       for( const auto& actor : cell->m_actors )
@@ -475,17 +491,14 @@ bool Sapphire::Territory::update( uint64_t tickCount )
   //TODO: this should be moved to a updateWeather call and pulled out of updateSessions
   bool changedWeather = checkWeather();
 
-  auto dt = std::difftime( tickCount, m_lastUpdate ) / 1000.f;
-
-  if( m_pNaviProvider )
-    m_pNaviProvider->updateCrowd( dt );
-
   updateSessions( tickCount, changedWeather );
   onUpdate( tickCount );
 
-  updateSpawnPoints();
+  // effect results, status effect ticks, respawns and everything else that was scheduled for this tick
+  m_timerWheel.advance( tickCount );
 
-  processEffectResults( tickCount );
+  // one update per changed actor, no matter how often it was hit or moved during the tick
+  flushStateUpdates();
 
   if( !m_playerMap.empty() )
     m_lastActivityTime = tickCount;
@@ -560,11 +573,13 @@ bool Sapphire::Territory::isCellActive( uint32_t x, uint32_t y )
 
 void Sapphire::Territory::updateCellActivity( uint32_t x, uint32_t y, int32_t radius )
 {
-
-  uint32_t endX = ( x + radius ) <= _sizeX ? x + radius : ( _sizeX - 1 );
-  uint32_t endY = ( y + radius ) <= _sizeY ? y + radius : ( _sizeY - 1 );
-  uint32_t startX = x - radius > 0 ? x - radius : 0;
-  uint32_t startY = y - radius > 0 ? y - radius : 0;
+  // signed, x - radius would wrap around for the cells along the edge
+  const int32_t maxX = static_cast< int32_t >( _sizeX ) - 1;
+  const int32_t maxY = static_cast< int32_t >( _sizeY ) - 1;
+  uint32_t endX = static_cast< uint32_t >( std::min( static_cast< int32_t >( x ) + radius, maxX ) );
+  uint32_t endY = static_cast< uint32_t >( std::min( static_cast< int32_t >( y ) + radius, maxY ) );
+  uint32_t startX = static_cast< uint32_t >( std::max( static_cast< int32_t >( x ) - radius, 0 ) );
+  uint32_t startY = static_cast< uint32_t >( std::max( static_cast< int32_t >( y ) - radius, 0 ) );
   uint32_t posX, posY;
 
   Cell* pCell;
@@ -641,7 +656,6 @@ void Sapphire::Territory::updateActorPosition( Entity::Actor& actor )
 
     pCell->addActor( actor.shared_from_this() );
     actor.setCell( pCell );
-    pOldCell = pCell;
 
     // if player we need to update cell activity
     // radius = 2 is used in order to update both
@@ -729,12 +743,12 @@ void Sapphire::Territory::updateInRangeSet( Entity::ActorPtr pActor, Cell* pCell
 
 void Sapphire::Territory::onPlayerZoneIn( Entity::Player& player )
 {
-  Logger::debug( "Territory::onEnterTerritory: Territory#{0}|{1}, Entity#{2}", getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "Territory::onEnterTerritory: Territory#{0}|{1}, Entity#{2}", getGuId(), getTerritoryTypeId(), player.getId() );
 }
 
 void Sapphire::Territory::onLeaveTerritory( Entity::Player& player )
 {
-  Logger::debug( "Territory::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}", getGuId(), getTerritoryTypeId(), player.getId() );
+  SAPPHIRE_LOG_DEBUG( "Territory::onLeaveTerritory: Territory#{0}|{1}, Entity#{2}", getGuId(), getTerritoryTypeId(), player.getId() );
 }
 
 void Sapphire::Territory::onUpdate( uint64_t tickCount )
@@ -833,7 +847,7 @@ bool Sapphire::Territory::loadSpawnGroups()
 
     m_spawnGroups.emplace_back( id, templateId, level, maxHp );
 
-    Logger::trace( "id: {0}, template: {1}, level: {2}, maxHp: {3}", id, m_spawnGroups.back().getTemplateId(), level, maxHp );
+    SAPPHIRE_LOG_TRACE( "id: {0}, template: {1}, level: {2}, maxHp: {3}", id, m_spawnGroups.back().getTemplateId(), level, maxHp );
   }
 
   res.reset();
@@ -856,53 +870,79 @@ bool Sapphire::Territory::loadSpawnGroups()
 
       group.getSpawnPointList().emplace_back( std::make_shared< Entity::SpawnPoint >( x, y, z, r, gimmickId ) );
 
-      Logger::trace( "id: {0}, x: {1}, y: {2}, z: {3}, gimmickId: {4}", id, x, y, z, gimmickId );
+      SAPPHIRE_LOG_TRACE( "id: {0}, x: {1}, y: {2}, z: {3}, gimmickId: {4}", id, x, y, z, gimmickId );
     }
   }
   return false;
 }
 
-void Sapphire::Territory::updateSpawnPoints()
+void Sapphire::Territory::initSpawnPoints()
 {
-  auto& RNGMgr = Common::Service< World::Manager::RNGMgr >::ref();
-  auto rng = RNGMgr.getRandGenerator< float >( 0.f, PI * 2 );
-
-  for( auto& group : m_spawnGroups )
+  for( std::size_t groupIdx = 0; groupIdx < m_spawnGroups.size(); ++groupIdx )
   {
-    for( auto& point : group.getSpawnPointList() )
-    {
-      if( !point->getLinkedBNpc() && ( Util::getTimeSeconds() - point->getTimeOfDeath() ) > 60 )
-      {
-        auto& serverMgr = Common::Service< World::ServerMgr >::ref();
+    for( auto& point : m_spawnGroups[ groupIdx ].getSpawnPointList() )
+      spawnBNpcFromSpawnPoint( groupIdx, point );
+  }
+}
 
-        auto bNpcTemplate = serverMgr.getBNpcTemplate( group.getTemplateId() );
+void Sapphire::Territory::spawnBNpcFromSpawnPoint( std::size_t spawnGroupIdx, Entity::SpawnPointPtr pSpawnPoint )
+{
+  auto& group = m_spawnGroups[ spawnGroupIdx ];
+  auto& serverMgr = Common::Service< World::ServerMgr >::ref();
 
-        if( !bNpcTemplate )
-        {
-          //Logger::error( "No template found for templateId#{0}", group.getTemplateId() );
-          continue;
-        }
+  auto bNpcTemplate = serverMgr.getBNpcTemplate( group.getTemplateId() );
 
-        auto pBNpc = std::make_shared< Entity::BNpc >( getNextActorId(),
-                                                       bNpcTemplate,
-                                                       point->getPosX(),
-                                                       point->getPosY(),
-                                                       point->getPosZ(),
-                                                       rng.next(),
-                                                       group.getLevel(),
-                                                       group.getMaxHp(), shared_from_this() );
-        point->setLinkedBNpc( pBNpc );
-
-        pushActor( pBNpc );
-      }
-      else if( point->getLinkedBNpc() && !point->getLinkedBNpc()->isAlive() )
-      {
-        point->setTimeOfDeath( Util::getTimeSeconds() );
-        point->setLinkedBNpc( nullptr );
-      }
-    }
+  if( !bNpcTemplate )
+  {
+    //Logger::error( "No template found for templateId#{0}", group.getTemplateId() );
+    return;
   }
 
+  auto pBNpc = std::make_shared< Entity::BNpc >( getNextActorId(),
+                                                 bNpcTemplate,
+                                                 pSpawnPoint->getPosX(),
+                                                 pSpawnPoint->getPosY(),
+                                                 pSpawnPoint->getPosZ(),
+                                                 m_randomEngine.nextFloat( 0.f, PI * 2 ),
+                                                 group.getLevel(),
+                                                 group.getMaxHp(), shared_from_this() );
+  pSpawnPoint->setLinkedBNpc( pBNpc );
+  m_bNpcSpawnPoints[ pBNpc->getId() ] = std::make_pair( spawnGroupIdx, pSpawnPoint );
+
+  pushActor( pBNpc );
+}
+
+void Sapphire::Territory::onBNpcDeath( Entity::BNpc& bnpc )
+{
+  std::weak_ptr< Entity::BNpc > weakBNpc = bnpc.getAsBNpc();
+  std::weak_ptr< Territory > weakZone = shared_from_this();
+
+  // leave the corpse around for a bit
+  scheduleTimer( 10000, [ weakZone, weakBNpc ]()
+  {
+    auto pZone = weakZone.lock();
+    auto pBNpc = weakBNpc.lock();
+
+    if( pZone && pBNpc && !pBNpc->isAlive() && pBNpc->getCurrentTerritory() == pZone )
+      pZone->removeActor( pBNpc );
+  } );
+
+  auto it = m_bNpcSpawnPoints.find( bnpc.getId() );
+  if( it == m_bNpcSpawnPoints.end() )
+    return;
+
+  auto spawnGroupIdx = it->second.first;
+  auto pSpawnPoint = it->second.second;
+  m_bNpcSpawnPoints.erase( it );
+
+  pSpawnPoint->setTimeOfDeath( Util::getTimeSeconds() );
+  pSpawnPoint->setLinkedBNpc( nullptr );
+
+  scheduleTimer( 60000, [ weakZone, spawnGroupIdx, pSpawnPoint ]()
+  {
+    if( auto pZone = weakZone.lock() )
+      pZone->spawnBNpcFromSpawnPoint( spawnGroupIdx, pSpawnPoint );
+  } );
 }
 
 uint32_t Sapphire::Territory::getNextEffectSequence()
@@ -1022,25 +1062,92 @@ std::shared_ptr< Sapphire::World::Navi::NaviProvider > Sapphire::Territory::getN
 
 void Sapphire::Territory::addEffectResult( Sapphire::World::Action::EffectResultPtr result )
 {
-  m_effectResults.emplace_back( std::move( result ) );
+  auto delay = result->getDelay();
+  m_timerWheel.scheduleAt( delay, [ result ]()
+  {
+    result->execute();
+  } );
+}
+
+Sapphire::Common::Util::TimerWheel::TimerId
+  Sapphire::Territory::scheduleTimer( uint64_t delayMs, Common::Util::TimerWheel::Callback callback )
+{
+  return m_timerWheel.schedule( delayMs, std::move( callback ) );
 }
 
-void Sapphire::Territory::processEffectResults( uint64_t tickCount )
+bool Sapphire::Territory::cancelTimer( Common::Util::TimerWheel::TimerId timerId )
+{
+  return m_timerWheel.cancel( timerId );
+}
 
+void Sapphire::Territory::queueStateUpdate( Entity::CharaPtr pChara )
 {
-  // todo: move this to generic territory/instance delay wrapper cause it might be useful scheduling other things
-  for( auto it = m_effectResults.begin(); it != m_effectResults.end(); )
-  {
-    auto effect = *it;
+  m_pendingStateUpdates.push_back( std::move( pChara ) );
+}
+
+void Sapphire::Territory::flushStateUpdates()
+{
+  // indexed, an actor marked dirty while flushing is picked up in the same pass
+  for( std::size_t i = 0; i < m_pendingStateUpdates.size(); ++i )
+    m_pendingStateUpdates[ i ]->flushStateUpdates();
+
+  m_pendingStateUpdates.clear();
+}
 
-    if( tickCount < effect->getDelay() )
+void Sapphire::Territory::findCharasInShape( const World::Util::TargetShape& shape,
+                                              std::vector< Entity::CharaPtr >& charas )
+{
+  auto reach = shape.getReach();
+  auto clampX = []( float x ) { return std::min( std::max( x, _minX ), _maxX ); };
+  auto clampY = []( float y ) { return std::min( std::max( y, _minY ), _maxY ); };
+
+  // cell indices grow in the opposite direction of the coordinates
+  uint32_t startX = getPosX( clampX( shape.origin.x + reach ) );
+  uint32_t endX = std::min< uint32_t >( getPosX( clampX( shape.origin.x - reach ) ), _sizeX - 1 );
+  uint32_t startY = getPosY( clampY( shape.origin.z + reach ) );
+  uint32_t endY = std::min< uint32_t >( getPosY( clampY( shape.origin.z - reach ) ), _sizeY - 1 );
+
+  m_shapeCandidates.clear();
+  m_shapeCandidateX.clear();
+  m_shapeCandidateZ.clear();
+
+  for( auto x = startX; x <= endX; ++x )
+  {
+    for( auto y = startY; y <= endY; ++y )
     {
-      ++it;
-      continue;
+      auto pCell = getCellPtr( x, y );
+      if( !pCell )
+        continue;
+
+      for( const auto& pActor : pCell->m_actors )
+      {
+        if( !pActor->isPlayer() && !pActor->isBattleNpc() )
+          continue;
+
+        m_shapeCandidates.push_back( static_cast< Entity::Chara* >( pActor.get() ) );
+        m_shapeCandidateX.push_back( pActor->getPos().x );
+        m_shapeCandidateZ.push_back( pActor->getPos().z );
+      }
     }
+  }
 
-    effect->execute();
+  m_shapeHits.resize( m_shapeCandidates.size() );
+  World::Util::queryShape( shape, m_shapeCandidateX.data(), m_shapeCandidateZ.data(), m_shapeCandidates.size(),
+                           m_shapeHits.data() );
 
-    it = m_effectResults.erase( it );
+  for( std::size_t i = 0; i < m_shapeCandidates.size(); ++i )
+  {
+    if( m_shapeHits[ i ] )
+      charas.push_back( m_shapeCandidates[ i ]->getAsChara() );
   }
-}
\ No newline at end of file
+}
+
+Sapphire::Common::Util::TimerWheel& Sapphire::Territory::getTimerWheel()
+{
+  return m_timerWheel;
+}
+
+Sapphire::Common::Util::RandomEngine& Sapphire::Territory::getRandomEngine()
+{
+  return m_randomEngine;
+}
@@ -3,6 +3,8 @@
 
 #include <unordered_map>
 #include <Common.h>
+#include <Util/TimerWheel.h>
+#include <Util/RandomEngine.h>
 
 #include "Cell.h"
 #include "CellHandler.h"
@@ -29,6 +31,11 @@ namespace Sapphire
     struct TerritoryType;
   }
 
+  namespace World::Util
+  {
+    struct TargetShape;
+  }
+
   class Territory : public CellHandler< Cell >, public std::enable_shared_from_this< Territory >
   {
   protected:
@@ -60,11 +67,25 @@ namespace Sapphire
     uint32_t m_nextActorId;
 
     std::vector< Entity::SpawnGroup > m_spawnGroups;
+    // bnpc actor id to the index of its spawn group and the spawn point it has been spawned at
+    std::unordered_map< uint32_t, std::pair< std::size_t, Entity::SpawnPointPtr > > m_bNpcSpawnPoints;
 
     uint32_t m_effectCounter;
     std::shared_ptr< World::Navi::NaviProvider > m_pNaviProvider;
 
-    std::vector< World::Action::EffectResultPtr > m_effectResults;
+    Common::Util::TimerWheel m_timerWheel;
+
+    // seeded from RNGMgr by guid, every roll made for this territory should come from it
+    Common::Util::RandomEngine m_randomEngine;
+
+    // actors with state changes to send at the end of this tick
+    std::vector< Entity::CharaPtr > m_pendingStateUpdates;
+
+    // scratch space of findCharasInShape, kept around so queries do not allocate
+    std::vector< Entity::Chara* > m_shapeCandidates;
+    std::vector< float > m_shapeCandidateX;
+    std::vector< float > m_shapeCandidateZ;
+    std::vector< uint8_t > m_shapeHits;
 
   public:
     Territory();
@@ -145,6 +166,8 @@ namespace Sapphire
 
     std::size_t getPopCount() const;
 
+    std::size_t getBNpcCount() const;
+
     void loadWeatherRates();
 
     bool loadSpawnGroups();
@@ -170,7 +193,12 @@ namespace Sapphire
 
     QuestBattlePtr getAsQuestBattle();
 
-    void updateSpawnPoints();
+    void initSpawnPoints();
+
+    void spawnBNpcFromSpawnPoint( std::size_t spawnGroupIdx, Entity::SpawnPointPtr pSpawnPoint );
+
+    /*! schedules the despawn of a dead bnpc and, if it came from a spawn point, its respawn */
+    void onBNpcDeath( Entity::BNpc& bnpc );
 
     uint32_t getNextEffectSequence();
 
@@ -178,7 +206,28 @@ namespace Sapphire
 
     void addEffectResult( World::Action::EffectResultPtr result );
 
-    void processEffectResults( uint64_t tickCount );
+    /*!
+     * @brief Runs a callback once delayMs have passed, as part of the update of this territory.
+     *
+     * Meant for anything that would otherwise poll a timestamp every tick, also available to scripts
+     * for delayed events. The callback must not keep the territory alive.
+     */
+    Common::Util::TimerWheel::TimerId scheduleTimer( uint64_t delayMs, Common::Util::TimerWheel::Callback callback );
+
+    bool cancelTimer( Common::Util::TimerWheel::TimerId timerId );
+
+    Common::Util::TimerWheel& getTimerWheel();
+
+    /*! engine for everything rolled during the update of this territory, not to be used from other threads */
+    Common::Util::RandomEngine& getRandomEngine();
+
+    /*! queues the actor to have its dirty state sent at the end of the tick, see Chara::markStateDirty */
+    void queueStateUpdate( Entity::CharaPtr pChara );
+
+    void flushStateUpdates();
+
+    /*! appends every player and bnpc standing inside the shape to charas, in no particular order */
+    void findCharasInShape( const World::Util::TargetShape& shape, std::vector< Entity::CharaPtr >& charas );
   };
 
 }
@@ -0,0 +1,109 @@
+#include "ShapeQuery.h"
+
+#include <cmath>
+
+Sapphire::World::Util::TargetShape
+  Sapphire::World::Util::TargetShape::circle( const Common::FFXIVARR_POSITION3& origin, float radius )
+{
+  return { Type::Circle, origin, 0.f, radius, 0.f, 0.f, 0.f };
+}
+
+Sapphire::World::Util::TargetShape
+  Sapphire::World::Util::TargetShape::donut( const Common::FFXIVARR_POSITION3& origin, float innerRadius,
+                                             float outerRadius )
+{
+  return { Type::Donut, origin, 0.f, outerRadius, innerRadius, 0.f, 0.f };
+}
+
+Sapphire::World::Util::TargetShape
+  Sapphire::World::Util::TargetShape::rectangle( const Common::FFXIVARR_POSITION3& origin, float rotation,
+                                                 float length, float width )
+{
+  return { Type::Rectangle, origin, rotation, length, 0.f, width / 2, 0.f };
+}
+
+Sapphire::World::Util::TargetShape
+  Sapphire::World::Util::TargetShape::cone( const Common::FFXIVARR_POSITION3& origin, float rotation,
+                                            float radius, float angle )
+{
+  return { Type::Cone, origin, rotation, radius, 0.f, 0.f, angle / 2 };
+}
+
+float Sapphire::World::Util::TargetShape::getReach() const
+{
+  if( type == Type::Rectangle )
+    return std::sqrt( radius * radius + halfWidth * halfWidth );
+
+  return radius;
+}
+
+void Sapphire::World::Util::queryShape( const TargetShape& shape, const float* posX, const float* posZ,
+                                        std::size_t count, uint8_t* hits )
+{
+  const float originX = shape.origin.x;
+  const float originZ = shape.origin.z;
+  const float radiusSq = shape.radius * shape.radius;
+
+  // facing direction, see Chara::face
+  const float forwardX = std::sin( shape.rotation );
+  const float forwardZ = std::cos( shape.rotation );
+
+  switch( shape.type )
+  {
+    case TargetShape::Type::Circle:
+    {
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        float dx = posX[ i ] - originX;
+        float dz = posZ[ i ] - originZ;
+        hits[ i ] = static_cast< uint8_t >( dx * dx + dz * dz <= radiusSq );
+      }
+      break;
+    }
+
+    case TargetShape::Type::Donut:
+    {
+      const float innerRadiusSq = shape.innerRadius * shape.innerRadius;
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        float dx = posX[ i ] - originX;
+        float dz = posZ[ i ] - originZ;
+        float distanceSq = dx * dx + dz * dz;
+        hits[ i ] = static_cast< uint8_t >( ( distanceSq <= radiusSq ) & ( distanceSq >= innerRadiusSq ) );
+      }
+      break;
+    }
+
+    case TargetShape::Type::Rectangle:
+    {
+      const float length = shape.radius;
+      const float halfWidth = shape.halfWidth;
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        float dx = posX[ i ] - originX;
+        float dz = posZ[ i ] - originZ;
+        float forward = dx * forwardX + dz * forwardZ;
+        float side = dx * forwardZ - dz * forwardX;
+        hits[ i ] = static_cast< uint8_t >( ( forward >= 0.f ) & ( forward <= length ) &
+                                            ( std::fabs( side ) <= halfWidth ) );
+      }
+      break;
+    }
+
+    case TargetShape::Type::Cone:
+    {
+      const float cosHalfAngle = std::cos( shape.halfAngle );
+      for( std::size_t i = 0; i < count; ++i )
+      {
+        float dx = posX[ i ] - originX;
+        float dz = posZ[ i ] - originZ;
+        float distanceSq = dx * dx + dz * dz;
+        float forward = dx * forwardX + dz * forwardZ;
+        // the angle to the facing direction is within the half angle when cos( angle ) * distance <= forward
+        hits[ i ] = static_cast< uint8_t >( ( distanceSq <= radiusSq ) &
+                                            ( forward >= cosHalfAngle * std::sqrt( distanceSq ) ) );
+      }
+      break;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#ifndef _WORLD_SHAPEQUERY_H
+#define _WORLD_SHAPEQUERY_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <Common.h>
+
+namespace Sapphire::World::Util
+{
+  /*!
+   * @brief Area covered by an aoe, tested on the xz plane only
+   *
+   * The rotation follows the actor convention, 0 faces towards +z. Rectangles start at the origin and reach
+   * length yalms in the facing direction, cones are centered on it.
+   */
+  struct TargetShape
+  {
+    enum class Type : uint8_t
+    {
+      Circle,
+      Donut,
+      Rectangle,
+      Cone,
+    };
+
+    Type type;
+    Common::FFXIVARR_POSITION3 origin;
+    float rotation;
+    // outer radius of circles, donuts and cones, length of rectangles
+    float radius;
+    float innerRadius;
+    float halfWidth;
+    float halfAngle;
+
+    static TargetShape circle( const Common::FFXIVARR_POSITION3& origin, float radius );
+
+    static TargetShape donut( const Common::FFXIVARR_POSITION3& origin, float innerRadius, float outerRadius );
+
+    static TargetShape rectangle( const Common::FFXIVARR_POSITION3& origin, float rotation, float length, float width );
+
+    /*! @param angle full opening angle in radians */
+    static TargetShape cone( const Common::FFXIVARR_POSITION3& origin, float rotation, float radius, float angle );
+
+    /*! @return distance from the origin to the furthest point of the shape */
+    float getReach() const;
+  };
+
+  /*!
+   * @brief Tests a batch of positions against a shape
+   *
+   * Positions are passed as separate x and z arrays and the shape is resolved once up front,
+   * so the loop over the candidates is branch free and the compiler can vectorise it.
+   *
+   * @param hits receives 1 for every position inside the shape and 0 otherwise, count entries
+   */
+  void queryShape( const TargetShape& shape, const float* posX, const float* posZ, std::size_t count, uint8_t* hits );
+}
+
+#endif